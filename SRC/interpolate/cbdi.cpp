@@ -1,22 +1,146 @@
 //===----------------------------------------------------------------------===//
 //
-//        OpenSees - Open System for Earthquake Engineering Simulation    
+//        OpenSees - Open System for Earthquake Engineering Simulation
 //
 //===----------------------------------------------------------------------===//
 //
-#include <math.h>                                                                        
+// The CBDI influence matrix and the inverse Vandermonde matrix depend only
+// on the locations of the points, and elements that share an integration
+// rule ask for them with identical arguments. Both are therefore computed
+// once for each set of points, stored in a process-wide table, and copied
+// (scaled by L*L for the influence matrix) on each later request.
+//
+#include <math.h>
 #include <stdlib.h>
+#include <map>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <shared_mutex>
 #include <Vector.h>
 #include <Matrix.h>
 #include "cbdi.h"
 
+namespace {
+
+enum TableKind {
+  InverseVandermonde,
+  Influence
+};
+
+struct Table {
+  int nr, nc;
+  std::vector<double> data; // row-major
+};
+
+// The points at which the influence is evaluated followed by the
+// integration points; for the inverse Vandermonde matrix only the latter.
+using TableKey = std::pair<int, std::vector<double>>;
+
+class TableCache {
+public:
+  template <class Build> const Table&
+  get(const TableKey& key, Build&& build)
+  {
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex);
+      auto found = tables.find(key);
+      if (found != tables.end())
+        return *found->second;
+    }
+
+    // Build outside of the lock; if another thread finished the
+    // same table first, its result is kept.
+    std::unique_ptr<Table> table = std::make_unique<Table>(build());
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto inserted = tables.emplace(key, std::move(table));
+    return *inserted.first->second;
+  }
+
+private:
+  std::shared_mutex mutex;
+  std::map<TableKey, std::unique_ptr<const Table>> tables;
+};
+
+static TableCache&
+cache()
+{
+  static TableCache instance;
+  return instance;
+}
+
+static Table
+buildInverseVandermonde(int n, const double *xi)
+{
+  Matrix G(n, n), Ginv(n, n);
+  vandermonde(n, xi, G);
+  G.Invert(Ginv);
+
+  Table table {n, n, std::vector<double>(n*n)};
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      table.data[i*n + j] = Ginv(i, j);
+  return table;
+}
+
+//
+// Influence matrix for L = 1
+//
+static Table
+buildInfluence(int nPts, const double *pts, int nIntegrPts, const double *integrPts)
+{
+  const Table& inverse = cache().get(
+      TableKey(InverseVandermonde, std::vector<double>(integrPts, integrPts + nIntegrPts)),
+      [&]() { return buildInverseVandermonde(nIntegrPts, integrPts); });
+
+  Matrix Ginv(nIntegrPts, nIntegrPts);
+  for (int i = 0; i < nIntegrPts; i++)
+    for (int j = 0; j < nIntegrPts; j++)
+      Ginv(i, j) = inverse.data[i*nIntegrPts + j];
+
+  // l(i,j) = (xi^(j+2) - xi)/((j+1)(j+2))
+  Matrix l(nPts, nIntegrPts);
+  for (int i = 0; i < nPts; i++) {
+    const double xi = pts[i];
+    double power = xi*xi;
+    for (int j = 0; j < nIntegrPts; j++) {
+      l(i, j) = (power - xi)/((j + 1)*(j + 2));
+      power *= xi;
+    }
+  }
+
+  Matrix ls(nPts, nIntegrPts);
+  ls.addMatrixProduct(0.0, l, Ginv, 1.0);
+
+  Table table {nPts, nIntegrPts, std::vector<double>(nPts*nIntegrPts)};
+  for (int i = 0; i < nPts; i++)
+    for (int j = 0; j < nIntegrPts; j++)
+      table.data[i*nIntegrPts + j] = ls(i, j);
+  return table;
+}
+
+static void
+copyScaled(const Table& table, double scale, Matrix& out)
+{
+  for (int i = 0; i < table.nr; i++)
+    for (int j = 0; j < table.nc; j++)
+      out(i, j) = scale*table.data[i*table.nc + j];
+}
+
+} // namespace
+
+
 void
 vandermonde(int numSections, const double xi[], Matrix& G)
 {
   for (int i = 0; i < numSections; i++) {
-    G(i, 0) = 1;
-    for (int j = 1; j < numSections; j++)
-      G(i, j) = pow(xi[i], j);
+    double power = 1.0;
+    for (int j = 0; j < numSections; j++) {
+      G(i, j) = power;
+      power *= xi[i];
+    }
   }
 
   return;
@@ -25,85 +149,40 @@ vandermonde(int numSections, const double xi[], Matrix& G)
 void
 vandermonde_inverse(int numSections, const double xi[], Matrix& Ginv)
 {
-  Matrix G(numSections, numSections);
-  vandermonde(numSections, xi, G);
-
-  Matrix I(numSections, numSections);
-  for (int i = 0; i < numSections; i++)
-    I(i, i) = 1.0;
+  const Table& table = cache().get(
+      TableKey(InverseVandermonde, std::vector<double>(xi, xi + numSections)),
+      [&]() { return buildInverseVandermonde(numSections, xi); });
 
-  G.Solve(I, Ginv);
+  copyScaled(table, 1.0, Ginv);
 }
 
-void 
+void
 getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nIntegrPts, nIntegrPts);
-
-   for (int i = 1; i <= nIntegrPts; i++)
-      for (int j = 1; j <= nIntegrPts; j++) {
-         int i0 = i - 1;
-         int j0 = j - 1;
-         double xi = xi_pt(i0,0);
-         G(i0,j0) =  pow(xi,j-1);
-         l(i0,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-      }
-
-   G.Invert(Ginv);
-
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+  std::vector<double> pts(nIntegrPts);
+  for (int i = 0; i < nIntegrPts; i++)
+    pts[i] = xi_pt(i, 0);
+
+  getCBDIinfluenceMatrix(nIntegrPts, pts.data(), nIntegrPts, pts.data(), L, ls);
 }
 
 void getCBDIinfluenceMatrix(int nIntegrPts, const double *pts, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nIntegrPts, nIntegrPts);
-
-   for (int i = 0; i < nIntegrPts; i++) {
-     double xi = pts[i];
-     for (int j = 1; j <= nIntegrPts; j++) {
-       int j0 = j - 1;
-       G(i,j0) =  pow(xi,j-1);
-       l(i,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-     }
-   }
-
-   G.Invert(Ginv);
-
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+  getCBDIinfluenceMatrix(nIntegrPts, pts, nIntegrPts, pts, L, ls);
 }
 
-void 
+void
 getCBDIinfluenceMatrix(int nPts, const double *pts, int nIntegrPts, const double *integrPts, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   double xi;
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nPts, nIntegrPts);
-
-   // Loop over columns
-   for (int j = 1; j <= nIntegrPts; j++) {
-     int j0 = j - 1;
-     for (int i = 0; i < nIntegrPts; i++) {
-       xi = integrPts[i];
-       G(i,j0) =  pow(xi,j-1);
-     }
-     for (int i = 0; i < nPts; i++) {
-       xi = pts[i];
-       l(i,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-     }
-   }
-
-   G.Invert(Ginv);
-      
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+  std::vector<double> key(pts, pts + nPts);
+  key.insert(key.end(), integrPts, integrPts + nIntegrPts);
+  // Distinguish (pts, ipts) pairs that concatenate to the same list
+  key.push_back(nPts);
+
+  const Table& table = cache().get(TableKey(Influence, std::move(key)), [&]() {
+    return buildInfluence(nPts, pts, nIntegrPts, integrPts);
+  });
+
+  // ls = l * Ginv * (L*L);
+  copyScaled(table, L*L, ls);
 }
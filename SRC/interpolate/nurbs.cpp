@@ -5,13 +5,19 @@
 //
 // This file contains the implementation for NURBS derivatives
 //
-// Authors 
+// Authors
 //   Vinh Phu Nguyen, nvinhphu@gmail.com
 //   Robert Simpson, Cardiff University, UK
 //
+// The routines work on raw knot arrays and a caller supplied workspace so
+// that they may be evaluated at every quadrature point without allocating.
+// The Vector/Matrix forms are kept for existing callers and use a per-thread
+// workspace.
+//
 #include <math.h>
 #include <float.h>
 #include <stdlib.h>
+#include <vector>
 
 #include "nurbs.h"
 #include <Vector.h>
@@ -19,28 +25,18 @@
 
 #define TOL 100*DBL_EPSILON
 
-
-static double** 
-init2DArray(int x, int y) {
-  double **array = (double **)malloc(x * sizeof(double *));
-
-  for (int c = 0; c < x; c++)
-    array[c] = (double*)malloc(y * sizeof(double));
-
-  return array;
-}
-
-static void
-free2Darray(double **array, int x) {
-  for (int c = 0; c < x; c++)
-    free(array[c]);
-
-  free(array);
+static double*
+threadWorkspace(int p)
+{
+  thread_local std::vector<double> work;
+  if ((int)work.size() < NurbsWorkSize(p))
+    work.resize(NurbsWorkSize(p));
+  return work.data();
 }
 
-int FindSpan(int n, int p, double u, Vector& U)
+int FindSpan(int n, int p, double u, const double* U)
 {
-  /* 
+  /*
    * This function determines the knot span.
      ie. if we have a coordinate u which lies in the range u \in [u_i, u_{i+1})
      we want to find i
@@ -55,7 +51,7 @@ int FindSpan(int n, int p, double u, Vector& U)
     return p;
 
   int low  = p,
-      high = n + 1, 
+      high = n + 1,
       mid  = (low + high) / 2;
 
   while ( u < U[mid] || u >= U[mid + 1] )
@@ -69,8 +65,8 @@ int FindSpan(int n, int p, double u, Vector& U)
   return mid;
 }
 
-void 
-BasisFuns( int i, double u, int p, Vector& U, Vector& N)
+void
+BasisFuns(int i, double u, int p, const double* U, double* N, double* work)
 {
 
   /*
@@ -78,13 +74,10 @@ BasisFuns( int i, double u, int p, Vector& U, Vector& N)
      at point u, there are p+1 non zero basis functions
   */
 
-  N[0] = 1.0;
-
-  // double *left  = (double *)malloc(sizeof(double) * (p + 1));
-  // double *right = (double *)malloc(sizeof(double) * (p + 1));
+  double *left  = work,
+         *right = work + (p + 1);
 
-  Vector left(p+1);
-  Vector right(p+1);
+  N[0] = 1.0;
 
   double saved, temp;
 
@@ -99,14 +92,9 @@ BasisFuns( int i, double u, int p, Vector& U, Vector& N)
     }
     N[j] = saved;
   }
-
-  // free(left);
-  // free(right);
-
 }
 
-// void dersBasisFuns(int i, double u, int p, int order, Vector knot, double **ders)
-void dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders)
+void dersBasisFuns(int i, double u, int p, int order, const double* knot, double* ders, double* work)
 {
   /*
    * Calculate the non-zero derivatives of the b-spline functions
@@ -115,74 +103,69 @@ void dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders
   double saved, temp;
   int j, j1, j2, r;
 
-  // double *left  = (double *)malloc(sizeof(double) * (p + 1));
-  // double *right = (double *)malloc(sizeof(double) * (p + 1));
-
-  static Vector right(p+1);
-  static Vector left(p+1);
-  right.resize(p+1);
-  left.resize(p+1);
+  const int np = p + 1;
 
-  // double **ndu  = init2DArray(p + 1, p + 1);
-  // double **a    = init2DArray(p + 1, p + 1);
+  double *left  = work,
+         *right = work + np,
+         *ndu   = work + 2*np,       // np x np
+         *a     = work + 2*np + np*np; // 2 x np
 
-  static Matrix ndu(p+1,p+1);
-  static Matrix a(p+1,p+1);
-  ndu.resize(p+1,p+1);
-  a.resize(p+1,p+1);
+#define NDU(r,c) ndu[(r)*np + (c)]
+#define A(r,c)   a[(r)*np + (c)]
+#define DERS(r,c) ders[(r)*np + (c)]
 
-  ndu(0,0) = 1.0;
+  NDU(0,0) = 1.0;
   for ( j = 1; j <= p; j++ ) {
     left[j] = u - knot[i + 1 - j];
     right[j] = knot[i + j] - u;
 
     saved = 0.0;
     for ( r = 0; r < j; r++ ) {
-      ndu(j,r) = right[r + 1] + left[j - r];
-      temp = ndu(r,j - 1) / ndu(j,r);
+      NDU(j,r) = right[r + 1] + left[j - r];
+      temp = NDU(r,j - 1) / NDU(j,r);
 
-      ndu(r,j) = saved + right[r + 1] * temp;
+      NDU(r,j) = saved + right[r + 1] * temp;
       saved = left[j - r] * temp;
     }
-    ndu(j,j) = saved;
+    NDU(j,j) = saved;
   }
 
   for (int j = 0; j <= p; j++ )
-    ders(0,j) = ndu(j,p);
+    DERS(0,j) = NDU(j,p);
 
   if ( order == 0 )
     return;
 
   for (int r = 0; r <= p; r++ ) {
-    int s1 = 0, 
+    int s1 = 0,
         s2 = 1;
 
-    a(0,0) = 1.0;
+    A(0,0) = 1.0;
 
     for (int k = 1; k <= order; k++ ) {
       double d = 0.;
-      int rk = r - k, 
+      int rk = r - k,
           pk = p - k;
 
       if ( r >= k ) {
-        a(s2,0) = a(s1,0) / ndu(pk + 1,rk);
-        d = a(s2,0) * ndu(rk,pk);
+        A(s2,0) = A(s1,0) / NDU(pk + 1,rk);
+        d = A(s2,0) * NDU(rk,pk);
       }
 
       j1 = rk >= -1 ? 1 : -rk;
       j2 = (r - 1 <= pk) ? k - 1 : p - r;
 
       for ( j = j1; j <= j2; j++ ) {
-        a(s2,j) = (a(s1,j) - a(s1,j - 1)) / ndu(pk + 1,rk + j);
-        d += a(s2,j) * ndu(rk + j,pk);
+        A(s2,j) = (A(s1,j) - A(s1,j - 1)) / NDU(pk + 1,rk + j);
+        d += A(s2,j) * NDU(rk + j,pk);
       }
       if ( r <= pk ) {
-        a(s2,k) = -a(s1,k - 1) / ndu(pk + 1,r);
-        d += a(s2,k) * ndu(r,pk);
+        A(s2,k) = -A(s1,k - 1) / NDU(pk + 1,r);
+        d += A(s2,k) * NDU(r,pk);
       }
-      ders(k,r) = d;
-      j  = s1; 
-      s1 = s2; 
+      DERS(k,r) = d;
+      j  = s1;
+      s1 = s2;
       s2 = j;
     }
   }
@@ -190,21 +173,18 @@ void dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders
   r = p;
   for (int k = 1; k <= order; k++ ) {
     for (int j = 0; j <= p; j++ )
-      ders(k,j) *= r;
+      DERS(k,j) *= r;
     r *= (p - k);
   }
 
-  // free(left);
-  // free(right);
-
-  // free2Darray(ndu, p + 1);
-  // free2Darray(a, p + 1);
-
+#undef NDU
+#undef A
+#undef DERS
 }
 
 
 double
-OneBasisFun(int p, int m, Vector U, int i, double u)
+OneBasisFun(int p, int m, const double* U, int i, double u, double* N)
 {
   /*
     Compute an individual B-spline function
@@ -217,8 +197,6 @@ OneBasisFun(int p, int m, Vector U, int i, double u)
   if (u < U[i] || u >= U[i + p + 1])
     return 0.0;
 
-  double *N = (double*)malloc(sizeof(double) * (p + 1));
-
   for (int j = 0; j <= p; j++) {
     if (u >= U[i + j] && u < U[i + j + 1])
       N[j] = 1.0;
@@ -229,16 +207,16 @@ OneBasisFun(int p, int m, Vector U, int i, double u)
   for (int k = 1; k <= p; k++) {
     double saved, Uleft, Uright, temp;
 
-    if (N[0] == 0.0) 
+    if (N[0] == 0.0)
       saved = 0.0;
-    else 
+    else
       saved = ((u - U[i]) * N[0]) / (U[i + k] - U[i]);
 
     for (int j = 0; j < (p - k + 1); j++) {
       Uleft = U[i + j + 1];
       Uright = U[i + j + k + 1];
       if (N[j + 1] == 0.0) {
-        N[j] = saved; 
+        N[j] = saved;
         saved = 0.0;
       } else {
         temp = N[j + 1] / (Uright - Uleft);
@@ -248,25 +226,22 @@ OneBasisFun(int p, int m, Vector U, int i, double u)
     }
   }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-  double Nip = N[0];
-#pragma GCC diagnostic pop
-  free(N);
-
-  return Nip;
-
+  return N[0];
 }
 
 
-void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double* ders)
+void dersOneBasisFuns(int p, int m, const double* U, int i, double u, int order, double* ders, double* work)
 {
   /*
     Compute the derivatives for basis function Nip
   */
 
-  double **N = init2DArray(order + 1, order + 1);
-  double *ND = (double*)malloc((order + 1) * sizeof(double));
+  // N is (p+1) x (p+1), by rows; ND holds order+1 <= p+1 values
+  const int np = p + 1;
+  double *N  = work,
+         *ND = work + np*np;
+
+#define N_(r,c) N[(r)*np + (c)]
 
   double saved, temp;
 
@@ -278,37 +253,37 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
 
   for (int j = 0; j <= p; j++) {
     if (u >= U[i + j] && u < U[i + j + 1])
-      N[j][0] = 1.0;
+      N_(j,0) = 1.0;
     else
-      N[j][0] = 0.0;
+      N_(j,0) = 0.0;
   }
 
   for (int k = 1; k <= p; k++)
   {
-    if (N[0][k - 1] == 0.0)
+    if (N_(0,k - 1) == 0.0)
       saved = 0.0;
     else
-      saved = ((u - U[i]) * N[0][k - 1]) / ( U[i + k] - U[i] );
+      saved = ((u - U[i]) * N_(0,k - 1)) / ( U[i + k] - U[i] );
 
     for (int j = 0; j < (p - k + 1); j++) {
       double Uleft = U[i + j + 1];
       double Uright = U[i + j + k + 1];
-      if (N[j + 1][k - 1] == 0.0) {
-        N[j][k] = saved; 
+      if (N_(j + 1,k - 1) == 0.0) {
+        N_(j,k) = saved;
         saved = 0.0;
       } else {
-        temp = N[j + 1][k - 1] / (Uright - Uleft);
-        N[j][k] = saved + (Uright - u) * temp;
+        temp = N_(j + 1,k - 1) / (Uright - Uleft);
+        N_(j,k) = saved + (Uright - u) * temp;
         saved = (u - Uleft) * temp;
       }
     }
   }
 
-  ders[0] = N[0][p];
+  ders[0] = N_(0,p);
 
   for (int k = 1; k <= order; k++) {
     for (int j = 0; j <= k; j++)
-      ND[j] = N[j][p - k];
+      ND[j] = N_(j,p - k);
 
     for (int jj = 1; jj <= k; jj++) {
 
@@ -319,10 +294,10 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
 
       for (int j = 0; j < (k - jj + 1); j++) {
         double Uleft = U[i + j + 1];
-        double Uright = U[i + j + p + jj];
+        double Uright = U[i + j + p - k + jj + 1];
 
         if (ND[j + 1] == 0.0) {
-          ND[j] = (p - k + jj) * saved; 
+          ND[j] = (p - k + jj) * saved;
           saved = 0.0;
         } else {
           temp = ND[j + 1] / (Uright - Uleft);
@@ -333,9 +308,43 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
     }
     ders[k] = ND[0];
   }
+#undef N_
+}
+
+
+//
+// Vector and Matrix forms
+//
+int FindSpan(int n, int p, double u, Vector& U)
+{
+  return FindSpan(n, p, u, &U[0]);
+}
+
+void
+BasisFuns(int i, double u, int p, Vector& U, Vector& N)
+{
+  BasisFuns(i, u, p, &U[0], &N[0], threadWorkspace(p));
+}
+
+void dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders)
+{
+  thread_local std::vector<double> values;
+  values.resize((order + 1)*(p + 1));
+
+  dersBasisFuns(i, u, p, order, &knot[0], values.data(), threadWorkspace(p));
 
-  free2Darray(N, order + 1);
-  free(ND);
+  for (int k = 0; k <= order; k++)
+    for (int j = 0; j <= p; j++)
+      ders(k,j) = values[k*(p + 1) + j];
 }
 
+double
+OneBasisFun(int p, int m, Vector& U, int i, double u)
+{
+  return OneBasisFun(p, m, &U[0], i, u, threadWorkspace(p));
+}
 
+void dersOneBasisFuns(int p, int m, Vector& U, int i, double u, int order, double* ders)
+{
+  dersOneBasisFuns(p, m, &U[0], i, u, order, ders, threadWorkspace(p));
+}
@@ -16,7 +16,20 @@ class Matrix;
 int      FindSpan(int n, int p, double u, Vector& U);
 void     BasisFuns( int i, double u, int p, Vector& U, Vector& N);
 void     dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders);
-double   OneBasisFun(int p, int m, Vector U, int i, double u);
-void     dersOneBasisFuns(int p, int m, Vector U, int i, double u, int n, double* ders);
+double   OneBasisFun(int p, int m, Vector& U, int i, double u);
+void     dersOneBasisFuns(int p, int m, Vector& U, int i, double u, int n, double* ders);
+
+//
+// Allocation-free forms. U points to the knot vector and work to at least
+// NurbsWorkSize(p) doubles supplied by the caller; ders from dersBasisFuns
+// is (order+1) x (p+1), stored by rows.
+//
+inline int NurbsWorkSize(int p) { return (p + 1)*(p + 5); }
+
+int      FindSpan(int n, int p, double u, const double* U);
+void     BasisFuns(int i, double u, int p, const double* U, double* N, double* work);
+void     dersBasisFuns(int i, double u, int p, int order, const double* U, double* ders, double* work);
+double   OneBasisFun(int p, int m, const double* U, int i, double u, double* work);
+void     dersOneBasisFuns(int p, int m, const double* U, int i, double u, int n, double* ders, double* work);
 
 #endif
@@ -345,7 +345,7 @@ ElasticLinearFrameSection3d::getStressResultant()
   #ifdef THREAD_SAFE 
   #else 
   static VectorND<nr> s;
-  static Vector s_wrap(s);
+  static thread_local Vector s_wrap(s);
   #endif
   s = (*Ks)*e;
   return s_wrap;
@@ -407,7 +407,7 @@ ElasticLinearFrameSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -435,7 +435,7 @@ ElasticLinearFrameSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
 
-      static Vector data(7);
+      static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -33,8 +33,8 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Vector BeamFiberMaterial::stress(3);
-Matrix BeamFiberMaterial::tangent(3,3);
+thread_local Vector BeamFiberMaterial::stress(3);
+thread_local Matrix BeamFiberMaterial::tangent(3,3);
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
@@ -192,10 +192,10 @@ BeamFiberMaterial::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(3);
-  static Vector strainIncrement(3);
-  static Vector threeDstrain(6);
-  static Matrix dd22(3,3);
+  static thread_local Vector condensedStress(3);
+  static thread_local Vector strainIncrement(3);
+  static thread_local Vector threeDstrain(6);
+  static thread_local Matrix dd22(3,3);
 
   int count = 0;
   const int maxCount = 20;
@@ -289,7 +289,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
   dd12(2,0) = threeDtangent(5,1);
@@ -303,7 +303,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd12(2,2) = threeDtangent(5,4);
 
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -317,12 +317,12 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(4,4);
 
   
-  static Vector sigma2(3);
+  static thread_local Vector sigma2(3);
   sigma2(0) = threeDstress(1);
   sigma2(1) = threeDstress(2);
   sigma2(2) = threeDstress(4);
 
-  static Vector dd22sigma2(3);
+  static thread_local Vector dd22sigma2(3);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -330,75 +330,68 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   return stress;
 }
 
-const Matrix&  
-BeamFiberMaterial::getTangent()
+//
+// Condense the 6x6 tangent D onto the 11, 12 and 13 components,
+//
+//   C = D11 - D12 inv(D22) D21
+//
+// where 1 = {0,3,5} are retained and 2 = {1,2,4} are condensed out.
+// C is written column major.
+//
+static void
+condenseTangent(const Matrix &D, double C[9])
 {
-  const Matrix &threeDtangent = theMaterial->getTangent();
-
-  static Matrix dd11(3,3);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(3,0);
-  dd11(2,0) = threeDtangent(5,0);
-
-  dd11(0,1) = threeDtangent(0,3);
-  dd11(1,1) = threeDtangent(3,3);
-  dd11(2,1) = threeDtangent(5,3);
-
-  dd11(0,2) = threeDtangent(0,5);
-  dd11(1,2) = threeDtangent(3,5);
-  dd11(2,2) = threeDtangent(5,5);
-
-
-  static Matrix dd12(3,3);
-  dd12(0,0) = threeDtangent(0,1);
-  dd12(1,0) = threeDtangent(3,1);
-  dd12(2,0) = threeDtangent(5,1);
-
-  dd12(0,1) = threeDtangent(0,2);
-  dd12(1,1) = threeDtangent(3,2);
-  dd12(2,1) = threeDtangent(5,2);
-
-  dd12(0,2) = threeDtangent(0,4);
-  dd12(1,2) = threeDtangent(3,4);
-  dd12(2,2) = threeDtangent(5,4);
-
-  static Matrix dd21(3,3);
-  dd21(0,0) = threeDtangent(1,0);
-  dd21(1,0) = threeDtangent(2,0);
-  dd21(2,0) = threeDtangent(4,0);
-
-  dd21(0,1) = threeDtangent(1,3);
-  dd21(1,1) = threeDtangent(2,3);
-  dd21(2,1) = threeDtangent(4,3);
-
-  dd21(0,2) = threeDtangent(1,5);
-  dd21(1,2) = threeDtangent(2,5);
-  dd21(2,2) = threeDtangent(4,5);
-
-  static Matrix dd22(3,3);
-  dd22(0,0) = threeDtangent(1,1);
-  dd22(1,0) = threeDtangent(2,1);
-  dd22(2,0) = threeDtangent(4,1);
-
-  dd22(0,1) = threeDtangent(1,2);
-  dd22(1,1) = threeDtangent(2,2);
-  dd22(2,1) = threeDtangent(4,2);
-
-  dd22(0,2) = threeDtangent(1,4);
-  dd22(1,2) = threeDtangent(2,4);
-  dd22(2,2) = threeDtangent(4,4);
+  static constexpr int a[3] = {0, 3, 5};
+  static constexpr int b[3] = {1, 2, 4};
+
+  double d22[3][3];
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      d22[i][j] = D(b[i],b[j]);
+
+  // inv(D22) by cofactors
+  double inv[3][3];
+  inv[0][0] = d22[1][1]*d22[2][2] - d22[1][2]*d22[2][1];
+  inv[0][1] = d22[0][2]*d22[2][1] - d22[0][1]*d22[2][2];
+  inv[0][2] = d22[0][1]*d22[1][2] - d22[0][2]*d22[1][1];
+  inv[1][0] = d22[1][2]*d22[2][0] - d22[1][0]*d22[2][2];
+  inv[1][1] = d22[0][0]*d22[2][2] - d22[0][2]*d22[2][0];
+  inv[1][2] = d22[0][2]*d22[1][0] - d22[0][0]*d22[1][2];
+  inv[2][0] = d22[1][0]*d22[2][1] - d22[1][1]*d22[2][0];
+  inv[2][1] = d22[0][1]*d22[2][0] - d22[0][0]*d22[2][1];
+  inv[2][2] = d22[0][0]*d22[1][1] - d22[0][1]*d22[1][0];
+
+  const double det = d22[0][0]*inv[0][0] + d22[0][1]*inv[1][0] + d22[0][2]*inv[2][0];
+
+  // inv(D22) D21
+  double x[3][3] = {{0.0}};
+  if (det != 0.0) {
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++)
+          x[i][j] += inv[i][k]*D(b[k],a[j]);
+        x[i][j] /= det;
+      }
+  }
 
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++) {
+      double c = D(a[i],a[j]);
+      for (int k = 0; k < 3; k++)
+        c -= D(a[i],b[k])*x[k][j];
+      C[3*j+i] = c;
+    }
+}
 
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
+const Matrix&  
+BeamFiberMaterial::getTangent()
+{
+  double C[9];
+  condenseTangent(theMaterial->getTangent(), C);
 
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11; 
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      tangent(i,j) = C[3*j+i];
 
   return tangent;
 }
@@ -406,74 +399,29 @@ BeamFiberMaterial::getTangent()
 const Matrix&  
 BeamFiberMaterial::getInitialTangent()
 {
-  const Matrix &threeDtangent = theMaterial->getInitialTangent();
-
-  static Matrix dd11(3,3);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(3,0);
-  dd11(2,0) = threeDtangent(5,0);
+  double C[9];
+  condenseTangent(theMaterial->getInitialTangent(), C);
 
-  dd11(0,1) = threeDtangent(0,3);
-  dd11(1,1) = threeDtangent(3,3);
-  dd11(2,1) = threeDtangent(5,3);
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      tangent(i,j) = C[3*j+i];
 
-  dd11(0,2) = threeDtangent(0,5);
-  dd11(1,2) = threeDtangent(3,5);
-  dd11(2,2) = threeDtangent(5,5);
-
-
-  static Matrix dd12(3,3);
-  dd12(0,0) = threeDtangent(0,1);
-  dd12(1,0) = threeDtangent(3,1);
-  dd12(2,0) = threeDtangent(5,1);
-
-  dd12(0,1) = threeDtangent(0,2);
-  dd12(1,1) = threeDtangent(3,2);
-  dd12(2,1) = threeDtangent(5,2);
-
-  dd12(0,2) = threeDtangent(0,4);
-  dd12(1,2) = threeDtangent(3,4);
-  dd12(2,2) = threeDtangent(5,4);
-
-  static Matrix dd21(3,3);
-  dd21(0,0) = threeDtangent(1,0);
-  dd21(1,0) = threeDtangent(2,0);
-  dd21(2,0) = threeDtangent(4,0);
-
-  dd21(0,1) = threeDtangent(1,3);
-  dd21(1,1) = threeDtangent(2,3);
-  dd21(2,1) = threeDtangent(4,3);
-
-  dd21(0,2) = threeDtangent(1,5);
-  dd21(1,2) = threeDtangent(2,5);
-  dd21(2,2) = threeDtangent(4,5);
-
-  static Matrix dd22(3,3);
-  dd22(0,0) = threeDtangent(1,1);
-  dd22(1,0) = threeDtangent(2,1);
-  dd22(2,0) = threeDtangent(4,1);
-
-  dd22(0,1) = threeDtangent(1,2);
-  dd22(1,1) = threeDtangent(2,2);
-  dd22(2,1) = threeDtangent(4,2);
-
-  dd22(0,2) = threeDtangent(1,4);
-  dd22(1,2) = threeDtangent(2,4);
-  dd22(2,2) = threeDtangent(4,4);
-
-
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
+  return tangent;
+}
 
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11; 
+int
+BeamFiberMaterial::getFiberState(double sig[3], double C[9], bool initial)
+{
+  condenseTangent(initial ? theMaterial->getInitialTangent()
+                          : theMaterial->getTangent(), C);
 
-  return tangent;
+  if (sig != nullptr) {
+    const Vector &threeDstress = theMaterial->getStress();
+    sig[0] = threeDstress(0);
+    sig[1] = threeDstress(3);
+    sig[2] = threeDstress(5);
+  }
+  return 0;
 }
 
 void  
@@ -491,7 +439,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -508,7 +456,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma23;
@@ -533,7 +481,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send id data\n";
@@ -557,7 +505,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send vector data\n";
@@ -48,6 +48,7 @@ class BeamFiberMaterial: public NDMaterial {
     const Vector& getStress();
     const Matrix& getTangent();
     const Matrix& getInitialTangent();
+    int getFiberState(double stress[3], double tangent[9], bool initial = false);
 
     double getRho();
 
@@ -82,8 +83,8 @@ class BeamFiberMaterial: public NDMaterial {
 
     Vector strain;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 };
 
 
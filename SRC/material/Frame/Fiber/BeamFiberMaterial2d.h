@@ -86,7 +86,7 @@ class BeamFiberMaterial2d: public NDMaterial {
 
     Vector strain;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 };
 
@@ -29,6 +29,9 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 #include "FiberResponse.h"
 
+// Fiber loops (state determination and the sensitivity passes) run on
+// a thread pool only when N_FIBER_THREADS is defined at build time; it is
+// off by default, and making it a runtime option is deferred.
 // #include <threads/thread_pool.hpp>
 // #define N_FIBER_THREADS 6
 
@@ -369,8 +372,8 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FrameFiberSection3d::getInitialTangent()
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static thread_local double kInitialData[16];
+  static thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -534,7 +537,7 @@ FrameFiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   // size 5 so no conflict with matData below if just 2 fibers
-  static ID data(5);
+  static thread_local ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -597,7 +600,7 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  static thread_local ID data(5);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1050,18 +1053,75 @@ FrameFiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FrameFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  static thread_local Vector dummy(4);
   
   dummy.Zero();
   
   return dummy;
 }
 
-   
+
+#ifdef N_FIBER_THREADS
+//
+// The sensitivity passes run once per parameter; the fibers are
+// independent, so they are split over the pool as in the state
+// determination. Fiber locations and areas do not depend on parameters.
+//
+const Vector &
+FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
+{
+  static thread_local Vector ds(4);
+
+  ds.Zero();
+
+  std::mutex resp_mutex;
+
+  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
+  [&](int i){
+    const double y  = matData[3*i]   - yBar;
+    const double z  = matData[3*i+1] - zBar;
+    const double A  = matData[3*i+2];
+
+    const double dsA = theMaterials[i]->getStressSensitivity(gradIndex, conditional)*A;
+
+    const std::lock_guard<std::mutex> lock(resp_mutex);
+    ds(0) +=    dsA;
+    ds(1) += -y*dsA;
+    ds(2) +=  z*dsA;
+  }).wait();
+
+  ds(3) = theTorsion->getStressSensitivity(gradIndex, conditional);
+
+  return ds;
+}
+
+int
+FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numGrads)
+{
+  const double d0 = defSens(0),
+               d1 = defSens(1),
+               d2 = defSens(2),
+               d3 = defSens(3);
+
+  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
+  [&,d0,d1,d2](int i){
+    const double y = matData[3*i]   - yBar;
+    const double z = matData[3*i+1] - zBar;
+
+    theMaterials[i]->commitSensitivity(d0 - y*d1 + z*d2, gradIndex, numGrads);
+  }).wait();
+
+  theTorsion->commitSensitivity(d3, gradIndex, numGrads);
+
+  return 0;
+}
+
+#else
+
 const Vector &
 FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  static thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1116,16 +1176,16 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    static thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    static thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    static thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1139,10 +1199,12 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
   return ds;
 }
 
+#endif
+
 const Matrix &
 FrameFiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(nsr,nsr);
+  static thread_local Matrix something(nsr,nsr);
   
   something.Zero();
 
@@ -1152,6 +1214,7 @@ FrameFiberSection3d::getSectionTangentSensitivity(int gradIndex)
 }
 
 
+#ifndef N_FIBER_THREADS
 int
 FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numGrads)
 {
@@ -1200,4 +1263,5 @@ FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int
 
   return 0;
 }
+#endif
 
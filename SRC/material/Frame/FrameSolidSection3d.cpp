@@ -41,7 +41,8 @@ FrameSolidSection3d::FrameSolidSection3d(int tag, int num):
     e_wrap(e), s_wrap(s),
     parameterID(0), dedh(nsr),
     fibers(new std::vector<FiberData>),
-    K_init(new Tangent)
+    K_init(new Tangent),
+    wagner(getenv("Wagner") != nullptr)
 {
   code(inx) = SECTION_RESPONSE_P;
   code(iny) = SECTION_RESPONSE_VY;
@@ -62,7 +63,8 @@ FrameSolidSection3d::FrameSolidSection3d():
   FrameSection(0, SEC_TAG_FrameSolidSection3d),
   e_wrap(e), s_wrap(s),
   parameterID(0), dedh(nsr),
-  fibers(new std::vector<FiberData>)
+  fibers(new std::vector<FiberData>),
+  wagner(getenv("Wagner") != nullptr)
 {
   code(inx) = SECTION_RESPONSE_P;
   code(iny) = SECTION_RESPONSE_VY;
@@ -149,10 +151,11 @@ FrameSolidSection3d::addFiber(NDMaterial& theMat,
                               double zLoc)
 {
   std::array<std::array<double,3>,3> warp{0};
-  FiberData fiber {yLoc, zLoc, Area, warp, {0.0, yLoc, zLoc}};
+  FiberData fiber {yLoc, zLoc, Area, warp, {0.0, yLoc, zLoc}, yLoc*yLoc + zLoc*zLoc};
   fibers->emplace_back(fiber);
 
   materials.emplace_back(theMat.getCopy("BeamFiber"));
+  state.resize(materials.size());
 
   if (materials[materials.size()-1] == nullptr)
     return -1;
@@ -207,102 +210,123 @@ FrameSolidSection3d::stateDetermination(Tangent& K, VectorND<nsr>* s_trial, cons
 
   int res = 0;
   const int nf = fibers->size();
-  for (int i = 0; i < nf; i++) {
+  const FiberData * const fiber = fibers->data();
+  FiberState * const fs = state.data();
 
+  //
+  // Update the materials and collect their state
+  //
+  for (int i = 0; i < nf; i++) {
     NDMaterial &theMat = *materials[i];
-    auto & fiber = (*fibers)[i];
-    auto & w = fiber.warp;
-
-    const Vector3D r = fiber.r;
-    double tr2 = 0;
-
-    bool wagner = getenv("Wagner") != nullptr;
 
     if (e_trial != nullptr) {
+      const auto & w = fiber[i].warp;
       // Form material strain
-      Vector3D eps = gamma + kappa.cross(r);
+      Vector3D eps = gamma + kappa.cross(fiber[i].r);
       for (int k=0; k<nwm; k++) {
           eps[0] += w[k][0]*dalpha[k];
           for (int j=1; j<3; j++)
               eps[j] += w[k][j]*alpha[k];
       }
-      if (wagner) {
-          tr2 = r.dot(r)*kappa[0];
-          eps[0] += 0.5*kappa[0]*tr2;
-      }
+      if (wagner)
+          eps[0] += 0.5*kappa[0]*kappa[0]*fiber[i].r2;
+
       res += theMat.setTrialStrain(eps);
     }
 
-    const Matrix &tangent = tangentFlag==CurrentTangent
-                            ? theMat.getTangent()
-                            : theMat.getInitialTangent();
-
-    Matrix3D C{};
-    C.addMatrix(tangent, fiber.area);
-
-    // NOTE: Matrix 3D is column major so these are transposed.
-    const Matrix3D iow{{
-      {w[0][0],     0.0,     0.0},
-      {w[1][0],     0.0,     0.0},
-      {w[2][0],     0.0,     0.0}
-    }};
-
-    const Matrix3D iodw{{
-      {    0.0, w[0][1], w[0][2]},
-      {    0.0, w[1][1], w[1][2]},
-      {    0.0, w[2][1], w[2][2]}
-    }};
-
-
-    K.nn.addMatrix(C, 1.0);
-    {
-      Matrix3D rxC{};
-      rxC.addSpinMatrixProduct(r, C, 1.0);
-      K.mm.addMatrixSpinProduct(rxC, r, -1.0);
-      K.mn.addMatrix(rxC, 1.0);
-      K.mw.addMatrixProduct(rxC, iow,  1.0);
-      K.mv.addMatrixProduct(rxC, iodw, 1.0);
+    res += theMat.getFiberState(fs[i].stress, fs[i].tangent, tangentFlag == InitialTangent);
+  }
+
+  //
+  // Integrate the section tangent and stress resultants. With
+  //
+  //   iow  = [w_k[0]; 0; 0]           (columns k = x, y, z)
+  //   iodw = [0; w_k[1]; w_k[2]]
+  //
+  // each fiber contributes
+  //
+  //   nn = C         mn = rxC          mm = -rxC rx
+  //   nw = C iow     mw = rxC iow      ww = iow' C iow
+  //   nv = C iodw    mv = rxC iodw     vv = iodw' C iodw
+  //
+  const bool twist = wagner && e_trial != nullptr;
+  for (int i = 0; i < nf; i++) {
+    const auto & w = fiber[i].warp;
+    const double rx = fiber[i].r[0],
+                 ry = fiber[i].r[1],
+                 rz = fiber[i].r[2];
+    const double area = fiber[i].area;
+
+    double C[3][3];
+    for (int j=0; j<3; j++)
+      for (int k=0; k<3; k++)
+        C[k][j] = fs[i].tangent[3*j+k]*area;
+
+    double rxC[3][3];
+    for (int j=0; j<3; j++) {
+      rxC[0][j] = -rz*C[1][j] + ry*C[2][j];
+      rxC[1][j] =  rz*C[0][j] - rx*C[2][j];
+      rxC[2][j] = -ry*C[0][j] + rx*C[1][j];
     }
-    {
-      Matrix3D Ciow{};
-      Ciow.addMatrixProduct(C, iow, 1.0);
-      K.nw.addMatrix(Ciow,  1.0);
-      K.ww.addMatrixTransposeProduct(1.0, iow,  Ciow, 1.0);
+
+    for (int k=0; k<3; k++) {
+      for (int j=0; j<3; j++) {
+        K.nn(k,j) += C[k][j];
+        K.mn(k,j) += rxC[k][j];
+      }
+      K.mm(k,0) -= rxC[k][1]*rz - rxC[k][2]*ry;
+      K.mm(k,1) -= rxC[k][2]*rx - rxC[k][0]*rz;
+      K.mm(k,2) -= rxC[k][0]*ry - rxC[k][1]*rx;
     }
-    {
-      Matrix3D Ciodw{};
-      Ciodw.addMatrixProduct(C, iodw, 1.0);
-      K.nv.addMatrix(Ciodw, 1.0);
-      K.vv.addMatrixTransposeProduct(1.0, iodw,  Ciodw, 1.0);
+
+    for (int l=0; l<nwm; l++) {
+      for (int k=0; k<3; k++) {
+        K.nw(k,l) += C[k][0]*w[l][0];
+        K.mw(k,l) += rxC[k][0]*w[l][0];
+        K.nv(k,l) += C[k][1]*w[l][1] + C[k][2]*w[l][2];
+        K.mv(k,l) += rxC[k][1]*w[l][1] + rxC[k][2]*w[l][2];
+      }
+      for (int k=0; k<nwm; k++) {
+        K.ww(k,l) += w[k][0]*C[0][0]*w[l][0];
+        K.vv(k,l) += w[k][1]*(C[1][1]*w[l][1] + C[1][2]*w[l][2])
+                   + w[k][2]*(C[2][1]*w[l][1] + C[2][2]*w[l][2]);
+      }
     }
 
-    const Vector &stress  = theMat.getStress();
-
-    if (wagner && e_trial != nullptr) {
-      Matrix3D ioi {{{1, 0, 0},
-                     {0, 0, 0},
-                     {0, 0, 0}}};
-       Matrix3D ioiC = ioi*C;
-       K.mn.addMatrix(ioiC, tr2);
-       //
-       K.mm.addSpinMatrixProduct(r, ioiC.transpose(), tr2);
-       K.mm.addMatrixSpinProduct(ioiC, r, -tr2);
-       K.mm.addMatrixProduct(ioiC, ioi, tr2*tr2);
-
-       // Geometric part,  equivalent to Kmm.addMatrix(ioi, r2*stress(0));
-       if (kappa[0] != 0)
-          K.mm(0,0) += tr2/kappa[0]*stress(0)*fiber.area;
-
-       K.mw.addMatrixProduct(ioiC, iow,  tr2);
-       K.mv.addMatrixProduct(ioiC, iodw, tr2);
+    const double * const stress = fs[i].stress;
+    const double tr2 = twist ? fiber[i].r2*kappa[0] : 0.0;
+
+    if (twist) {
+      // Contributions of ioi C, where ioi = e1 e1'
+      const double c[3] = {C[0][0], C[0][1], C[0][2]};
+      const double rxc[3] = {
+        -rz*c[1] + ry*c[2],
+         rz*c[0] - rx*c[2],
+        -ry*c[0] + rx*c[1]
+      };
+      for (int j=0; j<3; j++) {
+        K.mn(0,j) += tr2*c[j];
+        K.mm(j,0) += tr2*rxc[j];
+        K.mm(0,j) += tr2*rxc[j];
+      }
+      K.mm(0,0) += tr2*tr2*c[0];
+
+      // Geometric part
+      if (kappa[0] != 0)
+        K.mm(0,0) += fiber[i].r2*stress[0]*area;
+
+      for (int l=0; l<nwm; l++) {
+        K.mw(0,l) += tr2*c[0]*w[l][0];
+        K.mv(0,l) += tr2*(c[1]*w[l][1] + c[2]*w[l][2]);
+      }
     }
 
     if (s_trial != nullptr) {
-      const double y = fiber.r[1];
-      const double z = fiber.r[2];
-      const double sig0 = stress(0)*fiber.area;
-      const double sig1 = stress(1)*fiber.area;
-      const double sig2 = stress(2)*fiber.area;
+      const double y = ry;
+      const double z = rz;
+      const double sig0 = stress[0]*area;
+      const double sig1 = stress[1]*area;
+      const double sig2 = stress[2]*area;
       // n += s da
       (*s_trial)(inx) +=    sig0;
       (*s_trial)(iny) +=    sig1;
@@ -319,7 +343,7 @@ FrameSolidSection3d::stateDetermination(Tangent& K, VectorND<nsr>* s_trial, cons
         (*s_trial)(ivx+j) += w[j][2]*sig2;
       }
 
-      if (wagner && e_trial != nullptr)
+      if (twist)
         (*s_trial)(imx) += tr2*sig0;
     }
   }
@@ -335,8 +359,8 @@ FrameSolidSection3d::getSectionDeformation()
 const Matrix&
 FrameSolidSection3d::getInitialTangent()
 {
-  static double kInitial[nsr*nsr];
-  static Matrix ksi(kInitial, nsr, nsr);
+  static thread_local double kInitial[nsr*nsr];
+  static thread_local Matrix ksi(kInitial, nsr, nsr);
 
   ksi.Zero();
   this->stateDetermination(*K_init, nullptr, nullptr, InitialTangent);
@@ -364,7 +388,7 @@ const Matrix&
 FrameSolidSection3d::getSectionTangent()
 {
 #ifndef SEES_SECTION_THREADS
-  static Matrix K_wrap(nsr, nsr);
+  static thread_local Matrix K_wrap(nsr, nsr);
 #endif
   K_wrap.Zero();
   K_wrap.Assemble(K_pres.nn, 0, 0, 1.0);
@@ -402,6 +426,8 @@ FrameSolidSection3d::getFrameCopy()
     theCopy->materials.push_back(material->getCopy("BeamFiber"));
 
   theCopy->fibers = fibers;
+  theCopy->state.resize(materials.size());
+  theCopy->wagner = wagner;
   theCopy->e = e;
   theCopy->parameterID = parameterID;
   theCopy->K_init = K_init;
@@ -737,6 +763,8 @@ FrameSolidSection3d::updateParameter(int paramID, Information &info)
       default:
         return -1;
     }
+    auto& fiber = (*fibers)[fiberID];
+    fiber.r2 = fiber.r.dot(fiber.r);
     return 0;
   }
 
@@ -761,14 +789,14 @@ FrameSolidSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(nsr);
+  static thread_local Vector ds(nsr);
   
   ds.Zero();
   
-  static Vector stress(3);
-  static Vector dsigdh(3);
-  static Vector sig_dAdh(3);
-  static Matrix tangent(3,3);
+  static thread_local Vector stress(3);
+  static thread_local Vector dsigdh(3);
+  static thread_local Vector sig_dAdh(3);
+  static thread_local Matrix tangent(3,3);
 
   static double dydh[10000];
   static double dzdh[10000];
@@ -832,7 +860,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     as(1,5) = -z;
     as(2,5) =  y;
     
-    static Matrix dasdh(3,nsr);
+    static thread_local Matrix dasdh(3,nsr);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     dasdh(1,3) = 0;
@@ -840,7 +868,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     dasdh(1,5) = -dzdh[i];
     dasdh(2,5) = dydh[i];
     
-    static Matrix tmpMatrix(nsr,nsr);
+    static thread_local Matrix tmpMatrix(nsr,nsr);
     tmpMatrix.addMatrixTripleProduct(0.0, as, tangent, dasdh, 1.0);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -852,7 +880,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
 const Matrix &
 FrameSolidSection3d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(6,6);
+  static thread_local Matrix dksdh(6,6);
   
   dksdh.Zero();
   return dksdh;
@@ -882,7 +910,7 @@ FrameSolidSection3d::commitSensitivity(const Vector& defSens,
     }
   }
 
-  static Vector depsdh(3);
+  static thread_local Vector depsdh(3);
 
 
   for (int i = 0; i < nf; i++) {
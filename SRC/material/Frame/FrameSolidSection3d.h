@@ -144,10 +144,21 @@ class FrameSolidSection3d : public FrameSection
       double area;
       std::array<std::array<double,3>,nwm> warp{{{0}}};
       OpenSees::VectorND<3> r;
+      double r2;                      // r.dot(r), used by the Wagner term
     };
     std::shared_ptr<std::vector<FiberData>> fibers;
     std::vector<NDMaterial*> materials;
 
+    // Material state gathered from each fiber before the section
+    // tangent is assembled; tangent is column major.
+    struct FiberState {
+      double stress[3];
+      double tangent[9];
+    };
+    std::vector<FiberState> state;
+
+    bool wagner;                      // include the Wagner (twist) term
+
     VectorND<nsr> s, e;
     Vector s_wrap, e_wrap;
 
@@ -38,9 +38,9 @@
 
 
 //static vectors and matrices
-Vector CycLiqCPSPPlaneStrain :: strain_vec(3) ;
-Vector CycLiqCPSPPlaneStrain :: stress_vec(3) ;
-Matrix CycLiqCPSPPlaneStrain :: tangent_matrix(3,3) ;
+thread_local Vector CycLiqCPSPPlaneStrain :: strain_vec(3) ;
+thread_local Vector CycLiqCPSPPlaneStrain :: stress_vec(3) ;
+thread_local Matrix CycLiqCPSPPlaneStrain :: tangent_matrix(3,3) ;
 
 //null constructor
 CycLiqCPSPPlaneStrain :: CycLiqCPSPPlaneStrain() :
@@ -123,7 +123,7 @@ int CycLiqCPSPPlaneStrain :: setTrialStrain( const Vector &v, const Vector &r )
 
 int CycLiqCPSPPlaneStrain :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(3);
+  static thread_local Vector newStrain(3);
   newStrain(0) = strain_nplus1(0,0) + v(0);
   newStrain(1) = strain_nplus1(1,1) + v(1);
   newStrain(2) = 2.0*strain_nplus1(0,1) + v(2);
@@ -223,7 +223,7 @@ CycLiqCPSPPlaneStrain::sendSelf(int commitTag, Channel &theChannel)
   // we place all the data needed to define material and it's state
   // int a vector object
 	int res = 0;
-  static Vector data(22+9*3);
+  static thread_local Vector data(22+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -277,7 +277,7 @@ CycLiqCPSPPlaneStrain::recvSelf (int commitTag, Channel &theChannel,
 {
 	int res = 0;
   // recv the vector object from the channel which defines material param and state
-  static Vector data(22+9*3);
+  static thread_local Vector data(22+9*3);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "CycLiqCPSP::recvSelf - failed to recv vector from channel\n";
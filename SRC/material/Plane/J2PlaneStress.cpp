@@ -53,9 +53,9 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-Vector J2PlaneStress :: strain_vec(3) ;
-Vector J2PlaneStress :: stress_vec(3) ;
-Matrix J2PlaneStress :: tangent_matrix(3,3) ;
+thread_local Vector J2PlaneStress :: strain_vec(3) ;
+thread_local Vector J2PlaneStress :: stress_vec(3) ;
+thread_local Matrix J2PlaneStress :: tangent_matrix(3,3) ;
 
 //null constructor
 J2PlaneStress ::  J2PlaneStress( ) : 
@@ -190,7 +190,7 @@ int J2PlaneStress :: setTrialStrain( const Vector &v, const Vector &r )
 
 int J2PlaneStress :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(3);
+  static thread_local Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -316,7 +316,7 @@ J2PlaneStress::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(11+9);
+  static thread_local Vector data(11+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -350,7 +350,7 @@ J2PlaneStress::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(11+9);
+  static thread_local Vector data(11+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2PlaneStress::recvSelf - failed to recv vector from channel\n";
     return -1;
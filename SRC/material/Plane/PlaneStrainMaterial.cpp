@@ -72,8 +72,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PlaneStrain)
 }
 
 //static vector and matrices
-Vector  PlaneStrainMaterial::stress(3) ;
-Matrix  PlaneStrainMaterial::tangent(3,3) ;
+thread_local Vector  PlaneStrainMaterial::stress(3) ;
+thread_local Matrix  PlaneStrainMaterial::tangent(3,3) ;
 
 //null constructor
 PlaneStrainMaterial::PlaneStrainMaterial( ) : 
@@ -307,7 +307,7 @@ PlaneStrainMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -337,7 +337,7 @@ PlaneStrainMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStrainMaterial::sendSelf() - failed to send id data\n";
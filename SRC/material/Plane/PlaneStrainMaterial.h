@@ -96,8 +96,8 @@ private :
     NDMaterial *theMaterial ;  //pointer to three dimensional material
 
     Vector strain ;
-    static Vector stress ;
-    static Matrix tangent ;
+    static thread_local Vector stress ;
+    static thread_local Matrix tangent ;
 
 } ;
 
@@ -87,8 +87,8 @@ class PlaneStressLayeredMaterial : public NDMaterial {
     NDMaterial **theFibers;  //pointers to the materials (fibers)
 
     Vector strain;
-    static Vector stress;
-    static Matrix tangent ;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent ;
     static ID array ;  
 
 } ; //end of PlaneStressLayeredMaterial declarations
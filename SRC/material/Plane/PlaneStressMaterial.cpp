@@ -38,8 +38,8 @@
 #include <Matrix3D.h>
 using namespace OpenSees;
 //static vector and matrices
-Vector  PlaneStressMaterial::stress(3) ;
-Matrix  PlaneStressMaterial::tangent(3,3) ;
+thread_local Vector  PlaneStressMaterial::stress(3) ;
+thread_local Matrix  PlaneStressMaterial::tangent(3,3) ;
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
@@ -320,8 +320,8 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd12(3,3);
+  static thread_local Matrix dd22(3,3);
   //
   dd12(0,0) = threeDtangent(0,2);
   dd12(1,0) = threeDtangent(1,2);
@@ -349,12 +349,12 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(5,5);
 
   
-  static Vector sigma2(3);
+  static thread_local Vector sigma2(3);
   sigma2(0) = threeDstress(2);
   sigma2(1) = threeDstress(4);
   sigma2(2) = threeDstress(5);
 
-  static Vector dd22sigma2(3);
+  static thread_local Vector dd22sigma2(3);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -369,10 +369,10 @@ PlaneStressMaterial::getTangent( )
   const Matrix &C = theMaterial->getTangent();
 
 //Matrix3D dd11, dd12, dd21, dd22;
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd11(3,3);
+  static thread_local Matrix dd12(3,3);
+  static thread_local Matrix dd21(3,3);
+  static thread_local Matrix dd22(3,3);
   //
   dd11(0,0) = C(0,0);
   dd11(1,0) = C(1,0);
@@ -429,7 +429,7 @@ PlaneStressMaterial::getTangent( )
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11 ; 
@@ -448,10 +448,10 @@ PlaneStressMaterial::getInitialTangent( )
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd11(3,3);
+  static thread_local Matrix dd12(3,3);
+  static thread_local Matrix dd21(3,3);
+  static thread_local Matrix dd22(3,3);
 
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(1,0);
@@ -506,7 +506,7 @@ PlaneStressMaterial::getInitialTangent( )
 
 
   // condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11 ; 
@@ -547,7 +547,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -564,7 +564,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cgamma02;
   vecData(2) = Cgamma12;
@@ -589,7 +589,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send id data\n";
@@ -613,7 +613,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send vector data\n";
@@ -117,9 +117,9 @@ class PlaneStressMaterial: public NDMaterial{
 
     Vector strain ;
 
-    static Vector stress ;
+    static thread_local Vector stress ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 } ; //end of PlaneStressMaterial declarations
 
 
@@ -29,8 +29,8 @@
 #include <elementAPI.h>
 
 //static vector and matrices
-Vector  PlaneStressRebarMaterial::stress(3) ;
-Matrix  PlaneStressRebarMaterial::tangent(3,3) ;
+thread_local Vector  PlaneStressRebarMaterial::stress(3) ;
+thread_local Matrix  PlaneStressRebarMaterial::tangent(3,3) ;
 
 //null constructor
 PlaneStressRebarMaterial::PlaneStressRebarMaterial( ) : 
@@ -296,7 +296,7 @@ PlaneStressRebarMaterial::sendSelf(int commitTag, Channel &theChannel)
 
   int matDbTag;
   
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = dataTag;
   idData(1) = theMat->getClassTag();
   matDbTag = theMat->getDbTag();
@@ -312,7 +312,7 @@ PlaneStressRebarMaterial::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   vecData(0) = angle;
 
   res = theChannel.sendVector(dataTag, commitTag, vecData);
@@ -337,7 +337,7 @@ PlaneStressRebarMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   int dataTag = this->getDbTag();
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStressRebarMaterial::sendSelf() - failed to receive id data" << endln;
@@ -356,7 +356,7 @@ PlaneStressRebarMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   }
   theMat->setDbTag(idData(2));
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   res = theChannel.recvVector(dataTag, commitTag, vecData);
   if (res < 0) {
     opserr << "PlaneStressRebarMaterial::sendSelf() - failed to receive vector data" << endln;
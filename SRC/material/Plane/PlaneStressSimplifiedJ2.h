@@ -98,8 +98,8 @@ class PlaneStressSimplifiedJ2 : public NDMaterial
   double CsavedStrain33;
   // ---  define classwide variables
 
-  static Vector tmpVector;
-  static Matrix tmpMatrix;
+  static thread_local Vector tmpVector;
+  static thread_local Matrix tmpMatrix;
 };
 #endif
 
@@ -343,7 +343,7 @@ PlaneStressUserMaterial::sendSelf(int commitTag, Channel &theChannel)
 
   int dataTag = this->getDbTag();
 
-  static ID idData(3);
+  static thread_local ID idData(3);
 
   idData(0) = this->getTag();
   idData(1) = nstatevs;
@@ -379,7 +379,7 @@ PlaneStressUserMaterial::recvSelf(int commitTag, Channel& theChannel, FEM_Object
 
     int dataTag = this->getDbTag();
 
-    static ID idData(3);
+    static thread_local ID idData(3);
 
     res = theChannel.recvID(dataTag, commitTag, idData);
     if (res < 0) {
@@ -441,7 +441,7 @@ PlaneStressUserMaterial::recvSelf(int commitTag, Channel& theChannel, FEM_Object
   //cracking output - added by V.K. Papanikolaou [AUTh] - start
   const Vector& PlaneStressUserMaterial::getCracking()
   {
-      static Vector vec = Vector(3);
+      static thread_local Vector vec = Vector(3);
 
       vec(0) = statevdata[27];                          // crack 0/1 in direction 1
 
@@ -477,7 +477,7 @@ PlaneStressUserMaterial::recvSelf(int commitTag, Channel& theChannel, FEM_Object
           output.tag("ResponseType", "Crack2");
           output.tag("ResponseType", "CAngle");
           output.endTag();
-          static Vector vec(3);
+          static thread_local Vector vec(3);
           // use a number not used in the NDMaterial..
           // 5 is too likely to be used if someone will implement another response there.
           return new MaterialResponse(this, 5555, vec);
@@ -635,7 +635,7 @@ int PrestressedConcretePlaneStress::sendSelf(int commitTag, Channel &theChannel)
   int dataTag = this->getDbTag();
   
 	// Packs its data into a Vector and sends this to theChannel
-  static Vector data(11);
+  static thread_local Vector data(11);
   data(0) = this->getTag();
   data(1) = rho;
   data(2) = angle1;
@@ -658,7 +658,7 @@ int PrestressedConcretePlaneStress::sendSelf(int commitTag, Channel &theChannel)
   // Now sends the IDs of its materials
   int matDbTag;
   
-  static ID idData(8);
+  static thread_local ID idData(8);
   
   // NOTE: to ensure that the material has a database
   // tag if sending to a database channel.
@@ -703,7 +703,7 @@ int PrestressedConcretePlaneStress::recvSelf(int commitTag, Channel &theChannel,
   
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(11);
+  static thread_local Vector data(11);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING PrestressedConcretePlaneStress::recvSelf() - failed to receive Vector\n";
@@ -722,7 +722,7 @@ int PrestressedConcretePlaneStress::recvSelf(int commitTag, Channel &theChannel,
   fy2 = data(9);
   E0 = data(10);
 
-  static ID idData(8);
+  static thread_local ID idData(8);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1318,7 +1318,7 @@ int PrestressedConcretePlaneStress::determineTrialStress(void)
   Information &theInfoC02 = theResponses[2]->getInformation();
   Information &theInfoC03 = theResponses[3]->getInformation();
   
-  static Vector theData(5);
+  static thread_local Vector theData(5);
   theData(0) = xx;
   theData(1) = kk;
   theData(2) = DOne;
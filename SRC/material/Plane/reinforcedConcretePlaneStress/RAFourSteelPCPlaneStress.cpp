@@ -699,7 +699,7 @@ int RAFourSteelPCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	int dataTag = this->getDbTag();
 
 	// Packs its data into a Vector and sends this to theChannel
-	static Vector data(16);
+	static thread_local Vector data(16);
 	data(0) = this->getTag();
 	data(1) = rho;
 	data(2) = angle1;
@@ -727,7 +727,7 @@ int RAFourSteelPCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	// Now sends the IDs of its materials
     int matDbTag;
  
-    static ID idData(12);
+    static thread_local ID idData(12);
 
 	// NOTE: to ensure that the material has a database
     // tag if sending to a database channel.
@@ -772,7 +772,7 @@ int RAFourSteelPCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(16);
+  static thread_local Vector data(16);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING RAFourSteelPCPlaneStress::recvSelf() - failed to receive Vector\n";
@@ -796,7 +796,7 @@ int RAFourSteelPCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
   fy2 = data(14);
   E0 = data(15);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1440,7 +1440,7 @@ int RAFourSteelPCPlaneStress::determineTrialStress(void)
 	Information &theInfoC02 = theResponses[4]->getInformation();
 	Information &theInfoC03 = theResponses[5]->getInformation();
 	
-	static Vector theData(5);
+	static thread_local Vector theData(5);
 	theData(0) = xx;
 	theData(1) = kk;
 	theData(2) = DOne;
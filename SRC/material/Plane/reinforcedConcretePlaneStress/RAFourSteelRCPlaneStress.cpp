@@ -692,7 +692,7 @@ int RAFourSteelRCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	int dataTag = this->getDbTag();
 
 	// Packs its data into a Vector and sends this to theChannel
-	static Vector data(13);
+	static thread_local Vector data(13);
 	data(0) = this->getTag();
 	data(1) = rho;
 	data(2) = angle1;
@@ -717,7 +717,7 @@ int RAFourSteelRCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	// Now sends the IDs of its materials
     int matDbTag;
  
-    static ID idData(12);
+    static thread_local ID idData(12);
 
 	// NOTE: to ensure that the material has a database
     // tag if sending to a database channel.
@@ -762,7 +762,7 @@ int RAFourSteelRCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING RAFourSteelRCPlaneStress::recvSelf() - failed to receive Vector\n";
@@ -783,7 +783,7 @@ int RAFourSteelRCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
   fy = data(11);
   E0 = data(12);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1424,7 +1424,7 @@ int RAFourSteelRCPlaneStress::determineTrialStress(void)
 	Information &theInfoC02 = theResponses[4]->getInformation();
 	Information &theInfoC03 = theResponses[5]->getInformation();
     
-	static Vector theData(5);
+	static thread_local Vector theData(5);
 	theData(0) = xx;
 	theData(1) = kk;
 	theData(2) = DOne;
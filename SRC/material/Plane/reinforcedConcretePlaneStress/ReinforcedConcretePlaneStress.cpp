@@ -603,7 +603,7 @@ int ReinforcedConcretePlaneStress::sendSelf(int commitTag, Channel &theChannel)
   int dataTag = this->getDbTag();
   
   // Packs its data into a Vector and sends this to theChannel
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = rho;
   data(2) = angle1;
@@ -624,7 +624,7 @@ int ReinforcedConcretePlaneStress::sendSelf(int commitTag, Channel &theChannel)
   // Now sends the IDs of its materials
   int matDbTag;
   
-  static ID idData(8);
+  static thread_local ID idData(8);
 
   // NOTE: to ensure that the material has a database
   // tag if sending to a database channel.
@@ -669,7 +669,7 @@ int ReinforcedConcretePlaneStress::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING ReinforcedConcretePlaneStress::recvSelf() - failed to receive Vector\n";
@@ -686,7 +686,7 @@ int ReinforcedConcretePlaneStress::recvSelf(int commitTag, Channel &theChannel,
   fy = data(7);
   E0 = data(8);
 
-  static ID idData(8);
+  static thread_local ID idData(8);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1273,7 +1273,7 @@ int ReinforcedConcretePlaneStress::determineTrialStress(void)
   Information &theInfoC02 = theResponses[2]->getInformation();
   Information &theInfoC03 = theResponses[3]->getInformation();
   
-  static Vector theData(5);
+  static thread_local Vector theData(5);
   theData(0) = xx;
   theData(1) = kk;
   theData(2) = DOne;
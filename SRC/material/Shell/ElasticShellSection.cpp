@@ -139,7 +139,7 @@ int ElasticMembranePlateSection::getOrder( ) const
 //send back order of strain in vector form
 const ID& ElasticMembranePlateSection::getType( )
 {
-    static bool initialized = false;
+    static thread_local bool initialized = false;
     if (!initialized) {
         array(0) = SECTION_RESPONSE_FXX;
         array(1) = SECTION_RESPONSE_FYY;
@@ -358,7 +358,7 @@ void  ElasticMembranePlateSection::Print( OPS_Stream &s, int flag )
 int ElasticMembranePlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = Em;
   data(2) = nu;
@@ -378,7 +378,7 @@ int ElasticMembranePlateSection::recvSelf(int cTag, Channel &theChannel,
 				      FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticMembranePlateSection::recvSelf() - failed to recv data\n";
@@ -23,8 +23,8 @@
 
 #include <elementAPI.h>
 
-Vector ElasticIsotropicThreeDimensional::sigma(6);
-Matrix ElasticIsotropicThreeDimensional::D(6,6);
+thread_local Vector ElasticIsotropicThreeDimensional::sigma(6);
+thread_local Matrix ElasticIsotropicThreeDimensional::D(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticIsotropic3D)
 {
@@ -231,7 +231,7 @@ ElasticIsotropicThreeDimensional::getOrder (void) const
 int 
 ElasticIsotropicThreeDimensional::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -257,7 +257,7 @@ int
 ElasticIsotropicThreeDimensional::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -26,7 +26,7 @@
 
 bool IncrementalElasticIsotropicThreeDimensional::printnow = true;
 // Vector IncrementalElasticIsotropicThreeDimensional::sigma(6);
-Matrix IncrementalElasticIsotropicThreeDimensional::D(6,6);
+thread_local Matrix IncrementalElasticIsotropicThreeDimensional::D(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_IncrementalElasticIsotropicThreeDimensional)
 {
@@ -222,7 +222,7 @@ IncrementalElasticIsotropicThreeDimensional::getInitialTangent (void)
 const Vector&
 IncrementalElasticIsotropicThreeDimensional::getStress (void)
 {	
-  static Vector depsilon(6);
+  static thread_local Vector depsilon(6);
   depsilon.Zero();
   
   sigma = sigma_n;
@@ -330,7 +330,7 @@ IncrementalElasticIsotropicThreeDimensional::getOrder (void) const
 int 
 IncrementalElasticIsotropicThreeDimensional::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(28);
+  static thread_local Vector data(28);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -374,7 +374,7 @@ int
 IncrementalElasticIsotropicThreeDimensional::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(28);
+  static thread_local Vector data(28);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
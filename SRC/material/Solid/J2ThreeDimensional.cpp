@@ -58,9 +58,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector J2ThreeDimensional :: strain_vec(6) ;
-Vector J2ThreeDimensional :: stress_vec(6) ;
-Matrix J2ThreeDimensional :: tangent_matrix(6,6) ;
+thread_local Vector J2ThreeDimensional :: strain_vec(6) ;
+thread_local Vector J2ThreeDimensional :: stress_vec(6) ;
+thread_local Matrix J2ThreeDimensional :: tangent_matrix(6,6) ;
 
 
 //null constructor
@@ -158,7 +158,7 @@ int J2ThreeDimensional :: setTrialStrain( const Vector &v, const Vector &r )
 
 int J2ThreeDimensional :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(6);
+  static thread_local Vector newStrain(6);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = strain(2,2) + v(2);
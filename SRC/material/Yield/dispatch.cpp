@@ -1191,7 +1191,7 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
     if (argc < 7) {
       opserr << "WARNING invalid number of arguments\n";
       printCommand(argc, argv);
-      opserr << "Want: section YS_Section2D01 tag? E? A? Iz? ysTag? <algo?>"
+      opserr << "Want: section YS_Section2D01 tag? E? A? Iz? ysTag? <algo?> <-closestPoint>"
              << "\n";
       return 0;
     }
@@ -1234,8 +1234,13 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
     }
 
     bool useKr = true;
-    if (argc > indx) {
-      if (Tcl_GetInt(interp, argv[indx++], &algo) != TCL_OK) {
+    bool closestPoint = false;
+    for (; indx < argc; indx++) {
+      if (strcmp(argv[indx], "-closestPoint") == 0) {
+        closestPoint = true;
+        continue;
+      }
+      if (Tcl_GetInt(interp, argv[indx], &algo) != TCL_OK) {
         opserr << "WARNING invalid algo" << "\n";
         opserr << " section: " << tag << "\n";
         return 0;
@@ -1244,7 +1249,9 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
         useKr = false;
     }
 
-    theModel = new YS_Section2D01(tag, E, A, Iz, ys, useKr);
+    YS_Section2D01 *theSection = new YS_Section2D01(tag, E, A, Iz, ys, useKr);
+    theSection->setClosestPointReturn(closestPoint);
+    theModel = theSection;
   }
 
   else if (strcmp(argv[1], "YS_Section2D02") == 0 ||
@@ -1254,7 +1261,7 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
       opserr << "WARNING invalid number of arguments\n";
       printCommand(argc, argv);
       opserr << "Want: section YS_Section2D01 tag? E? A? Iz? maxPlastRot? "
-                "ysTag? <algo?>"
+                "ysTag? <algo?> <-closestPoint>"
              << "\n";
       return 0;
     }
@@ -1303,8 +1310,13 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
     }
 
     bool useKr = true;
-    if (argc > indx) {
-      if (Tcl_GetInt(interp, argv[indx++], &algo) != TCL_OK) {
+    bool closestPoint = false;
+    for (; indx < argc; indx++) {
+      if (strcmp(argv[indx], "-closestPoint") == 0) {
+        closestPoint = true;
+        continue;
+      }
+      if (Tcl_GetInt(interp, argv[indx], &algo) != TCL_OK) {
         opserr << "WARNING invalid algo" << "\n";
         opserr << " section: " << tag << "\n";
         return 0;
@@ -1313,7 +1325,9 @@ TclBasicBuilderYS_SectionCommand(ClientData clientData, Tcl_Interp *interp,
         useKr = false;
     }
 
-    theModel = new YS_Section2D02(tag, E, A, Iz, maxPlstkRot, ys, useKr);
+    YS_Section2D02 *theSection = new YS_Section2D02(tag, E, A, Iz, maxPlstkRot, ys, useKr);
+    theSection->setClosestPointReturn(closestPoint);
+    theModel = theSection;
   }
 
   // Added by S.Gajan <sgajan@ucdavis.edu>
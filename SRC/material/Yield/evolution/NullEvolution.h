@@ -50,9 +50,9 @@ public:
   double getCommitPlasticStrains(int dof);
 
 private:
-static Vector vec_dim_1;
-static Vector vec_dim_2;  
-static Vector vec_dim_3;
+static thread_local Vector vec_dim_1;
+static thread_local Vector vec_dim_2;  
+static thread_local Vector vec_dim_3;
 };
 
 #endif
@@ -5,10 +5,6 @@
 #include "YS_Evolution.h"
 #include <Logging.h>
 
-Vector YS_Evolution::crd1(1);
-Vector YS_Evolution::crd2(2);
-Vector YS_Evolution::crd3(3);
-
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -119,67 +115,42 @@ void  YS_Evolution::toOriginalCoord(Vector &coord)
 
 }
 
+// the scalar forms are called for every drift evaluation; they work on
+// the coordinates directly rather than through a scratch Vector
 void YS_Evolution::toDeformedCoord(double &x)
 {
-//	opserr << "WARNING YS_Evolution::toDeformedCoord(.) - This method should not be called\n";
-	crd1(0) = x;
-	this->toDeformedCoord(crd1);
-	x = crd1(0);
+	x = x*isotropicFactor(0) + translate(0);
 }
 
 void YS_Evolution::toDeformedCoord(double &x, double &y)
 {
-//  opserr << "WARNING YS_Evolution::toDeformedCoord(..) - This method should not be called\n";
-	crd2(0) = x;
-	crd2(1) = y;
-	this->toDeformedCoord(crd2);
-	x = crd2(0);
-	y = crd2(1);
+	x = x*isotropicFactor(0) + translate(0);
+	y = y*isotropicFactor(1) + translate(1);
 }
 
 void YS_Evolution::toDeformedCoord(double &x, double &y, double &z)
 {
-//	opserr << "WARNING YS_Evolution::toDeformedCoord(...) - This method should not be called\n";
-	crd3(0) = x;
-	crd3(1) = y;
-	crd3(2) = z;
-	this->toDeformedCoord(crd3);
-	x = crd3(0);
-	y = crd3(1);
-	z = crd3(2);
-
+	x = x*isotropicFactor(0) + translate(0);
+	y = y*isotropicFactor(1) + translate(1);
+	z = z*isotropicFactor(2) + translate(2);
 }
 
 void YS_Evolution::toOriginalCoord(double &x)
 {
-//	opserr << "WARNING YS_Evolution::toOriginalCoord(.) - This method should not be called\n";
-	crd1(0) = x;
-	this->toOriginalCoord(crd1);
-	x = crd1(0);
-
+	x = (x - translate(0))/isotropicFactor(0);
 }
 
 void YS_Evolution::toOriginalCoord(double &x, double &y)
 {
-//	opserr << "WARNING YS_Evolution::toOriginalCoord(..) - This method should not be called\n";
-	crd2(0) = x;
-	crd2(1) = y;
-	this->toOriginalCoord(crd2);
-	x = crd2(0);
-	y = crd2(1);
+	x = (x - translate(0))/isotropicFactor(0);
+	y = (y - translate(1))/isotropicFactor(1);
 }
 
 void YS_Evolution::toOriginalCoord(double &x, double &y, double &z)
 {
-//	opserr << "WARNING YS_Evolution::toOriginalCoord(...) - This method should not be called\n";
-	crd3(0) = x;
-	crd3(1) = y;
-	crd3(2) = z;
-	this->toOriginalCoord(crd3);
-	x = crd3(0);
-	y = crd3(1);
-	z = crd3(2);
-
+	x = (x - translate(0))/isotropicFactor(0);
+	y = (y - translate(1))/isotropicFactor(1);
+	z = (z - translate(2))/isotropicFactor(2);
 }
 
 double YS_Evolution::getCommitTranslation(int dir)
@@ -11,7 +11,7 @@
 #define modifDebug 0
 #define transDebug 0
 
-Vector YS_Evolution2D::v2(2);
+thread_local Vector YS_Evolution2D::v2(2);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -141,12 +141,10 @@ int YS_Evolution2D::evolveSurface(YieldSurface_BC *ys, double lamda,
 	//freezeEvolution = false; -> have set this in commitState -> don't change
 	// first save the values on stack
 	// static vectors could get reallocated elsewhere
-	Vector f_sur(2);
-		f_sur(0) = F_Surface(0);
-		f_sur(1) = F_Surface(1);
-	Vector gl(2);
-		gl(0) = G(0);
-		gl(1) = G(1);
+	double f_sur_data[2] = {F_Surface(0), F_Surface(1)};
+	double gl_data[2]    = {G(0), G(1)};
+	Vector f_sur(f_sur_data, 2);
+	Vector gl(gl_data, 2);
 	
 	setTrialPlasticStrains(lamda, f_sur, gl);
 	if(freezeEvolution)
@@ -279,41 +277,36 @@ int YS_Evolution2D::evolveSurface(YieldSurface_BC *ys, double lamda,
 	    opserr << "---------------------------------------------------------" << endln;
      }
 
-	Vector mgnf(2);
-	mgnf = isotropicFactor_hist;
-	if(flag==1)
-		mgnf = isotropicFactor;
-	Vector delMag(2);
+	const Vector &mgnf = (flag==1) ? isotropicFactor : isotropicFactor_hist;
+	double delMag[2];
 	
 	if(deformable)
 	{
 
-		delMag(0) = x_grow*fabs(dfx_iso);
-		delMag(1) = y_grow*fabs(dfy_iso);
+		delMag[0] = x_grow*fabs(dfx_iso);
+		delMag[1] = y_grow*fabs(dfy_iso);
 	}
 	else
 	{
 		double dR = sqrt(dfx_iso*dfx_iso + dfy_iso*dfy_iso);
 		if(!iso_harden)
 		dR = -1*dR;
-		delMag(0) = dR;
-		delMag(1) = dR;
+		delMag[0] = dR;
+		delMag[1] = dR;
 	}
 
-	Vector isoFact = mgnf + delMag;
-
 	//check 2: For min isotropic factor
-	 if( (isotropicFactor(0) + delMag(0)) <= minIsoFactor)
+	 if( (isotropicFactor(0) + delMag[0]) <= minIsoFactor)
 	{
-		delMag(0) = 0.0;
+		delMag[0] = 0.0;
 		dfx_kin = 0.0;
         freezeEvolution = true;
 		if(!deformable)// nothing to do
 			return 0;
 	}
-	if( (isotropicFactor(1) + delMag(1)) <= minIsoFactor)
+	if( (isotropicFactor(1) + delMag[1]) <= minIsoFactor)
 	{
-		delMag(1) = 0.0;
+		delMag[1] = 0.0;
 		dfy_kin = 0.0;
 		freezeEvolution = true;
 
@@ -328,22 +321,19 @@ int YS_Evolution2D::evolveSurface(YieldSurface_BC *ys, double lamda,
     //cout << "YS_Evolution2D - F_Surface = " << F_Surface;
 
 	toOriginalCoord(fx_aim, fy_aim);
-	Vector f_aim(2);
-	f_aim(0) = fx_aim;
-	f_aim(1) = fy_aim;
+	double f_aim_data[2] = {fx_aim, fy_aim};
+	Vector f_aim(f_aim_data, 2);
 	v2 = getEvolDirection(f_aim);
 
-	Vector df_kin = ys->translationTo(f_aim, v2);
+	const Vector &df_kin = ys->translationTo(f_aim, v2);
 	// correct for isotropic factor
-	Vector trans(2);
-	trans = translate_hist;
-	if(flag==1)
-		trans = translate;
+	const Vector &trans = (flag==1) ? translate : translate_hist;
 
     // Update the quantities
 	translate(0) = trans(0) + df_kin(0)*isotropicFactor(0);
 	translate(1) = trans(1) + df_kin(1)*isotropicFactor(1);
-	isotropicFactor = mgnf + delMag;
+	isotropicFactor(0) = mgnf(0) + delMag[0];
+	isotropicFactor(1) = mgnf(1) + delMag[1];
 
 	return 0;
 }
@@ -78,29 +78,39 @@ void Attalla2D::getGradient(double &gx, double &gy, double x, double y)
 
 }
 
-double Attalla2D::getSurfaceDrift(double x, double y)
+template <typename T>
+T Attalla2D::surfaceFunction(const T &x, const T &y)
 {
-double phi;
 double a = 10.277; //3.043;//4.29293;
 double yt = 0.95, xt = 0.054029;
+double xv = valueOf(x), yv = valueOf(y);
 
-	if(y > yt && fabs(x) < fabs(y)*xt/yt)
+	if(yv > yt && fabs(xv) < fabs(yv)*xt/yt)
 	{
-		phi = a*x*x + y + 0.02;
+		return a*x*x + y + 0.02;
 	}
-	else if(y < -yt && fabs(x) < fabs(y)*xt/yt)
+	else if(yv < -yt && fabs(xv) < fabs(yv)*xt/yt)
 	{
-		phi = a*x*x - y + 0.02;
+		return a*x*x - y + 0.02;
 	}
 	else
 	{
-		phi = a1*pow(y,6) + a2*pow(x,6) + a3*pow(y,4) + a4*pow(x,4) + a5*y*y + a6*x*x;
+		return a1*pow(y,6) + a2*pow(x,6) + a3*pow(y,4) + a4*pow(x,4) + a5*y*y + a6*x*x;
 	}
+}
 
+double Attalla2D::getSurfaceDrift(double x, double y)
+{
+double phi = surfaceFunction(x, y);
 double drift = phi - 1;
 	return drift;
 }
 
+YS_Dual2D Attalla2D::getSurfaceDerivatives(double x, double y)
+{
+	return surfaceFunction(YS_Dual2D::X(x), YS_Dual2D::Y(y)) - 1;
+}
+
 // Always call the base class method first
 void Attalla2D::customizeInterpolate(double &xi, double &yi, double &xj, double &yj)
 {
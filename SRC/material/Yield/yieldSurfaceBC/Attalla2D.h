@@ -25,11 +25,14 @@ public:
 //  For the following 2 methods, x, y already non-dimensionalized
     virtual void 	getGradient(double &gx, double &gy, double x, double y);
     virtual double 	getSurfaceDrift(double x, double y);
+    virtual YS_Dual2D getSurfaceDerivatives(double x, double y);
     virtual void	setExtent();
 	virtual void	customizeInterpolate(double &xi, double &yi, double &xj, double &yj);
 protected:
     double a1, a2, a3, a4, a5, a6;
 	int    driftAlgo;
+private:
+    template <typename T> T surfaceFunction(const T &x, const T &y);
 };
 
 #endif
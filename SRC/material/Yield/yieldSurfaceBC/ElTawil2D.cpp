@@ -135,30 +135,40 @@ void ElTawil2D::getGradient(double &gx, double &gy, double x, double y)
 	// opserr << "\a";
 }
 
-double ElTawil2D::getSurfaceDrift(double x, double y)
+template <typename T>
+T ElTawil2D::surfaceFunction(const T &x, const T &y)
 {
-double phi;
 double a = 5;//10.277; //3.043;//4.29293; --> effects convergence
+double xv = valueOf(x), yv = valueOf(y);
 
-
-	if(y > ytPos && fabs(x) < fabs(y*xtPos/ytPos) )
+	if(yv > ytPos && fabs(xv) < fabs(yv*xtPos/ytPos) )
 	{
-		phi = a*x*x + y + qy;
+		return a*x*x + y + qy;
 	}
-	else if(y < ytNeg && fabs(x) < fabs(y*xtNeg/ytNeg))
+	else if(yv < ytNeg && fabs(xv) < fabs(yv*xtNeg/ytNeg))
 	{
-		phi = a*x*x - y + qy;
+		return a*x*x - y + qy;
 	}
 	else
 	{
-		double xVal = x*capX;
-		double yVal = y*capY;
+		T xVal = x*capX;
+		T yVal = y*capY;
 
-		if(y < 0)
-			phi = fabs(xVal/xBal) + pow(fabs(yVal/yNegCap), ty);
+		if(yv < 0)
+			return fabs(xVal/xBal) + pow(fabs(yVal/yNegCap), ty);
 		else
-			phi = fabs(xVal/xBal) + pow(yVal/yPosCap, cz);
+			return fabs(xVal/xBal) + pow(yVal/yPosCap, cz);
 	}
+}
+
+YS_Dual2D ElTawil2D::getSurfaceDerivatives(double x, double y)
+{
+	return surfaceFunction(YS_Dual2D::X(x), YS_Dual2D::Y(y)) - 1;
+}
+
+double ElTawil2D::getSurfaceDrift(double x, double y)
+{
+double phi = surfaceFunction(x, y);
 
 	double drift = phi - 1;
 
@@ -25,6 +25,7 @@ public:
 //  For the following 2 methods, x, y already non-dimensionalized
     virtual void 	getGradient(double &gx, double &gy, double x, double y);
     virtual double 	getSurfaceDrift(double x, double y);
+    virtual YS_Dual2D getSurfaceDerivatives(double x, double y);
     virtual void	setExtent();
 	virtual void	customizeInterpolate(double &xi, double &yi, double &xj, double &yj);
 protected:
@@ -37,6 +38,8 @@ protected:
 	double xtPos, xtNeg;
 	double qy;
 
+private:
+    template <typename T> T surfaceFunction(const T &x, const T &y);
 };
 
 #endif
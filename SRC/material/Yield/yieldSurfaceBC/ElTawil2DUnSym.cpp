@@ -213,53 +213,57 @@ void ElTawil2DUnSym::getGradient(double &gx, double &gy, double x, double y)
 //	opserr << "\a";
 }
 
-double ElTawil2DUnSym::getSurfaceDrift(double x, double y)
+template <typename T>
+T ElTawil2DUnSym::surfaceFunction(const T &x, const T &y)
 {
-double phi;
 double a = 5;//10.277; //3.043;//4.29293; --> effects convergence
 // why isn't a = 10.77 here or 5 in getGradient
      double capx = capX;
      double capy = capY;
-     
+     double xv = valueOf(x), yv = valueOf(y);
+
 	// ignore the small difference between xt1, xt2
 	// and xt4, xt3 for determining whether the
 	// quadratic should be used
-	if(y > ytPos && fabs(x) < fabs(y*xt1/ytPos) )
+	if(yv > ytPos && fabs(xv) < fabs(yv*xt1/ytPos) )
 	{
-		phi = a*x*x + y + qy;
+		return a*x*x + y + qy;
 	}
-	else if(y < ytNeg && fabs(x) < fabs(y*xt4/ytNeg))
+	else if(yv < ytNeg && fabs(xv) < fabs(yv*xt4/ytNeg))
 	{
-		phi = a*x*x - y + qy;
+		return a*x*x - y + qy;
 	}
 	else
 	{
-		double xVal = x*capx;
-		double yVal = y*capy;
+		T xVal = x*capx;
+		T yVal = y*capy;
+		double xValv = xv*capx;
+		double yValv = yv*capy;
 
-		if(xVal >=0 && yVal >= yPosBal) 	// quad 1
+		if(xValv >=0 && yValv >= yPosBal) 	// quad 1
 		{
-		 	phi = fabs(xVal/xPosBal) + pow((yVal - yPosBal)/(yPosCap - yPosBal), czPos);
+		 	return fabs(xVal/xPosBal) + pow((yVal - yPosBal)/(yPosCap - yPosBal), czPos);
 		}
-		else if(xVal >=0 && yVal < yPosBal)	// quad 1 or 4
+		else if(xValv >=0 && yValv < yPosBal)	// quad 1 or 4
 		{
-		 	phi = fabs(xVal/xPosBal) + pow(fabs((yVal - yPosBal)/(yNegCap - yPosBal)), tyPos);
+		 	return fabs(xVal/xPosBal) + pow(fabs((yVal - yPosBal)/(yNegCap - yPosBal)), tyPos);
 		}
-		else if(xVal < 0 && yVal >= yNegBal)// quad 2
+		else if(xValv < 0 && yValv >= yNegBal)// quad 2
 		{
-		 	phi = fabs(xVal/xNegBal) + pow((yVal - yNegBal)/(yPosCap - yNegBal), czNeg);
+		 	return fabs(xVal/xNegBal) + pow((yVal - yNegBal)/(yPosCap - yNegBal), czNeg);
 		}
-		else if(xVal < 0 && yVal < yNegBal)	// quad 2 or 3
+		else if(xValv < 0 && yValv < yNegBal)	// quad 2 or 3
 		{
 		
-		 	phi = fabs(xVal/xNegBal) + pow(fabs((yVal - yNegBal)/(yNegCap - yNegBal)), tyNeg);
+		 	return fabs(xVal/xNegBal) + pow(fabs((yVal - yNegBal)/(yNegCap - yNegBal)), tyNeg);
 		}
 		else
 		{
 			opserr << "ElTawil2DUnSym::getSurfaceDrift(..) - cond not possible\n";
-			opserr << "x=" << x << ", y=" << y << ", capx=" << capx << ", capy=" << capy << endln;
-			opserr << "xVal = " << xVal << ", yVal = " << yVal << endln;
+			opserr << "x=" << xv << ", y=" << yv << ", capx=" << capx << ", capy=" << capy << endln;
+			opserr << "xVal = " << xValv << ", yVal = " << yValv << endln;
 			opserr << "\a";
+			return T(0.0);
 		}
 		/*	
 		if(y < 0)
@@ -268,11 +272,21 @@ double a = 5;//10.277; //3.043;//4.29293; --> effects convergence
 			phi = fabs(xVal/xBal) + pow(yVal/yPosCap, cz);
 		*/
 	}
+}
+
+double ElTawil2DUnSym::getSurfaceDrift(double x, double y)
+{
+double phi = surfaceFunction(x, y);
 
 	double drift = phi - 1;
 	return drift;
 }
 
+YS_Dual2D ElTawil2DUnSym::getSurfaceDerivatives(double x, double y)
+{
+	return surfaceFunction(YS_Dual2D::X(x), YS_Dual2D::Y(y)) - 1;
+}
+
 // Always call the base class method first
 void ElTawil2DUnSym::customizeInterpolate(double &xi, double &yi, double &xj, double &yj)
 {
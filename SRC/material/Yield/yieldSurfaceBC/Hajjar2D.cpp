@@ -136,16 +136,27 @@ void Hajjar2D::getGradient(double &gx, double &gy, double xi, double yi)
 
 }
 
+template <typename T>
+T Hajjar2D::surfaceFunction(const T &x, const T &y)
+{
+	return c1*x*x + c2*y*y + c3*y*y*x*x;
+}
+
 double Hajjar2D::getSurfaceDrift(double xi, double yi)
 {
 double x = xi;
 double y = yi/* - centroidY*/;
 
-double phi = c1*x*x + c2*y*y + c3*y*y*x*x;
+double phi = surfaceFunction(x, y);
 double drift = phi - 1;
 	return drift;
 }
 
+YS_Dual2D Hajjar2D::getSurfaceDerivatives(double x, double y)
+{
+	return surfaceFunction(YS_Dual2D::X(x), YS_Dual2D::Y(y)) - 1;
+}
+
 YieldSurface_BC *Hajjar2D::getCopy(void)
 {
     Hajjar2D *theCopy = new Hajjar2D(this->getTag(), *hModel,
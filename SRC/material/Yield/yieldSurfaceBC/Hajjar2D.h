@@ -29,10 +29,13 @@ public:
 //  For the following 2 methods, x, y already non-dimensionalized
     virtual void 	getGradient(double &gx, double &gy, double x, double y);
     virtual double 	getSurfaceDrift(double x, double y);
+    virtual YS_Dual2D getSurfaceDerivatives(double x, double y);
     virtual void	setExtent();
 
 	double depth, width, thick, fc, fy, centroidY;
 	double c1, c2, c3;
+private:
+    template <typename T> T surfaceFunction(const T &x, const T &y);
 };
 
 #endif
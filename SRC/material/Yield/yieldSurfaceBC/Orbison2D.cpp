@@ -63,13 +63,24 @@ void Orbison2D::getGradient(double &gx, double &gy, double x, double y)
 
 }
 
+template <typename T>
+T Orbison2D::surfaceFunction(const T &x, const T &y)
+{
+	return 1.15*y*y - 0.15*pow(y, 6) + x*x + 3.67*y*y*x*x;
+}
+
 double Orbison2D::getSurfaceDrift(double x, double y)
 {
-double phi = 1.15*y*y - 0.15*pow(y, 6) + x*x + 3.67*y*y*x*x;
+double phi = surfaceFunction(x, y);
 double drift = phi - 1;
 	return drift;
 }
 
+YS_Dual2D Orbison2D::getSurfaceDerivatives(double x, double y)
+{
+	return surfaceFunction(YS_Dual2D::X(x), YS_Dual2D::Y(y)) - 1;
+}
+
 YieldSurface_BC *Orbison2D::getCopy(void)
 {
     Orbison2D *theCopy = new Orbison2D(this->getTag(), capX, capY, *hModel);
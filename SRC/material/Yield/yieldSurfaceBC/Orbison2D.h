@@ -27,8 +27,11 @@ public:
 //  For the following 2 methods, x, y already non-dimensionalized
     virtual void 	getGradient(double &gx, double &gy, double x, double y);
     virtual double 	getSurfaceDrift(double x, double y);
+    virtual YS_Dual2D getSurfaceDerivatives(double x, double y);
     virtual void	setExtent();
 
+private:
+    template <typename T> T surfaceFunction(const T &x, const T &y);
 };
 
 #endif
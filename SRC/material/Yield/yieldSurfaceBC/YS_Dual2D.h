@@ -0,0 +1,103 @@
+// YS_Dual2D.h: second order dual numbers in two variables
+//
+// A YS_Dual2D carries a value with its gradient and Hessian with respect
+// to the force point (x, y). Writing the surface function of a 2D yield
+// surface once as a template lets the compiler generate the closed-form
+// gradient and Hessian alongside the drift, in one pass and without any
+// heap storage.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined YS_DUAL2D_H
+#define YS_DUAL2D_H
+
+#include <math.h>
+
+class YS_Dual2D
+{
+public:
+    YS_Dual2D(double v = 0.0)
+      : val(v), gx(0.0), gy(0.0), hxx(0.0), hxy(0.0), hyy(0.0) {}
+
+    // the independent variables
+    static YS_Dual2D X(double x) {YS_Dual2D d(x); d.gx = 1.0; return d;}
+    static YS_Dual2D Y(double y) {YS_Dual2D d(y); d.gy = 1.0; return d;}
+
+    double val;
+    double gx, gy;
+    double hxx, hxy, hyy;
+};
+
+inline double valueOf(double a)           {return a;}
+inline double valueOf(const YS_Dual2D &a) {return a.val;}
+
+// f(a), given f(a.val), f'(a.val) and f''(a.val)
+inline YS_Dual2D chain(const YS_Dual2D &a, double f, double df, double ddf)
+{
+    YS_Dual2D r(f);
+    r.gx  = df*a.gx;
+    r.gy  = df*a.gy;
+    r.hxx = df*a.hxx + ddf*a.gx*a.gx;
+    r.hxy = df*a.hxy + ddf*a.gx*a.gy;
+    r.hyy = df*a.hyy + ddf*a.gy*a.gy;
+    return r;
+}
+
+inline YS_Dual2D operator-(const YS_Dual2D &a)
+{
+    return chain(a, -a.val, -1.0, 0.0);
+}
+
+inline YS_Dual2D operator+(const YS_Dual2D &a, const YS_Dual2D &b)
+{
+    YS_Dual2D r(a.val + b.val);
+    r.gx  = a.gx  + b.gx;
+    r.gy  = a.gy  + b.gy;
+    r.hxx = a.hxx + b.hxx;
+    r.hxy = a.hxy + b.hxy;
+    r.hyy = a.hyy + b.hyy;
+    return r;
+}
+
+inline YS_Dual2D operator-(const YS_Dual2D &a, const YS_Dual2D &b)
+{
+    return a + (-b);
+}
+
+inline YS_Dual2D operator*(const YS_Dual2D &a, const YS_Dual2D &b)
+{
+    YS_Dual2D r(a.val*b.val);
+    r.gx  = a.val*b.gx + b.val*a.gx;
+    r.gy  = a.val*b.gy + b.val*a.gy;
+    r.hxx = a.val*b.hxx + b.val*a.hxx + 2.0*a.gx*b.gx;
+    r.hxy = a.val*b.hxy + b.val*a.hxy + a.gx*b.gy + a.gy*b.gx;
+    r.hyy = a.val*b.hyy + b.val*a.hyy + 2.0*a.gy*b.gy;
+    return r;
+}
+
+inline YS_Dual2D operator+(const YS_Dual2D &a, double b) {YS_Dual2D r(a); r.val += b; return r;}
+inline YS_Dual2D operator+(double a, const YS_Dual2D &b) {return b + a;}
+inline YS_Dual2D operator-(const YS_Dual2D &a, double b) {return a + (-b);}
+inline YS_Dual2D operator-(double a, const YS_Dual2D &b) {return (-b) + a;}
+inline YS_Dual2D operator*(const YS_Dual2D &a, double b) {return chain(a, a.val*b, b, 0.0);}
+inline YS_Dual2D operator*(double a, const YS_Dual2D &b) {return b*a;}
+inline YS_Dual2D operator/(const YS_Dual2D &a, double b) {return a*(1.0/b);}
+
+// the kink of fabs at 0 takes the derivative from the positive side
+inline YS_Dual2D fabs(const YS_Dual2D &a)
+{
+    return a.val < 0.0 ? -a : a;
+}
+
+inline YS_Dual2D pow(const YS_Dual2D &a, double p)
+{
+    if(a.val == 0.0) // keep 0^(p-1), 0^(p-2) from blowing up for p < 2
+    {
+        double df  = (p == 1.0) ? 1.0 : 0.0;
+        double ddf = (p == 2.0) ? 2.0 : 0.0;
+        return chain(a, (p == 0.0) ? 1.0 : 0.0, df, ddf);
+    }
+    double f = ::pow(a.val, p - 2.0);
+    return chain(a, f*a.val*a.val, p*f*a.val, p*(p - 1.0)*f);
+}
+
+#endif
@@ -15,6 +15,7 @@ const int YieldSurface_BC::ConstantYReturn(3);
 const int YieldSurface_BC::NoFP(4);
 const int YieldSurface_BC::SurfOnly(5);
 const int YieldSurface_BC::StateLoading(6);
+const int YieldSurface_BC::ClosestPointReturn(7);
 
 static MapOfTaggedObjects theYieldSurface_BCObjects;
 
@@ -197,6 +198,12 @@ double YieldSurface_BC::interpolate(double x1, double y1, double z1, double x2,
 	return 0;
 }
 
+// the caller falls back on setToSurface
+int YieldSurface_BC::closestPointReturn(Vector &force, Vector &stiffness)
+{
+	return -1;
+}
+
 
 void YieldSurface_BC::setEleInfo(int tag, int loc)
 {
@@ -73,6 +73,9 @@ public:
     virtual void    addPlasticStiffness(Matrix &K)=0;
 
 	virtual double	setToSurface(Vector &force, int algoType, int flag=0)=0;
+	// closest point on the surface in the norm of the elastic stiffness
+	// (a diagonal, in the element system); < 0 if not available
+	virtual int     closestPointReturn(Vector &force, Vector &stiffness);
 	virtual int 	    modifySurface(double magPlasticDefo, Vector &Fsurface, Matrix &G, int flag=0)=0;
 
 	virtual int      commitState(Vector &force);
@@ -118,7 +121,7 @@ protected:
 
 public:
 int      ele_Tag, ele_Location;
-const  static int dFReturn, RadialReturn, ConstantXReturn, ConstantYReturn;
+const  static int dFReturn, RadialReturn, ConstantXReturn, ConstantYReturn, ClosestPointReturn;
 const  static int NoFP, SurfOnly, StateLoading;
 };
 
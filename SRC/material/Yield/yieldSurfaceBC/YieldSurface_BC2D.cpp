@@ -14,12 +14,12 @@
 #include <math.h>
 
 double YieldSurface_BC2D::error(1.0e-6);
-Vector YieldSurface_BC2D::v6(6);
-Vector YieldSurface_BC2D::T2(2);
-Vector YieldSurface_BC2D::F2(2);
-Vector YieldSurface_BC2D::g2(2);
-Vector YieldSurface_BC2D::v2(2);
-Vector YieldSurface_BC2D::v4(4);
+thread_local Vector YieldSurface_BC2D::v6(6);
+thread_local Vector YieldSurface_BC2D::T2(2);
+thread_local Vector YieldSurface_BC2D::F2(2);
+thread_local Vector YieldSurface_BC2D::g2(2);
+thread_local Vector YieldSurface_BC2D::v2(2);
+thread_local Vector YieldSurface_BC2D::v4(4);
 
 
 //////////////////////////////////////////////////////////////////////
@@ -412,7 +412,7 @@ int       status = -2;
 
 void YieldSurface_BC2D::addPlasticStiffness(Matrix &K)
 {
-Vector v2 = hModel->getEquiPlasticStiffness();
+const Vector &v2 = hModel->getEquiPlasticStiffness();
 
        v6.Zero();
 double kpX =  v2(0);
@@ -652,6 +652,7 @@ double dy = yj - yi;
 double dx = xj - xi;
 int count = 0;
     tu = 1; tl =0;
+    dtu = dj; dtl = di;
 
     //double d = getDrift(xi, yi, false);
     //if(d>0) opserr << "WARNING - Orbison2D::interpolate, Drift inside > 0 (" << d << ")\n";
@@ -669,25 +670,19 @@ int count = 0;
             return 1;
         }
 
-        dtl = getDrift(xi + tl*dx, yi + tl*dy);
-        dtu = getDrift(xi + tu*dx, yi + tu*dy);
-
         tr    =    tu - (  dtu*(tl - tu)/(dtl - dtu)  );
         dtr = getDrift(xi + tr*dx, yi + tr*dy);
 
-        if(dtr >= 0)
+        // carry the drift at the new bound over to the next iteration
+        if((dtr >= 0) == (dtu >= 0))
         {
-            if(dtu >= 0)
-                tu = tr;
-            else
-                tl = tr;
+            tu  = tr;
+            dtu = dtr;
         }
         else
         {
-            if(dtu < 0)
-                tu = tr;
-            else
-                tl = tr;
+            tl  = tr;
+            dtl = dtr;
         }
 
     }// while
@@ -724,6 +719,7 @@ double dy = yj - yi;
 double dx = xj - xi;
 int count = 0;
     tu = 1; tl =0;
+    dtu = dj; dtl = di;
 
     //double d = getDrift(xi, yi, false);
     //if(d>0) opserr << "WARNING - Orbison2D::interpolate, Drift inside > 0 (" << d << ")\n";
@@ -740,25 +736,19 @@ int count = 0;
             return 1;
         }
 
-        dtl = getSurfaceDrift(xi + tl*dx, yi + tl*dy);
-        dtu = getSurfaceDrift(xi + tu*dx, yi + tu*dy);
-
         tr    =    tu - (  dtu*(tl - tu)/(dtl - dtu)  );
         dtr = getSurfaceDrift(xi + tr*dx, yi + tr*dy);
 
-        if(dtr >= 0)
+        // carry the drift at the new bound over to the next iteration
+        if((dtr >= 0) == (dtu >= 0))
         {
-            if(dtu >= 0)
-                tu = tr;
-            else
-                tl = tr;
+            tu  = tr;
+            dtu = dtr;
         }
         else
         {
-            if(dtu < 0)
-                tu = tr;
-            else
-                tl = tr;
+            tl  = tr;
+            dtl = dtr;
         }
 
     }// while
@@ -861,6 +851,23 @@ double x, y;
             }
 
 
+            case 7: //ClosestPointReturn:
+            {
+                // closest in the non-dimensional system
+                double isoX = hModel->getTrialIsotropicFactor(0);
+                double isoY = hModel->getTrialIsotropicFactor(1);
+                x = xj;
+                y = yj;
+                if(closestPoint(x, y, 1/(isoX*isoX), 1/(isoY*isoY)) >= 0)
+                {
+                    hModel->toDeformedCoord(x, y);
+                    toElementSystem(force, x, y, true);
+                    return 1;
+                }
+                xi = 0; yi = 0; //revert to radial return
+                break;
+            }
+
             default:
             {
                 opserr << "YieldSurface_BC2D: Method not implemented yet\n";
@@ -890,6 +897,161 @@ double x, y;
         return t;
 }
 
+// Return the force point to the closest point of the surface in the
+// energy norm of the elastic stiffness, given by its diagonal in the
+// element system.  Returns the number of Newton iterations taken, or
+// -1 with the force left unchanged if they did not converge.
+int YieldSurface_BC2D::closestPointReturn(Vector &force, Vector &stiffness)
+{
+double x, y, kx, ky;
+
+    toLocalSystem(force, x, y, true);
+    hModel->toOriginalCoord(x, y);
+    toLocalSystem(stiffness, kx, ky, false, false);
+
+    // a unit change of x (or y) is a change sx (or sy) of the force
+double sx = capX*hModel->getTrialIsotropicFactor(0);
+double sy = capY*hModel->getTrialIsotropicFactor(1);
+
+    if(kx <= 0 || ky <= 0)
+    {
+        kx = 1;
+        ky = 1;
+    }
+
+double mx = kx/(sx*sx);
+double my = ky/(sy*sy);
+
+    // only the ratio matters
+double m = max_(mx, my);
+    mx /= m;
+    my /= m;
+
+int iter = closestPoint(x, y, mx, my);
+    if(iter < 0)
+        return -1;
+
+    hModel->toDeformedCoord(x, y);
+    toElementSystem(force, x, y, true);
+
+    return iter;
+}
+
+// Newton iterations for the point u of the surface closest to (x, y) in
+// the norm with weights 1/mx, 1/my; with M = diag(mx, my) and g, H the
+// gradient and Hessian of the drift:
+//
+//      r   = u - (x, y) + lamda*M*g(u) = 0
+//      phi = drift(u)                  = 0
+//
+//  [ I + lamda*M*H   M*g ] [ du      ]     [ r   ]
+//  [ g^T             0   ] [ dlamda  ] = - [ phi ]
+//
+// solved by eliminating du.  The step is halved (up to 4 times) while
+// it does not reduce |r|^2 + phi^2.  x, y are only changed on success.
+int YieldSurface_BC2D::closestPoint(double &x, double &y, double mx, double my)
+{
+const int    maxIter = 25;
+const double tol     = 1.0e-10;
+
+double u = x, v = y, lamda = 0;
+double ru = 0, rv = 0;
+YS_Dual2D phi = getSurfaceDerivatives(u, v);
+
+    for(int iter = 0; iter <= maxIter; iter++)
+    {
+        if(fabs(phi.val) < tol && fabs(ru) < tol && fabs(rv) < tol)
+        {
+            // from inside the surface the iterations may also end on
+            // the far side; the distance must be a minimum along the
+            // tangent (-gy, gx)
+            double tx = -phi.gy, ty = phi.gx;
+            double q  = tx*tx/mx + ty*ty/my
+                      + lamda*(phi.hxx*tx*tx + 2*phi.hxy*tx*ty + phi.hyy*ty*ty);
+            if(q <= 0)
+                return -1;
+
+            // a surface that opens up while expanding may have
+            // zeros of the drift away from the surface itself
+            if(forceLocation(getDrift(u, v)) != 0)
+                return -1;
+
+            x = u;
+            y = v;
+            return iter;
+        }
+
+        double a11 = 1 + lamda*mx*phi.hxx;
+        double a12 =     lamda*mx*phi.hxy;
+        double a21 =     lamda*my*phi.hxy;
+        double a22 = 1 + lamda*my*phi.hyy;
+        double det = a11*a22 - a12*a21;
+        if(det == 0)
+            return -1;
+
+        double bx = mx*phi.gx;
+        double by = my*phi.gy;
+
+        // A^-1 r and A^-1 M g
+        double zu = ( a22*ru - a12*rv)/det;
+        double zv = (-a21*ru + a11*rv)/det;
+        double wu = ( a22*bx - a12*by)/det;
+        double wv = (-a21*bx + a11*by)/det;
+
+        double gw = phi.gx*wu + phi.gy*wv;
+        if(gw == 0)
+            return -1;
+
+        double dl = (phi.val - phi.gx*zu - phi.gy*zv)/gw;
+        double du = -zu - wu*dl;
+        double dv = -zv - wv*dl;
+
+        double merit = ru*ru + rv*rv + phi.val*phi.val;
+        double step  = 1;
+        for(int k = 0; ; k++)
+        {
+            double un = u + step*du;
+            double vn = v + step*dv;
+            double ln = lamda + step*dl;
+            YS_Dual2D pn = getSurfaceDerivatives(un, vn);
+            double run = un - x + ln*mx*pn.gx;
+            double rvn = vn - y + ln*my*pn.gy;
+
+            if(run*run + rvn*rvn + pn.val*pn.val < merit || k == 4)
+            {
+                u = un;  v = vn;  lamda = ln;
+                ru = run; rv = rvn;
+                phi = pn;
+                break;
+            }
+            step *= 0.5;
+        }
+    }
+
+    return -1;
+}
+
+// central differences of getSurfaceDrift
+YS_Dual2D YieldSurface_BC2D::getSurfaceDerivatives(double x, double y)
+{
+const double h = 1.0e-5;
+
+YS_Dual2D d(getSurfaceDrift(x, y));
+double dxp = getSurfaceDrift(x + h, y);
+double dxm = getSurfaceDrift(x - h, y);
+double dyp = getSurfaceDrift(x, y + h);
+double dym = getSurfaceDrift(x, y - h);
+
+    d.gx  = (dxp - dxm)/(2*h);
+    d.gy  = (dyp - dym)/(2*h);
+    d.hxx = (dxp - 2*d.val + dxm)/(h*h);
+    d.hyy = (dyp - 2*d.val + dym)/(h*h);
+    d.hxy = (getSurfaceDrift(x + h, y + h) - getSurfaceDrift(x + h, y - h)
+           - getSurfaceDrift(x - h, y + h) + getSurfaceDrift(x - h, y - h))/(4*h*h);
+
+    return d;
+}
+
 #ifdef _GRAPHICS
 int YieldSurface_BC2D::displaySelf(Renderer &theViewer, int displayMode, float fact)
 {
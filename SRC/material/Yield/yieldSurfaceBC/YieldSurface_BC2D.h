@@ -5,6 +5,7 @@
 #if !defined YIELDSURFACE_BC2D_H
 #define YIELDSURFACE_BC2D_H
 #include "YieldSurface_BC.h"
+#include "YS_Dual2D.h"
 #include <UniaxialMaterial.h>
 
 class YieldSurface_BC2D : public YieldSurface_BC
@@ -46,6 +47,7 @@ public:
 //    virtual void	checkState(Vector &trialforce, bool &plastify, bool &shootsthrough);
 
 	virtual double	setToSurface(Vector &force, int algoType, int colorFlag = 0);
+	virtual int     closestPointReturn(Vector &force, Vector &stiffness);
 	virtual int 	modifySurface(double magPlasticDefo, Vector &Fsurface, Matrix &G, int flag=0);
 	//virtual int     trialModifySurface(double magPlasticDefo);
 	//virtual double	getElasticForce(Vector &force, Vector &elasticForce);
@@ -68,6 +70,9 @@ public:
 //  For the following 2 methods, x, y already non-dimensionalized
     virtual void 	getGradient(double &gx, double &gy, double x, double y)=0;
     virtual double	getSurfaceDrift(double x, double y)=0;
+//  Drift with its gradient and Hessian; by default from differences of
+//  getSurfaceDrift, surfaces with a closed form override it
+    virtual YS_Dual2D getSurfaceDerivatives(double x, double y);
     virtual void	setExtent()=0;
 	virtual const   Vector &getExtent(void);
 
@@ -76,6 +81,7 @@ public:
 	virtual void	customizeInterpolate(double &xi, double &yi, double &xj, double &yj);
 
 	double	interpolateClose(double xi, double yi, double xj, double yj);
+	int     closestPoint(double &x, double &y, double mx, double my);
 //  Dimensionalizing taken care at Element System <--> Local System level
 //    		void 	toDeformedCoord(double &x, double &y);
 //    		void 	toOriginalCoord(double &x, double &y);
@@ -103,13 +109,13 @@ protected:
     double fx_hist, fy_hist, gx_hist, gy_hist;
     double fx_trial, fy_trial, gx_trial, gy_trial;
 
-    static Vector v6;
+    static thread_local Vector v6;
 	static double  error;
-	static Vector v2;
-	static Vector g2;
-	static Vector v4;
-	static Vector T2;
-	static Vector F2;
+	static thread_local Vector v2;
+	static thread_local Vector g2;
+	static thread_local Vector v4;
+	static thread_local Vector T2;
+	static thread_local Vector F2;
 public:
 //	const  static int dFReturn, RadialReturn, ConstantXReturn, ConstantYReturn;
 
@@ -512,7 +512,7 @@ TclCommand_addMaterial(ClientData clientData, Tcl_Interp* interp,
         return TCL_ERROR;
       }
 
-    static double* gredu = 0;
+    static thread_local double* gredu = 0;
     // user defined yield surfaces
     if (param[9] < 0 && param[9] > -40) {
       param[9] = -int(param[9]);
@@ -609,7 +609,7 @@ TclCommand_addMaterial(ClientData clientData, Tcl_Interp* interp,
         return TCL_ERROR;
       }
 
-    static double* gredu = 0;
+    static thread_local double* gredu = 0;
     // user defined yield surfaces
     if (param[15] < 0 && param[15] > -40) {
       param[15] = -int(param[15]);
@@ -733,7 +733,7 @@ TclCommand_addMaterial(ClientData clientData, Tcl_Interp* interp,
         return TCL_ERROR;
       }
 
-    static double* gredu = 0;
+    static thread_local double* gredu = 0;
 
     // user defined yield surfaces
     if (param[numParam] < 0 && param[numParam] > -100) {
@@ -25,8 +25,8 @@
                                                                         
 #include <ElasticIsotropicPlaneStrain2D.h>                                                                        
 #include <Channel.h>
-Vector ElasticIsotropicPlaneStrain2D::sigma(3);
-Matrix ElasticIsotropicPlaneStrain2D::D(3,3);
+thread_local Vector ElasticIsotropicPlaneStrain2D::sigma(3);
+thread_local Matrix ElasticIsotropicPlaneStrain2D::D(3,3);
 
 ElasticIsotropicPlaneStrain2D::ElasticIsotropicPlaneStrain2D
 (int tag, double E, double nu, double rho) :
@@ -182,7 +182,7 @@ int
 ElasticIsotropicPlaneStrain2D::sendSelf(int commitTag, Channel &theChannel)
 {
   
-  static Vector data(7);
+  static thread_local Vector data(7);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -205,7 +205,7 @@ int
 ElasticIsotropicPlaneStrain2D::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(7);
+  static thread_local Vector data(7);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
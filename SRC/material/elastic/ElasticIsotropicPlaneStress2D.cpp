@@ -22,8 +22,8 @@
 #include <ElasticIsotropicPlaneStress2D.h>           
 #include <Channel.h>
 
-Vector ElasticIsotropicPlaneStress2D::sigma(3);
-Matrix ElasticIsotropicPlaneStress2D::D(3,3);
+thread_local Vector ElasticIsotropicPlaneStress2D::sigma(3);
+thread_local Matrix ElasticIsotropicPlaneStress2D::D(3,3);
 
 ElasticIsotropicPlaneStress2D::ElasticIsotropicPlaneStress2D
 (int tag, double E, double nu, double rho) :
@@ -176,7 +176,7 @@ int
 ElasticIsotropicPlaneStress2D::sendSelf(int commitTag, Channel &theChannel)
 {
   
-  static Vector data(7);
+  static thread_local Vector data(7);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -199,7 +199,7 @@ int
 ElasticIsotropicPlaneStress2D::recvSelf(int commitTag, Channel &theChannel, 
 				      FEM_ObjectBroker &theBroker)
 {
-  static Vector data(7);
+  static thread_local Vector data(7);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
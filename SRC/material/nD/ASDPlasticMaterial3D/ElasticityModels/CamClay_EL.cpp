@@ -78,7 +78,7 @@ VoigtMatrix& CamClay_EL::operator()(const VoigtVector& stress) //See note on bas
 
 int CamClay_EL::sendSelf(int commitTag, Channel &theChannel)
 {
-    static Vector data(3);
+    static thread_local Vector data(3);
     data(0) = e0;
     data(1) = kappa;
     data(2) = nu;
@@ -94,7 +94,7 @@ int CamClay_EL::sendSelf(int commitTag, Channel &theChannel)
 
 int CamClay_EL::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    static Vector data(3);
+    static thread_local Vector data(3);
 
     if (theChannel.receiveVector(0, commitTag, data) != 0)
     {
@@ -77,7 +77,7 @@ VoigtMatrix& NoTensionLinearIsotropic3D_EL::operator()(const VoigtVector& stress
 
 int NoTensionLinearIsotropic3D_EL::sendSelf(int commitTag, Channel &theChannel)
 {
-    static Vector data(2);
+    static thread_local Vector data(2);
     data(0) = lambda;
     data(1) = mu;
 
@@ -92,7 +92,7 @@ int NoTensionLinearIsotropic3D_EL::sendSelf(int commitTag, Channel &theChannel)
 
 int NoTensionLinearIsotropic3D_EL::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    static Vector data(2);
+    static thread_local Vector data(2);
 
     if (theChannel.receiveVector(0, commitTag, data) != 0)
     {
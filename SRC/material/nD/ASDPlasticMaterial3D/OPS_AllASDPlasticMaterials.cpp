@@ -79,7 +79,7 @@ void print_usage(void)
 void *OPS_ADD_RUNTIME_VPV(OPS_AllASDPlasticMaterials)
 {
     // some kudos
-    static bool first_done = false;
+    static thread_local bool first_done = false;
     if (!first_done) {
         opserr << "Using ASDPlasticMaterial - Developed by: Jose Abell (UANDES), Massimo Petracca and Guido Camata (ASDEA Software Technology)\n";
         first_done = true;
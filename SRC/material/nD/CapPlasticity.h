@@ -169,8 +169,8 @@ class CapPlasticity : public NDMaterial {
 
 // ---  classwide variables --
 
-  static Matrix tempMatrix;
-  static Vector tempVector;
+  static thread_local Matrix tempMatrix;
+  static thread_local Vector tempVector;
 
 
 	////////////////////add sensitivity ////////////////////////
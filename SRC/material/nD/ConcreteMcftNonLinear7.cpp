@@ -1518,7 +1518,7 @@ if(SHVs != 0) {
 const Matrix&
 ConcreteMcftNonLinear7 ::getInitialTangentSensitivity(int gradNumber)
 {
-  static Matrix dDridh(2,2);
+  static thread_local Matrix dDridh(2,2);
   
   dDridh.Zero();
   
@@ -2148,7 +2148,7 @@ double sigxy = fxy;
 double angl = FinalAnglex;
 double cL = crackLabel;
 
-	static Vector crackInfo(6);
+	static thread_local Vector crackInfo(6);
 	if (responseID == 10) {
 		crackInfo(0) = epsx;
 		crackInfo(1) = epsxy;
@@ -2158,7 +2158,7 @@ double cL = crackLabel;
 		crackInfo(5) = epsy;
 		matInformation.setVector(crackInfo);
 	} 
-	static Vector prinStress(8);
+	static thread_local Vector prinStress(8);
 	if (responseID == 11) {
 		prinStress(0) = e1;
 		prinStress(1) = e2;
@@ -51,7 +51,7 @@ const double CycLiqCP :: pat=101.0;
 const double CycLiqCP :: pcut=0.5;    // cut off confining stress
 const double CycLiqCP :: pmin=0.5;    // cut off confining stress
 
-double CycLiqCP::initialTangent[3][3][3][3] ;   //material tangent
+thread_local double CycLiqCP::initialTangent[3][3][3][3] ;   //material tangent
 double CycLiqCP::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 double CycLiqCP::IbunI[3][3][3][3] ; //rank 4 I bun I 
 double CycLiqCP::mElastFlag = 0;
@@ -113,9 +113,9 @@ void * OPS_ADD_RUNTIME_VPV(OPS_CycLiqCPMaterial)
 }
 
 //static vectors and matrices
-Vector CycLiqCP :: strain_vec(6) ;
-Vector CycLiqCP :: stress_vec(6) ;
-Matrix CycLiqCP :: tangent_matrix(6,6) ;
+thread_local Vector CycLiqCP :: strain_vec(6) ;
+thread_local Vector CycLiqCP :: stress_vec(6) ;
+thread_local Matrix CycLiqCP :: tangent_matrix(6,6) ;
 Matrix CycLiqCP :: I(6,6);
 
 
@@ -402,17 +402,17 @@ void CycLiqCP :: plastic_integrator( )
   const double tole = 1.0e-6*pcut ; //tolerance
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  static thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
+  static thread_local Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
 
-  static Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
+  static thread_local Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
-  static Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
+  static thread_local Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
  
-  static Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
+  static thread_local Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
 
   Matrix pass(3,3); //matrix to pass on values
   double G0ep;
@@ -1040,7 +1040,7 @@ CycLiqCP::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(20+9*3);
+  static thread_local Vector data(20+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -1091,7 +1091,7 @@ CycLiqCP::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(20+9*3);
+  static thread_local Vector data(20+9*3);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "CycLiqCP::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -49,7 +49,7 @@ const double CycLiqCPSP :: pat=101.0;
 const double CycLiqCPSP :: pcut=0.5;    // cut off confining stress
 const double CycLiqCPSP :: pmin=0.5;    // cut off confining stress
 
-double CycLiqCPSP::initialTangent[3][3][3][3] ;   //material tangent
+thread_local double CycLiqCPSP::initialTangent[3][3][3][3] ;   //material tangent
 double CycLiqCPSP::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 double CycLiqCPSP::IbunI[3][3][3][3] ; //rank 4 I bun I 
 double CycLiqCPSP::mElastFlag = 0;
@@ -112,9 +112,9 @@ OPS_Export void * OPS_ADD_RUNTIME_VPV(OPS_CycLiqCPSPMaterial)
 
 
 //static vectors and matrices
-Vector CycLiqCPSP :: strain_vec(6) ;
-Vector CycLiqCPSP :: stress_vec(6) ;
-Matrix CycLiqCPSP :: tangent_matrix(6,6) ;
+thread_local Vector CycLiqCPSP :: strain_vec(6) ;
+thread_local Vector CycLiqCPSP :: stress_vec(6) ;
+thread_local Matrix CycLiqCPSP :: tangent_matrix(6,6) ;
 Matrix CycLiqCPSP :: I(6,6);
 
 
@@ -422,17 +422,17 @@ void CycLiqCPSP :: plastic_integrator( )
   const double tole = 1.0e-6*pcut ; //tolerance
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  static thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
+  static thread_local Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
 
-  static Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
+  static thread_local Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
-  static Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
+  static thread_local Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
  
-  static Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
+  static thread_local Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
 
   Matrix pass(3,3); //matrix to pass on values
 
@@ -1409,7 +1409,7 @@ CycLiqCPSP::sendSelf(int commitTag, Channel &theChannel)
   // we place all the data needed to define material and it's state
   // int a vector object
 	int res = 0;
-  static Vector data(23+9*3);
+  static thread_local Vector data(23+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -1464,7 +1464,7 @@ CycLiqCPSP::recvSelf (int commitTag, Channel &theChannel,
 {
 	int res = 0;
   // recv the vector object from the channel which defines material param and state
-  static Vector data(23+9*3);
+  static thread_local Vector data(23+9*3);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "CycLiqCPSP::recvSelf - failed to recv vector from channel\n";
@@ -202,7 +202,7 @@ class CycLiqCPSP : public NDMaterial {
 
   //material response 
   double tangent[3][3][3][3] ;   //material tangent
-  static double initialTangent[3][3][3][3] ;   //material tangent
+  static thread_local double initialTangent[3][3][3][3] ;   //material tangent
   static double IIdev[3][3][3][3] ; //rank 4 deviatoric 
   static double IbunI[3][3][3][3] ; //rank 4 I bun I 
   static Matrix I; //rank 2 I
@@ -235,9 +235,9 @@ class CycLiqCPSP : public NDMaterial {
   private:
 
   //static vectors and matrices sent back in get functions
-  static Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  static thread_local Vector strain_vec ;     //strain in vector notation
+  static thread_local Vector stress_vec ;     //stress in vector notation
+  static thread_local Matrix tangent_matrix ; //material tangent in matrix notation
 
 } ; //end of CycLiqCPSP declarations
 
@@ -25,8 +25,8 @@
 #include <Logging.h>
 #include <Channel.h>
 
-Vector ElasticIsotropic3DThermal::sigma(6);
-Matrix ElasticIsotropic3DThermal::D(6,6);
+thread_local Vector ElasticIsotropic3DThermal::sigma(6);
+thread_local Matrix ElasticIsotropic3DThermal::D(6,6);
 
 ElasticIsotropic3DThermal::ElasticIsotropic3DThermal
 (int tag, double e, double nu, double rho, double alpha, int softindex) :
@@ -279,7 +279,7 @@ ElasticIsotropic3DThermal::getOrder (void) const
 int 
 ElasticIsotropic3DThermal::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -305,7 +305,7 @@ int
 ElasticIsotropic3DThermal::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -333,7 +333,7 @@ ElasticIsotropic3DThermal::recvSelf(int commitTag, Channel &theChannel,
 const Vector& 
 ElasticIsotropic3DThermal::getTempAndElong( void)
 {
-	static Vector TempElong = Vector(2);
+	static thread_local Vector TempElong = Vector(2);
 	TempElong(0) = Temp;
 	TempElong(1) = ThermalElong;
   return TempElong;
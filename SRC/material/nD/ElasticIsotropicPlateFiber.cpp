@@ -27,8 +27,8 @@
 #include <ElasticIsotropicPlateFiber.h>           
 #include <Channel.h>
 
-Vector ElasticIsotropicPlateFiber::sigma(5);
-Matrix ElasticIsotropicPlateFiber::D(5,5);
+thread_local Vector ElasticIsotropicPlateFiber::sigma(5);
+thread_local Matrix ElasticIsotropicPlateFiber::D(5,5);
 
 ElasticIsotropicPlateFiber::ElasticIsotropicPlateFiber
 (int tag, double E, double nu, double rho) :
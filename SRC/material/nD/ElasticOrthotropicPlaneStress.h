@@ -95,8 +95,8 @@ class ElasticOrthotropicPlaneStress : public NDMaterial {
   
   //static vectors and matrices
   Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  static thread_local Vector stress_vec ;     //stress in vector notation
+  static thread_local Matrix tangent_matrix ; //material tangent in matrix notation
 
   double E1, E2, nu12, nu21, G12, rho;
 
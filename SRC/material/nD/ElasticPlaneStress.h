@@ -92,8 +92,8 @@ class ElasticPlaneStress : public NDMaterial {
   
   //static vectors and matrices
   Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  static thread_local Vector stress_vec ;     //stress in vector notation
+  static thread_local Matrix tangent_matrix ; //material tangent in matrix notation
 
   double E, nu, rho;
 
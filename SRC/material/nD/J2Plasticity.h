@@ -134,7 +134,7 @@ class J2Plasticity : public NDMaterial {
   //material response 
   Matrix stress ;                //stress tensor
   double tangent[3][3][3][3] ;   //material tangent
-  static double initialTangent[3][3][3][3] ;   //material tangent
+  static thread_local double initialTangent[3][3][3][3] ;   //material tangent
 
 //static double IIdev[3][3][3][3] ; //rank 4 deviatoric 
 //static double IbunI[3][3][3][3] ; //rank 4 I bun I 
@@ -59,7 +59,7 @@ const double J2PlasticityThermal :: two3   = 2.0 / 3.0 ;
 const double J2PlasticityThermal :: four3  = 4.0 / 3.0 ;
 const double J2PlasticityThermal :: root23 = sqrt( 2.0 / 3.0 ) ;
 
-double J2PlasticityThermal::initialTangent[3][3][3][3] ;   //material tangent
+thread_local double J2PlasticityThermal::initialTangent[3][3][3][3] ;   //material tangent
 double J2PlasticityThermal::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 double J2PlasticityThermal::IbunI[3][3][3][3] ; //rank 4 I bun I 
 
@@ -403,11 +403,11 @@ void J2PlasticityThermal :: plastic_integrator( )
 
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  static thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static thread_local Matrix dev_stress(3,3) ; //deviatoric stress
  
-  static Matrix normal(3,3) ;     //normal to yield surface
+  static thread_local Matrix normal(3,3) ;     //normal to yield surface
 
   double NbunN ; //normal bun normal   
 
@@ -875,7 +875,7 @@ J2PlasticityThermal::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10+9);
+  static thread_local Vector data(10+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -908,7 +908,7 @@ J2PlasticityThermal::recvSelf (int commitTag, Channel &theChannel,
 			 FEM_ObjectBroker &theBroker)
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10+9);
+  static thread_local Vector data(10+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2PlasticityThermal::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -140,7 +140,7 @@ protected :
   //material response 
   Matrix stress ;                //stress tensor
   double tangent[3][3][3][3] ;   //material tangent
-  static double initialTangent[3][3][3][3] ;   //material tangent
+  static thread_local double initialTangent[3][3][3][3] ;   //material tangent
   static double IIdev[3][3][3][3] ; //rank 4 deviatoric 
   static double IbunI[3][3][3][3] ; //rank 4 I bun I 
 
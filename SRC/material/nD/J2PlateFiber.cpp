@@ -49,9 +49,9 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-Vector J2PlateFiber :: strain_vec(5) ;
-Vector J2PlateFiber :: stress_vec(5) ;
-Matrix J2PlateFiber :: tangent_matrix(5,5) ;
+thread_local Vector J2PlateFiber :: strain_vec(5) ;
+thread_local Vector J2PlateFiber :: stress_vec(5) ;
+thread_local Matrix J2PlateFiber :: tangent_matrix(5,5) ;
 
 //null constructor
 J2PlateFiber ::  J2PlateFiber( ) : 
@@ -341,7 +341,7 @@ J2PlateFiber::sendSelf (int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(11+9);
+  static thread_local Vector data(11+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -375,7 +375,7 @@ J2PlateFiber::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(11+9);
+  static thread_local Vector data(11+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2Plasticity::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -93,8 +93,8 @@ class J2PlateFibre : public NDMaterial
   int parameterID;
   Matrix *SHVs;
 
-  static Vector sigma;	// Stress vector ... class-wide for returns
-  static Matrix D;		// Elastic constants
+  static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+  static thread_local Matrix D;		// Elastic constants
   Vector Tepsilon;		// Trial strains
 
   double epsPn[5];
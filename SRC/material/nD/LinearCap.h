@@ -141,8 +141,8 @@ class LinearCap : public NDMaterial {
 
 // ---  classwide variables --
 
-  static Matrix tempMatrix;
-  static Vector tempVector;
+  static thread_local Matrix tempMatrix;
+  static thread_local Vector tempVector;
 
 // ---------------------sensitivity -----------------------
 public:
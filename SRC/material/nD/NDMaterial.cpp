@@ -47,8 +47,8 @@
 #include <string.h>
 #include <api/runtimeAPI.h>
 
-Matrix NDMaterial::errMatrix(1,1);
-Vector NDMaterial::errVector(1);
+thread_local Matrix NDMaterial::errMatrix(1,1);
+thread_local Vector NDMaterial::errVector(1);
 
 
 NDMaterial::NDMaterial(int tag, int classTag)
@@ -151,6 +151,25 @@ NDMaterial::getTangent(void)
    return errMatrix;    
 }
 
+int
+NDMaterial::getFiberState(double stress[3], double tangent[9], bool initial)
+{
+  const Matrix &C = initial ? this->getInitialTangent() : this->getTangent();
+  if (C.noRows() != 3 || C.noCols() != 3)
+    return -1;
+
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      tangent[3*j+i] = C(i,j);
+
+  if (stress != nullptr) {
+    const Vector &s = this->getStress();
+    for (int i = 0; i < 3; i++)
+      stress[i] = s(i);
+  }
+  return 0;
+}
+
 #if 1
 const Vector &
 NDMaterial::getStress(void)
@@ -300,14 +319,14 @@ NDMaterial::getResponse (int responseID, Information &matInfo)
 const Vector &
 NDMaterial::getStressSensitivity(int gradIndex, bool conditional)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
 const Vector &
 NDMaterial::getStrainSensitivity(int gradIndex)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
@@ -320,21 +339,21 @@ NDMaterial::getRhoSensitivity(int gradIndex)
 const Matrix &
 NDMaterial::getDampTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getInitialTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
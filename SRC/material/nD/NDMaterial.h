@@ -76,6 +76,11 @@ class NDMaterial : // public Material
     virtual const Vector &getStress(void);
     virtual const Vector &getStrain(void);
 
+    // Fixed-size state of materials with three strain components (beam
+    // fibers); the tangent is written column major. The default copies
+    // from getStress() and getTangent().
+    virtual int getFiberState(double stress[3], double tangent[9], bool initial = false);
+
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
@@ -102,8 +107,8 @@ class NDMaterial : // public Material
   protected:
 
   private:
-    static Matrix errMatrix;
-    static Vector errVector;
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVector;
 };
 
 // extern bool OPS_addNDMaterial(NDMaterial *newComponent);
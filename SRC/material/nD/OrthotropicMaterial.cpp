@@ -104,7 +104,7 @@ OrthotropicMaterial::OrthotropicMaterial(
 	}
 
 	// compute the initial orthotropic constitutive tensor
-	static Matrix C0(6, 6);
+	static thread_local Matrix C0(6, 6);
 	C0.Zero();
 	double vyx = vxy * Ey / Ex;
 	double vzy = vyz * Ez / Ey;
@@ -128,7 +128,7 @@ OrthotropicMaterial::OrthotropicMaterial(
 		opserr << "nDMaterial Orthotropic Error: Asigma11, Asigma22, Asigma33, Asigma12, Asigma23, Asigma13 must be greater than 0.\n";
 		exit(-1);
 	}
-	static Matrix Asigma(6, 6);
+	static thread_local Matrix Asigma(6, 6);
 	Asigma.Zero();
 	Asigma(0, 0) = Asigmaxx;
 	Asigma(1, 1) = Asigmayy;
@@ -140,8 +140,8 @@ OrthotropicMaterial::OrthotropicMaterial(
 		Asigma_inv(i) = 1.0 / Asigma(i, i);
 
 	// coompute the initial isotropic constitutive tensor and its inverse
-	static Matrix C0iso(6, 6);
-	static Matrix C0iso_inv(6, 6);
+	static thread_local Matrix C0iso(6, 6);
+	static thread_local Matrix C0iso_inv(6, 6);
 	C0iso = theIsotropicMaterial->getInitialTangent();
 	int res = C0iso.Invert(C0iso_inv);
 	if (res < 0) {
@@ -150,7 +150,7 @@ OrthotropicMaterial::OrthotropicMaterial(
 	}
 
 	// compute the strain tensor map inv(C0_iso) * Asigma * C0_ortho
-	static Matrix Asigma_C0(6, 6);
+	static thread_local Matrix Asigma_C0(6, 6);
 	Asigma_C0.addMatrixProduct(0.0, Asigma, C0, 1.0);
 	Aepsilon.addMatrixProduct(0.0, C0iso_inv, Asigma_C0, 1.0);
 }
@@ -177,7 +177,7 @@ int OrthotropicMaterial::setTrialStrain(const Vector & strain)
 	epsilon = strain;
 
 	// move to isotropic space
-	static Vector eps_iso(6);
+	static thread_local Vector eps_iso(6);
 	eps_iso.addMatrixVector(0.0, Aepsilon, epsilon, 1.0);
 
 	// call isotropic material
@@ -200,7 +200,7 @@ const Vector &OrthotropicMaterial::getStress(void)
 	const Vector& sigma_iso = theIsotropicMaterial->getStress();
 
 	// move to orthotropic space
-	static Vector sigma(6);
+	static thread_local Vector sigma(6);
 	for (int i = 0; i < 6; ++i)
 		sigma(i) = Asigma_inv(i) * sigma_iso(i);
 	return sigma;
@@ -212,9 +212,9 @@ const Matrix &OrthotropicMaterial::getTangent(void)
 	const Matrix &C_iso = theIsotropicMaterial->getTangent();
 
 	// compute orthotripic tangent
-	static Matrix C(6, 6);
-	static Matrix temp(6, 6);
-	static Matrix invAsigma(6, 6);
+	static thread_local Matrix C(6, 6);
+	static thread_local Matrix temp(6, 6);
+	static thread_local Matrix invAsigma(6, 6);
 	invAsigma.Zero();
 	for (int i = 0; i < 6; ++i)
 		invAsigma(i, i) = Asigma_inv(i);
@@ -229,9 +229,9 @@ const Matrix &OrthotropicMaterial::getInitialTangent(void)
 	const Matrix& C_iso = theIsotropicMaterial->getInitialTangent();
 
 	// compute orthotripic tangent
-	static Matrix C(6, 6);
-	static Matrix temp(6, 6);
-	static Matrix invAsigma(6, 6);
+	static thread_local Matrix C(6, 6);
+	static thread_local Matrix temp(6, 6);
+	static thread_local Matrix invAsigma(6, 6);
 	invAsigma.Zero();
 	for (int i = 0; i < 6; ++i)
 		invAsigma(i, i) = Asigma_inv(i);
@@ -294,7 +294,7 @@ int OrthotropicMaterial::sendSelf(int commitTag, Channel &theChannel)
 	int res = 0;
 
 	// data
-	static Vector data(48);
+	static thread_local Vector data(48);
 	int counter = 0;
 	// store int values
 	data(counter++) = static_cast<double>(getTag());
@@ -337,7 +337,7 @@ int OrthotropicMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_Objec
 	int res = 0;
 
 	// data
-	static Vector data(48);
+	static thread_local Vector data(48);
 	int counter = 0;
 
 	// receive data
@@ -381,7 +381,7 @@ int Parallel3DMaterial::sendSelf(int commitTag, Channel &theChannel)
 	int num_mat = static_cast<int>(m_materials.size());
 
 	// send basic int data
-	static ID I1(2);
+	static thread_local ID I1(2);
 	I1(0) = getTag();
 	I1(1) = num_mat;
 	if (theChannel.sendID(getDbTag(), commitTag, I1) < 0) {
@@ -390,7 +390,7 @@ int Parallel3DMaterial::sendSelf(int commitTag, Channel &theChannel)
 	}
 
 	// send double data
-	static Vector D1;
+	static thread_local Vector D1;
 	D1.resize(num_mat*2 /*ints for mats*/ + num_mat /*floats for mats*/ + 90 /*other fixed data*/);
 	int counter = 0;
 	/*ints for mats*/
@@ -443,7 +443,7 @@ int Parallel3DMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_Object
 {
 	// receive basic int data,
 	// reset and reallocate materials and weights vectors
-	static ID I1(2);
+	static thread_local ID I1(2);
 	if (theChannel.recvID(getDbTag(), commitTag, I1) < 0) {
 		opserr << "Parallel3DMaterial::recvSelf() - failed to receive data (I1)\n";
 		return -1;
@@ -462,7 +462,7 @@ int Parallel3DMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_Object
 	m_weights.resize(static_cast<std::size_t>(num_mat), 0.0);
 
 	// receive double data
-	static Vector D1;
+	static thread_local Vector D1;
 	D1.resize(num_mat * 2 /*ints for mats*/ + num_mat /*floats for mats*/ + 90 /*other fixed data*/);
 	int counter = 0;
 	if (theChannel.recvVector(getDbTag(), commitTag, D1) < 0) {
@@ -226,23 +226,23 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
   //  opserr << "PlasticDamageConcrete3d::setTrialStrain: " << strain << endln;
 
   // bunch of Vectors and Matrices used in the method
-  static Vector Depse_tr(6);
-  static Vector Deps(6);  
-  static Vector sige_tr(6);
-  static Vector sigpos(6);
-  static Vector signeg(6);
-  static Matrix Qpos(6,6);
-  static Matrix Qneg(6,6);
-  static Vector L_tr(6);
-  static Vector L_tr_temp(6);  
-  static Vector Dnrm_Dsig(6);
-  static Vector Dlam_Dsig(6);
-  static Vector Dnrm_Deps(6);
-  static Matrix Dsigpos_Deps(6,6);
-  static Matrix Dsigneg_Deps(6,6);
-  static Vector Ddp_Deps(6);
-  static Vector Ddn_Deps(6);
-  static Matrix Cbar(6,6);
+  static thread_local Vector Depse_tr(6);
+  static thread_local Vector Deps(6);  
+  static thread_local Vector sige_tr(6);
+  static thread_local Vector sigpos(6);
+  static thread_local Vector signeg(6);
+  static thread_local Matrix Qpos(6,6);
+  static thread_local Matrix Qneg(6,6);
+  static thread_local Vector L_tr(6);
+  static thread_local Vector L_tr_temp(6);  
+  static thread_local Vector Dnrm_Dsig(6);
+  static thread_local Vector Dlam_Dsig(6);
+  static thread_local Vector Dnrm_Deps(6);
+  static thread_local Matrix Dsigpos_Deps(6,6);
+  static thread_local Matrix Dsigneg_Deps(6,6);
+  static thread_local Vector Ddp_Deps(6);
+  static thread_local Vector Ddn_Deps(6);
+  static thread_local Matrix Cbar(6,6);
 
   double f2c = 1.16*fc;
   double k = sqrt(2.0)*(f2c - fc)/(2.*f2c - fc);
@@ -310,7 +310,7 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
     
     //  Deps_p = beta*E*(L_tr'*Deps)*Depse_tr/nrm;     // plastic strain increment
     double L_trDotDeps = L_tr ^ Deps;
-    static Vector Deps_p(6);
+    static thread_local Vector Deps_p(6);
     Deps_p = Depse_tr;
     Deps_p *= beta*E*L_trDotDeps/nrm;
 
@@ -347,7 +347,7 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
 
       Dnrm_Dsig = L_tr_temp;
       Dlam_Dsig = Deps; Dlam_Dsig *= -beta*E/(nrm*nrm); // Dlam_Dsig = -beta*E/(nrm*nrm)*Deps;
-      static Vector Dlam_Deps(6);
+      static thread_local Vector Dlam_Deps(6);
       Dlam_Deps = L_tr; Dlam_Deps *= -beta*E/nrm;       // Dlam_Deps = -beta*E/nrm*L_tr;
       // Dlam_Deps = Dlam_Dnrm * Ce * Dnrm_Dsig + Ce*Dlam_Dsig + Dlam_Deps; 
       Dlam_Deps = Dlam_Dnrm * (Ce * Dnrm_Dsig) + Ce*Dlam_Dsig + Dlam_Deps;
@@ -369,7 +369,7 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
   StrsDecA(sige, sigpos, signeg, Qpos, Qneg);    // decompose the effective stress  
     
   // calculate equivalent stresses
-  static Vector tmp(6);
+  static thread_local Vector tmp(6);
   Ce.Solve(sigpos, tmp);
   double taup = sqrt(sigpos^tmp);                // positive equivalent stress
 
@@ -427,7 +427,7 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
   opserr << "Cbar: " << Cbar;
   */
   
-  static Vector s(6);
+  static thread_local Vector s(6);
   s = Idp*signeg;                    // deviatoric stress
 
   //  opserr << "Idp: " << Idp;
@@ -437,15 +437,15 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
   double nrms = sqrt( pow(s(0),2) + pow(s(1),2) + pow(s(2),2) +  
 		      2*pow(s(3),2) + 2*pow(s(4),2) + 2*pow(s(5),2));
 
-  static Vector n(6);
+  static thread_local Vector n(6);
   if (nrms <= tol) 
     n.Zero(); 
   else {
     n = s; n/=nrms;
   }
 
-  static Vector Dtaup_Dsigpos(6);
-  static Vector Dtaun_Dsigneg(6);
+  static thread_local Vector Dtaup_Dsigpos(6);
+  static thread_local Vector Dtaun_Dsigneg(6);
 
   if (taup <= tol) {
     Dtaup_Dsigpos.Zero();   //  Dtaup_Dsigpos = zeros(6,1); 
@@ -459,9 +459,9 @@ PlasticDamageConcrete3d::setTrialStrain (const Vector &strain)
   } else {
     double Dtaun_Dsigoct = pow(3,0.25) * k/2/sqrt(k*sigoct + tauoct);
     double Dtaun_Dtauoct = pow(3,0.25) /2/sqrt(k*sigoct + tauoct);
-    static Vector Dsigoct_Dsigneg(6);
+    static thread_local Vector Dsigoct_Dsigneg(6);
     Dsigoct_Dsigneg = Iv6; Dsigoct_Dsigneg/=3.;
-    static Vector Dtauoct_Dsigneg(6);
+    static thread_local Vector Dtauoct_Dsigneg(6);
     
     Dtauoct_Dsigneg = n; Dtauoct_Dsigneg/=sqrt(3.0);
     /*
@@ -637,7 +637,7 @@ PlasticDamageConcrete3d::getOrder (void) const
 int 
 PlasticDamageConcrete3d::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
 
   int res = theChannel.sendVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -652,7 +652,7 @@ int
 PlasticDamageConcrete3d::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
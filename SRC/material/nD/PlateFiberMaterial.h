@@ -115,9 +115,9 @@ class PlateFiberMaterial: public NDMaterial{
 
     Vector strain ;
 
-    static Vector stress ;
+    static thread_local Vector stress ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 } ; //end of PlateFiberMaterial declarations
 
 
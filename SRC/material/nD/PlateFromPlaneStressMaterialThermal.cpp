@@ -40,8 +40,8 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 #include <MaterialResponse.h>
 
 //static vector and matrices
-Vector  PlateFromPlaneStressMaterialThermal::stress(5) ;
-Matrix  PlateFromPlaneStressMaterialThermal::tangent(5,5) ;
+thread_local Vector  PlateFromPlaneStressMaterialThermal::stress(5) ;
+thread_local Matrix  PlateFromPlaneStressMaterialThermal::tangent(5,5) ;
 
 //null constructor
 PlateFromPlaneStressMaterialThermal::PlateFromPlaneStressMaterialThermal( ) : 
@@ -153,7 +153,7 @@ PlateFromPlaneStressMaterialThermal::setTrialStrain( const Vector &strainFromEle
   strain(3) = strainFromElement(3) ;
   strain(4) = strainFromElement(4) ;
 
-  static Vector PSStrain(3) ;
+  static thread_local Vector PSStrain(3) ;
   
   PSStrain(0) = strain(0);
   PSStrain(1) = strain(1);
@@ -257,7 +257,7 @@ PlateFromPlaneStressMaterialThermal::sendSelf(int commitTag, Channel &theChannel
 
   int matDbTag;
   
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = dataTag;
   idData(1) = theMat->getClassTag();
   matDbTag = theMat->getDbTag();
@@ -273,7 +273,7 @@ PlateFromPlaneStressMaterialThermal::sendSelf(int commitTag, Channel &theChannel
     return res;
   }
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   vecData(0) = gmod;
 
   res = theChannel.sendVector(dataTag, commitTag, vecData);
@@ -298,7 +298,7 @@ PlateFromPlaneStressMaterialThermal::recvSelf(int commitTag, Channel &theChannel
   int dataTag = this->getDbTag();
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "PlateFromPlaneStressMaterialThermal::sendSelf() - failed to receive id data" << endln;
@@ -317,7 +317,7 @@ PlateFromPlaneStressMaterialThermal::recvSelf(int commitTag, Channel &theChannel
   }
   theMat->setDbTag(idData(2));
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   res = theChannel.recvVector(dataTag, commitTag, vecData);
   if (res < 0) {
     opserr << "PlateFromPlaneStressMaterialThermal::sendSelf() - failed to receive vector data" << endln;
@@ -346,7 +346,7 @@ const Vector&
 PlateFromPlaneStressMaterialThermal::getTempAndElong()
 {
 	//return theMaterial->getTempAndElong( );
-   static Vector returnedVec = Vector(2);
+   static thread_local Vector returnedVec = Vector(2);
 	returnedVec(0)= theMat->getTempAndElong( )(0);
 	returnedVec(1) = theMat->getTempAndElong( )(1);
 	return returnedVec;
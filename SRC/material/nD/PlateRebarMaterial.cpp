@@ -39,8 +39,8 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 #include <elementAPI.h>
 
 //static vector and matrices
-Vector  PlateRebarMaterial::stress(5) ;
-Matrix  PlateRebarMaterial::tangent(5,5) ;
+thread_local Vector  PlateRebarMaterial::stress(5) ;
+thread_local Matrix  PlateRebarMaterial::tangent(5,5) ;
 
 //null constructor
 PlateRebarMaterial::PlateRebarMaterial( ) : 
@@ -319,7 +319,7 @@ PlateRebarMaterial::sendSelf(int commitTag, Channel &theChannel)
 
   int matDbTag;
   
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = dataTag;
   idData(1) = theMat->getClassTag();
   matDbTag = theMat->getDbTag();
@@ -335,7 +335,7 @@ PlateRebarMaterial::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   vecData(0) = angle;
 
   res = theChannel.sendVector(dataTag, commitTag, vecData);
@@ -360,7 +360,7 @@ PlateRebarMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroke
   int dataTag = this->getDbTag();
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "PlateRebarMaterial::sendSelf() - failed to receive id data" << endln;
@@ -379,7 +379,7 @@ PlateRebarMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroke
   }
   theMat->setDbTag(idData(2));
 
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   res = theChannel.recvVector(dataTag, commitTag, vecData);
   if (res < 0) {
     opserr << "PlateRebarMaterial::sendSelf() - failed to receive vector data" << endln;
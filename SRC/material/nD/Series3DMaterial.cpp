@@ -344,8 +344,8 @@ Series3DMaterial::Series3DMaterial(
 	}
 
 	// compute initial tangent here and also the sabilization term
-	static Matrix iCinv(6, 6);
-	static Matrix Cinv(6, 6);
+	static thread_local Matrix iCinv(6, 6);
+	static thread_local Matrix Cinv(6, 6);
 	Cinv.Zero();
 	for (std::size_t i = 0; i < m_materials.size(); ++i) {
 		const Matrix& iC = m_materials[i]->getInitialTangent();
@@ -556,7 +556,7 @@ int Series3DMaterial::sendSelf(int commitTag, Channel &theChannel)
 	int num_mat = static_cast<int>(m_materials.size());
 
 	// send basic int data
-	static ID I1(4);
+	static thread_local ID I1(4);
 	I1(0) = getTag();
 	I1(1) = num_mat;
 	I1(2) = m_max_iter;
@@ -567,7 +567,7 @@ int Series3DMaterial::sendSelf(int commitTag, Channel &theChannel)
 	}
 
 	// send double data
-	static Vector D1;
+	static thread_local Vector D1;
 	D1.resize(num_mat*2 /*ints for mats*/ + num_mat * 7 /*floats for mats*/ + 111 /*other fixed data*/);
 	int counter = 0;
 	/*ints for mats*/
@@ -632,7 +632,7 @@ int Series3DMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_ObjectBr
 {
 	// receive basic int data,
 	// reset and reallocate materials and weights vectors
-	static ID I1(4);
+	static thread_local ID I1(4);
 	if (theChannel.recvID(getDbTag(), commitTag, I1) < 0) {
 		opserr << "Series3DMaterial::recvSelf() - failed to receive data (I1)\n";
 		return -1;
@@ -654,7 +654,7 @@ int Series3DMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_ObjectBr
 	m_mat_strain_commit.resize(static_cast<std::size_t>(num_mat), Vector(6));
 
 	// receive double data
-	static Vector D1;
+	static thread_local Vector D1;
 	D1.resize(num_mat * 2 /*ints for mats*/ + num_mat * 7 /*floats for mats*/ + 111 /*other fixed data*/);
 	int counter = 0;
 	if (theChannel.recvVector(getDbTag(), commitTag, D1) < 0) {
@@ -920,8 +920,8 @@ double Series3DMaterial::computeResidualNorm()
 	- g is the homogenized strain;
 	*/
 
-	static Vector NR2(6);
-	static Vector NRtemp(6);
+	static thread_local Vector NR2(6);
+	static thread_local Vector NRtemp(6);
 
 	double NR1 = 0.0;
 	NR2 = m_strain;
@@ -951,9 +951,9 @@ const Matrix& Series3DMaterial::computeDenominator(IterativeTangentType ittype)
 	D: SUM_i(wi * MULT_j(kj, j!=i))
 	*/
 
-	static Matrix D(6, 6);
-	static Matrix Di(6, 6);
-	static Matrix DiTemp(6, 6);
+	static thread_local Matrix D(6, 6);
+	static thread_local Matrix Di(6, 6);
+	static thread_local Matrix DiTemp(6, 6);
 
 	D.Zero();
 	for (std::size_t i = 0; i < m_materials.size(); ++i) {
@@ -989,7 +989,7 @@ const Vector& Series3DMaterial::computeWeightedStrainResidual()
 	- g is the homogenized strain;
 	*/
 
-	static Vector ewg(6);
+	static thread_local Vector ewg(6);
 
 	ewg.addVector(0.0, m_strain, -1.0);
 	for(std::size_t i = 0; i < m_materials.size(); ++i) {
@@ -1017,15 +1017,15 @@ bool Series3DMaterial::solveForLagrangeMultipliers(
 	- g is the homogenized strain;
 	*/
 
-	static Matrix A(6, 6);
-	static Matrix ATemp(6, 6);
-	static Vector B(6);
-	static Matrix Bi(6, 6);
-	static Matrix BiTemp(6, 6);
-	static Vector lsi(6);
-	static Vector Blsi(6);
-	static Vector Aewg(6);
-	static Vector dLambda(6);
+	static thread_local Matrix A(6, 6);
+	static thread_local Matrix ATemp(6, 6);
+	static thread_local Vector B(6);
+	static thread_local Matrix Bi(6, 6);
+	static thread_local Matrix BiTemp(6, 6);
+	static thread_local Vector lsi(6);
+	static thread_local Vector Blsi(6);
+	static thread_local Vector Aewg(6);
+	static thread_local Vector dLambda(6);
 
 	A.Zero();
 	for (int q = 0; q < 6; ++q)
@@ -1102,13 +1102,13 @@ bool Series3DMaterial::solveForStrainVectors(
 		dStrain_vector.resize(m_materials.size(), Vector(6));
 
 	// other static variables
-	static Matrix A(6, 6);
-	static Vector B(6);
-	static Matrix C(6, 6);
-	static Matrix KKq(6, 6);
-	static Vector lsi(6);
-	static Vector lsj(6);
-	static Matrix auxM(6, 6);
+	static thread_local Matrix A(6, 6);
+	static thread_local Vector B(6);
+	static thread_local Matrix C(6, 6);
+	static thread_local Matrix KKq(6, 6);
+	static thread_local Vector lsi(6);
+	static thread_local Vector lsj(6);
+	static thread_local Matrix auxM(6, 6);
 
 	// for each material, compute and store the strain correction dStrain
 	for (std::size_t i = 0; i < m_materials.size(); ++i) {
@@ -1161,7 +1161,7 @@ bool Series3DMaterial::solveForStrainVectors(
 	solveForLagrangeMultipliers(ewg, ittype, solver);
 
 	// now we can update each material
-	static Vector strain_new(6);
+	static thread_local Vector strain_new(6);
 	for (std::size_t i = 0; i < m_materials.size(); ++i) {
 		NDMaterial* imaterial = m_materials[i];
 		strain_new = imaterial->getStrain();
@@ -1176,7 +1176,7 @@ bool Series3DMaterial::solveForStrainVectors(
 
 const Matrix& Series3DMaterial::getMaterialTangent(NDMaterial* mat, IterativeTangentType ittype) const
 {
-	static Matrix Kaux(6, 6);
+	static thread_local Matrix Kaux(6, 6);
 	if (ittype == Series3DMaterial::IT_Initial) {
 		return mat->getInitialTangent();
 	}
@@ -1192,8 +1192,8 @@ const Matrix& Series3DMaterial::getMaterialTangent(NDMaterial* mat, IterativeTan
 
 void Series3DMaterial::computeHomogenizedTangent(IterativeTangentType ittype)
 {
-	static Matrix iCinv(6, 6);
-	static Matrix Cinv(6, 6);
+	static thread_local Matrix iCinv(6, 6);
+	static thread_local Matrix Cinv(6, 6);
 	bool done;
 
 	if (ittype == IT_Tangent) {
@@ -15,8 +15,8 @@
 #include <MaterialResponse.h>
 #include <Parameter.h>
 
-Matrix SimplifiedJ2::tmpMatrix(6,6);
-Vector SimplifiedJ2::tmpVector(6);
+thread_local Matrix SimplifiedJ2::tmpMatrix(6,6);
+thread_local Vector SimplifiedJ2::tmpVector(6);
 
 // --- element: eps(1,1),eps(2,2),eps(3,3),2*eps(1,2),2*eps(2,3),2*eps(1,3) ----
 // --- material strain: eps(1,1),eps(2,2),eps(3,3),eps(1,2),eps(2,3),eps(1,3) , same sign ----
@@ -425,7 +425,7 @@ const Matrix & SimplifiedJ2::getTangent (void){
 	if (ndm ==3)
 	     return theTangent; 
 	else{
-		static Matrix workM(3,3);
+		static thread_local Matrix workM(3,3);
 		workM(0,0) = theTangent(0,0);
 		workM(0,1) = theTangent(0,1);
 		workM(0,2) = theTangent(0,3);
@@ -523,7 +523,7 @@ NDMaterial * SimplifiedJ2::getCopy (const char *code)
 
 int SimplifiedJ2::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(7+6+6+6+6+1);
+  static thread_local Vector data(7+6+6+6+6+1);
   data(0) = this->getTag();
   data(1) = ndm;
   data(2) = G;
@@ -551,7 +551,7 @@ int SimplifiedJ2::sendSelf(int commitTag, Channel &theChannel)
 
 int SimplifiedJ2::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static Vector data(7+6+6+6+6+1);
+  static thread_local Vector data(7+6+6+6+6+1);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "SimplifiedJ2::recvSelf - failed to recv vector from channel\n";
     return -1;
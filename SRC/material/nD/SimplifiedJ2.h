@@ -119,8 +119,8 @@ class SimplifiedJ2 : public NDMaterial
   
   // ---  define classwide variables
   
-  static Vector tmpVector;
-  static Matrix tmpMatrix;
+  static thread_local Vector tmpVector;
+  static thread_local Matrix tmpMatrix;
 };
 
 #endif
@@ -2139,8 +2139,8 @@ SAniSandMS::GetElastoPlasticTangent(const Vector& NextStress, const double& Next
 Vector
 SAniSandMS::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-	static Vector devStress(6);
-	static Vector n(6);
+	static thread_local Vector devStress(6);
+	static thread_local Vector n(6);
 	devStress.Zero();
 	n.Zero();
 	devStress = GetDevPart(stress);
@@ -2406,7 +2406,7 @@ SAniSandMS::GetDevPart(const Vector& aV)
 	if (aV.Size() != 6)
 		opserr << "\n ERROR! SAniSandMS::GetDevPart requires vector of size(6)!" << endln;
 
-	static Vector result(6); result.Zero();
+	static thread_local Vector result(6); result.Zero();
 
 	double p = GetTrace(aV);
 	result = aV;
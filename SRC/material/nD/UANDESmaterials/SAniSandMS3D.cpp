@@ -24,9 +24,9 @@
 
 #include "SAniSandMS3D.h"
 
-Vector SAniSandMS3D::mEpsilon_M(6);
-Vector SAniSandMS3D::mEpsilonE_M(6);
-Vector SAniSandMS3D::mSigma_M(6);
+thread_local Vector SAniSandMS3D::mEpsilon_M(6);
+thread_local Vector SAniSandMS3D::mEpsilonE_M(6);
+thread_local Vector SAniSandMS3D::mSigma_M(6);
 
 // full constructor
 SAniSandMS3D::SAniSandMS3D(int tag, double G0, double nu, double e_init, double Mc, double c, double lambda_c, double e0, double ksi,
@@ -76,9 +76,9 @@ class SAniSandMS3D : public SAniSandMS
 
   private :
 
-  static Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
-  static Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
-  static Vector mEpsilonE_M; // mEpsilon with continuum mechanic sign convention
+  static thread_local Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
+  static thread_local Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
+  static thread_local Vector mEpsilonE_M; // mEpsilon with continuum mechanic sign convention
 
 
 };
@@ -24,12 +24,12 @@
 
 #include "SAniSandMSPlaneStrain.h"
 
-Vector SAniSandMSPlaneStrain::mEpsilon_M(3);
-Vector SAniSandMSPlaneStrain::mEpsilonE_M(3);
-Vector SAniSandMSPlaneStrain::mSigma_M(3);
-Vector SAniSandMSPlaneStrain::rSigma(4);
-Matrix SAniSandMSPlaneStrain::mTangent(3,3);
-Matrix SAniSandMSPlaneStrain::mTangent_init(3,3);
+thread_local Vector SAniSandMSPlaneStrain::mEpsilon_M(3);
+thread_local Vector SAniSandMSPlaneStrain::mEpsilonE_M(3);
+thread_local Vector SAniSandMSPlaneStrain::mSigma_M(3);
+thread_local Vector SAniSandMSPlaneStrain::rSigma(4);
+thread_local Matrix SAniSandMSPlaneStrain::mTangent(3,3);
+thread_local Matrix SAniSandMSPlaneStrain::mTangent_init(3,3);
 
 // full constructor
 SAniSandMSPlaneStrain::SAniSandMSPlaneStrain(int tag, double G0, double nu, double e_init, double Mc, double c, double lambda_c, double e0, double ksi,
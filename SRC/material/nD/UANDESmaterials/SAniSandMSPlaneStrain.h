@@ -79,12 +79,12 @@ class SAniSandMSPlaneStrain : public SAniSandMS
   private :
 
   // static vectors and matrices
-  static Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
-  static Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
-  static Vector mEpsilonE_M; // mEpsilon with continuum mechanic sign convention
-  static Vector rSigma;     // Stress for the recorders
-  static Matrix mTangent;
-  static Matrix mTangent_init;
+  static thread_local Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
+  static thread_local Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
+  static thread_local Vector mEpsilonE_M; // mEpsilon with continuum mechanic sign convention
+  static thread_local Vector rSigma;     // Stress for the recorders
+  static thread_local Matrix mTangent;
+  static thread_local Matrix mTangent_init;
 
 };
 
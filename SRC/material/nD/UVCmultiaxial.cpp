@@ -629,7 +629,7 @@ NDMaterial* UVCmultiaxial::getCopy(const char* code) {
 int UVCmultiaxial::sendSelf(int commitTag, Channel& theChannel) {
 
   /*
-  static Vector data(26);  // enough space for 4 backstresses
+  static thread_local Vector data(26);  // enough space for 4 backstresses
   // Material properties
   data(0) = elasticModulus;
   data(1) = initialYield;
@@ -681,7 +681,7 @@ int UVCmultiaxial::sendSelf(int commitTag, Channel& theChannel) {
 int UVCmultiaxial::recvSelf(int commitTag, Channel& theChannel,
   FEM_ObjectBroker& theBroker) {
   /*
-  static Vector data(26);
+  static thread_local Vector data(26);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
   opserr << "UVCmultiaxial::recvSelf() - failed to recvSelf\n";
@@ -667,7 +667,7 @@ NDMaterial* UVCplanestress::getCopy(const char* code) {
 int UVCplanestress::sendSelf(int commitTag, Channel& theChannel) {
 
   /*
-  static Vector data(26);  // enough space for 4 backstresses
+  static thread_local Vector data(26);  // enough space for 4 backstresses
   // Material properties
   data(0) = elasticModulus;
   data(1) = initialYield;
@@ -719,7 +719,7 @@ int UVCplanestress::sendSelf(int commitTag, Channel& theChannel) {
 int UVCplanestress::recvSelf(int commitTag, Channel& theChannel,
   FEM_ObjectBroker& theBroker) {
   /*
-  static Vector data(26);
+  static thread_local Vector data(26);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
   opserr << "UVCplanestress::recvSelf() - failed to recvSelf\n";
@@ -1070,7 +1070,7 @@ BoundingCamClay::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(8);
+  static thread_local Vector data(8);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = iC;
@@ -1099,7 +1099,7 @@ BoundingCamClay::recvSelf(int commitTag, Channel &theChannel,
                                          FEM_ObjectBroker &theBroker)    
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(7);
+  static thread_local Vector data(7);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "BoundingCamClay::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -26,9 +26,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector BoundingCamClayPlaneStrain::strain(3);
-Vector BoundingCamClayPlaneStrain::stress(3);
-Matrix BoundingCamClayPlaneStrain::tangent(3,3);
+thread_local Vector BoundingCamClayPlaneStrain::strain(3);
+thread_local Vector BoundingCamClayPlaneStrain::stress(3);
+thread_local Matrix BoundingCamClayPlaneStrain::tangent(3,3);
 
 //null constructor
 BoundingCamClayPlaneStrain::BoundingCamClayPlaneStrain() : 
@@ -68,9 +68,9 @@ class BoundingCamClayPlaneStrain : public BoundingCamClay {
   private :
 
   // static vectors and matrices
-  static Vector strain;
-  static Vector stress;
-  static Matrix tangent;
+  static thread_local Vector strain;
+  static thread_local Vector stress;
+  static thread_local Matrix tangent;
 
 
 };
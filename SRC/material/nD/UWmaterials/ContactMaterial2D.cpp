@@ -434,7 +434,7 @@ int ContactMaterial2D::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(6);
+  static thread_local Vector data(6);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = frictionCoeff;
@@ -459,7 +459,7 @@ int ContactMaterial2D::recvSelf(int commitTag, Channel &theChannel,
                      FEM_ObjectBroker &theBroker)    
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(5);
+  static thread_local Vector data(5);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "ContactMaterial2D::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -848,7 +848,7 @@ int DruckerPrager::sendSelf(int commitTag, Channel &theChannel)
 	int res = 0;
 
     // place data in a vector
-	static Vector data(45);
+	static thread_local Vector data(45);
 	data(0) = this->getTag();
     data(1)  = mKref;
     data(2)  = mGref;
@@ -913,7 +913,7 @@ int DruckerPrager::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 	int res = 0;
 
 	// receive data
-	static Vector data(45);
+	static thread_local Vector data(45);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
 		opserr << "WARNING: DruckerPrager::recvSelf - failed to receive vector from channel" << endln;
@@ -236,7 +236,7 @@ InitialStateAnalysisWrapper::sendSelf(int commitTag, Channel &theChannel)
   int res;
   int dataTag = this->getDbTag();
   
-  static ID data(4);
+  static thread_local ID data(4);
   data(0) = this->getTag();
   data(1) = theMainMaterial->getClassTag();
   
@@ -287,7 +287,7 @@ InitialStateAnalysisWrapper::recvSelf(int commitTag, Channel &theChannel, FEM_Ob
   int dataTag = this->getDbTag();
   
   
-  static ID data(4);
+  static thread_local ID data(4);
   res = theChannel.recvID(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING InitialStateAnalysisWrapper::recvSelf() - failed to receive Vector\n";
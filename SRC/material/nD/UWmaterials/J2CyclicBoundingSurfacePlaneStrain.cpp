@@ -28,9 +28,9 @@
 #include "J2CyclicBoundingSurfacePlaneStrain.h"
 
 //static vectors and matrices
-Vector J2CyclicBoundingSurfacePlaneStrain::strain(3);
-Vector J2CyclicBoundingSurfacePlaneStrain::stress(3);
-Matrix J2CyclicBoundingSurfacePlaneStrain::tangent(3, 3);
+thread_local Vector J2CyclicBoundingSurfacePlaneStrain::strain(3);
+thread_local Vector J2CyclicBoundingSurfacePlaneStrain::stress(3);
+thread_local Matrix J2CyclicBoundingSurfacePlaneStrain::tangent(3, 3);
 
 // full constructor
 J2CyclicBoundingSurfacePlaneStrain::J2CyclicBoundingSurfacePlaneStrain(int tag, double G, double K, double su, double rho, double h, double m, double h0, double chi, double beta)
@@ -73,9 +73,9 @@ class J2CyclicBoundingSurfacePlaneStrain : public J2CyclicBoundingSurface
   private :
 
   // static vectors and matrices
-  static Vector strain;
-  static Vector stress;
-  static Matrix tangent;
+  static thread_local Vector strain;
+  static thread_local Vector stress;
+  static thread_local Matrix tangent;
 };
 
 #endif
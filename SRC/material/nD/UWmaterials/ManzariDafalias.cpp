@@ -531,7 +531,7 @@ ManzariDafalias::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
 
     // place data in a vector
-    static Vector data(97);
+    static thread_local Vector data(97);
 
     data(0) = this->getTag();
 
@@ -607,7 +607,7 @@ ManzariDafalias::recvSelf(int commitTag, Channel &theChannel,
     int res = 0;
 
     // receive data
-    static Vector data(97);
+    static thread_local Vector data(97);
     res = theChannel.recvVector(this->getDbTag(), commitTag, data);
     if (res < 0) {
         opserr << "WARNING: ManzariDafalias::recvSelf - failed to receive vector from channel" << endln;
@@ -1712,7 +1712,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
-    static bool do_once = true;
+    static thread_local bool do_once = true;
 
     if (do_once) {
         opserr << 
@@ -1727,14 +1727,14 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
     double temp4, q;
 
     //Static allocation so we can avoid mallocs and get maximum speed. This is not thread-safe
-    static Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
-    static Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
-    static Vector dSigma1(6), dSigma2(6), dSigma3(6), dSigma4(6), dSigma5(6), dSigma6(6), dSigma(6), 
+    static thread_local Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
+    static thread_local Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
+    static thread_local Vector dSigma1(6), dSigma2(6), dSigma3(6), dSigma4(6), dSigma5(6), dSigma6(6), dSigma(6), 
         dAlpha1(6), dAlpha2(6), dAlpha3(6), dAlpha4(6), dAlpha5(6), dAlpha6(6), dAlpha(6), 
         dFabric1(6), dFabric2(6), dFabric3(6), dFabric4(6), dFabric5(6), dFabric6(6), dFabric(6),
         dPStrain1(6), dPStrain2(6), dPStrain3(6), dPStrain4(6), dPStrain5(6), dPStrain6(6), dPStrain(6);
-    static Matrix aCep1(6,6), aCep2(6,6), aCep3(6,6), aCep4(6,6), aCep5(6,6), aCep6(6,6), aCep_thisStep(6,6), aD(6,6);
-    static Vector thisSigma(6), thisAlpha(6), thisFabric(6);    
+    static thread_local Matrix aCep1(6,6), aCep2(6,6), aCep3(6,6), aCep4(6,6), aCep5(6,6), aCep6(6,6), aCep_thisStep(6,6), aD(6,6);
+    static thread_local Vector thisSigma(6), thisAlpha(6), thisFabric(6);    
     
     // Zero everything out for good measure. 
     n.Zero(); d.Zero(); b.Zero(); R.Zero(); dDevStrain.Zero(); r.Zero();
@@ -2592,13 +2592,13 @@ ManzariDafalias::NewtonIter(const Vector& xo, const Vector& inVar, Vector& x, Ma
     bool jacoFlag = true;
     Matrix (ManzariDafalias::*jacoFunc)(const Vector&, const Vector&);
     // Declare variables to be used
-    static Vector sol(ResSize);
-    static Vector R(ResSize), R2(ResSize);
-    static Vector dX(ResSize);
-    static Vector norms(ResSize+1);
-	static Vector aux;
-    static Matrix jaco(ResSize,ResSize);
-    static Matrix jInv(ResSize,ResSize);
+    static thread_local Vector sol(ResSize);
+    static thread_local Vector R(ResSize), R2(ResSize);
+    static thread_local Vector dX(ResSize);
+    static thread_local Vector norms(ResSize+1);
+	static thread_local Vector aux;
+    static thread_local Matrix jaco(ResSize,ResSize);
+    static thread_local Matrix jInv(ResSize,ResSize);
     double normR1, alpha;
     double aNormR1, aNormR2;
 
@@ -5166,7 +5166,7 @@ const Vector&
 ManzariDafalias::getPStrain() 
 {
     opserr << "ManzariDafalias::getPStrain - base class function called. This is an error\n ";
-    static Vector result(6);
+    static thread_local Vector result(6);
     result = mEpsilon - mEpsilonE;
     return result; 
 } 
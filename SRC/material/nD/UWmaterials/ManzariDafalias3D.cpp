@@ -24,8 +24,8 @@
 
 #include "ManzariDafalias3D.h"
 
-Vector ManzariDafalias3D::mEpsilon_M(6);
-Vector ManzariDafalias3D::mSigma_M(6);
+thread_local Vector ManzariDafalias3D::mEpsilon_M(6);
+thread_local Vector ManzariDafalias3D::mSigma_M(6);
 
 // full constructor
 ManzariDafalias3D::ManzariDafalias3D(int tag, double G0, double nu, double e_init, double Mc, double c, double lambda_c, double e0, double ksi,
@@ -75,8 +75,8 @@ class ManzariDafalias3D : public ManzariDafalias
 
   private :
 
-  static Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
-  static Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
+  static thread_local Vector mSigma_M  ; // mSigma with continuum mechanic sign convention
+  static thread_local Vector mEpsilon_M; // mEpsilon with continuum mechanic sign convention
 
 };
 
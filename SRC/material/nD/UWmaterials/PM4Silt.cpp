@@ -540,7 +540,7 @@ PM4Silt::sendSelf(int commitTag, Channel &theChannel)
 {
 
 	int res = 0;
-	static Vector data(105);
+	static thread_local Vector data(105);
 
 	data(0) = this->getTag();
 
@@ -628,7 +628,7 @@ PM4Silt::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(105);
+	static thread_local Vector data(105);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
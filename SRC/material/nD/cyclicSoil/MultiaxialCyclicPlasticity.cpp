@@ -92,7 +92,7 @@ const double MultiaxialCyclicPlasticity :: four3  = 4.0 / 3.0 ;
 const double MultiaxialCyclicPlasticity :: root23 = sqrt( 2.0 / 3.0 ) ;
 const double MultiaxialCyclicPlasticity :: infinity  = 1.0e12;
 
-double MultiaxialCyclicPlasticity::initialTangent[3][3][3][3] ;   //material tangent
+thread_local double MultiaxialCyclicPlasticity::initialTangent[3][3][3][3] ;   //material tangent
 double MultiaxialCyclicPlasticity::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 double MultiaxialCyclicPlasticity::IbunI[3][3][3][3] ; //rank 4 I bun I 
 
@@ -483,9 +483,9 @@ void MultiaxialCyclicPlasticity :: Print( OPS_Stream &s, int flag )
 
 void MultiaxialCyclicPlasticity :: elastic_integrator( )
 {
-  static Matrix dev_strain(3,3) ; //deviatoric strain  
+  static thread_local Matrix dev_strain(3,3) ; //deviatoric strain  
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  static thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
   // add
   double pressure;                // 1/3 trace(stress) 
@@ -515,11 +515,11 @@ void MultiaxialCyclicPlasticity :: elastic_integrator( )
   pressure  *= bulk_K0 ;						 
   }
 
-  static Matrix IncrStrain(3,3);
+  static thread_local Matrix IncrStrain(3,3);
 
-  static Matrix DevStress_n(3,3);
+  static thread_local Matrix DevStress_n(3,3);
 
-  static double pressure_n;
+  static thread_local double pressure_n;
 
   if (IncrFormulationFlag==1){
    
@@ -746,7 +746,7 @@ MultiaxialCyclicPlasticity::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10); 
+  static thread_local Vector data(10); 
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = density;   //add
@@ -774,7 +774,7 @@ MultiaxialCyclicPlasticity::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10);
+  static thread_local Vector data(10);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "MultiaxialCyclicPlasticity::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -826,33 +826,33 @@ void MultiaxialCyclicPlasticity::plastic_integrator()
 
   // toleraces
 
-  static double ZERO      = 1.0e-16; 
+  static thread_local double ZERO      = 1.0e-16; 
 
-  static double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
-  static double tolforload= 1.0e-10;     // tol to determine loading/unloading
-  static double tolforX   = 1.0e-6;;       // tol for compute norm g1g2 in iteration X[1], X[2]
+  static thread_local double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
+  static thread_local double tolforload= 1.0e-10;     // tol to determine loading/unloading
+  static thread_local double tolforX   = 1.0e-6;;       // tol for compute norm g1g2 in iteration X[1], X[2]
   
   double twomu; 
   int ii,jj;              // for loop iterators
   int i,j,k,l;
 
-  static Matrix de(3,3) ;   //incremental deviatoric strain  
-  static Matrix  s(3,3) ;   //deviatoric stress
+  static thread_local Matrix de(3,3) ;   //incremental deviatoric strain  
+  static thread_local Matrix  s(3,3) ;   //deviatoric stress
  // add
-  static double p;          // pressure, 1/3 trace(stress) 
-  static double e;          // incr. vol.strain, trace(incremental strains)
+  static thread_local double p;          // pressure, 1/3 trace(stress) 
+  static thread_local double e;          // incr. vol.strain, trace(incremental strains)
 
-  static Matrix IncrStrain(3,3); // Frank let all Matrix be static
-  static Matrix s_n(3,3);        // dev. stress at t_n 
-  static double p_n;             // pressure at t_n
+  static thread_local Matrix IncrStrain(3,3); // Frank let all Matrix be static
+  static thread_local Matrix s_n(3,3);        // dev. stress at t_n 
+  static thread_local double p_n;             // pressure at t_n
   //static Matrix soinit(3,3);   // save s0_n here
   double normchi=0;
-  static Matrix strial(3,3);
-  static Matrix chitri(3,3);
-  static Matrix alpha_n(3,3); // backstress of loading surface at t_n
-  static double  Psi_split; // Psi for strain split step
-  static Matrix temp6(3,3);
-  static double dottemp6;
+  static thread_local Matrix strial(3,3);
+  static thread_local Matrix chitri(3,3);
+  static thread_local Matrix alpha_n(3,3); // backstress of loading surface at t_n
+  static thread_local double  Psi_split; // Psi for strain split step
+  static thread_local Matrix temp6(3,3);
+  static thread_local double dottemp6;
   double norm = 0;
 	
   double Hn =0;
@@ -1750,7 +1750,7 @@ LABEL10:
 }  // end of this subroutine
 
 
-Vector MultiaxialCyclicPlasticity::MCPparameter(10) ;
+thread_local Vector MultiaxialCyclicPlasticity::MCPparameter(10) ;
 
 
 
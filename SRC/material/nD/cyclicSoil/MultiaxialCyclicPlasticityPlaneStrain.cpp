@@ -33,9 +33,9 @@
 #include  <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector MultiaxialCyclicPlasticityPlaneStrain :: strain_vec(3) ;
-Vector MultiaxialCyclicPlasticityPlaneStrain :: stress_vec(3) ;
-Matrix MultiaxialCyclicPlasticityPlaneStrain :: tangent_matrix(3,3) ;
+thread_local Vector MultiaxialCyclicPlasticityPlaneStrain :: strain_vec(3) ;
+thread_local Vector MultiaxialCyclicPlasticityPlaneStrain :: stress_vec(3) ;
+thread_local Matrix MultiaxialCyclicPlasticityPlaneStrain :: tangent_matrix(3,3) ;
 
 
 //null constructor
@@ -136,7 +136,7 @@ int MultiaxialCyclicPlasticityPlaneStrain :: setTrialStrain( const Vector &v, co
 
 int MultiaxialCyclicPlasticityPlaneStrain :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(3);
+  static thread_local Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -150,7 +150,7 @@ int MultiaxialCyclicPlasticityPlaneStrain :: setTrialStrainIncr( const Vector &v
 {
  
    // implemented April. 4, 2004, Gang Wang
-	static Vector newStrain(3);
+	static thread_local Vector newStrain(3);
 	newStrain(0) = strain(0,0) + v(0);
 	newStrain(1) = strain(1,1) + v(1);
  	newStrain(2) = 2.0*strain(0,1) + v(2);
@@ -114,9 +114,9 @@ class MultiaxialCyclicPlasticityPlaneStrain : public MultiaxialCyclicPlasticity
   private :
     
   //static vectors and matrices
-  static Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  static thread_local Vector strain_vec ;     //strain in vector notation
+  static thread_local Vector stress_vec ;     //stress in vector notation
+  static thread_local Matrix tangent_matrix ; //material tangent in matrix notation
 } ; 
 
 //end of MultiaxialCyclicPlasticityPlaneStrain declarations
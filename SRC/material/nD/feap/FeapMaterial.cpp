@@ -39,20 +39,20 @@
 #include <float.h>
 
 double FeapMaterial::d[200];
-double FeapMaterial::sig[6];
-double FeapMaterial::dd[36];
+thread_local double FeapMaterial::sig[6];
+thread_local double FeapMaterial::dd[36];
 
-Vector FeapMaterial::strain3(3);
-Vector FeapMaterial::strain4(4);
-Vector FeapMaterial::strain6(6);
+thread_local Vector FeapMaterial::strain3(3);
+thread_local Vector FeapMaterial::strain4(4);
+thread_local Vector FeapMaterial::strain6(6);
 
-Vector FeapMaterial::sigma3(3);
-Vector FeapMaterial::sigma4(4);
-Vector FeapMaterial::sigma6(sig,6);
+thread_local Vector FeapMaterial::sigma3(3);
+thread_local Vector FeapMaterial::sigma4(4);
+thread_local Vector FeapMaterial::sigma6(sig,6);
 
-Matrix FeapMaterial::tangent3(3,3);
-Matrix FeapMaterial::tangent4(4,4);
-Matrix FeapMaterial::tangent6(dd,6,6);
+thread_local Matrix FeapMaterial::tangent3(3,3);
+thread_local Matrix FeapMaterial::tangent4(4,4);
+thread_local Matrix FeapMaterial::tangent6(dd,6,6);
 
 FeapMaterial::FeapMaterial(int tag, int classTag, int nhv, int ndata, double r)
   :NDMaterial(tag,classTag), ud(0), hstv(0), rho(r),
@@ -361,7 +361,7 @@ FeapMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static ID idData(4);
+  static thread_local ID idData(4);
   
   idData(0) = this->getTag();
   idData(1) = numHV;
@@ -396,7 +396,7 @@ FeapMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static ID idData(4);
+  static thread_local ID idData(4);
   
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -81,20 +81,20 @@ class FeapMaterial : public NDMaterial
   int numData;		// Number of material parameters
   
   double eps[6];        // Strain vector
-  static double sig[6]; // Stress vector
-  static double dd[36]; // Tangent matrix
+  static thread_local double sig[6]; // Stress vector
+  static thread_local double dd[36]; // Tangent matrix
   
-  static Vector strain3;
-  static Vector strain4;
-  static Vector strain6;
+  static thread_local Vector strain3;
+  static thread_local Vector strain4;
+  static thread_local Vector strain6;
   
-  static Vector sigma3;
-  static Vector sigma4;
-  static Vector sigma6;
+  static thread_local Vector sigma3;
+  static thread_local Vector sigma4;
+  static thread_local Vector sigma6;
   
-  static Matrix tangent3;
-  static Matrix tangent4;
-  static Matrix tangent6;
+  static thread_local Matrix tangent3;
+  static thread_local Matrix tangent4;
+  static thread_local Matrix tangent6;
   
   enum Formulation{Unknown, ThreeDimensional, PlaneStrain, AxiSymmetric};
   int myFormulation;
@@ -21,16 +21,11 @@
 #include <string.h>
 #include <elementAPI.h>
 
-int* FluidSolidPorousMaterial::loadStagex = 0;
-int* FluidSolidPorousMaterial::ndmx = 0;
-double* FluidSolidPorousMaterial::combinedBulkModulusx = 0;
-int FluidSolidPorousMaterial::matCount = 0;
-double FluidSolidPorousMaterial::pAtm = 101;
 
-Vector FluidSolidPorousMaterial::workV3(3);
-Vector FluidSolidPorousMaterial::workV6(6);
-Matrix FluidSolidPorousMaterial::workM3(3,3);
-Matrix FluidSolidPorousMaterial::workM6(6,6);
+thread_local Vector FluidSolidPorousMaterial::workV3(3);
+thread_local Vector FluidSolidPorousMaterial::workV6(6);
+thread_local Matrix FluidSolidPorousMaterial::workM3(3,3);
+thread_local Matrix FluidSolidPorousMaterial::workM6(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_FluidSolidPorousMaterial)
 {
@@ -89,29 +84,12 @@ FluidSolidPorousMaterial::FluidSolidPorousMaterial (int tag, int nd, NDMaterial
     combinedBulkModul = 0.;
   }
 
-  if (matCount%20 == 0) {
-     int * temp1 = loadStagex;
-     int * temp2 = ndmx;
-     double * temp3 = combinedBulkModulusx;
-     loadStagex = new int[matCount+20];
-     ndmx = new int[matCount+20];
-     combinedBulkModulusx = new double[matCount+20];
-     for (int i=0; i<matCount; i++) {
-       loadStagex[i] = temp1[i];
-       ndmx[i] = temp2[i];
-       combinedBulkModulusx[i] = temp3[i];
-     }
-     if (matCount > 0) {
-       delete [] temp1; delete [] temp2; delete [] temp3;
-     }
-  }
-  
-  ndmx[matCount] = nd;
-  loadStagex[matCount] = 0;  //default
-  combinedBulkModulusx[matCount] = combinedBulkModul;
-  matN = matCount;
-  matCount ++;
-  pAtm = atm;
+  params = std::make_shared<Parameters>();
+
+  params->ndm = nd;
+  params->loadStage = 0;  //default
+  params->combinedBulkModulus = combinedBulkModul;
+  params->pAtm = atm;
 
   theSoilMaterial = soilMat.getCopy();
   theSoilCommittedStress = theSoilMaterial->getStress();
@@ -137,7 +115,7 @@ FluidSolidPorousMaterial::FluidSolidPorousMaterial ()
 FluidSolidPorousMaterial::FluidSolidPorousMaterial (const FluidSolidPorousMaterial & a)
  : NDMaterial(a.getTag(),ND_TAG_FluidSolidPorousMaterial)
 {
-  matN = a.matN;
+  params = a.params;
   theSoilMaterial = a.theSoilMaterial->getCopy();
   trialExcessPressure = a.trialExcessPressure;
   currentExcessPressure = a.currentExcessPressure;
@@ -157,7 +135,7 @@ FluidSolidPorousMaterial::~FluidSolidPorousMaterial ()
 
 int FluidSolidPorousMaterial::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
   
   if (ndm==2 && strain.Size()==3)
     trialVolumeStrain = strain[0]+strain[1];
@@ -175,7 +153,7 @@ int FluidSolidPorousMaterial::setTrialStrain (const Vector &strain)
 
 int FluidSolidPorousMaterial::setTrialStrain (const Vector &strain, const Vector &rate)
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	if (ndm==2 && strain.Size()==3)
 		trialVolumeStrain = strain[0]+strain[1];
@@ -193,7 +171,7 @@ int FluidSolidPorousMaterial::setTrialStrain (const Vector &strain, const Vector
 
 int FluidSolidPorousMaterial::setTrialStrainIncr (const Vector &strain)
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	if (ndm==2 && strain.Size()==3)
 		trialVolumeStrain = currentVolumeStrain + strain[0]+strain[1];
@@ -211,7 +189,7 @@ int FluidSolidPorousMaterial::setTrialStrainIncr (const Vector &strain)
 
 int FluidSolidPorousMaterial::setTrialStrainIncr (const Vector &strain, const Vector &rate)
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	if (ndm==2 && strain.Size()==3)
 		trialVolumeStrain = currentVolumeStrain + strain[0]+strain[1];
@@ -229,9 +207,9 @@ int FluidSolidPorousMaterial::setTrialStrainIncr (const Vector &strain, const Ve
 
 const Matrix & FluidSolidPorousMaterial::getTangent (void)
 {
-	int ndm = ndmx[matN];
-	int loadStage = loadStagex[matN];
-	double combinedBulkModulus = combinedBulkModulusx[matN];
+	int ndm = params->ndm;
+	int loadStage = params->loadStage;
+	double combinedBulkModulus = params->combinedBulkModulus;
 
 	Matrix *workM = (ndm == 2) ? &workM3 : &workM6;
   
@@ -248,7 +226,7 @@ const Matrix & FluidSolidPorousMaterial::getTangent (void)
 
 const Matrix & FluidSolidPorousMaterial::getInitialTangent (void)
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	Matrix *workM = (ndm == 2) ? &workM3 : &workM6;
   
@@ -264,9 +242,9 @@ double FluidSolidPorousMaterial::getRho(void)
 
 const Vector & FluidSolidPorousMaterial::getStress (void)
 {
-  int ndm = ndmx[matN];
-  int loadStage = loadStagex[matN];
-  double combinedBulkModulus = combinedBulkModulusx[matN];
+  int ndm = params->ndm;
+  int loadStage = params->loadStage;
+  double combinedBulkModulus = params->combinedBulkModulus;
   
   Vector *workV = (ndm == 2) ? &workV3 : &workV6;
   
@@ -282,8 +260,8 @@ const Vector & FluidSolidPorousMaterial::getStress (void)
     trialExcessPressure = currentExcessPressure;
     trialExcessPressure += 
       (trialVolumeStrain - currentVolumeStrain) * combinedBulkModulus;
-    if (trialExcessPressure > pAtm-initMaxPress) 
-      trialExcessPressure = pAtm-initMaxPress;
+    if (trialExcessPressure > params->pAtm-initMaxPress) 
+      trialExcessPressure = params->pAtm-initMaxPress;
     //if (trialExcessPressure < initMaxPress)
     //	trialExcessPressure = initMaxPress;
     for (int i=0; i<ndm; i++) 
@@ -315,11 +293,11 @@ int FluidSolidPorousMaterial::updateParameter(int responseID, Information &info)
 {
   if (responseID == 1) {
     //    opserr << "FluidSolidPorousMaterial updateMaterialStage" << info.theInt << endln;
-    loadStagex[matN] = info.theInt;
+    params->loadStage = info.theInt;
   }
   else if (responseID == 2) {
     //    opserr << "FluidSolidPorousMaterial combinedBulk" << info.theDouble << endln;
-    combinedBulkModulusx[matN]=info.theDouble;
+    params->combinedBulkModulus=info.theDouble;
   }
 
   return 0;
@@ -340,9 +318,9 @@ const Vector & FluidSolidPorousMaterial::getCommittedStrain (void)
 
 const Vector & FluidSolidPorousMaterial::getCommittedPressure (void)
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
-	static Vector temp(2);
+	static thread_local Vector temp(2);
 	
 	temp[0] = currentExcessPressure;
 	temp[1] = temp[0]/initMaxPress;
@@ -359,7 +337,7 @@ const Vector & FluidSolidPorousMaterial::getStrain (void)
 
 int FluidSolidPorousMaterial::commitState (void)
 {
-	int loadStage = loadStagex[matN];
+	int loadStage = params->loadStage;
 
 	currentVolumeStrain = trialVolumeStrain;
 	if (loadStage != 0) 
@@ -405,7 +383,7 @@ NDMaterial * FluidSolidPorousMaterial::getCopy (const char *code)
 
 const char * FluidSolidPorousMaterial::getType (void) const
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -413,7 +391,7 @@ const char * FluidSolidPorousMaterial::getType (void) const
 
 int FluidSolidPorousMaterial::getOrder (void) const
 {
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
 	return (ndm == 2) ? 3 : 6;
 }
@@ -421,20 +399,20 @@ int FluidSolidPorousMaterial::getOrder (void) const
 
 int FluidSolidPorousMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
-	int ndm = ndmx[matN];
-	int loadStage = loadStagex[matN];
-	double combinedBulkModulus = combinedBulkModulusx[matN];
+	int ndm = params->ndm;
+	int loadStage = params->loadStage;
+	double combinedBulkModulus = params->combinedBulkModulus;
 
 	int res = 0;
 
-	static Vector data(7);
+	static thread_local Vector data(7);
 	data(0) = this->getTag();
 	data(1) = ndm;
 	data(2) = loadStage;
     data(3) = combinedBulkModulus;
 	data(4) = currentExcessPressure;
     data(5) = currentVolumeStrain;
-	data(6) = matN;
+	data(6) = params->pAtm;
 
     res += theChannel.sendVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -481,7 +459,7 @@ int FluidSolidPorousMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
 	int res = 0;
 
-	static Vector data(7);
+	static thread_local Vector data(7);
 
 	res += theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -495,11 +473,12 @@ int FluidSolidPorousMaterial::recvSelf(int commitTag, Channel &theChannel,
 	double combinedBulkModulus = data(3);
 	currentExcessPressure = data(4);
 	currentVolumeStrain = data(5);
-	matN = data(6);
+	params = std::make_shared<Parameters>();
+	params->pAtm = data(6);
 
-	ndmx[matN] = ndm;
-	loadStagex[matN] = loadStage;
-	combinedBulkModulusx[matN] = combinedBulkModulus;
+	params->ndm = ndm;
+	params->loadStage = loadStage;
+	params->combinedBulkModulus = combinedBulkModulus;
 
 	// now receives the ids of its material
 	ID classTags(2);
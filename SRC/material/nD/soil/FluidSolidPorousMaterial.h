@@ -13,6 +13,7 @@
 #ifndef FluidSolidPorousMaterial_h
 #define FluidSolidPorousMaterial_h
 
+#include <memory>
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include "soil/T2Vector.h"
@@ -99,12 +100,14 @@ class FluidSolidPorousMaterial : public NDMaterial
    protected:
 
    private:
-     static int matCount;
-     static int* ndmx;
-     static int* loadStagex;
-     static double* combinedBulkModulusx;
-     static double pAtm;
-     int matN;
+     // Parameters shared by a material and its copies
+     struct Parameters {
+       int    ndm;
+       int    loadStage;
+       double combinedBulkModulus;
+       double pAtm;
+     };
+     std::shared_ptr<Parameters> params;
      NDMaterial * theSoilMaterial;
      double trialExcessPressure;
      double currentExcessPressure;
@@ -116,10 +119,10 @@ class FluidSolidPorousMaterial : public NDMaterial
      Vector theSoilCommittedStress;
      Vector theSoilCommittedStrain;
 
-     static Vector workV3;
-     static Vector workV6;
-     static Matrix workM3;
-     static Matrix workM6;
+     static thread_local Vector workV3;
+     static thread_local Vector workV6;
+     static thread_local Matrix workM3;
+     static thread_local Matrix workM6;
 };
 
 #endif
@@ -31,40 +31,29 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Matrix MultiYieldSurfaceClay::theTangent(6,6);
-Matrix MultiYieldSurfaceClay::dTrialStressdStrain(6,6);    //classwide matrix
-Matrix MultiYieldSurfaceClay::dContactStressdStrain(6,6);  //classwide matrix
-Matrix MultiYieldSurfaceClay::dSurfaceNormaldStrain(6,6);  //classwide matrix
-Vector MultiYieldSurfaceClay::dXdStrain(6);                // classwide Vector
+thread_local Matrix MultiYieldSurfaceClay::theTangent(6,6);
+thread_local Matrix MultiYieldSurfaceClay::dTrialStressdStrain(6,6);    //classwide matrix
+thread_local Matrix MultiYieldSurfaceClay::dContactStressdStrain(6,6);  //classwide matrix
+thread_local Matrix MultiYieldSurfaceClay::dSurfaceNormaldStrain(6,6);  //classwide matrix
+thread_local Vector MultiYieldSurfaceClay::dXdStrain(6);                // classwide Vector
 
 
-Vector     MultiYieldSurfaceClay::temp6(6);    // classwide Vector
-Vector     MultiYieldSurfaceClay::temp(6);     // classwide Vector
-Vector     MultiYieldSurfaceClay::devia(6);    // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::temp6(6);    // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::temp(6);     // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::devia(6);    // classwide Vector
 
 
 double delta(int i,int j);
  
-T2Vector MultiYieldSurfaceClay::dCurrentStress;
-T2Vector MultiYieldSurfaceClay::dTrialStress;
-T2Vector MultiYieldSurfaceClay::dCurrentStrain;
-T2Vector MultiYieldSurfaceClay::dSubStrainRate;
-T2Vector MultiYieldSurfaceClay::dStrainRate;
-T2Vector MultiYieldSurfaceClay::dContactStress;
-
-
-T2Vector MultiYieldSurfaceClay::subStrainRate;
-int MultiYieldSurfaceClay::matCount=0;
-int* MultiYieldSurfaceClay::loadStagex=0;  //=0 if elastic; =1 if plastic
-int* MultiYieldSurfaceClay::ndmx=0;  //num of dimensions (2 or 3)
-double* MultiYieldSurfaceClay::rhox=0;
-double* MultiYieldSurfaceClay::frictionAnglex=0;
-double* MultiYieldSurfaceClay::peakShearStrainx=0;
-double* MultiYieldSurfaceClay::refPressurex=0;
-double* MultiYieldSurfaceClay::cohesionx=0;
-double* MultiYieldSurfaceClay::pressDependCoeffx=0;
-int*    MultiYieldSurfaceClay::numOfSurfacesx=0;
-double* MultiYieldSurfaceClay::residualPressx=0;
+thread_local T2Vector MultiYieldSurfaceClay::dCurrentStress;
+thread_local T2Vector MultiYieldSurfaceClay::dTrialStress;
+thread_local T2Vector MultiYieldSurfaceClay::dCurrentStrain;
+thread_local T2Vector MultiYieldSurfaceClay::dSubStrainRate;
+thread_local T2Vector MultiYieldSurfaceClay::dStrainRate;
+thread_local T2Vector MultiYieldSurfaceClay::dContactStress;
+
+
+thread_local T2Vector MultiYieldSurfaceClay::subStrainRate;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_MultiYieldSurfaceClay)
 {
@@ -105,7 +94,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_MultiYieldSurfaceClay)
 	return 0;
     }
 
-    static double * gredu = 0;
+    static thread_local double * gredu = 0;
     // user defined yield surfaces
     if (param[9] < 0 && param[9] > -40) {
 	param[9] = -int(param[9]);
@@ -211,67 +200,24 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (int tag, int nd,
 //............more ..............
 
 
-  if (matCount%20 == 0) {
-     int * temp1 = loadStagex;
-	 int * temp2 = ndmx;
-	 double * temp3 = rhox;
-     double * temp_6 = frictionAnglex;
-     double * temp7 = peakShearStrainx;
-     double * temp8 = refPressurex;
-     double * temp9 = cohesionx;
-     double * temp10 = pressDependCoeffx;
-	 int * temp11 = numOfSurfacesx;
-     double * temp12 = residualPressx;
-     loadStagex = new int[matCount+20];
-     ndmx = new int[matCount+20];
-     rhox = new double[matCount+20];
-     frictionAnglex = new double[matCount+20];
-     peakShearStrainx = new double[matCount+20];
-     refPressurex = new double[matCount+20];
-	 cohesionx = new double[matCount+20];
-     pressDependCoeffx = new double[matCount+20];
-     numOfSurfacesx = new int[matCount+20];
-     residualPressx = new double[matCount+20];
-
-	 for (int i=0; i<matCount; i++) {
-         loadStagex[i] = temp1[i];
-		 ndmx[i] = temp2[i];
-         rhox[i] = temp3[i];
-         frictionAnglex[i] = temp_6[i];
-         peakShearStrainx[i] = temp7[i];
-         refPressurex[i] = temp8[i];
-         cohesionx[i] = temp9[i];
-         pressDependCoeffx[i] = temp10[i];
-         numOfSurfacesx[i] = temp11[i];
-         residualPressx[i] = temp12[i];
-     }
-
-	 if (matCount > 0) {
-	     delete [] temp1; delete [] temp2; delete [] temp3;
-	     delete [] temp_6; delete [] temp7; delete [] temp8; 
-	     delete [] temp9; delete [] temp10; delete [] temp11; 
-		 delete [] temp12;
-     }
-  }
-// changed by guquan temporily !!!!!!! changed back  ----------
-  ndmx[matCount] = nd; // we ignore 2d material       
-//  ndmx[matCount] = 3;
+  params = std::make_shared<Parameters>();
+
+  params->ndm = nd; // we ignore 2d material       
+//  params->ndm = 3;
 // end changed by guquan ---------------------------------------
 
-  loadStagex[matCount] = 0;   //default
+  params->loadStage = 0;   //default
   refShearModulus = refShearModul;
   refBulkModulus = refBulkModul;
-  frictionAnglex[matCount] = frictionAng;
-  peakShearStrainx[matCount] = peakShearStra;
-  refPressurex[matCount] = -refPress;  //compression is negative
-  cohesionx[matCount] = cohesi;
-  pressDependCoeffx[matCount] = pressDependCoe;
-  numOfSurfacesx[matCount] = numberOfYieldSurf;
-  rhox[matCount] = r;
+  params->frictionAngle = frictionAng;
+  params->peakShearStrain = peakShearStra;
+  params->refPressure = -refPress;  //compression is negative
+  params->cohesion = cohesi;
+  params->pressDependCoeff = pressDependCoe;
+  params->numOfSurfaces = numberOfYieldSurf;
+  params->rho = r;
 
   e2p = 0;
-  matN = matCount;
-  matCount ++;
 
 	theSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; //first surface not used, pointer array??
     committedSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; 
@@ -282,7 +228,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (int tag, int nd,
 
 
   // === update to plastic now ==== 2009 July
-  loadStagex[matN] = 1; 
+  params->loadStage = 1; 
 
 }
    
@@ -294,7 +240,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay ()
 {
   //does nothing
   // === update to plastic now ==== 2009 July
-  loadStagex[matN] = 1; 
+  params->loadStage = 1; 
 }
 
 
@@ -303,13 +249,13 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (const MultiYieldSurfaceClay & a)
    currentStress(a.currentStress), trialStress(a.trialStress), 
   currentStrain(a.currentStrain), strainRate(a.strainRate),consistentTangent(6,6)
 {
-  matN = a.matN;
+  params = a.params;
   e2p = a.e2p;
   refShearModulus = a.refShearModulus;
   refBulkModulus = a.refBulkModulus;
   
 
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   committedActiveSurf = a.committedActiveSurf;
   activeSurfaceNum = a.activeSurfaceNum; 
@@ -339,7 +285,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (const MultiYieldSurfaceClay & a)
   }
   
   // === update to plastic now ==== 2009 July
-  loadStagex[matN] = 1; 
+  params->loadStage = 1; 
 }
 
 
@@ -356,9 +302,9 @@ MultiYieldSurfaceClay::~MultiYieldSurfaceClay ()
 
 void MultiYieldSurfaceClay::elast2Plast(void)
 {
-  int loadStage = loadStagex[matN];
-  double frictionAngle = frictionAnglex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  double frictionAngle = params->frictionAngle;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (loadStage != 1 || e2p == 1) return;
   e2p = 1;
@@ -389,7 +335,7 @@ void MultiYieldSurfaceClay::elast2Plast(void)
 
 int MultiYieldSurfaceClay::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
 //  static Vector temp(6);
   if (ndm==3 && strain.Size()==6) 
@@ -424,7 +370,7 @@ int MultiYieldSurfaceClay::setTrialStrain (const Vector &strain, const Vector &r
 
 int MultiYieldSurfaceClay::setTrialStrainIncr (const Vector &strain)
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
 //  static Vector temp(6);
   if (ndm==3 && strain.Size()==6) 
@@ -453,8 +399,8 @@ int MultiYieldSurfaceClay::setTrialStrainIncr (const Vector &strain, const Vecto
 /*
 const Matrix & MultiYieldSurfaceClay::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  int ndm = ndmx[matN];
+  int loadStage = params->loadStage;
+  int ndm = params->ndm;
 
   if (loadStage == 1 && e2p == 0) elast2Plast();
 
@@ -469,7 +415,7 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
   }
   else {
     double coeff;
-    static Vector devia(6);
+    static thread_local Vector devia(6);
   
 
 	if (activeSurfaceNum > 0) {
@@ -500,7 +446,7 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -519,8 +465,8 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
 
 const Matrix & MultiYieldSurfaceClay::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  int ndm = ndmx[matN];
+  int loadStage = params->loadStage;
+  int ndm = params->ndm;
 
   if (loadStage == 1 && e2p == 0) {
 	  opserr << "FATAL:MultiYieldSurfaceClay::Can not deal with e2p" 
@@ -598,7 +544,7 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -617,7 +563,7 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
 
 const Matrix & MultiYieldSurfaceClay::getInitialTangent (void)
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
   for (int i=0;i<6;i++) 
     for (int j=0;j<6;j++) {
@@ -630,7 +576,7 @@ const Matrix & MultiYieldSurfaceClay::getInitialTangent (void)
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -647,9 +593,9 @@ const Matrix & MultiYieldSurfaceClay::getInitialTangent (void)
 
 const Vector & MultiYieldSurfaceClay::getStress (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
 
   int i;
   if (loadStage == 1 && e2p == 0) elast2Plast();
@@ -657,7 +603,7 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
   if (loadStage!=1) {  //linear elastic
     //trialStrain.setData(currentStrain.t2Vector() + strainRate.t2Vector());
     getTangent();
-    static Vector a(6);
+    static thread_local Vector a(6);
     a = currentStress.t2Vector();
 	a.addMatrixVector(1.0, theTangent, strainRate.t2Vector(1), 1.0);
     trialStress.setData(a);
@@ -694,8 +640,8 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
 
 	//--------- add consistent tangent part code -------------------
 	// unitTensor = I*I 
-	static Matrix unitTensor(6,6);
-	static Matrix tempTangent(6,6);
+	static thread_local Matrix unitTensor(6,6);
+	static thread_local Matrix tempTangent(6,6);
 	unitTensor.Zero();
 	for(int i=0;i<3;i++){
 		for(int j=0;j<3;j++){
@@ -754,7 +700,7 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
 	return temp6;
 //	  return trialStress.t2Vector();
   else {
-    static Vector workV(3);
+    static thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -772,8 +718,8 @@ const Vector & MultiYieldSurfaceClay::getStrain (void)
 
 int MultiYieldSurfaceClay::commitState (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   currentStress = trialStress;
   
@@ -814,7 +760,7 @@ int MultiYieldSurfaceClay::revertToStart (void)
     strainRate.Zero();
     subStrainRate.Zero();
 	devia.Zero();
-	for (int i = 0; i<=numOfSurfacesx[matN]; i++){
+	for (int i = 0; i<=params->numOfSurfaces; i++){
 		theSurfaces[i].setCenter(devia);
 		committedSurfaces[i].setCenter(devia);
 	}
@@ -831,7 +777,7 @@ int MultiYieldSurfaceClay::revertToStart (void)
 	dCommittedMultiSurfaceCenter=0;
 	dVolume=0.0;
 */	
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
 	for (int i=0; i<numOfSurfaces+1; i++){
 		for(int j=0;j<myNumGrads;j++){
 			if (dMultiSurfaceCenter !=0)
@@ -879,7 +825,7 @@ NDMaterial * MultiYieldSurfaceClay::getCopy (const char *code)
 
 const char * MultiYieldSurfaceClay::getType (void) const
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
   return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -887,7 +833,7 @@ const char * MultiYieldSurfaceClay::getType (void) const
 
 int MultiYieldSurfaceClay::getOrder (void) const
 {
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
   return (ndm == 2) ? 3 : 6;
 }
@@ -897,25 +843,24 @@ int MultiYieldSurfaceClay::getOrder (void) const
 
 int MultiYieldSurfaceClay::sendSelf(int commitTag, Channel &theChannel)
 {
-  int loadStage = loadStagex[matN];
-  int ndm = ndmx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  double rho = rhox[matN];
-  double frictionAngle = frictionAnglex[matN];
-  double peakShearStrain = peakShearStrainx[matN];
-  double refPressure = refPressurex[matN];
-  double cohesion = cohesionx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double residualPress = residualPressx[matN];
+  int loadStage = params->loadStage;
+  int ndm = params->ndm;
+  int numOfSurfaces = params->numOfSurfaces;
+  double rho = params->rho;
+  double frictionAngle = params->frictionAngle;
+  double peakShearStrain = params->peakShearStrain;
+  double refPressure = params->refPressure;
+  double cohesion = params->cohesion;
+  double pressDependCoeff = params->pressDependCoeff;
+  double residualPress = params->residualPress;
 
   int i, res = 0;
 
-  static ID idData(5);
+  static thread_local ID idData(4);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
   idData(3) = ndm;
-  idData(4) = matN;
 
   res += theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -971,7 +916,7 @@ int MultiYieldSurfaceClay::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(5);
+  static thread_local ID idData(4);
 
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -983,7 +928,7 @@ int MultiYieldSurfaceClay::recvSelf(int commitTag, Channel &theChannel,
   int numOfSurfaces = idData(1);
   int loadStage = idData(2);
   int ndm = idData(3);
-  matN = idData(4);
+  params = std::make_shared<Parameters>();
 
   Vector data(23+idData(1)*8);
 //  static Vector temp(6);
@@ -1034,16 +979,16 @@ int MultiYieldSurfaceClay::recvSelf(int commitTag, Channel &theChannel,
     committedSurfaces[i+1].setData(temp, data(k), data(k+1));
   }
   
-  loadStagex[matN] = loadStage;
-  ndmx[matN] = ndm;
-  numOfSurfacesx[matN] = numOfSurfaces;
-  rhox[matN] = rho;
-  frictionAnglex[matN] = frictionAngle;
-  peakShearStrainx[matN] = peakShearStrain;
-  refPressurex[matN] = refPressure;
-  cohesionx[matN] = cohesion;
-  pressDependCoeffx[matN] = pressDependCoeff;
-  residualPressx[matN] = residualPress;
+  params->loadStage = loadStage;
+  params->ndm = ndm;
+  params->numOfSurfaces = numOfSurfaces;
+  params->rho = rho;
+  params->frictionAngle = frictionAngle;
+  params->peakShearStrain = peakShearStrain;
+  params->refPressure = refPressure;
+  params->cohesion = cohesion;
+  params->pressDependCoeff = pressDependCoeff;
+  params->residualPress = residualPress;
 
   return res;
 }
@@ -1062,8 +1007,8 @@ MultiYieldSurfaceClay::setResponse (const char **argv, int argc, OPS_Stream &the
 		return new MaterialResponse(this, 3, this->getTangent());
     
 	else if (strcmp(argv[0],"backbone") == 0) {
-	    int numOfSurfaces = numOfSurfacesx[matN];
-        static Matrix curv(numOfSurfaces+1,(argc-1)*2);
+	    int numOfSurfaces = params->numOfSurfaces;
+        static thread_local Matrix curv(numOfSurfaces+1,(argc-1)*2);
 		  for (int i=1; i<argc; i++)
 		   	curv(0,(i-1)*2) = atoi(argv[i]);
 		return new MaterialResponse(this, 4, curv);
@@ -1146,10 +1091,10 @@ int MultiYieldSurfaceClay::getResponse (int responseID, Information &matInfo)
 
 void MultiYieldSurfaceClay::getBackbone (Matrix & bb)
 {
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double vol, conHeig, scale, factor, shearModulus, stress1, 
 		     stress2, strain1, strain2, plastModulus, elast_plast, gre;
@@ -1192,13 +1137,13 @@ void MultiYieldSurfaceClay::Print(OPS_Stream &s, int flag )
 
 const Vector & MultiYieldSurfaceClay::getCommittedStress (void)
 {
-	int ndm = ndmx[matN];
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int ndm = params->ndm;
+	int numOfSurfaces = params->numOfSurfaces;
 
 	double scale = sqrt(3./2.)*currentStress.deviatorLength()/committedSurfaces[numOfSurfaces].size();
-	if (loadStagex[matN] != 1) scale = 0.;
+	if (params->loadStage != 1) scale = 0.;
 	if (ndm==3) {
-		static Vector temp7(7);
+		static thread_local Vector temp7(7);
 //		static Vector temp6(6);
 		temp6 = currentStress.t2Vector();
     temp7[0] = temp6[0];
@@ -1211,7 +1156,7 @@ const Vector & MultiYieldSurfaceClay::getCommittedStress (void)
 		return temp7;
 	}
   else {
-    static Vector temp3(3);
+    static thread_local Vector temp3(3);
 	//, temp6(6);
 		temp6 = currentStress.t2Vector();
     temp3[0] = temp6[0];
@@ -1226,12 +1171,12 @@ const Vector & MultiYieldSurfaceClay::getCommittedStress (void)
 
 const Vector & MultiYieldSurfaceClay::getCommittedStrain (void)
 {	
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-    static Vector workV(3);//, temp6(6);
+    static thread_local Vector workV(3);//, temp6(6);
 		temp6 = currentStrain.t2Vector(1);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -1244,13 +1189,13 @@ const Vector & MultiYieldSurfaceClay::getCommittedStrain (void)
 // NOTE: surfaces[0] is not used 
 void MultiYieldSurfaceClay::setUpSurfaces (double * gredu)
 { 
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    int numOfSurfaces = params->numOfSurfaces;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
 
 	double  stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
 	double pi = 3.14159265358979;
@@ -1369,9 +1314,9 @@ void MultiYieldSurfaceClay::setUpSurfaces (double * gredu)
 			}
 	  }  
 
-  residualPressx[matN] = residualPress;
-  frictionAnglex[matN] = frictionAngle;
-  cohesionx[matN] = cohesion;
+  params->residualPress = residualPress;
+  params->frictionAngle = frictionAngle;
+  params->cohesion = cohesion;
 }
 
 
@@ -1396,7 +1341,7 @@ void MultiYieldSurfaceClay::deviatorScaling(T2Vector & stress, const MultiYieldS
 	return;
 //end
 	count++;
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
     
 	double diff = yieldFunc(stress, surfaces, surfaceNum);
 
@@ -1420,7 +1365,7 @@ void MultiYieldSurfaceClay::deviatorScaling(T2Vector & stress, const MultiYieldS
 	if (surfaceNum==numOfSurfaces && fabs(diff) > LOW_LIMIT) {
 		opserr <<"deviatorScaling called,bigger than bound" << endln;
 		double sz = surfaces[surfaceNum].size();
-		static Vector newDevia(6);
+		static thread_local Vector newDevia(6);
 		newDevia.addVector(0.0, stress.deviator(), sz/sqrt(diff+sz*sz));
 		stress.setData(newDevia, stress.volume());
 	}
@@ -1431,12 +1376,12 @@ void MultiYieldSurfaceClay::initSurfaceUpdate()
 {
 	if (activeSurfaceNum == 0) return; 
 
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
 
 //	static Vector devia(6);
 	devia = currentStress.deviator();
 	double Ms = sqrt(3./2.*(devia && devia));
-	static Vector newCenter(6);
+	static thread_local Vector newCenter(6);
 
 	if (activeSurfaceNum < numOfSurfaces) { // failure surface can't move
 		//newCenter = devia * (1. - committedSurfaces[activeSurfaceNum].size() / Ms); 
@@ -1453,11 +1398,11 @@ void MultiYieldSurfaceClay::initSurfaceUpdate()
 
 void MultiYieldSurfaceClay::paramScaling(void)
 {
-	int numOfSurfaces = numOfSurfacesx[matN];
-	double frictionAngle = frictionAnglex[matN];
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
+	double frictionAngle = params->frictionAngle;
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
 
 	if (frictionAngle == 0.) return;
 
@@ -1519,7 +1464,7 @@ void MultiYieldSurfaceClay::setTrialStress(T2Vector & stress)
 
 int MultiYieldSurfaceClay::setSubStrainRate(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
 	if (activeSurfaceNum==numOfSurfaces) return 1;
 
@@ -1540,11 +1485,11 @@ int MultiYieldSurfaceClay::setSubStrainRate(void)
 	  elast_plast_modulus = 2*refShearModulus*plast_modulus 
 	    / (2*refShearModulus+plast_modulus);
 	}
-	static Vector incre(6);
+	static thread_local Vector incre(6);
 	//incre = strainRate.deviator()*elast_plast_modulus;
 	incre.addVector(0.0, strainRate.deviator(),elast_plast_modulus);
 
-	static T2Vector increStress;
+	static thread_local T2Vector increStress;
 	increStress.setData(incre, 0);
 	double singleCross = theSurfaces[numOfSurfaces].size() / numOfSurfaces;
 	double totalCross = 3.*increStress.octahedralShear() / sqrt(2.);
@@ -1565,13 +1510,13 @@ int MultiYieldSurfaceClay::setSubStrainRate(void)
 void
 MultiYieldSurfaceClay::getContactStress(T2Vector &contactStress)
 {
-	static Vector center(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center(); 
 //	static Vector devia(6);
-	static Vector tempStress(6);
+	static thread_local Vector tempStress(6);
 	
-	static Vector dKdStrain(6);
-	static Matrix tempTangent(6,6);
+	static thread_local Vector dKdStrain(6);
+	static thread_local Matrix tempTangent(6,6);
 	
 	//devia = trialStress.deviator() - center;
 	devia = trialStress.deviator();
@@ -1613,12 +1558,12 @@ int MultiYieldSurfaceClay::isLoadReversal(void)
 {
   if(activeSurfaceNum == 0) return 0;
 
-  static Vector surfaceNormal(6);
+  static thread_local Vector surfaceNormal(6);
   getSurfaceNormal(currentStress, surfaceNormal);
  
   //(((trialStress.deviator() - currentStress.deviator()) && surfaceNormal) < 0) 
   // return 1;
-  static Vector a(6);
+  static thread_local Vector a(6);
   a = trialStress.deviator();
   a-= currentStress.deviator();
   if((a && surfaceNormal) < 0) 
@@ -1634,8 +1579,8 @@ MultiYieldSurfaceClay::getSurfaceNormal(const T2Vector & stress, Vector &surface
   //Q = stress.deviator() - theSurfaces[activeSurfaceNum].center();
   // return Q / sqrt(Q && Q);
 
-  static Vector tempStress(6),tempProduct(6);
-  static Matrix tempTangent(6,6);
+  static thread_local Vector tempStress(6),tempProduct(6);
+  static thread_local Matrix tempTangent(6,6);
 
 
   surfaceNormal = stress.deviator();
@@ -1715,9 +1660,9 @@ double MultiYieldSurfaceClay::getLoadingFunc(const T2Vector & contactStress,
 
 void MultiYieldSurfaceClay::stressCorrection(int crossedSurface)
 {
-	static T2Vector contactStress;
+	static thread_local T2Vector contactStress;
 	this->getContactStress(contactStress);
-	static Vector surfaceNormal(6);
+	static thread_local Vector surfaceNormal(6);
 	this->getSurfaceNormal(contactStress, surfaceNormal);
 	double loadingFunc = getLoadingFunc(contactStress, surfaceNormal, crossedSurface);
 //	static Vector devia(6);
@@ -1755,19 +1700,19 @@ void MultiYieldSurfaceClay::stressCorrection(int crossedSurface)
 
 void MultiYieldSurfaceClay::updateActiveSurface(void)
 {
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
 	double A, B, C, X;
-	static T2Vector direction;
-	static Vector t1(6);
-	static Vector t2(6);
+	static thread_local T2Vector direction;
+	static thread_local Vector t1(6);
+	static thread_local Vector t2(6);
 //	static Vector temp(6);
-	static Vector center(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector outcenter(6);
+	static thread_local Vector outcenter(6);
 	outcenter= theSurfaces[activeSurfaceNum+1].center();
 	double outsize = theSurfaces[activeSurfaceNum+1].size();
 
@@ -1833,10 +1778,10 @@ void MultiYieldSurfaceClay::updateInnerSurface(void)
 
 //	static Vector devia(6);
 	devia = currentStress.deviator();
-	static Vector center(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector newcenter(6);
+	static thread_local Vector newcenter(6);
 
 	for (int i=1; i<activeSurfaceNum; i++) {
 		//newcenter = devia - (devia - center) * theSurfaces[i].size() / size;
@@ -1852,7 +1797,7 @@ void MultiYieldSurfaceClay::updateInnerSurface(void)
 
 int MultiYieldSurfaceClay:: isCrossingNextSurface(void)
 {
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
   if (activeSurfaceNum == numOfSurfaces) return 0;  
 
   if(yieldFunc(trialStress, theSurfaces, activeSurfaceNum+1) > 0) return 1;
@@ -1901,8 +1846,8 @@ MultiYieldSurfaceClay::updateParameter(int passedParameterID,
 		this->refShearModulus= info.theDouble; // 
 		break;
 	case 2:
-		cohesionx[matN]=info.theDouble;
-//		this->peakShearStrainx[matN]  = info.theDouble;
+		params->cohesion=info.theDouble;
+//		this->params->peakShearStrain  = info.theDouble;
 		break;
 	case 3:
 		this->refBulkModulus  = info.theDouble;
@@ -1946,11 +1891,11 @@ void MultiYieldSurfaceClay::setUpSurfacesSensitivity(int passedGradNumber )
 		}
 	}
 
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double frictionAngle = frictionAnglex[matN];
+    int numOfSurfaces = params->numOfSurfaces;
+    double frictionAngle = params->frictionAngle;
 	
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
 
 	double  stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
 	double pi = 3.14159265358979;
@@ -2151,7 +2096,7 @@ void MultiYieldSurfaceClay::updateInnerSurfaceSensitivity(void)
 {
 	if (activeSurfaceNum <= 1) return;
 
-	int numOfSurfaces=numOfSurfacesx[matN];
+	int numOfSurfaces=params->numOfSurfaces;
 	
 //	static 		Vector devia(6);
 	devia = currentStress.deviator();
@@ -2219,7 +2164,7 @@ void MultiYieldSurfaceClay::updateInnerSurfaceSensitivity(void)
 
 int MultiYieldSurfaceClay::setSubStrainRateSensitivity(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
 	if (activeSurfaceNum==numOfSurfaces) return 1;
 
@@ -2297,7 +2242,7 @@ MultiYieldSurfaceClay::getContactStressSensitivity(T2Vector &contactStress)
 	static 
 		Vector dTempStress(6),dCenter(6),tempStress(6);
 	double dMs;
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
 	devia = trialStress.deviator();
 	devia -= center;
@@ -2339,7 +2284,7 @@ MultiYieldSurfaceClay::getSurfaceNormalSensitivity(const T2Vector & stress,
 	static 
 	   Vector dCenter(6),tempStress(6);
 	double tempNormal,temp;	
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
 	surfaceNormal = stress.deviator();
 	surfaceNormal -= theSurfaces[activeSurfaceNum].center();
@@ -2407,7 +2352,7 @@ double MultiYieldSurfaceClay::getLoadingFuncSensitivity(const T2Vector & contact
  double temp4,temp5;
  static 
 	 Vector dTempStress(6);
- int numOfSurfaces = numOfSurfacesx[matN];
+ int numOfSurfaces = params->numOfSurfaces;
  
  dPlastModulus=dCommittedMultiSurfacePlastModul[activeSurfaceNum+(gradNumber-1)*(numOfSurfaces+1)];
  dRefShearModulus=0.0;
@@ -2448,7 +2393,7 @@ double MultiYieldSurfaceClay::getLoadingFuncSensitivity(const T2Vector & contact
 
 void MultiYieldSurfaceClay::updateActiveSurfaceSensitivity(void)
 {
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
@@ -2764,9 +2709,9 @@ opserr << "---------------------------------"<< endln;
 
 // --------------------------------------------------------	
 //------------------ Program ------------------------------
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
 
   int i;
   if (loadStage == 1 && e2p == 0) //elast2PlastSensitivity();
@@ -2888,7 +2833,7 @@ opserr << "---------------------------------"<< endln;
     //return dTrialStress.t2Vector();   ~~~~~guquan ~~~~~ change by following line
 	return temp6;
   else {
-    static Vector workV(3);
+    static thread_local Vector workV(3);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
     workV[2] = temp6[3];
@@ -2914,9 +2859,9 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 	gradNumber = passedGradNumber;
 
 
-  int ndm = ndmx[matN];
+  int ndm = params->ndm;
 
-  static Vector strainSensitivity(6);
+  static thread_local Vector strainSensitivity(6);
   if (ndm==3 && strainSens.Size()==6) 
     strainSensitivity = strainSens;
   else if (ndm==2 && strainSens.Size()==3) {
@@ -2963,7 +2908,7 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 
 
 	
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
     double * dTemp;
 	int * dTemp1;
 	dTemp=new double [6*(numOfSurfaces+1)*myNumGrads];
@@ -3063,7 +3008,7 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 //    opserr << "-------------------------------------------"<< endln;
 //	opserr << strainSensitivity<< endln;
  
-	static Vector tempaa(6);
+	static thread_local Vector tempaa(6);
 	tempaa = currentStrain.t2Vector();
 	 tempaa += strainRate.t2Vector();
   
@@ -3080,9 +3025,9 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 
 // --------------------------------------------------------	
 //------------------ Program ------------------------------
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-//  int ndm = ndmx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+//  int ndm = params->ndm;
 
   if (loadStage == 1 && e2p == 0) //elast2PlastSensitivity();
   {  opserr << "Fatal: can not deal with elast2plast right now" << endln;
@@ -3257,7 +3202,7 @@ void MultiYieldSurfaceClay::setSurfacesSensitivitySetUpMark(int passedGradNumber
 const Vector &MultiYieldSurfaceClay::getCommittedStressSensitivity(int GradientNumber){
 
 
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 //	static Vector temp6(6);
 	temp6.Zero();
 	int i;
@@ -3269,7 +3214,7 @@ const Vector &MultiYieldSurfaceClay::getCommittedStressSensitivity(int GradientN
 		return temp6;
 	
 	else {
-    static Vector workV(3);
+    static thread_local Vector workV(3);
 	
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -3286,7 +3231,7 @@ const Vector &MultiYieldSurfaceClay::getCommittedStressSensitivity(int GradientN
 
 const Vector &MultiYieldSurfaceClay::getCommittedStrainSensitivity(int GradientNumber){
 
-	int ndm = ndmx[matN];
+	int ndm = params->ndm;
 //	static Vector temp6(6);
 	temp6.Zero();
 	int i;
@@ -3298,7 +3243,7 @@ const Vector &MultiYieldSurfaceClay::getCommittedStrainSensitivity(int GradientN
 		return temp6;
 	
 	else {
-    static Vector workV(3);
+    static thread_local Vector workV(3);
 	
     workV[0] = temp6[0];
     workV[1] = temp6[1];
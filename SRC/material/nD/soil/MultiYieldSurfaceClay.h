@@ -17,6 +17,7 @@
 #ifndef MultiYieldSurfaceClay_h
 #define MultiYieldSurfaceClay_h
 
+#include <memory>
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include "soil/T2Vector.h"
@@ -50,7 +51,7 @@ public:
      // Destructor: clean up memory storage space.
      virtual ~MultiYieldSurfaceClay ();
 
-		 double getRho(void) {return rhox[matN];} ;
+		 double getRho(void) {return params->rho;} ;
      // Sets the values of the trial strain tensor.
      int setTrialStrain (const Vector &strain);
 
@@ -111,24 +112,24 @@ public:
 protected:
 
 private:
-	static int matCount;
-	static int* loadStagex;  //=0 if elastic; =1 if plastic
-
-  // user supplied
-	static int* ndmx;  //num of dimensions (2 or 3)
-	static double* rhox;
-	static double* frictionAnglex;
-	static double* peakShearStrainx;
-	static double* refPressurex;
-	static double* cohesionx;
-	static double* pressDependCoeffx;
-	static int*    numOfSurfacesx;
+	// Parameters shared by a material and its copies
+	struct Parameters {
+	  int    loadStage;  //=0 if elastic; =1 if plastic
+	  int    ndm;  //num of dimensions (2 or 3)
+	  double rho;
+	  double frictionAngle;
+	  double peakShearStrain;
+	  double refPressure;
+	  double cohesion;
+	  double pressDependCoeff;
+	  int    numOfSurfaces;
+	  double residualPress;
+	};
 
 	// internal
-	static double* residualPressx;
-	static Matrix theTangent;  //classwise member
+	static thread_local Matrix theTangent;  //classwise member
 	int e2p;
-	int matN;
+	std::shared_ptr<Parameters> params;
 	double refShearModulus;
 	double refBulkModulus;
 	MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
@@ -139,7 +140,7 @@ private:
 	T2Vector trialStress;
 	T2Vector currentStrain;
 	T2Vector strainRate;
-	static T2Vector subStrainRate;
+	static thread_local T2Vector subStrainRate;
 
 	void elast2Plast(void);
 	// Called by constructor
@@ -219,12 +220,12 @@ private:
 	double dLoadingFunc;
 	int debugMarks;               // NONclasswide int for debug only
 
-	static T2Vector dCurrentStress;
-	static T2Vector dTrialStress;
-	static T2Vector dCurrentStrain;
-	static T2Vector dSubStrainRate;
-	static T2Vector dStrainRate;
-	static T2Vector dContactStress;
+	static thread_local T2Vector dCurrentStress;
+	static thread_local T2Vector dTrialStress;
+	static thread_local T2Vector dCurrentStrain;
+	static thread_local T2Vector dSubStrainRate;
+	static thread_local T2Vector dStrainRate;
+	static thread_local T2Vector dContactStress;
 
 // uncommitted conditional sensitivity
 	double * dMultiSurfaceCenter;
@@ -243,15 +244,15 @@ private:
 
 //------------- for consistent tangent ----------------
 private:
-	static Matrix dTrialStressdStrain;   //classwide matrix
+	static thread_local Matrix dTrialStressdStrain;   //classwide matrix
 	Matrix consistentTangent;
-	static Matrix dContactStressdStrain;  // classwide matrix
-	static Matrix dSurfaceNormaldStrain;  // classwide matrix
-	static Vector dXdStrain;              // classwide Vector
+	static thread_local Matrix dContactStressdStrain;  // classwide matrix
+	static thread_local Matrix dSurfaceNormaldStrain;  // classwide matrix
+	static thread_local Vector dXdStrain;              // classwide Vector
 
-	static Vector     temp6;          // classwide Vector
-	static Vector     temp;           // classwide Vector
-	static Vector     devia;          // classwide Vector
+	static thread_local Vector     temp6;          // classwide Vector
+	static thread_local Vector     temp;           // classwide Vector
+	static thread_local Vector     devia;          // classwide Vector
 
 
 
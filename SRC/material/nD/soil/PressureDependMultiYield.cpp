@@ -22,40 +22,12 @@
 #include <string.h>
 #include <elementAPI.h>
 
-int PressureDependMultiYield::matCount=0;
-int* PressureDependMultiYield::loadStagex = 0;  //=0 if elastic; =1 if plastic
-int* PressureDependMultiYield::ndmx=0;  //num of dimensions (2 or 3)
-double* PressureDependMultiYield::rhox=0;
-double* PressureDependMultiYield::refShearModulusx=0;
-double* PressureDependMultiYield::refBulkModulusx=0;
-double* PressureDependMultiYield::frictionAnglex=0;
-double* PressureDependMultiYield::peakShearStrainx=0;
-double* PressureDependMultiYield::refPressurex=0;
-double* PressureDependMultiYield::cohesionx=0;
-double* PressureDependMultiYield::pressDependCoeffx=0;
-int*    PressureDependMultiYield::numOfSurfacesx=0;
-double* PressureDependMultiYield::phaseTransfAnglex=0;
-double* PressureDependMultiYield::contractParam1x=0;
-double* PressureDependMultiYield::dilateParam1x=0;
-double* PressureDependMultiYield::dilateParam2x=0;
-double* PressureDependMultiYield::liquefyParam1x=0;
-double* PressureDependMultiYield::liquefyParam2x=0;
-double* PressureDependMultiYield::liquefyParam4x=0;
-double* PressureDependMultiYield::einitx=0;    //initial void ratio
-double* PressureDependMultiYield::volLimit1x=0;
-double* PressureDependMultiYield::volLimit2x=0;
-double* PressureDependMultiYield::volLimit3x=0;
-double* PressureDependMultiYield::residualPressx=0;
-double* PressureDependMultiYield::stressRatioPTx=0;
-double* PressureDependMultiYield::Hvx=0;
-double* PressureDependMultiYield::Pvx=0;
-
-double PressureDependMultiYield::pAtm = 101.;
-Matrix PressureDependMultiYield::theTangent(6,6);
-T2Vector PressureDependMultiYield::trialStrain;
-T2Vector PressureDependMultiYield::subStrainRate;
-Vector PressureDependMultiYield::workV6(6);
-T2Vector PressureDependMultiYield::workT2V;
+
+thread_local Matrix PressureDependMultiYield::theTangent(6,6);
+thread_local T2Vector PressureDependMultiYield::trialStrain;
+thread_local T2Vector PressureDependMultiYield::subStrainRate;
+thread_local Vector PressureDependMultiYield::workV6(6);
+thread_local T2Vector PressureDependMultiYield::workT2V;
 
 const	double pi = 3.14159265358979;
 
@@ -113,7 +85,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependMultiYield)
 	    return 0;
 	}
 
-    static double * gredu = 0;
+    static thread_local double * gredu = 0;
     // user defined yield surfaces
     if (param[15] < 0 && param[15] > -40) {
 	param[15] = -int(param[15]);
@@ -257,132 +229,37 @@ PressureDependMultiYield::PressureDependMultiYield (int tag, int nd,
    exit(-1);
   }
 
-  if (matCount%20 == 0) {
-     int * temp1 = loadStagex;
-	 int * temp2 = ndmx;
-	 double * temp3 = rhox;
-     double * temp4 = refShearModulusx;
-     double * temp5 = refBulkModulusx;
-     double * temp6 = frictionAnglex;
-     double * temp7 = peakShearStrainx;
-     double * temp8 = refPressurex;
-     double * temp9 = cohesionx;
-     double * temp10 = pressDependCoeffx;
-	 int * temp11 = numOfSurfacesx;
-     double * temp12 = residualPressx;
-     double * temp13 = phaseTransfAnglex;
-     double * temp14 = contractParam1x;
-     double * temp15 = dilateParam1x;
-     double * temp16 = dilateParam2x;
-     double * temp17 = liquefyParam1x;
-     double * temp18 = liquefyParam2x;
-     double * temp19 = liquefyParam4x;
-     double * temp20 = einitx;    //initial void ratio
-     double * temp21 = volLimit1x;
-     double * temp22 = volLimit2x;
-     double * temp23 = volLimit3x;
-     double * temp24 = stressRatioPTx;
-	 double * temp25 = Hvx;
-	 double * temp26 = Pvx;
-
-     loadStagex = new int[matCount+20];
-     ndmx = new int[matCount+20];
-     rhox = new double[matCount+20];
-     refShearModulusx = new double[matCount+20];
-     refBulkModulusx = new double[matCount+20];
-     frictionAnglex = new double[matCount+20];
-     peakShearStrainx = new double[matCount+20];
-     refPressurex = new double[matCount+20];
-	 cohesionx = new double[matCount+20];
-     pressDependCoeffx = new double[matCount+20];
-     numOfSurfacesx = new int[matCount+20];
-     residualPressx = new double[matCount+20];
-     phaseTransfAnglex = new double[matCount+20];
-     contractParam1x = new double[matCount+20];
-     dilateParam1x = new double[matCount+20];
-     dilateParam2x = new double[matCount+20];
-     liquefyParam1x = new double[matCount+20];
-     liquefyParam2x = new double[matCount+20];
-     liquefyParam4x = new double[matCount+20];
-     einitx = new double[matCount+20];    //initial void ratio
-     volLimit1x = new double[matCount+20];
-     volLimit2x = new double[matCount+20];
-     volLimit3x = new double[matCount+20];
-     stressRatioPTx = new double[matCount+20];
-	 Hvx = new double[matCount+20];
-	 Pvx = new double[matCount+20];
-
-	 for (int i=0; i<matCount; i++) {
-         loadStagex[i] = temp1[i];
-		 ndmx[i] = temp2[i];
-         rhox[i] = temp3[i];
-	     refShearModulusx[i] = temp4[i];
-         refBulkModulusx[i] = temp5[i];
-         frictionAnglex[i] = temp6[i];
-         peakShearStrainx[i] = temp7[i];
-         refPressurex[i] = temp8[i];
-         cohesionx[i] = temp9[i];
-         pressDependCoeffx[i] = temp10[i];
-         numOfSurfacesx[i] = temp11[i];
-         residualPressx[i] = temp12[i];
-         phaseTransfAnglex[i] = temp13[i];
-         contractParam1x[i] = temp14[i];
-         dilateParam1x[i] = temp15[i];
-         dilateParam2x[i] = temp16[i];
-         liquefyParam1x[i] = temp17[i];
-         liquefyParam2x[i] = temp18[i];
-         liquefyParam4x[i] = temp19[i];
-         einitx[i] = temp20[i];    //initial void ratio
-         volLimit1x[i] = temp21[i];
-         volLimit2x[i] = temp22[i];
-         volLimit3x[i] = temp23[i];
-         stressRatioPTx[i] = temp24[i];
-		 Hvx[i] = temp25[i];
-		 Pvx[i] = temp26[i];
-     }
-
-	 if (matCount > 0) {
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; delete [] temp15; delete [] temp16;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; delete [] temp26;
-     }
-  }
-
-  ndmx[matCount] = nd;
-  loadStagex[matCount] = 0;   //default
-  refShearModulusx[matCount] = refShearModul;
-  refBulkModulusx[matCount] = refBulkModul;
-  frictionAnglex[matCount] = frictionAng;
-  peakShearStrainx[matCount] = peakShearStra;
-  refPressurex[matCount] = -refPress;  //compression is negative
-  cohesionx[matCount] = cohesi;
-  pressDependCoeffx[matCount] = pressDependCoe;
-  numOfSurfacesx[matCount] = numberOfYieldSurf;
-  rhox[matCount] = r;
-  phaseTransfAnglex[matCount] = phaseTransformAng;
-  contractParam1x[matCount] = contractionParam1;
-  dilateParam1x[matCount] = dilationParam1;
-  dilateParam2x[matCount] = dilationParam2;
-  volLimit1x[matCount] = volLim1;
-  volLimit2x[matCount] = volLim2;
-  volLimit3x[matCount] = volLim3;
-  liquefyParam1x[matCount] = liquefactionParam1;
-  liquefyParam2x[matCount] = liquefactionParam2;
-  liquefyParam4x[matCount] = liquefactionParam4;
-  einitx[matCount] = ei;
-  Hvx[matCount] = hv;
-  Pvx[matCount] = pv;
-
-  matN = matCount;
-  matCount ++;
-  pAtm = atm;
-
-  int numOfSurfaces = numOfSurfacesx[matN];
-  initPress = refPressurex[matN];
+  params = std::make_shared<Parameters>();
+
+  params->ndm = nd;
+  params->loadStage = 0;   //default
+  params->refShearModulus = refShearModul;
+  params->refBulkModulus = refBulkModul;
+  params->frictionAngle = frictionAng;
+  params->peakShearStrain = peakShearStra;
+  params->refPressure = -refPress;  //compression is negative
+  params->cohesion = cohesi;
+  params->pressDependCoeff = pressDependCoe;
+  params->numOfSurfaces = numberOfYieldSurf;
+  params->rho = r;
+  params->phaseTransfAngle = phaseTransformAng;
+  params->contractParam1 = contractionParam1;
+  params->dilateParam1 = dilationParam1;
+  params->dilateParam2 = dilationParam2;
+  params->volLimit1 = volLim1;
+  params->volLimit2 = volLim2;
+  params->volLimit3 = volLim3;
+  params->liquefyParam1 = liquefactionParam1;
+  params->liquefyParam2 = liquefactionParam2;
+  params->liquefyParam4 = liquefactionParam4;
+  params->einit = ei;
+  params->Hv = hv;
+  params->Pv = pv;
+
+  params->pAtm = atm;
+
+  int numOfSurfaces = params->numOfSurfaces;
+  initPress = params->refPressure;
 
   e2p = committedActiveSurf = activeSurfaceNum = 0;
   onPPZCommitted = onPPZ = -1 ;
@@ -423,9 +300,9 @@ PressureDependMultiYield::PressureDependMultiYield (const PressureDependMultiYie
   PPZCenterCommitted(a.PPZCenterCommitted),
   lockStressCommitted(a.lockStressCommitted)
 {
-  matN = a.matN;
+  params = a.params;
 
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   e2p = a.e2p;
   strainPTOcta = a.strainPTOcta;
@@ -468,8 +345,8 @@ PressureDependMultiYield::~PressureDependMultiYield ()
 void
 PressureDependMultiYield::elast2Plast(void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (loadStage != 1 || e2p == 1) return;
   e2p = 1;
@@ -500,8 +377,8 @@ PressureDependMultiYield::elast2Plast(void)
 int
 PressureDependMultiYield::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -535,8 +412,8 @@ PressureDependMultiYield::setTrialStrain (const Vector &strain, const Vector &ra
 int
 PressureDependMultiYield::setTrialStrainIncr (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -567,14 +444,14 @@ PressureDependMultiYield::setTrialStrainIncr (const Vector &strain, const Vector
 const Matrix &
 PressureDependMultiYield::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) elast2Plast();
   if (loadStage==2 && initPress==refPressure)
@@ -604,9 +481,9 @@ PressureDependMultiYield::getTangent (void)
     double bulkModulus = factor*refBulkModulus;
 
 	// volumetric plasticity
-	if (Hvx[matN] != 0. && trialStress.volume()<=maxPress && strainRate.volume()<0.) {
+	if (params->Hv != 0. && trialStress.volume()<=maxPress && strainRate.volume()<0.) {
 	  double tp = fabs(trialStress.volume() - residualPress);
-      bulkModulus = (bulkModulus*Hvx[matN]*pow(tp,Pvx[matN]))/(bulkModulus+Hvx[matN]*pow(tp,Pvx[matN]));
+      bulkModulus = (bulkModulus*params->Hv*pow(tp,params->Pv))/(bulkModulus+params->Hv*pow(tp,params->Pv));
 	}
 
     if (loadStage!=0 && committedActiveSurf > 0) {
@@ -650,7 +527,7 @@ PressureDependMultiYield::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -676,14 +553,14 @@ PressureDependMultiYield::getTangent (void)
 const Matrix &
 PressureDependMultiYield::getInitialTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage==2 && initPress==refPressure)
 	  initPress = currentStress.volume();
@@ -710,7 +587,7 @@ PressureDependMultiYield::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -735,10 +612,10 @@ PressureDependMultiYield::getInitialTangent (void)
 const Vector &
 PressureDependMultiYield::getStress (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   int i, is;
   if (loadStage == 1 && e2p == 0)
@@ -814,7 +691,7 @@ PressureDependMultiYield::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-		static Vector workV(3);
+		static thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -831,8 +708,8 @@ PressureDependMultiYield::getStrain (void)
 int
 PressureDependMultiYield::commitState (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   currentStress = trialStress;
   //currentStrain = T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
@@ -892,8 +769,8 @@ PressureDependMultiYield::getCopy (const char *code)
 const char *
 PressureDependMultiYield::getType (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -901,8 +778,8 @@ PressureDependMultiYield::getType (void) const
 int
 PressureDependMultiYield::getOrder (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? 3 : 6;
 }
@@ -933,22 +810,22 @@ PressureDependMultiYield::updateParameter(int responseID, Information &info)
 {
   if (responseID == 1) {
     //    opserr << "PressureDependMultiYield::updateParameter() - materialStage " << info.theInt << endln;
-    loadStagex[matN] = info.theInt;
+    params->loadStage = info.theInt;
   }
 
   else if (responseID==10) {
     //    opserr << "PressureDependMultiYield::updateParameter() - shearModulus " << info.theDouble << endln;
-    refShearModulusx[matN]=info.theDouble;
+    params->refShearModulus=info.theDouble;
   }
 
   else if (responseID==11) {
     //    opserr << "PressureDependMultiYield::updateParameter() - bulkModulus " << info.theDouble << endln;
-    refBulkModulusx[matN]=info.theDouble;
+    params->refBulkModulus=info.theDouble;
   }
 
   // used by BBarFourNodeQuadUP element
-  else if (responseID==20 && ndmx[matN] == 2)
-		ndmx[matN] = 0;
+  else if (responseID==20 && params->ndm == 2)
+		params->ndm = 0;
 
   return 0;
 }
@@ -956,39 +833,38 @@ PressureDependMultiYield::updateParameter(int responseID, Information &info)
 int
 PressureDependMultiYield::sendSelf(int commitTag, Channel &theChannel)
 {
-    int loadStage = loadStagex[matN];
-    int ndm = ndmx[matN];
-	double rho = rhox[matN];
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
-	double contractParam1 = contractParam1x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double liquefyParam4 = liquefyParam4x[matN];
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
+    int loadStage = params->loadStage;
+    int ndm = params->ndm;
+	double rho = params->rho;
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
+	double contractParam1 = params->contractParam1;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double liquefyParam4 = params->liquefyParam4;
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
 
   int i, res = 0;
 
-  static ID idData(5);
+  static thread_local ID idData(4);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
   idData(3) = ndm;
-  idData(4) = matN;
 
   res += theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -1013,7 +889,7 @@ PressureDependMultiYield::sendSelf(int commitTag, Channel &theChannel)
   data(13) = volLimit1;
   data(14) = volLimit2;
   data(15) = volLimit3;
-  data(16) = pAtm;
+  data(16) = params->pAtm;
   data(17) = liquefyParam1;
   data(18) = liquefyParam2;
   data(19) = liquefyParam4;
@@ -1078,7 +954,7 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(5);
+  static thread_local ID idData(4);
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PressureDependMultiYield::recvelf -- could not recv ID\n";
@@ -1090,7 +966,7 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
   int numOfSurfaces = idData(1);
   int loadStage = idData(2);
   int ndm = idData(3);
-  matN = idData(4);
+  params = std::make_shared<Parameters>();
 
   Vector data(70+idData(1)*8);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
@@ -1115,7 +991,7 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
   double volLimit1 = data(13);
   double volLimit2 = data(14);
   double volLimit3 = data(15);
-  pAtm = data(16);
+  params->pAtm = data(16);
   double liquefyParam1 = data(17);
   double liquefyParam2 = data(18);
   double liquefyParam4 = data(19);
@@ -1169,131 +1045,30 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
     committedSurfaces[i+1].setData(workV6, data(k), data(k+1));
   }
 
-  int *temp1, *temp2, *temp11;
-  double *temp3, *temp4, *temp5, *temp6, *temp7, *temp8, *temp9, *temp10, *temp12;
-  double *temp13, *temp14, *temp15, *temp16, *temp17, *temp18, *temp19, *temp20;
-  double *temp21, *temp22, *temp23, *temp24, *temp25, *temp26;
-
-  if (matN >= matCount*20) {  // allocate memory if not enough
-     temp1 = loadStagex;
-	 temp2 = ndmx;
-	 temp3 = rhox;
-     temp4 = refShearModulusx;
-     temp5 = refBulkModulusx;
-     temp6 = frictionAnglex;
-     temp7 = peakShearStrainx;
-     temp8 = refPressurex;
-     temp9 = cohesionx;
-     temp10 = pressDependCoeffx;
-	 temp11 = numOfSurfacesx;
-     temp12 = residualPressx;
-     temp13 = phaseTransfAnglex;
-     temp14 = contractParam1x;
-     temp15 = dilateParam1x;
-     temp16 = dilateParam2x;
-     temp17 = liquefyParam1x;
-     temp18 = liquefyParam2x;
-     temp19 = liquefyParam4x;
-     temp20 = einitx;    //initial void ratio
-     temp21 = volLimit1x;
-     temp22 = volLimit2x;
-     temp23 = volLimit3x;
-     temp24 = stressRatioPTx;
-	 temp25 = Hvx;
-	 temp26 = Pvx;
-
-     loadStagex = new int[(matCount+1)*20];
-     ndmx = new int[(matCount+1)*20];
-     rhox = new double[(matCount+1)*20];
-     refShearModulusx = new double[(matCount+1)*20];
-     refBulkModulusx = new double[(matCount+1)*20];
-     frictionAnglex = new double[(matCount+1)*20];
-     peakShearStrainx = new double[(matCount+1)*20];
-     refPressurex = new double[(matCount+1)*20];
-	 cohesionx = new double[(matCount+1)*20];
-     pressDependCoeffx = new double[(matCount+1)*20];
-     numOfSurfacesx = new int[(matCount+1)*20];
-     residualPressx = new double[(matCount+1)*20];
-     phaseTransfAnglex = new double[(matCount+1)*20];
-     contractParam1x = new double[(matCount+1)*20];
-     dilateParam1x = new double[(matCount+1)*20];
-     dilateParam2x = new double[(matCount+1)*20];
-     liquefyParam1x = new double[(matCount+1)*20];
-     liquefyParam2x = new double[(matCount+1)*20];
-     liquefyParam4x = new double[(matCount+1)*20];
-     einitx = new double[(matCount+1)*20];    //initial void ratio
-     volLimit1x = new double[(matCount+1)*20];
-     volLimit2x = new double[(matCount+1)*20];
-     volLimit3x = new double[(matCount+1)*20];
-     stressRatioPTx = new double[(matCount+1)*20];
-	 Hvx = new double[(matCount+1)*20];
-	 Pvx = new double[(matCount+1)*20];
-
-     if( matCount > 0 ) {
-		 for (int i=0; i<matCount*20; i++) {
-			 loadStagex[i] = temp1[i];
-			 ndmx[i] = temp2[i];
-			 rhox[i] = temp3[i];
-			 refShearModulusx[i] = temp4[i];
-			 refBulkModulusx[i] = temp5[i];
-			 frictionAnglex[i] = temp6[i];
-			 peakShearStrainx[i] = temp7[i];
-			 refPressurex[i] = temp8[i];
-			 cohesionx[i] = temp9[i];
-			 pressDependCoeffx[i] = temp10[i];
-			 numOfSurfacesx[i] = temp11[i];
-			 residualPressx[i] = temp12[i];
-			 phaseTransfAnglex[i] = temp13[i];
-			 contractParam1x[i] = temp14[i];
-			 dilateParam1x[i] = temp15[i];
-			 dilateParam2x[i] = temp16[i];
-			 liquefyParam1x[i] = temp17[i];
-			 liquefyParam2x[i] = temp18[i];
-			 liquefyParam4x[i] = temp19[i];
-			 einitx[i] = temp20[i];    //initial void ratio
-			 volLimit1x[i] = temp21[i];
-			 volLimit2x[i] = temp22[i];
-			 volLimit3x[i] = temp23[i];
-			 stressRatioPTx[i] = temp24[i];
-			 Hvx[i] = temp25[i];
-			 Pvx[i] = temp26[i];
-		 }
-
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; delete [] temp15; delete [] temp16;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; delete [] temp26;
-     }
-     matCount ++;
-  }
-
-	loadStagex[matN] = loadStage;
-	ndmx[matN] = ndm;
-	rhox[matN] = rho;
-	residualPressx[matN] = residualPress;
-	numOfSurfacesx[matN] = numOfSurfaces;
-	refPressurex[matN] = refPressure;
-	pressDependCoeffx[matN] =pressDependCoeff;
-	refShearModulusx[matN] = refShearModulus;
-	refBulkModulusx[matN] = refBulkModulus;
-	frictionAnglex[matN] = frictionAngle;
-	cohesionx[matN] = cohesion;
-	peakShearStrainx[matN] = peakShearStrain;
-	phaseTransfAnglex[matN] = phaseTransfAngle;
-	stressRatioPTx[matN] = stressRatioPT;
-	contractParam1x[matN] = contractParam1;
-	dilateParam1x[matN] = dilateParam1;
-	dilateParam2x[matN] = dilateParam2;
-	liquefyParam1x[matN] = liquefyParam1;
-	liquefyParam2x[matN] = liquefyParam2;
-	liquefyParam4x[matN] = liquefyParam4;
-	einitx[matN] = einit;
-	volLimit1x[matN] = volLimit1;
-	volLimit2x[matN] = volLimit2;
-	volLimit3x[matN] = volLimit3;
+	params->loadStage = loadStage;
+	params->ndm = ndm;
+	params->rho = rho;
+	params->residualPress = residualPress;
+	params->numOfSurfaces = numOfSurfaces;
+	params->refPressure = refPressure;
+	params->pressDependCoeff =pressDependCoeff;
+	params->refShearModulus = refShearModulus;
+	params->refBulkModulus = refBulkModulus;
+	params->frictionAngle = frictionAngle;
+	params->cohesion = cohesion;
+	params->peakShearStrain = peakShearStrain;
+	params->phaseTransfAngle = phaseTransfAngle;
+	params->stressRatioPT = stressRatioPT;
+	params->contractParam1 = contractParam1;
+	params->dilateParam1 = dilateParam1;
+	params->dilateParam2 = dilateParam2;
+	params->liquefyParam1 = liquefyParam1;
+	params->liquefyParam2 = liquefyParam2;
+	params->liquefyParam4 = liquefyParam4;
+	params->einit = einit;
+	params->volLimit1 = volLimit1;
+	params->volLimit2 = volLimit2;
+	params->volLimit3 = volLimit3;
 
   return res;
 }
@@ -1316,7 +1091,7 @@ PressureDependMultiYield::setResponse (const char **argv, int argc, OPS_Stream &
     return new MaterialResponse(this, 3, this->getTangent());
 
   else if (strcmp(argv[0],"backbone") == 0) {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
     Matrix curv(numOfSurfaces+1,(argc-1)*2);
     for (int i=1; i<argc; i++) {
       curv(0,(i-1)*2) = atoi(argv[i]);
@@ -1331,11 +1106,11 @@ PressureDependMultiYield::setResponse (const char **argv, int argc, OPS_Stream &
 void
 PressureDependMultiYield::getBackbone (Matrix & bb)
 {
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  double refShearModulus = refShearModulusx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  double refShearModulus = params->refShearModulus;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double vol, conHeig, scale, factor, shearModulus, stress1,
     stress2, strain1, strain2, plastModulus, elast_plast, gre;
@@ -1424,22 +1199,22 @@ void
 PressureDependMultiYield::Print(OPS_Stream &s, int flag )
 
 {
-  int theLoadStage = loadStagex[matN];
+  int theLoadStage = params->loadStage;
   s << "PressureDependMultiYield - loadSatge: " << theLoadStage << endln;
 }
 
 const Vector &
 PressureDependMultiYield::getCommittedStress (void)
 {
-  int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
-  int numOfSurfaces = numOfSurfacesx[matN];
-  double residualPress = residualPressx[matN];
+  int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
+  int numOfSurfaces = params->numOfSurfaces;
+  double residualPress = params->residualPress;
 
   double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
-  if (loadStagex[matN] != 1) scale = 0.;
+  if (params->loadStage != 1) scale = 0.;
   if (ndm==3) {
-		static Vector temp7(7);
+		static thread_local Vector temp7(7);
 		workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -1452,7 +1227,7 @@ PressureDependMultiYield::getCommittedStress (void)
 	}
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 		workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1460,8 +1235,8 @@ PressureDependMultiYield::getCommittedStress (void)
     temp5[3] = workV6[3];
     temp5[4] = scale;
     /*temp5[5] = committedActiveSurf;
-	temp5[6] = stressRatioPTx[matN];
-	temp5[7] = currentStress.deviatorRatio(residualPressx[matN]);
+	temp5[6] = params->stressRatioPT;
+	temp5[7] = currentStress.deviatorRatio(params->residualPress);
     temp5[8] = pressureDCommitted;
     temp5[9] = cumuDilateStrainOctaCommitted;
     temp5[10] = maxCumuDilateStrainOctaCommitted;
@@ -1476,15 +1251,15 @@ PressureDependMultiYield::getCommittedStress (void)
 const Vector &
 PressureDependMultiYield::getStressToRecord (int numOutput)
 {
-  int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	static thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		static thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1502,18 +1277,18 @@ PressureDependMultiYield::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		static thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		static thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1533,13 +1308,13 @@ PressureDependMultiYield::getStressToRecord (int numOutput)
 const
 Vector & PressureDependMultiYield::getCommittedStrain (void)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-		static Vector workV(3);
+		static thread_local Vector workV(3);
 		workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -1552,16 +1327,16 @@ Vector & PressureDependMultiYield::getCommittedStrain (void)
 void
 PressureDependMultiYield::setUpSurfaces (double * gredu)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+    int numOfSurfaces = params->numOfSurfaces;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
 
     double refStrain, peakShear, coneHeight;
     double stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
@@ -1575,7 +1350,7 @@ PressureDependMultiYield::setUpSurfaces (double * gredu)
 		// tao = cohesion * sqrt(8.0)/3.
     residualPress = 2 * cohesion / Mnys;
     // a small nonzero residualPress for numerical purpose only
-    if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+    if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
     coneHeight = - (refPressure - residualPress);
     peakShear = sqrt(2.) * coneHeight * Mnys / 3.;
     refStrain = (peakShearStrain * peakShear)
@@ -1616,7 +1391,7 @@ PressureDependMultiYield::setUpSurfaces (double * gredu)
 		double tmax = refShearModulus*gredu[ii]*gredu[ii+1];
 		double Mnys = -(sqrt(3.) * tmax - 2.* cohesion) / refPressure;
     residualPress = 2 * cohesion / Mnys;
-    if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+    if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
     coneHeight = - (refPressure - residualPress);
 
     double sinPhi = 3*Mnys /(6+Mnys);
@@ -1678,11 +1453,11 @@ PressureDependMultiYield::setUpSurfaces (double * gredu)
 		}
   }
 
-  residualPressx[matN] = residualPress;
-  frictionAnglex[matN] = frictionAngle;
-  cohesionx[matN] = cohesion;
-  phaseTransfAnglex[matN] = phaseTransfAngle;
-  stressRatioPTx[matN] = stressRatioPT;
+  params->residualPress = residualPress;
+  params->frictionAngle = frictionAngle;
+  params->cohesion = cohesion;
+  params->phaseTransfAngle = phaseTransfAngle;
+  params->stressRatioPT = stressRatioPT;
 }
 
 double
@@ -1690,7 +1465,7 @@ PressureDependMultiYield::yieldFunc(const T2Vector & stress,
 					   const MultiYieldSurface * surfaces,
 					   int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
+  double residualPress = params->residualPress;
 
   double coneHeight = stress.volume() - residualPress;
   //workV6 = stress.deviator() - surfaces[surfaceNum].center()*coneHeight;
@@ -1707,8 +1482,8 @@ PressureDependMultiYield::deviatorScaling(T2Vector & stress,
 					       const MultiYieldSurface * surfaces,
 					       int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double diff = yieldFunc(stress, surfaces, surfaceNum);
   double coneHeight = stress.volume() - residualPress;
@@ -1716,7 +1491,7 @@ PressureDependMultiYield::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    static thread_local Vector devia(6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1740,13 +1515,13 @@ PressureDependMultiYield::deviatorScaling(T2Vector & stress,
 void
 PressureDependMultiYield::initSurfaceUpdate(void)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  static thread_local Vector devia(6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -1773,12 +1548,12 @@ PressureDependMultiYield::initSurfaceUpdate(void)
 void
 PressureDependMultiYield::initStrainUpdate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double stressRatioPT = params->stressRatioPT;
 
   // elastic strain state
   double stressRatio = currentStress.deviatorRatio(residualPress);
@@ -1821,9 +1596,9 @@ PressureDependMultiYield::initStrainUpdate(void)
 double
 PressureDependMultiYield::getModulusFactor(T2Vector & stress)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
 
   double conHeig = stress.volume() - residualPress;
   double scale = conHeig / (refPressure-residualPress);
@@ -1835,8 +1610,8 @@ PressureDependMultiYield::getModulusFactor(T2Vector & stress)
 void
 PressureDependMultiYield::setTrialStress(T2Vector & stress)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   modulusFactor = getModulusFactor(stress);
   //workV6 = stress.deviator()
@@ -1846,9 +1621,9 @@ PressureDependMultiYield::setTrialStress(T2Vector & stress)
 
   double B = refBulkModulus*modulusFactor;
 
-  if (Hvx[matN] != 0. && trialStress.volume()<=maxPress && subStrainRate.volume()<0.) {
-     double tp = fabs(trialStress.volume() - residualPressx[matN]);
-     B = (B*Hvx[matN]*pow(tp,Pvx[matN]))/(B+Hvx[matN]*pow(tp,Pvx[matN]));
+  if (params->Hv != 0. && trialStress.volume()<=maxPress && subStrainRate.volume()<0.) {
+     double tp = fabs(trialStress.volume() - params->residualPress);
+     B = (B*params->Hv*pow(tp,params->Pv))/(B+params->Hv*pow(tp,params->Pv));
   }
 
   double volume = stress.volume() + subStrainRate.volume()*3.*B;
@@ -1860,9 +1635,9 @@ PressureDependMultiYield::setTrialStress(T2Vector & stress)
 int
 PressureDependMultiYield::setSubStrainRate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    double refShearModulus = params->refShearModulus;
+	int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum==numOfSurfaces) return 1;
   if (strainRate.isZero()) return 0;
@@ -1901,10 +1676,10 @@ PressureDependMultiYield::setSubStrainRate(void)
 void
 PressureDependMultiYield::getContactStress(T2Vector &contactStress)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -1936,11 +1711,11 @@ PressureDependMultiYield::isLoadReversal(const T2Vector & stress)
 void
 PressureDependMultiYield::getSurfaceNormal(const T2Vector & stress, T2Vector &normal)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -1956,12 +1731,12 @@ double
 PressureDependMultiYield::getPlasticPotential(const T2Vector & contactStress,
 					      const T2Vector & surfaceNormal)
 {
-    double residualPress = residualPressx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-	double contractParam1 = contractParam1x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
+    double residualPress = params->residualPress;
+    double stressRatioPT = params->stressRatioPT;
+    int numOfSurfaces = params->numOfSurfaces;
+	double contractParam1 = params->contractParam1;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
 
   double plasticPotential, contractRule, unloadRule, dilateRule, shearLoading, temp;
 
@@ -2031,10 +1806,10 @@ PressureDependMultiYield::getPlasticPotential(const T2Vector & contactStress,
 int
 PressureDependMultiYield::isCriticalState(const T2Vector & stress)
 {
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
 
   double vol = trialStrain.volume()*3.0;
 	double etria = einit + vol + vol*einit;
@@ -2043,11 +1818,11 @@ PressureDependMultiYield::isCriticalState(const T2Vector & stress)
 
 	double ecr1, ecr2;
 	if (volLimit3 != 0.) {
-		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/pAtm), volLimit3);
-	  ecr2 = volLimit1 - volLimit2*pow(fabs(-currentStress.volume()/pAtm), volLimit3);
+		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/params->pAtm), volLimit3);
+	  ecr2 = volLimit1 - volLimit2*pow(fabs(-currentStress.volume()/params->pAtm), volLimit3);
 	} else {
-		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/pAtm));
-	  ecr2 = volLimit1 - volLimit2*log(fabs(-currentStress.volume()/pAtm));
+		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/params->pAtm));
+	  ecr2 = volLimit1 - volLimit2*log(fabs(-currentStress.volume()/params->pAtm));
   }
 
 	if (ecurr < ecr2 && etria < ecr1) return 0;
@@ -2058,10 +1833,10 @@ PressureDependMultiYield::isCriticalState(const T2Vector & stress)
 void
 PressureDependMultiYield::updatePPZ(const T2Vector & contactStress)
 {
-  double liquefyParam1 = liquefyParam1x[matN];
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
+  double liquefyParam1 = params->liquefyParam1;
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
 
   // PPZ inactive if liquefyParam1==0.
   if (liquefyParam1==0.) {
@@ -2157,7 +1932,7 @@ PressureDependMultiYield::updatePPZ(const T2Vector & contactStress)
 void
 PressureDependMultiYield::PPZTranslation(const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
+	double liquefyParam1 = params->liquefyParam1;
 
   if (liquefyParam1==0.) return;
 
@@ -2181,9 +1956,9 @@ PressureDependMultiYield::PPZTranslation(const T2Vector & contactStress)
 double
 PressureDependMultiYield::getPPZLimits(int which, const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double liquefyParam4 = liquefyParam4x[matN];
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double liquefyParam4 = params->liquefyParam4;
 
   double PPZLimit, temp;
   double volume = -contactStress.volume();
@@ -2212,9 +1987,9 @@ PressureDependMultiYield::getLoadingFunc(const T2Vector & contactStress,
 					 double plasticPotential,
 					 int crossedSurface)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   double loadingFunc, limit;
   double modul = theSurfaces[activeSurfaceNum].modulus();
@@ -2254,12 +2029,12 @@ PressureDependMultiYield::getLoadingFunc(const T2Vector & contactStress,
 int
 PressureDependMultiYield::stressCorrection(int crossedSurface)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
-  static T2Vector contactStress;
+  static thread_local T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  static thread_local T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   if (plasticPotential==LOCK_VALUE && (onPPZ == -1 || onPPZ == 1)) {
@@ -2305,16 +2080,16 @@ PressureDependMultiYield::stressCorrection(int crossedSurface)
 void
 PressureDependMultiYield::updateActiveSurface(void)
 {
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  static thread_local Vector t1(6);
+  static thread_local Vector t2(6);
+  static thread_local Vector center(6);
+  static thread_local Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2383,11 +2158,11 @@ PressureDependMultiYield::updateActiveSurface(void)
 void
 PressureDependMultiYield::updateInnerSurface(void)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	static thread_local Vector devia(6);
+	static thread_local Vector center(6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
@@ -2410,7 +2185,7 @@ PressureDependMultiYield::updateInnerSurface(void)
 int
 PressureDependMultiYield:: isCrossingNextSurface(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return 0;
 
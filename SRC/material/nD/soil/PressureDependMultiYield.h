@@ -14,6 +14,7 @@
 #ifndef PressureDependMultiYield_h
 #define PressureDependMultiYield_h
 
+#include <memory>
 #include <NDMaterial.h>
 #include "soil/T2Vector.h"
 #include <Matrix.h>
@@ -61,7 +62,7 @@ public:
      virtual ~PressureDependMultiYield ();
 
      const char *getClassType(void) const {return "PressureDependMultiYield";};     
-     double getRho(void) {return rhox[matN];} ;
+     double getRho(void) {return params->rho;} ;
 
      // Sets the values of the trial strain tensor.
      int setTrialStrain (const Vector &strain);
@@ -120,39 +121,41 @@ protected:
 
 private:
   // user supplied 
-	 static int matCount;
-     static int* ndmx;  //num of dimensions (2 or 3)
-     static int* loadStagex;  //=0 if elastic; =1 or 2 if plastic
-     static double* rhox;  //mass density
-     static double* refShearModulusx;
-     static double* refBulkModulusx;
-     static double* frictionAnglex;
-     static double* peakShearStrainx;
-     static double* refPressurex;
-     static double* cohesionx;
-     static double* pressDependCoeffx;
-     static int*    numOfSurfacesx;
-     static double* phaseTransfAnglex; 
-     static double* contractParam1x;
-     static double* dilateParam1x;
-     static double* dilateParam2x;
-     static double* liquefyParam1x;
-     static double* liquefyParam2x;
-     static double* liquefyParam4x;
-     static double* einitx;    //initial void ratio
-     static double* volLimit1x;
-     static double* volLimit2x;
-     static double* volLimit3x;
-     static double pAtm;
-	 static double* Hvx;
-	 static double* Pvx;
+	// Parameters shared by a material and its copies
+	struct Parameters {
+	  int    ndm;  //num of dimensions (2 or 3)
+	  int    loadStage;  //=0 if elastic; =1 or 2 if plastic
+	  double rho;  //mass density
+	  double refShearModulus;
+	  double refBulkModulus;
+	  double frictionAngle;
+	  double peakShearStrain;
+	  double refPressure;
+	  double cohesion;
+	  double pressDependCoeff;
+	  int    numOfSurfaces;
+	  double phaseTransfAngle;
+	  double contractParam1;
+	  double dilateParam1;
+	  double dilateParam2;
+	  double liquefyParam1;
+	  double liquefyParam2;
+	  double liquefyParam4;
+	  double einit;    //initial void ratio
+	  double volLimit1;
+	  double volLimit2;
+	  double volLimit3;
+	  double pAtm;
+	  double Hv;
+	  double Pv;
+	  double residualPress;
+	  double stressRatioPT;
+	};
 
      // internal
-     static double* residualPressx;
-     static double* stressRatioPTx;
-     static Matrix theTangent;
+     static thread_local Matrix theTangent;
      
-	 int matN;
+	 std::shared_ptr<Parameters> params;
      int e2p;
      MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
      MultiYieldSurface * committedSurfaces;  
@@ -164,7 +167,7 @@ private:
      T2Vector trialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     static thread_local T2Vector subStrainRate;
 
      double pressureD;
      T2Vector reversalStress;
@@ -176,7 +179,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
      T2Vector lockStress;
@@ -193,8 +196,8 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
      T2Vector lockStressCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
 	 double maxPress;
      
      void elast2Plast(void);
@@ -21,43 +21,13 @@
 #include <elementAPI.h>
 #include <MultiYieldSurface.h>
 
-int PressureDependMultiYield02::matCount=0;
-int* PressureDependMultiYield02::loadStagex = 0;  //=0 if elastic; =1 if plastic
-int* PressureDependMultiYield02::ndmx=0;  //num of dimensions (2 or 3)
-double* PressureDependMultiYield02::rhox=0;
-double* PressureDependMultiYield02::refShearModulusx=0;
-double* PressureDependMultiYield02::refBulkModulusx=0;
-double* PressureDependMultiYield02::frictionAnglex=0;
-double* PressureDependMultiYield02::peakShearStrainx=0;
-double* PressureDependMultiYield02::refPressurex=0;
-double* PressureDependMultiYield02::cohesionx=0;
-double* PressureDependMultiYield02::pressDependCoeffx=0;
-int*    PressureDependMultiYield02::numOfSurfacesx=0;
-double* PressureDependMultiYield02::phaseTransfAnglex=0;
-double* PressureDependMultiYield02::contractParam1x=0;
-double* PressureDependMultiYield02::contractParam2x=0;
-double* PressureDependMultiYield02::contractParam3x=0;
-double* PressureDependMultiYield02::dilateParam1x=0;
-double* PressureDependMultiYield02::dilateParam2x=0;
-double* PressureDependMultiYield02::liquefyParam1x=0;
-double* PressureDependMultiYield02::liquefyParam2x=0;
-double* PressureDependMultiYield02::dilateParam3x=0;
-double* PressureDependMultiYield02::einitx=0;    //initial void ratio
-double* PressureDependMultiYield02::volLimit1x=0;
-double* PressureDependMultiYield02::volLimit2x=0;
-double* PressureDependMultiYield02::volLimit3x=0;
-double* PressureDependMultiYield02::residualPressx=0;
-double* PressureDependMultiYield02::stressRatioPTx=0;
-double* PressureDependMultiYield02::Hvx=0;
-double* PressureDependMultiYield02::Pvx=0;
-
-double PressureDependMultiYield02::pAtm = 101.;
-
-Matrix PressureDependMultiYield02::theTangent(6,6);
-T2Vector PressureDependMultiYield02::trialStrain;
-T2Vector PressureDependMultiYield02::subStrainRate;
-Vector PressureDependMultiYield02::workV6(6);
-T2Vector PressureDependMultiYield02::workT2V;
+
+
+thread_local Matrix PressureDependMultiYield02::theTangent(6,6);
+thread_local T2Vector PressureDependMultiYield02::trialStrain;
+thread_local T2Vector PressureDependMultiYield02::subStrainRate;
+thread_local Vector PressureDependMultiYield02::workV6(6);
+thread_local T2Vector PressureDependMultiYield02::workT2V;
 const	double pi = 3.14159265358979;
 
 //double check;
@@ -123,7 +93,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependMultiYield02)
 	    return 0;
 	}
 
-    static double * gredu = 0;
+    static thread_local double * gredu = 0;
 
     // user defined yield surfaces
     if (param[numParam] < 0 && param[numParam] > -100) {
@@ -270,144 +240,42 @@ PressureDependMultiYield02::PressureDependMultiYield02 (int tag, int nd,
    exit(-1);
   }
 
-  if (matCount%20 == 0) {
-     int * temp1 = loadStagex;
-	 int * temp2 = ndmx;
-	 double * temp3 = rhox;
-     double * temp4 = refShearModulusx;
-     double * temp5 = refBulkModulusx;
-     double * temp6 = frictionAnglex;
-     double * temp7 = peakShearStrainx;
-     double * temp8 = refPressurex;
-     double * temp9 = cohesionx;
-     double * temp10 = pressDependCoeffx;
-	 int * temp11 = numOfSurfacesx;
-     double * temp12 = residualPressx;
-     double * temp13 = phaseTransfAnglex;
-     double * temp14 = contractParam1x;
-     double * temp14a = contractParam2x;
-     double * temp14b = contractParam3x;
-     double * temp15 = dilateParam1x;
-     double * temp16 = dilateParam2x;
-     double * temp17 = liquefyParam1x;
-     double * temp18 = liquefyParam2x;
-     double * temp19 = dilateParam3x;
-     double * temp20 = einitx;    //initial void ratio
-     double * temp21 = volLimit1x;
-     double * temp22 = volLimit2x;
-     double * temp23 = volLimit3x;
-     double * temp24 = stressRatioPTx;
-	 double * temp25 = Hvx;
-	 double * temp26 = Pvx;
-
-     loadStagex = new int[matCount+20];
-     ndmx = new int[matCount+20];
-     rhox = new double[matCount+20];
-     refShearModulusx = new double[matCount+20];
-     refBulkModulusx = new double[matCount+20];
-     frictionAnglex = new double[matCount+20];
-     peakShearStrainx = new double[matCount+20];
-     refPressurex = new double[matCount+20];
-	 cohesionx = new double[matCount+20];
-     pressDependCoeffx = new double[matCount+20];
-     numOfSurfacesx = new int[matCount+20];
-     residualPressx = new double[matCount+20];
-     phaseTransfAnglex = new double[matCount+20];
-     contractParam1x = new double[matCount+20];
-     contractParam2x = new double[matCount+20];
-     contractParam3x = new double[matCount+20];
-     dilateParam1x = new double[matCount+20];
-     dilateParam2x = new double[matCount+20];
-     liquefyParam1x = new double[matCount+20];
-     liquefyParam2x = new double[matCount+20];
-     dilateParam3x = new double[matCount+20];
-     einitx = new double[matCount+20];    //initial void ratio
-     volLimit1x = new double[matCount+20];
-     volLimit2x = new double[matCount+20];
-     volLimit3x = new double[matCount+20];
-     stressRatioPTx = new double[matCount+20];
-	 Hvx = new double[matCount+20];
-	 Pvx = new double[matCount+20];
-
-	 for (int i=0; i<matCount; i++) {
-         loadStagex[i] = temp1[i];
-		 ndmx[i] = temp2[i];
-         rhox[i] = temp3[i];
-	     refShearModulusx[i] = temp4[i];
-         refBulkModulusx[i] = temp5[i];
-         frictionAnglex[i] = temp6[i];
-         peakShearStrainx[i] = temp7[i];
-         refPressurex[i] = temp8[i];
-         cohesionx[i] = temp9[i];
-         pressDependCoeffx[i] = temp10[i];
-         numOfSurfacesx[i] = temp11[i];
-         residualPressx[i] = temp12[i];
-         phaseTransfAnglex[i] = temp13[i];
-         contractParam1x[i] = temp14[i];
-         contractParam2x[i] = temp14a[i];
-         contractParam3x[i] = temp14b[i];
-         dilateParam1x[i] = temp15[i];
-         dilateParam2x[i] = temp16[i];
-         liquefyParam1x[i] = temp17[i];
-         liquefyParam2x[i] = temp18[i];
-         dilateParam3x[i] = temp19[i];
-         einitx[i] = temp20[i];    //initial void ratio
-         volLimit1x[i] = temp21[i];
-         volLimit2x[i] = temp22[i];
-         volLimit3x[i] = temp23[i];
-         stressRatioPTx[i] = temp24[i];
-		 Hvx[i] = temp25[i];
-		 Pvx[i] = temp26[i];
-     }
-
-	 if (matCount > 0) {
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; delete [] temp14a; delete [] temp14b;
-		 delete [] temp15; delete [] temp16;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; delete [] temp26;
-     }
-  }
-
-  ndmx[matCount] = nd;
-  loadStagex[matCount] = 0;   //default
-  refShearModulusx[matCount] = refShearModul;
-  refBulkModulusx[matCount] = refBulkModul;
-  frictionAnglex[matCount] = frictionAng;
-  peakShearStrainx[matCount] = peakShearStra;
-  refPressurex[matCount] = -refPress;  //compression is negative
-  cohesionx[matCount] = cohesi;
-  pressDependCoeffx[matCount] = pressDependCoe;
-  numOfSurfacesx[matCount] = numberOfYieldSurf;
-  rhox[matCount] = r;
-  phaseTransfAnglex[matCount] = phaseTransformAng;
-  contractParam1x[matCount] = contractionParam1;
-  contractParam2x[matCount] = contractionParam2;
-  contractParam3x[matCount] = contractionParam3;
-  dilateParam1x[matCount] = dilationParam1;
-  dilateParam2x[matCount] = dilationParam2;
-  volLimit1x[matCount] = volLim1;
-  volLimit2x[matCount] = volLim2;
-  volLimit3x[matCount] = volLim3;
-  liquefyParam1x[matCount] = liquefactionParam1;
-  liquefyParam2x[matCount] = liquefactionParam2;
-  dilateParam3x[matCount] = dilationParam3;
-  einitx[matCount] = ei;
-  Hvx[matCount] = hv;
-  Pvx[matCount] = pv;
-
-  residualPressx[matCount] =0.;
-  stressRatioPTx[matCount] =0.;
-
-  matN = matCount;
-  matCount ++;
-  pAtm = atm;
-
-  int numOfSurfaces = numOfSurfacesx[matN];
-  initPress = refPressurex[matN];
+  params = std::make_shared<Parameters>();
+
+  params->ndm = nd;
+  params->loadStage = 0;   //default
+  params->refShearModulus = refShearModul;
+  params->refBulkModulus = refBulkModul;
+  params->frictionAngle = frictionAng;
+  params->peakShearStrain = peakShearStra;
+  params->refPressure = -refPress;  //compression is negative
+  params->cohesion = cohesi;
+  params->pressDependCoeff = pressDependCoe;
+  params->numOfSurfaces = numberOfYieldSurf;
+  params->rho = r;
+  params->phaseTransfAngle = phaseTransformAng;
+  params->contractParam1 = contractionParam1;
+  params->contractParam2 = contractionParam2;
+  params->contractParam3 = contractionParam3;
+  params->dilateParam1 = dilationParam1;
+  params->dilateParam2 = dilationParam2;
+  params->volLimit1 = volLim1;
+  params->volLimit2 = volLim2;
+  params->volLimit3 = volLim3;
+  params->liquefyParam1 = liquefactionParam1;
+  params->liquefyParam2 = liquefactionParam2;
+  params->dilateParam3 = dilationParam3;
+  params->einit = ei;
+  params->Hv = hv;
+  params->Pv = pv;
+
+  params->residualPress =0.;
+  params->stressRatioPT =0.;
+
+  params->pAtm = atm;
+
+  int numOfSurfaces = params->numOfSurfaces;
+  initPress = params->refPressure;
 
   e2p = committedActiveSurf = activeSurfaceNum = 0;
   onPPZCommitted = onPPZ = -1 ;
@@ -447,9 +315,9 @@ PressureDependMultiYield02::PressureDependMultiYield02 (const PressureDependMult
   PPZPivotCommitted(a.PPZPivotCommitted), PPZCenterCommitted(a.PPZCenterCommitted),
   PivotStrainRate(a.PivotStrainRate), PivotStrainRateCommitted(a.PivotStrainRateCommitted)
 {
-  matN = a.matN;
+  params = a.params;
 
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   e2p = a.e2p;
   strainPTOcta = a.strainPTOcta;
@@ -494,8 +362,8 @@ PressureDependMultiYield02::~PressureDependMultiYield02 ()
 
 void PressureDependMultiYield02::elast2Plast(void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (loadStage != 1 || e2p == 1) 
 		return;
@@ -529,8 +397,8 @@ void PressureDependMultiYield02::elast2Plast(void)
 
 int PressureDependMultiYield02::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -564,8 +432,8 @@ int PressureDependMultiYield02::setTrialStrain (const Vector &strain, const Vect
 
 int PressureDependMultiYield02::setTrialStrainIncr (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -596,14 +464,14 @@ int PressureDependMultiYield02::setTrialStrainIncr (const Vector &strain, const
 
 const Matrix & PressureDependMultiYield02::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) {
 //	  opserr << "PDMY02::getTang() - 1\n";
@@ -642,10 +510,10 @@ const Matrix & PressureDependMultiYield02::getTangent (void)
     double bulkModulus = factor*refBulkModulus;
 
 	// volumetric plasticity
-	if (Hvx[matN] != 0. && trialStress.volume()<=maxPress
+	if (params->Hv != 0. && trialStress.volume()<=maxPress
 		&& strainRate.volume()<0. && loadStage == 1) {
 	  double tp = fabs(trialStress.volume() - residualPress);
-      bulkModulus = (bulkModulus*Hvx[matN]*pow(tp,Pvx[matN]))/(bulkModulus+Hvx[matN]*pow(tp,Pvx[matN]));
+      bulkModulus = (bulkModulus*params->Hv*pow(tp,params->Pv))/(bulkModulus+params->Hv*pow(tp,params->Pv));
 	}
 
     /*if (loadStage!=0 && committedActiveSurf > 0) {
@@ -705,7 +573,7 @@ const Matrix & PressureDependMultiYield02::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -731,14 +599,14 @@ const Matrix & PressureDependMultiYield02::getTangent (void)
 
 const Matrix & PressureDependMultiYield02::getInitialTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) {
       initPress = currentStress.volume();
@@ -769,7 +637,7 @@ const Matrix & PressureDependMultiYield02::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -795,10 +663,10 @@ const Matrix & PressureDependMultiYield02::getInitialTangent (void)
 const Vector & PressureDependMultiYield02::getStress (void)
 {
 //	opserr << "PDMY02-getStress() -1\n";
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   int i, is;
   if (loadStage == 1 && e2p == 0) {
@@ -871,7 +739,7 @@ const Vector & PressureDependMultiYield02::getStress (void)
         stressCorrection(0);
         updateActiveSurface();
 
-	    double refBulkModulus = refBulkModulusx[matN];
+	    double refBulkModulus = params->refBulkModulus;
 		//modulusFactor was calculated in setTrialStress
         double B = refBulkModulus*modulusFactor;
 		//double deltaD = 3.*subStrainRate.volume()
@@ -889,7 +757,7 @@ const Vector & PressureDependMultiYield02::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-	static Vector workV(3);
+	static thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -906,8 +774,8 @@ const Vector & PressureDependMultiYield02::getStrain (void)
 
 int PressureDependMultiYield02::commitState (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   currentStress = trialStress;
   //currentStrain = T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
@@ -966,8 +834,8 @@ NDMaterial * PressureDependMultiYield02::getCopy (const char *code)
 
 const char * PressureDependMultiYield02::getType (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -975,8 +843,8 @@ const char * PressureDependMultiYield02::getType (void) const
 
 int PressureDependMultiYield02::getOrder (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? 3 : 6;
 }
@@ -1033,24 +901,24 @@ int PressureDependMultiYield02::updateParameter(int responseID, Information &inf
 {
  
   if (responseID == 1) {
-      loadStagex[matN] = info.theInt;
+      params->loadStage = info.theInt;
   } else if (responseID==10) {
-    refShearModulusx[matN] = info.theDouble;
+    params->refShearModulus = info.theDouble;
   } else if (responseID==11) {
-    refBulkModulusx[matN] = info.theDouble;
+    params->refBulkModulus = info.theDouble;
   } else if (responseID==12) {
-    frictionAnglex[matN] = info.theDouble;
+    params->frictionAngle = info.theDouble;
     setUpSurfaces(mGredu);
     initSurfaceUpdate();
   } else if (responseID==13) {
-    cohesionx[matN] = info.theDouble;
+    params->cohesion = info.theDouble;
     setUpSurfaces(mGredu);
     initSurfaceUpdate();
   }
 
   // used by BBarFourNodeQuadUP element
-  else if (responseID==20 && ndmx[matN] == 2)
-		ndmx[matN] = 0;
+  else if (responseID==20 && params->ndm == 2)
+		params->ndm = 0;
 
   return 0;
 }
@@ -1058,76 +926,74 @@ int PressureDependMultiYield02::updateParameter(int responseID, Information &inf
 
 int PressureDependMultiYield02::sendSelf(int commitTag, Channel &theChannel)
 {
- // ndmx[matCount] = nd;
- // loadStagex[matCount] = 0;   //default
-  //refShearModulusx[matCount] = refShearModul;
-  //refBulkModulusx[matCount] = refBulkModul;
-  //frictionAnglex[matCount] = frictionAng;
-  //peakShearStrainx[matCount] = peakShearStra;
-  //refPressurex[matCount] = -refPress;  //compression is negative
-  //cohesionx[matCount] = cohesi;
-  //pressDependCoeffx[matCount] = pressDependCoe;
-  //numOfSurfacesx[matCount] = numberOfYieldSurf;
-  // rhox[matCount] = r;
-  //phaseTransfAnglex[matCount] = phaseTransformAng;
-  //contractParam1x[matCount] = contractionParam1;
-  //contractParam2x[matCount] = contractionParam2;
+ // params->ndm = nd;
+ // params->loadStage = 0;   //default
+  //params->refShearModulus = refShearModul;
+  //params->refBulkModulus = refBulkModul;
+  //params->frictionAngle = frictionAng;
+  //params->peakShearStrain = peakShearStra;
+  //params->refPressure = -refPress;  //compression is negative
+  //params->cohesion = cohesi;
+  //params->pressDependCoeff = pressDependCoe;
+  //params->numOfSurfaces = numberOfYieldSurf;
+  // params->rho = r;
+  //params->phaseTransfAngle = phaseTransformAng;
+  //params->contractParam1 = contractionParam1;
+  //params->contractParam2 = contractionParam2;
   
-  //dilateParam1x[matCount] = dilationParam1;
-  //dilateParam2x[matCount] = dilationParam2;
-  //volLimit1x[matCount] = volLim1;
-  //volLimit2x[matCount] = volLim2;
-  //volLimit3x[matCount] = volLim3;
-  //liquefyParam1x[matCount] = liquefactionParam1;
-  //liquefyParam2x[matCount] = liquefactionParam2;
-  //dilateParam3x[matCount] = dilationParam3;
-  //einitx[matCount] = ei;
+  //params->dilateParam1 = dilationParam1;
+  //params->dilateParam2 = dilationParam2;
+  //params->volLimit1 = volLim1;
+  //params->volLimit2 = volLim2;
+  //params->volLimit3 = volLim3;
+  //params->liquefyParam1 = liquefactionParam1;
+  //params->liquefyParam2 = liquefactionParam2;
+  //params->dilateParam3 = dilationParam3;
+  //params->einit = ei;
   
 	/*
-  contractParam3x[matCount] = contractionParam3;
-  Hvx[matCount] = hv;
-  Pvx[matCount] = pv;
+  params->contractParam3 = contractionParam3;
+  params->Hv = hv;
+  params->Pv = pv;
   */
 
-    int loadStage = loadStagex[matN];
-    int ndm = ndmx[matN];
-	double rho = rhox[matN];
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
-	double contractParam1 = contractParam1x[matN];
-	double contractParam2 = contractParam2x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double dilateParam3 = dilateParam3x[matN];
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
-
-     double contractionParam3 = contractParam3x[matN];
-     double hv = Hvx[matN];
-     double Pv = Pvx[matN];
+    int loadStage = params->loadStage;
+    int ndm = params->ndm;
+	double rho = params->rho;
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
+	double contractParam1 = params->contractParam1;
+	double contractParam2 = params->contractParam2;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double dilateParam3 = params->dilateParam3;
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
+
+     double contractionParam3 = params->contractParam3;
+     double hv = params->Hv;
+     double Pv = params->Pv;
 
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
   idData(3) = ndm;
-  idData(4) = matN;
-  idData(5) = matCount;
 
   res += theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -1152,7 +1018,7 @@ int PressureDependMultiYield02::sendSelf(int commitTag, Channel &theChannel)
   data(13) = volLimit1;
   data(14) = volLimit2;
   data(15) = volLimit3;
-  data(16) = pAtm;
+  data(16) = params->pAtm;
   data(17) = liquefyParam1;
   data(18) = liquefyParam2;
   data(19) = dilateParam3;
@@ -1172,9 +1038,9 @@ int PressureDependMultiYield02::sendSelf(int commitTag, Channel &theChannel)
 
   data(33) = initPress;
   data(34) = contractParam2;
-  data(35) = contractionParam3;// = contractParam3x[matN];
-  data(36) =  hv; //  = Hvx[matN];
-  data(37) = Pv; //  = Pvx[matN];
+  data(35) = contractionParam3;// = params->contractParam3;
+  data(36) =  hv; //  = params->Hv;
+  data(37) = Pv; //  = params->Pv;
 
   workV6 = currentStress.t2Vector();
   for(i = 0; i < 6; i++) data(i+38) = workV6[i];
@@ -1216,7 +1082,7 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PressureDependMultiYield02::recvelf -- could not recv ID\n";
@@ -1228,9 +1094,7 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
   int numOfSurfaces = idData(1);
   int loadStage = idData(2);
   int ndm = idData(3);
-  matN = idData(4);
-
-  int otherMatCount = idData(5);
+  params = std::make_shared<Parameters>();
 
   Vector data(69+idData(1)*8);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
@@ -1255,7 +1119,7 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
   double volLimit1 = data(13);
   double volLimit2 = data(14);
   double volLimit3 = data(15);
-  pAtm = data(16);
+  params->pAtm = data(16);
   double liquefyParam1 = data(17);
   double liquefyParam2 = data(18);
   double dilateParam3 = data(19);
@@ -1275,9 +1139,9 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
 
   initPress = data(33);
   double contractParam2 = data(34);
-  double contractParam3 =  data(35); //  = contractionParam3;// = contractParam3x[matN];
-  double hv = data(36); // =  hv; //  = Hvx[matN];
-  double Pv = data(37); // = Pv; //  = Pvx[matN];
+  double contractParam3 =  data(35); //  = contractionParam3;// = params->contractParam3;
+  double hv = data(36); // =  hv; //  = params->Hv;
+  double Pv = data(37); // = Pv; //  = params->Pv;
 
 
   for(i = 0; i < 6; i++) workV6[i] = data(i+38);
@@ -1311,142 +1175,32 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
     committedSurfaces[i+1].setData(workV6, data(k), data(k+1));
   }
 
-  int *temp1, *temp2, *temp11;
-  double *temp3, *temp4, *temp5, *temp6, *temp7, *temp8, *temp9, *temp10, *temp12;
-  double *temp13, *temp14, *temp15, *temp16, *temp17, *temp18, *temp19, *temp20;
-  double *temp14a, *temp14b;
-  double *temp21, *temp22, *temp23, *temp24, *temp25, *temp26;
-
-  if (matCount < otherMatCount) {  // allocate memory if not enough
-
-     temp1 = loadStagex;
-	 temp2 = ndmx;
-	 temp3 = rhox;
-     temp4 = refShearModulusx;
-     temp5 = refBulkModulusx;
-     temp6 = frictionAnglex;
-     temp7 = peakShearStrainx;
-     temp8 = refPressurex;
-     temp9 = cohesionx;
-     temp10 = pressDependCoeffx;
-	 temp11 = numOfSurfacesx;
-     temp12 = residualPressx;
-     temp13 = phaseTransfAnglex;
-     temp14 = contractParam1x;
-     temp14a = contractParam2x;
-	 temp14b = contractParam3x;
-     temp15 = dilateParam1x;
-     temp16 = dilateParam2x;
-     temp17 = liquefyParam1x;
-     temp18 = liquefyParam2x;
-     temp19 = dilateParam3x;
-     temp20 = einitx;    //initial void ratio
-     temp21 = volLimit1x;
-     temp22 = volLimit2x;
-     temp23 = volLimit3x;
-     temp24 = stressRatioPTx;
-	 temp25 = Hvx;
-	 temp26 = Pvx;
-
-     loadStagex = new int[otherMatCount];
-     ndmx = new int[otherMatCount];
-     rhox = new double[otherMatCount];
-     refShearModulusx = new double[otherMatCount];
-     refBulkModulusx = new double[otherMatCount];
-     frictionAnglex = new double[otherMatCount];
-     peakShearStrainx = new double[otherMatCount];
-     refPressurex = new double[otherMatCount];
-	 cohesionx = new double[otherMatCount];
-     pressDependCoeffx = new double[otherMatCount];
-     numOfSurfacesx = new int[otherMatCount];
-     residualPressx = new double[otherMatCount];
-     phaseTransfAnglex = new double[otherMatCount];
-     contractParam1x = new double[otherMatCount];
-     contractParam2x = new double[otherMatCount];
-	 contractParam3x = new double[otherMatCount];
-     dilateParam1x = new double[otherMatCount];
-     dilateParam2x = new double[otherMatCount];
-     liquefyParam1x = new double[otherMatCount];
-     liquefyParam2x = new double[otherMatCount];
-     dilateParam3x = new double[otherMatCount];
-     einitx = new double[otherMatCount];    //initial void ratio
-     volLimit1x = new double[otherMatCount];
-     volLimit2x = new double[otherMatCount];
-     volLimit3x = new double[otherMatCount];
-     stressRatioPTx = new double[otherMatCount];
-	 Hvx = new double[otherMatCount];
-	 Pvx = new double[otherMatCount];
-
-     if( matCount > 0 ) {
-		 for (int i=0; i<matCount; i++) {
-			 loadStagex[i] = temp1[i];
-			 ndmx[i] = temp2[i];
-			 rhox[i] = temp3[i];
-			 refShearModulusx[i] = temp4[i];
-			 refBulkModulusx[i] = temp5[i];
-			 frictionAnglex[i] = temp6[i];
-			 peakShearStrainx[i] = temp7[i];
-			 refPressurex[i] = temp8[i];
-			 cohesionx[i] = temp9[i];
-			 pressDependCoeffx[i] = temp10[i];
-			 numOfSurfacesx[i] = temp11[i];
-			 residualPressx[i] = temp12[i];
-			 phaseTransfAnglex[i] = temp13[i];
-			 contractParam1x[i] = temp14[i];
-	         contractParam2x[i] = temp14a[i];
-			 contractParam3x[i] = temp14b[i];
-			 dilateParam1x[i] = temp15[i];
-			 dilateParam2x[i] = temp16[i];
-			 liquefyParam1x[i] = temp17[i];
-			 liquefyParam2x[i] = temp18[i];
-	         dilateParam3x[i] = temp19[i];
-			 einitx[i] = temp20[i];    //initial void ratio
-			 volLimit1x[i] = temp21[i];
-			 volLimit2x[i] = temp22[i];
-			 volLimit3x[i] = temp23[i];
-			 stressRatioPTx[i] = temp24[i];
-			 Hvx[i] = temp25[i];
-			 Pvx[i] = temp26[i];
-		 }
-
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; delete [] temp15; delete [] temp16;
-	     delete [] temp14a;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; delete [] temp26;
-     }
-	 matCount = otherMatCount;
-  }
-
-    loadStagex[matN] = loadStage;
-    ndmx[matN] = ndm;
-	rhox[matN] = rho;
-    residualPressx[matN] = residualPress;
-    numOfSurfacesx[matN] = numOfSurfaces;
-    refPressurex[matN] = refPressure;
-    pressDependCoeffx[matN] =pressDependCoeff;
-    refShearModulusx[matN] = refShearModulus;
-	refBulkModulusx[matN] = refBulkModulus;
-    frictionAnglex[matN] = frictionAngle;
-	cohesionx[matN] = cohesion;
-    peakShearStrainx[matN] = peakShearStrain;
-    phaseTransfAnglex[matN] = phaseTransfAngle;
-	stressRatioPTx[matN] = stressRatioPT;
-	contractParam1x[matN] = contractParam1;
-	contractParam2x[matN] = contractParam2;
-	contractParam3x[matN] = contractParam3;
-    dilateParam1x[matN] = dilateParam1;
-    dilateParam2x[matN] = dilateParam2;
-	liquefyParam1x[matN] = liquefyParam1;
-	liquefyParam2x[matN] = liquefyParam2;
-	dilateParam3x[matN] = dilateParam3;
-	einitx[matN] = einit;
-	volLimit1x[matN] = volLimit1;
-	volLimit2x[matN] = volLimit2;
-	volLimit3x[matN] = volLimit3;
+    params->loadStage = loadStage;
+    params->ndm = ndm;
+	params->rho = rho;
+    params->residualPress = residualPress;
+    params->numOfSurfaces = numOfSurfaces;
+    params->refPressure = refPressure;
+    params->pressDependCoeff =pressDependCoeff;
+    params->refShearModulus = refShearModulus;
+	params->refBulkModulus = refBulkModulus;
+    params->frictionAngle = frictionAngle;
+	params->cohesion = cohesion;
+    params->peakShearStrain = peakShearStrain;
+    params->phaseTransfAngle = phaseTransfAngle;
+	params->stressRatioPT = stressRatioPT;
+	params->contractParam1 = contractParam1;
+	params->contractParam2 = contractParam2;
+	params->contractParam3 = contractParam3;
+    params->dilateParam1 = dilateParam1;
+    params->dilateParam2 = dilateParam2;
+	params->liquefyParam1 = liquefyParam1;
+	params->liquefyParam2 = liquefyParam2;
+	params->dilateParam3 = dilateParam3;
+	params->einit = einit;
+	params->volLimit1 = volLimit1;
+	params->volLimit2 = volLimit2;
+	params->volLimit3 = volLimit3;
 
 
   return res;
@@ -1471,7 +1225,7 @@ PressureDependMultiYield02::setResponse (const char **argv, int argc, OPS_Stream
 		return new MaterialResponse(this, 3, this->getTangent());
 
 	else if (strcmp(argv[0],"backbone") == 0) {
-	    int numOfSurfaces = numOfSurfacesx[matN];
+	    int numOfSurfaces = params->numOfSurfaces;
 	    Matrix curv(numOfSurfaces+1,(argc-1)*2);
 		for (int i=1; i<argc; i++)
 			curv(0,(i-1)*2) = atoi(argv[i]);
@@ -1484,11 +1238,11 @@ PressureDependMultiYield02::setResponse (const char **argv, int argc, OPS_Stream
 
 void PressureDependMultiYield02::getBackbone (Matrix & bb)
 {
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  double refShearModulus = refShearModulusx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  double refShearModulus = params->refShearModulus;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double vol, conHeig, scale, factor, shearModulus, stress1,
 		     stress2, strain1, strain2, plastModulus, elast_plast, gre;
@@ -1587,15 +1341,15 @@ void PressureDependMultiYield02::Print(OPS_Stream &s, int flag )
 
 const Vector & PressureDependMultiYield02::getCommittedStress (void)
 {
-	int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
-	int numOfSurfaces = numOfSurfacesx[matN];
-    double residualPress = residualPressx[matN];
+	int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
+	int numOfSurfaces = params->numOfSurfaces;
+    double residualPress = params->residualPress;
 
 	double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
-	if (loadStagex[matN] != 1) scale = 0.;
+	if (params->loadStage != 1) scale = 0.;
   if (ndm==3) {
-		static Vector temp7(7);
+		static thread_local Vector temp7(7);
 		workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -1605,8 +1359,8 @@ const Vector & PressureDependMultiYield02::getCommittedStress (void)
     temp7[5] = workV6[5];
     temp7[6] = scale;
     /*temp7[7] = committedActiveSurf;
-	temp7[8] = stressRatioPTx[matN];
-	temp7[9] = currentStress.deviatorRatio(residualPressx[matN]);
+	temp7[8] = params->stressRatioPT;
+	temp7[9] = currentStress.deviatorRatio(params->residualPress);
     temp7[10] = pressureDCommitted;
     temp7[11] = cumuDilateStrainOctaCommitted;
     temp7[12] = maxCumuDilateStrainOctaCommitted;
@@ -1617,7 +1371,7 @@ const Vector & PressureDependMultiYield02::getCommittedStress (void)
 	}
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1643,15 +1397,15 @@ const Vector & PressureDependMultiYield02::getCommittedStress (void)
 const Vector &
 PressureDependMultiYield02::getStressToRecord (int numOutput)
 {
-  int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	static thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		static thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1669,18 +1423,18 @@ PressureDependMultiYield02::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		static thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		static thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1699,13 +1453,13 @@ PressureDependMultiYield02::getStressToRecord (int numOutput)
 
 const Vector & PressureDependMultiYield02::getCommittedStrain (void)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-		static Vector workV(3);
+		static thread_local Vector workV(3);
 		workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -1718,16 +1472,16 @@ const Vector & PressureDependMultiYield02::getCommittedStrain (void)
 // NOTE: surfaces[0] is not used
 void PressureDependMultiYield02::setUpSurfaces (double * gredu)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+    int numOfSurfaces = params->numOfSurfaces;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
 
     double refStrain, peakShear, coneHeight;
     double stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
@@ -1741,7 +1495,7 @@ void PressureDependMultiYield02::setUpSurfaces (double * gredu)
 		// tao = cohesion * sqrt(8)/3.
     residualPress = 2 * cohesion / Mnys;
     // a small nonzero residualPress for numerical purpose only
-    if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+    if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
     coneHeight = - (refPressure - residualPress);
     peakShear = sqrt(2.) * coneHeight * Mnys / 3.;
     refStrain = (peakShearStrain * peakShear)
@@ -1782,7 +1536,7 @@ void PressureDependMultiYield02::setUpSurfaces (double * gredu)
 		double tmax = refShearModulus*gredu[ii]*gredu[ii+1];
 		double Mnys = -(sqrt(3.) * tmax - 2.* cohesion) / refPressure;
         residualPress = 2 * cohesion / Mnys;
-        if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+        if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
         coneHeight = - (refPressure - residualPress);
 
         double sinPhi = 3*Mnys /(6+Mnys);
@@ -1844,11 +1598,11 @@ void PressureDependMultiYield02::setUpSurfaces (double * gredu)
 	}
   }
 
-  residualPressx[matN] = residualPress;
-  frictionAnglex[matN] = frictionAngle;
-  cohesionx[matN] = cohesion;
-  phaseTransfAnglex[matN] = phaseTransfAngle;
-  stressRatioPTx[matN] = stressRatioPT;
+  params->residualPress = residualPress;
+  params->frictionAngle = frictionAngle;
+  params->cohesion = cohesion;
+  params->phaseTransfAngle = phaseTransfAngle;
+  params->stressRatioPT = stressRatioPT;
 }
 
 
@@ -1856,7 +1610,7 @@ double PressureDependMultiYield02::yieldFunc(const T2Vector & stress,
 					   const MultiYieldSurface * surfaces,
 					   int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
+  double residualPress = params->residualPress;
 
   double coneHeight = stress.volume() - residualPress;
   //workV6 = stress.deviator() - surfaces[surfaceNum].center()*coneHeight;
@@ -1873,8 +1627,8 @@ void PressureDependMultiYield02::deviatorScaling(T2Vector & stress,
 					       const MultiYieldSurface * surfaces,
 					       int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double diff = yieldFunc(stress, surfaces, surfaceNum);
   double coneHeight = stress.volume() - residualPress;
@@ -1882,7 +1636,7 @@ void PressureDependMultiYield02::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    static thread_local Vector devia(6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1906,13 +1660,13 @@ void PressureDependMultiYield02::deviatorScaling(T2Vector & stress,
 
 void PressureDependMultiYield02::initSurfaceUpdate(void)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  static thread_local Vector devia(6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -1939,12 +1693,12 @@ void PressureDependMultiYield02::initSurfaceUpdate(void)
 
 void PressureDependMultiYield02::initStrainUpdate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double stressRatioPT = params->stressRatioPT;
 
   // elastic strain state
   double stressRatio = currentStress.deviatorRatio(residualPress);
@@ -1988,9 +1742,9 @@ void PressureDependMultiYield02::initStrainUpdate(void)
 
 double PressureDependMultiYield02::getModulusFactor(T2Vector & stress)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
 
   double conHeig = stress.volume() - residualPress;
   double scale = conHeig / (refPressure-residualPress);
@@ -2002,8 +1756,8 @@ double PressureDependMultiYield02::getModulusFactor(T2Vector & stress)
 
 void PressureDependMultiYield02::setTrialStress(T2Vector & stress)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   modulusFactor = getModulusFactor(stress);
   //workV6 = stress.deviator()
@@ -2013,10 +1767,10 @@ void PressureDependMultiYield02::setTrialStress(T2Vector & stress)
 
   double B = refBulkModulus*modulusFactor;
 
-  if (Hvx[matN] != 0. && trialStress.volume()<=maxPress
-	  && subStrainRate.volume()<0. && loadStagex[matN] == 1) {
-     double tp = fabs(trialStress.volume() - residualPressx[matN]);
-     B = (B*Hvx[matN]*pow(tp,Pvx[matN]))/(B+Hvx[matN]*pow(tp,Pvx[matN]));
+  if (params->Hv != 0. && trialStress.volume()<=maxPress
+	  && subStrainRate.volume()<0. && params->loadStage == 1) {
+     double tp = fabs(trialStress.volume() - params->residualPress);
+     B = (B*params->Hv*pow(tp,params->Pv))/(B+params->Hv*pow(tp,params->Pv));
   }
 
   double volume = stress.volume() + subStrainRate.volume()*3.*B;
@@ -2028,9 +1782,9 @@ void PressureDependMultiYield02::setTrialStress(T2Vector & stress)
 
 int PressureDependMultiYield02::setSubStrainRate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    double refShearModulus = params->refShearModulus;
+	int numOfSurfaces = params->numOfSurfaces;
 
   //if (activeSurfaceNum==numOfSurfaces) return 1;
   if (strainRate.isZero()) return 0;
@@ -2070,10 +1824,10 @@ int PressureDependMultiYield02::setSubStrainRate(void)
 void
 PressureDependMultiYield02::getContactStress(T2Vector &contactStress)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -2106,11 +1860,11 @@ int PressureDependMultiYield02::isLoadReversal(const T2Vector & stress)
 void
 PressureDependMultiYield02::getSurfaceNormal(const T2Vector & stress, T2Vector &normal)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -2126,13 +1880,13 @@ PressureDependMultiYield02::getSurfaceNormal(const T2Vector & stress, T2Vector &
 double PressureDependMultiYield02::getPlasticPotential(const T2Vector & contactStress,
 						     const T2Vector & surfaceNormal)
 {
-    double residualPress = residualPressx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
-	double contractParam1 = contractParam1x[matN];
-	double contractParam2 = contractParam2x[matN];
-	double contractParam3 = contractParam3x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
+    double residualPress = params->residualPress;
+    double stressRatioPT = params->stressRatioPT;
+	double contractParam1 = params->contractParam1;
+	double contractParam2 = params->contractParam2;
+	double contractParam3 = params->contractParam3;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
 
   double plasticPotential, contractRule, shearLoading, angle;
 
@@ -2150,8 +1904,8 @@ double PressureDependMultiYield02::getPlasticPotential(const T2Vector & contactS
 		  plasticPotential = 0.;
       else if (onPPZ==2) {
           factorPT -= 1.0;
-		    	double dilateParam3 = dilateParam3x[matN];
-		  double ppp=pow((fabs(contactStress.volume())+fabs(residualPress))/pAtm, -dilateParam3);
+		    	double dilateParam3 = params->dilateParam3;
+		  double ppp=pow((fabs(contactStress.volume())+fabs(residualPress))/params->pAtm, -dilateParam3);
           plasticPotential = ppp*factorPT*(factorPT)*(dilateParam1+pow(cumuDilateStrainOcta,dilateParam2));
           if (plasticPotential < 0.) plasticPotential = -plasticPotential;
 		  if (plasticPotential>5.0e4) plasticPotential = 5.0e4;
@@ -2176,7 +1930,7 @@ double PressureDependMultiYield02::getPlasticPotential(const T2Vector & contactS
 	  }
       factorPT = factorPT*angle - 1.0;
 
-	  contractRule = pow((fabs(contactStress.volume())+fabs(residualPress))/pAtm, contractParam3);
+	  contractRule = pow((fabs(contactStress.volume())+fabs(residualPress))/params->pAtm, contractParam3);
       if (contractRule < 0.1) contractRule = 0.1;
 
 	  //plasticPotential = factorPT*(contractParam1+pressureD*contractParam2)*contractRule;
@@ -2198,10 +1952,10 @@ double PressureDependMultiYield02::getPlasticPotential(const T2Vector & contactS
 
 int PressureDependMultiYield02::isCriticalState(const T2Vector & stress)
 {
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
 
   double vol = trialStrain.volume()*3.0;
 	double etria = einit + vol + vol*einit;
@@ -2210,11 +1964,11 @@ int PressureDependMultiYield02::isCriticalState(const T2Vector & stress)
 
 	double ecr1, ecr2;
 	if (volLimit3 != 0.) {
-		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/pAtm), volLimit3);
-	  ecr2 = volLimit1 - volLimit2*pow(fabs(-updatedTrialStress.volume()/pAtm), volLimit3);
+		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/params->pAtm), volLimit3);
+	  ecr2 = volLimit1 - volLimit2*pow(fabs(-updatedTrialStress.volume()/params->pAtm), volLimit3);
 	} else {
-		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/pAtm));
-	  ecr2 = volLimit1 - volLimit2*log(fabs(-updatedTrialStress.volume()/pAtm));
+		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/params->pAtm));
+	  ecr2 = volLimit1 - volLimit2*log(fabs(-updatedTrialStress.volume()/params->pAtm));
 	}
 
 	if (ecurr < ecr2 && etria < ecr1) return 0;
@@ -2225,11 +1979,11 @@ int PressureDependMultiYield02::isCriticalState(const T2Vector & stress)
 
 void PressureDependMultiYield02::updatePPZ(const T2Vector & contactStress)
 {
-  double liquefyParam1 = liquefyParam1x[matN];
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  	double liquefyParam2 = liquefyParam2x[matN];
+  double liquefyParam1 = params->liquefyParam1;
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  	double liquefyParam2 = params->liquefyParam2;
 
   // onPPZ=-1 may not be needed. can start with onPPZ=0  ****
 
@@ -2343,9 +2097,9 @@ void PressureDependMultiYield02::updatePPZ(const T2Vector & contactStress)
 
 void PressureDependMultiYield02::PPZTranslation(const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
-  	double liquefyParam2 = liquefyParam2x[matN];
-    double residualPress = residualPressx[matN];
+	double liquefyParam1 = params->liquefyParam1;
+  	double liquefyParam2 = params->liquefyParam2;
+    double residualPress = params->residualPress;
 
 	//cumuDilateStrainOcta -= subStrainRate.octahedralShear(1);
     //if (cumuDilateStrainOcta < 0.) cumuDilateStrainOcta = 0.;
@@ -2386,9 +2140,9 @@ void PressureDependMultiYield02::PPZTranslation(const T2Vector & contactStress)
 
 double PressureDependMultiYield02::getPPZLimits(int which, const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double dilateParam3 = dilateParam3x[matN];
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double dilateParam3 = params->dilateParam3;
 
   double PPZLimit, temp;
   double volume = -contactStress.volume();
@@ -2419,9 +2173,9 @@ double PressureDependMultiYield02::getLoadingFunc(const T2Vector & contactStress
 						double * plasticPotential,
 						int crossedSurface)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   double loadingFunc, limit;
   double modul = theSurfaces[activeSurfaceNum].modulus();
@@ -2461,12 +2215,12 @@ double PressureDependMultiYield02::getLoadingFunc(const T2Vector & contactStress
 
 int PressureDependMultiYield02::stressCorrection(int crossedSurface)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
-  static T2Vector contactStress;
+  static thread_local T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  static thread_local T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   double tVolume = trialStress.volume();
@@ -2508,16 +2262,16 @@ int PressureDependMultiYield02::stressCorrection(int crossedSurface)
 
 void PressureDependMultiYield02::updateActiveSurface(void)
 {
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  static thread_local Vector t1(6);
+  static thread_local Vector t2(6);
+  static thread_local Vector center(6);
+  static thread_local Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2586,11 +2340,11 @@ void PressureDependMultiYield02::updateActiveSurface(void)
 
 void PressureDependMultiYield02::updateInnerSurface(void)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	static thread_local Vector devia(6);
+	static thread_local Vector center(6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
@@ -2613,7 +2367,7 @@ void PressureDependMultiYield02::updateInnerSurface(void)
 
 int PressureDependMultiYield02:: isCrossingNextSurface(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return 0;
 
@@ -13,6 +13,7 @@
 #ifndef PressureDependMultiYield02_h
 #define PressureDependMultiYield02_h
 
+#include <memory>
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include "soil/T2Vector.h"
@@ -61,7 +62,7 @@ public:
      // Destructor: clean up memory storage space.
      virtual ~PressureDependMultiYield02 ();
 
-     double getRho(void) {return rhox[matN];} ;
+     double getRho(void) {return params->rho;} ;
 
      // Sets the values of the trial strain tensor.
      int setTrialStrain (const Vector &strain);
@@ -126,42 +127,44 @@ protected:
 
 private:
   // user supplied
-	 static int matCount;
-     static int* ndmx;  //num of dimensions (2 or 3)
-     static int* loadStagex;  //=0 if elastic; =1 or 2 if plastic
-     static double* rhox;  //mass density
-     static double* refShearModulusx;
-     static double* refBulkModulusx;
-     static double* frictionAnglex;
-     static double* peakShearStrainx;
-     static double* refPressurex;
-     static double* cohesionx;
-     static double* pressDependCoeffx;
-     static int*    numOfSurfacesx;
-     static double* phaseTransfAnglex;
-     static double* contractParam1x;
-     static double* contractParam2x;
-     static double* contractParam3x;
-     static double* dilateParam1x;
-     static double* dilateParam2x;
-     static double* liquefyParam1x;
-     static double* liquefyParam2x;
-     static double* dilateParam3x;
-     static double* einitx;    //initial void ratio
-     static double* volLimit1x;
-     static double* volLimit2x;
-     static double* volLimit3x;
-     static double pAtm;
-	 static double* Hvx;
-	 static double* Pvx;
+	// Parameters shared by a material and its copies
+	struct Parameters {
+	  int    ndm;  //num of dimensions (2 or 3)
+	  int    loadStage;  //=0 if elastic; =1 or 2 if plastic
+	  double rho;  //mass density
+	  double refShearModulus;
+	  double refBulkModulus;
+	  double frictionAngle;
+	  double peakShearStrain;
+	  double refPressure;
+	  double cohesion;
+	  double pressDependCoeff;
+	  int    numOfSurfaces;
+	  double phaseTransfAngle;
+	  double contractParam1;
+	  double contractParam2;
+	  double contractParam3;
+	  double dilateParam1;
+	  double dilateParam2;
+	  double liquefyParam1;
+	  double liquefyParam2;
+	  double dilateParam3;
+	  double einit;    //initial void ratio
+	  double volLimit1;
+	  double volLimit2;
+	  double volLimit3;
+	  double pAtm;
+	  double Hv;
+	  double Pv;
+	  double residualPress;
+	  double stressRatioPT;
+	};
 
      // internal
-     static double* residualPressx;
-     static double* stressRatioPTx;
-     static Matrix theTangent;
+     static thread_local Matrix theTangent;
      double * mGredu;
 
-	 int matN;
+	 std::shared_ptr<Parameters> params;
      int e2p;
      MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used
      MultiYieldSurface * committedSurfaces;
@@ -176,7 +179,7 @@ private:
      T2Vector updatedTrialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     static thread_local T2Vector subStrainRate;
 
      double pressureD;
      int onPPZ; //=-1 never reach PPZ before; =0 below PPZ; =1 on PPZ; =2 above PPZ
@@ -187,7 +190,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
 	 Vector PivotStrainRate;
@@ -203,8 +206,8 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 	 Vector PivotStrainRateCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
 	 double maxPress;
 
      void elast2Plast(void);
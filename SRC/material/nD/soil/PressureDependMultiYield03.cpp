@@ -22,47 +22,14 @@
 #include <string.h>
 #include <elementAPI.h>
 
-int PressureDependMultiYield03::matCount=0;
-int* PressureDependMultiYield03::loadStagex = 0;  //=0 if elastic; =1 if plastic
-int* PressureDependMultiYield03::ndmx=0;  //num of dimensions (2 or 3)
-double* PressureDependMultiYield03::rhox=0;
-double* PressureDependMultiYield03::refShearModulusx=0;
-double* PressureDependMultiYield03::refBulkModulusx=0;
-double* PressureDependMultiYield03::frictionAnglex=0;
-double* PressureDependMultiYield03::peakShearStrainx=0;
-double* PressureDependMultiYield03::refPressurex=0;
-double* PressureDependMultiYield03::cohesionx=0;
-double* PressureDependMultiYield03::pressDependCoeffx=0;
-int*    PressureDependMultiYield03::numOfSurfacesx=0;
-double* PressureDependMultiYield03::phaseTransfAnglex=0;
-int* PressureDependMultiYield03::mTypex = 0;
-double* PressureDependMultiYield03::contractParam1x=0;
-double* PressureDependMultiYield03::contractParam2x=0;
-double* PressureDependMultiYield03::contractParam3x=0;
-double* PressureDependMultiYield03::contractParam4x = 0;
-double* PressureDependMultiYield03::contractParam5x = 0;
-double* PressureDependMultiYield03::dilateParam1x=0;
-double* PressureDependMultiYield03::dilateParam2x=0;
-double* PressureDependMultiYield03::dilateParam3x = 0;
-double* PressureDependMultiYield03::liquefyParam1x=0;
-double* PressureDependMultiYield03::liquefyParam2x=0;
-double* PressureDependMultiYield03::einitx=0;    //initial void ratio
-double* PressureDependMultiYield03::volLimit1x=0;
-double* PressureDependMultiYield03::volLimit2x=0;
-double* PressureDependMultiYield03::volLimit3x=0;
-double* PressureDependMultiYield03::residualPressx=0;
-double* PressureDependMultiYield03::stressRatioPTx=0;
-
-double* PressureDependMultiYield03::Hvx=0;
-double* PressureDependMultiYield03::Pvx=0;
-
-double PressureDependMultiYield03::pAtm = 101.;
-
-Matrix PressureDependMultiYield03::theTangent(6,6);
-T2Vector PressureDependMultiYield03::trialStrain;
-T2Vector PressureDependMultiYield03::subStrainRate;
-Vector PressureDependMultiYield03::workV6(6);
-T2Vector PressureDependMultiYield03::workT2V;
+
+
+
+thread_local Matrix PressureDependMultiYield03::theTangent(6,6);
+thread_local T2Vector PressureDependMultiYield03::trialStrain;
+thread_local T2Vector PressureDependMultiYield03::subStrainRate;
+thread_local Vector PressureDependMultiYield03::workV6(6);
+thread_local T2Vector PressureDependMultiYield03::workT2V;
 const	double pi = 3.14159265358979;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependMultiYield03)
@@ -125,7 +92,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependMultiYield03)
         }
     }
 
-    static double* gredu = 0;
+    static thread_local double* gredu = 0;
 
     // user defined yield surfaces
     if (param[numParam] < 0 && param[numParam] > -100) {
@@ -280,168 +247,50 @@ PressureDependMultiYield03::PressureDependMultiYield03 (int tag, int nd,
   double hv = 0.0;
   double pv = 1.0;
 
-  if (matCount%20 == 0) {
-     int * temp1 = loadStagex;
-	 int * temp2 = ndmx;
-	 double * temp3 = rhox;
-     double * temp4 = refShearModulusx;
-     double * temp5 = refBulkModulusx;
-     double * temp6 = frictionAnglex;
-     double * temp7 = peakShearStrainx;
-     double * temp8 = refPressurex;
-     double * temp9 = cohesionx;
-     double * temp10 = pressDependCoeffx;
-	 int * temp11 = numOfSurfacesx;
-     double * temp12 = residualPressx;
-     double * temp13 = phaseTransfAnglex;
-	 int * temp14 = mTypex;
-	 double * temp15 = contractParam1x;
-     double * temp16 = contractParam2x;
-     double * temp17 = contractParam3x;
-	 double * temp18 = contractParam4x;
-	 double * temp19 = contractParam5x;
-
-     double * temp20 = dilateParam1x;
-     double * temp21 = dilateParam2x;
-	 double * temp22 = dilateParam3x;
-
-     double * temp23 = liquefyParam1x;
-     double * temp24 = liquefyParam2x;
-	 double * temp25 = stressRatioPTx;
-	 
-     loadStagex = new int[matCount+20];
-     ndmx = new int[matCount+20];
-     rhox = new double[matCount+20];
-     refShearModulusx = new double[matCount+20];
-     refBulkModulusx = new double[matCount+20];
-     frictionAnglex = new double[matCount+20];
-     peakShearStrainx = new double[matCount+20];
-     refPressurex = new double[matCount+20];
-	 cohesionx = new double[matCount+20];
-     pressDependCoeffx = new double[matCount+20];
-     numOfSurfacesx = new int[matCount+20];
-     residualPressx = new double[matCount+20];
-     phaseTransfAnglex = new double[matCount+20];
-
-	 mTypex = new int[matCount + 20];
-	 contractParam1x = new double[matCount+20];
-     contractParam2x = new double[matCount+20];
-     contractParam3x = new double[matCount+20];
-	 contractParam4x = new double[matCount + 20];
-	 contractParam5x = new double[matCount + 20];
-
-     dilateParam1x = new double[matCount+20];
-     dilateParam2x = new double[matCount+20];
-	 dilateParam3x = new double[matCount + 20];
-
-	 liquefyParam1x = new double[matCount+20];
-     liquefyParam2x = new double[matCount+20];
-
-	 stressRatioPTx = new double[matCount + 20];
-
-     einitx = new double[matCount+20];    //initial void ratio
-     volLimit1x = new double[matCount+20];
-     volLimit2x = new double[matCount+20];
-     volLimit3x = new double[matCount+20];
-	 Hvx = new double[matCount+20];
-	 Pvx = new double[matCount+20];
-	 
-	 for (int i=0; i<matCount; i++) {
-         loadStagex[i] = temp1[i];
-		 ndmx[i] = temp2[i];
-         rhox[i] = temp3[i];
-	     refShearModulusx[i] = temp4[i];
-         refBulkModulusx[i] = temp5[i];
-         frictionAnglex[i] = temp6[i];
-         peakShearStrainx[i] = temp7[i];
-         refPressurex[i] = temp8[i];
-         cohesionx[i] = temp9[i];
-         pressDependCoeffx[i] = temp10[i];
-         numOfSurfacesx[i] = temp11[i];
-         residualPressx[i] = temp12[i];
-         phaseTransfAnglex[i] = temp13[i];
-
-		 mTypex[i] = temp14[i];
-		 contractParam1x[i] = temp15[i];
-         contractParam2x[i] = temp16[i];
-         contractParam3x[i] = temp17[i];
-		 contractParam4x[i] = temp18[i];
-		 contractParam5x[i] = temp19[i];
-
-         dilateParam1x[i] = temp20[i];
-         dilateParam2x[i] = temp21[i];
-		 dilateParam3x[i] = temp22[i];
-
-		 liquefyParam1x[i] = temp23[i];
-         liquefyParam2x[i] = temp24[i];
-
-         stressRatioPTx[i] = temp25[i];
-
-		 einitx[i] = ei;    //default initial void ratio
-		 volLimit1x[i] = cs1;
-		 volLimit2x[i] = cs2;
-		 volLimit3x[i] = cs3;
-		 
-		 Hvx[i] = hv;
-		 Pvx[i] = pv;
-     }
-
-	 if (matCount > 0) {
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; 
-		 delete [] temp15; delete [] temp16;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; 
-     }
-  }
-
-  ndmx[matCount] = nd;
-  loadStagex[matCount] = 0;   //default
-  refShearModulusx[matCount] = refShearModul;
-  refBulkModulusx[matCount] = refBulkModul;
-  frictionAnglex[matCount] = frictionAng;
-  peakShearStrainx[matCount] = peakShearStra;
-  refPressurex[matCount] = -refPress;  //compression is negative
-  cohesionx[matCount] = cohesi;
-  pressDependCoeffx[matCount] = pressDependCoe;
-  numOfSurfacesx[matCount] = numberOfYieldSurf;
-  rhox[matCount] = r;
-  phaseTransfAnglex[matCount] = phaseTransformAng;
-
-  mTypex[matCount] = mType;
-  contractParam1x[matCount] = ca;
-  contractParam2x[matCount] = cb;
-  contractParam3x[matCount] = cc;
-  contractParam4x[matCount] = cd;
-  contractParam5x[matCount] = ce;
-
-  dilateParam1x[matCount] = da;
-  dilateParam2x[matCount] = db;
-  dilateParam3x[matCount] = dc;
-
-  liquefyParam1x[matCount] = liquefactionParam1;
-  liquefyParam2x[matCount] = liquefactionParam2;
-
-  einitx[matCount] = ei;    //default initial void ratio
-  volLimit1x[matCount] = cs1;
-  volLimit2x[matCount] = cs2;
-  volLimit3x[matCount] = cs3;
-
-  Hvx[matCount] = hv;
-  Pvx[matCount] = pv;
+  params = std::make_shared<Parameters>();
+
+  params->ndm = nd;
+  params->loadStage = 0;   //default
+  params->refShearModulus = refShearModul;
+  params->refBulkModulus = refBulkModul;
+  params->frictionAngle = frictionAng;
+  params->peakShearStrain = peakShearStra;
+  params->refPressure = -refPress;  //compression is negative
+  params->cohesion = cohesi;
+  params->pressDependCoeff = pressDependCoe;
+  params->numOfSurfaces = numberOfYieldSurf;
+  params->rho = r;
+  params->phaseTransfAngle = phaseTransformAng;
+
+  params->mType = mType;
+  params->contractParam1 = ca;
+  params->contractParam2 = cb;
+  params->contractParam3 = cc;
+  params->contractParam4 = cd;
+  params->contractParam5 = ce;
+
+  params->dilateParam1 = da;
+  params->dilateParam2 = db;
+  params->dilateParam3 = dc;
+
+  params->liquefyParam1 = liquefactionParam1;
+  params->liquefyParam2 = liquefactionParam2;
+
+  params->einit = ei;    //default initial void ratio
+  params->volLimit1 = cs1;
+  params->volLimit2 = cs2;
+  params->volLimit3 = cs3;
+
+  params->Hv = hv;
+  params->Pv = pv;
   
-  residualPressx[matCount] =0.;
-  stressRatioPTx[matCount] =0.;
+  params->residualPress =0.;
+  params->stressRatioPT =0.;
   
-  matN = matCount;
-  matCount ++;
-  pAtm = atm;
+  params->pAtm = atm;
 
-  int numOfSurfaces = numOfSurfacesx[matN];
-  initPress = refPressurex[matN];
+  int numOfSurfaces = params->numOfSurfaces;
+  initPress = params->refPressure;
 
   e2p = committedActiveSurf = activeSurfaceNum = 0;
   onPPZCommitted = onPPZ = -1 ;
@@ -481,9 +330,9 @@ PressureDependMultiYield03::PressureDependMultiYield03 (const PressureDependMult
   PPZPivotCommitted(a.PPZPivotCommitted), PPZCenterCommitted(a.PPZCenterCommitted),
   PivotStrainRate(a.PivotStrainRate), PivotStrainRateCommitted(a.PivotStrainRateCommitted)
 {
-  matN = a.matN;
+  params = a.params;
 
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   e2p = a.e2p;
   strainPTOcta = a.strainPTOcta;
@@ -528,8 +377,8 @@ PressureDependMultiYield03::~PressureDependMultiYield03 ()
 
 void PressureDependMultiYield03::elast2Plast(void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (loadStage != 1 || e2p == 1) 
 		return;
@@ -563,8 +412,8 @@ void PressureDependMultiYield03::elast2Plast(void)
 
 int PressureDependMultiYield03::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -598,8 +447,8 @@ int PressureDependMultiYield03::setTrialStrain (const Vector &strain, const Vect
 
 int PressureDependMultiYield03::setTrialStrainIncr (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3 && strain.Size()==6)
     workV6 = strain;
@@ -630,14 +479,14 @@ int PressureDependMultiYield03::setTrialStrainIncr (const Vector &strain, const
 
 const Matrix & PressureDependMultiYield03::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) {
 //	  opserr << "PDMY03::getTang() - 1\n";
@@ -682,10 +531,10 @@ const Matrix & PressureDependMultiYield03::getTangent (void)
     double bulkModulus = factor*refBulkModulus;
 
 	// volumetric plasticity
-	if (Hvx[matN] != 0. && trialStress.volume()<=maxPress
+	if (params->Hv != 0. && trialStress.volume()<=maxPress
 		&& strainRate.volume()<0. && loadStage == 1) {
 	  double tp = fabs(trialStress.volume() - residualPress);
-      bulkModulus = (bulkModulus*Hvx[matN]*pow(tp,Pvx[matN]))/(bulkModulus+Hvx[matN]*pow(tp,Pvx[matN]));
+      bulkModulus = (bulkModulus*params->Hv*pow(tp,params->Pv))/(bulkModulus+params->Hv*pow(tp,params->Pv));
 	}
 
     /*if (loadStage!=0 && committedActiveSurf > 0) {
@@ -745,7 +594,7 @@ const Matrix & PressureDependMultiYield03::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -771,14 +620,14 @@ const Matrix & PressureDependMultiYield03::getTangent (void)
 
 const Matrix & PressureDependMultiYield03::getInitialTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  double refShearModulus = refShearModulusx[matN];
-  double refBulkModulus = refBulkModulusx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double refPressure = refPressurex[matN];
-  double residualPress = residualPressx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  double refShearModulus = params->refShearModulus;
+  double refBulkModulus = params->refBulkModulus;
+  double pressDependCoeff = params->pressDependCoeff;
+  double refPressure = params->refPressure;
+  double residualPress = params->residualPress;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) {
       initPress = currentStress.volume();
@@ -815,7 +664,7 @@ const Matrix & PressureDependMultiYield03::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -841,10 +690,10 @@ const Matrix & PressureDependMultiYield03::getInitialTangent (void)
 const Vector & PressureDependMultiYield03::getStress (void)
 {
 //	opserr << "PDMY03-getStress() -1\n";
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   int i, is;
   if (loadStage == 1 && e2p == 0) {
@@ -917,7 +766,7 @@ const Vector & PressureDependMultiYield03::getStress (void)
         stressCorrection(0);
         updateActiveSurface();
 
-	    double refBulkModulus = refBulkModulusx[matN];
+	    double refBulkModulus = params->refBulkModulus;
 		//modulusFactor was calculated in setTrialStress
         double B = refBulkModulus*modulusFactor;
 		//double deltaD = 3.*subStrainRate.volume()
@@ -935,7 +784,7 @@ const Vector & PressureDependMultiYield03::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-	static Vector workV(3);
+	static thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -952,8 +801,8 @@ const Vector & PressureDependMultiYield03::getStrain (void)
 
 int PressureDependMultiYield03::commitState (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   currentStress = trialStress;
   //currentStrain = T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
@@ -1012,8 +861,8 @@ NDMaterial * PressureDependMultiYield03::getCopy (const char *code)
 
 const char * PressureDependMultiYield03::getType (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -1021,8 +870,8 @@ const char * PressureDependMultiYield03::getType (void) const
 
 int PressureDependMultiYield03::getOrder (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? 3 : 6;
 }
@@ -1079,24 +928,24 @@ int PressureDependMultiYield03::updateParameter(int responseID, Information &inf
 {
  
   if (responseID == 1) {
-      loadStagex[matN] = info.theInt;
+      params->loadStage = info.theInt;
   } else if (responseID==10) {
-    refShearModulusx[matN] = info.theDouble;
+    params->refShearModulus = info.theDouble;
   } else if (responseID==11) {
-    refBulkModulusx[matN] = info.theDouble;
+    params->refBulkModulus = info.theDouble;
   } else if (responseID==12) {
-    frictionAnglex[matN] = info.theDouble;
+    params->frictionAngle = info.theDouble;
     setUpSurfaces(mGredu);
     initSurfaceUpdate();
   } else if (responseID==13) {
-    cohesionx[matN] = info.theDouble;
+    params->cohesion = info.theDouble;
     setUpSurfaces(mGredu);
     initSurfaceUpdate();
   }
 
   // used by BBarFourNodeQuadUP element
-  else if (responseID==20 && ndmx[matN] == 2)
-		ndmx[matN] = 0;
+  else if (responseID==20 && params->ndm == 2)
+		params->ndm = 0;
 
   return 0;
 }
@@ -1104,45 +953,43 @@ int PressureDependMultiYield03::updateParameter(int responseID, Information &inf
 
 int PressureDependMultiYield03::sendSelf(int commitTag, Channel &theChannel)
 {
-    int loadStage = loadStagex[matN];
-    int ndm = ndmx[matN];
-	double rho = rhox[matN];
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
-	double contractParam1 = contractParam1x[matN];
-	double contractParam2 = contractParam2x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double dilateParam3 = dilateParam3x[matN];
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
-
-     double contractionParam3 = contractParam3x[matN];
-     double hv = Hvx[matN];
-     double Pv = Pvx[matN];
+    int loadStage = params->loadStage;
+    int ndm = params->ndm;
+	double rho = params->rho;
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
+	double contractParam1 = params->contractParam1;
+	double contractParam2 = params->contractParam2;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double dilateParam3 = params->dilateParam3;
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
+
+     double contractionParam3 = params->contractParam3;
+     double hv = params->Hv;
+     double Pv = params->Pv;
 
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
   idData(3) = ndm;
-  idData(4) = matN;
-  idData(5) = matCount;
 
   res += theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -1167,7 +1014,7 @@ int PressureDependMultiYield03::sendSelf(int commitTag, Channel &theChannel)
   data(13) = volLimit1;
   data(14) = volLimit2;
   data(15) = volLimit3;
-  data(16) = pAtm;
+  data(16) = params->pAtm;
   data(17) = liquefyParam1;
   data(18) = liquefyParam2;
   data(19) = dilateParam3;
@@ -1187,9 +1034,9 @@ int PressureDependMultiYield03::sendSelf(int commitTag, Channel &theChannel)
 
   data(33) = initPress;
   data(34) = contractParam2;
-  data(35) = contractionParam3;// = contractParam3x[matN];
-  data(36) =  hv; //  = Hvx[matN];
-  data(37) = Pv; //  = Pvx[matN];
+  data(35) = contractionParam3;// = params->contractParam3;
+  data(36) =  hv; //  = params->Hv;
+  data(37) = Pv; //  = params->Pv;
 
   workV6 = currentStress.t2Vector();
   for(i = 0; i < 6; i++) data(i+38) = workV6[i];
@@ -1217,9 +1064,9 @@ int PressureDependMultiYield03::sendSelf(int commitTag, Channel &theChannel)
   }
 
   i = 69 + numOfSurfaces * 8;
-  data(i+1) = mTypex[matN];
-  data(i+2) = contractParam4x[matN];
-  data(i+3) = contractParam5x[matN];
+  data(i+1) = params->mType;
+  data(i+2) = params->contractParam4;
+  data(i+3) = params->contractParam5;
 
   res += theChannel.sendVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -1236,7 +1083,7 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PressureDependMultiYield03::recvelf -- could not recv ID\n";
@@ -1248,9 +1095,7 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
   int numOfSurfaces = idData(1);
   int loadStage = idData(2);
   int ndm = idData(3);
-  matN = idData(4);
-
-  int otherMatCount = idData(5);
+  params = std::make_shared<Parameters>();
 
   Vector data(72+idData(1)*8);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
@@ -1275,7 +1120,7 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
   double volLimit1 = data(13);
   double volLimit2 = data(14);
   double volLimit3 = data(15);
-  pAtm = data(16);
+  params->pAtm = data(16);
   double liquefyParam1 = data(17);
   double liquefyParam2 = data(18);
   double dilateParam3 = data(19);
@@ -1295,9 +1140,9 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
 
   initPress = data(33);
   double contractParam2 = data(34);
-  double contractParam3 =  data(35); //  = contractionParam3;// = contractParam3x[matN];
-  double hv = data(36); // =  hv; //  = Hvx[matN];
-  double Pv = data(37); // = Pv; //  = Pvx[matN];
+  double contractParam3 =  data(35); //  = contractionParam3;// = params->contractParam3;
+  double hv = data(36); // =  hv; //  = params->Hv;
+  double Pv = data(37); // = Pv; //  = params->Pv;
 
 
   for(i = 0; i < 6; i++) workV6[i] = data(i+38);
@@ -1337,162 +1182,36 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
   double contractParam5 = data(i+3);
   
   
-  int *temp1, *temp2, *temp11;
-  double *temp3, *temp4, *temp5, *temp6, *temp7, *temp8, *temp9, *temp10, *temp12;
-  double *temp13, *temp14, *temp15, *temp16, *temp17, *temp18, *temp19, *temp20;
-  double *temp14a, *temp14b;
-  double *temp21, *temp22, *temp23, *temp24, *temp25, *temp26;
-  int *temp27;
-  double *temp28, *temp29, *temp30, *temp31;
-
-  if (matCount < otherMatCount) {  // allocate memory if not enough
-
-     temp1 = loadStagex;
-	 temp2 = ndmx;
-	 temp3 = rhox;
-     temp4 = refShearModulusx;
-     temp5 = refBulkModulusx;
-     temp6 = frictionAnglex;
-     temp7 = peakShearStrainx;
-     temp8 = refPressurex;
-     temp9 = cohesionx;
-     temp10 = pressDependCoeffx;
-	 temp11 = numOfSurfacesx;
-     temp12 = residualPressx;
-     temp13 = phaseTransfAnglex;
-     temp14 = contractParam1x;
-     temp14a = contractParam2x;
-	 temp14b = contractParam3x;
-     temp15 = dilateParam1x;
-     temp16 = dilateParam2x;
-     temp17 = liquefyParam1x;
-     temp18 = liquefyParam2x;
-     temp19 = dilateParam3x;
-     temp20 = einitx;    //initial void ratio
-     temp21 = volLimit1x;
-     temp22 = volLimit2x;
-     temp23 = volLimit3x;
-     temp24 = stressRatioPTx;
-	 temp25 = Hvx;
-	 temp26 = Pvx;
-
-	 temp27 = mTypex;
-	 temp28 = contractParam4x;
-	 temp29 = contractParam5x;
-	 
-     loadStagex = new int[otherMatCount];
-     ndmx = new int[otherMatCount];
-     rhox = new double[otherMatCount];
-     refShearModulusx = new double[otherMatCount];
-     refBulkModulusx = new double[otherMatCount];
-     frictionAnglex = new double[otherMatCount];
-     peakShearStrainx = new double[otherMatCount];
-     refPressurex = new double[otherMatCount];
-	 cohesionx = new double[otherMatCount];
-     pressDependCoeffx = new double[otherMatCount];
-     numOfSurfacesx = new int[otherMatCount];
-     residualPressx = new double[otherMatCount];
-     phaseTransfAnglex = new double[otherMatCount];
-     contractParam1x = new double[otherMatCount];
-     contractParam2x = new double[otherMatCount];
-	 contractParam3x = new double[otherMatCount];
-     dilateParam1x = new double[otherMatCount];
-     dilateParam2x = new double[otherMatCount];
-     liquefyParam1x = new double[otherMatCount];
-     liquefyParam2x = new double[otherMatCount];
-     dilateParam3x = new double[otherMatCount];
-     einitx = new double[otherMatCount];    //initial void ratio
-     volLimit1x = new double[otherMatCount];
-     volLimit2x = new double[otherMatCount];
-     volLimit3x = new double[otherMatCount];
-     stressRatioPTx = new double[otherMatCount];
-	 Hvx = new double[otherMatCount];
-	 Pvx = new double[otherMatCount];
-
-	 mTypex = new int[otherMatCount];
-	 contractParam4x = new double[otherMatCount];
-	 contractParam5x = new double[otherMatCount];
-	 
-     if( matCount > 0 ) {
-		 for (int i=0; i<matCount; i++) {
-			 loadStagex[i] = temp1[i];
-			 ndmx[i] = temp2[i];
-			 rhox[i] = temp3[i];
-			 refShearModulusx[i] = temp4[i];
-			 refBulkModulusx[i] = temp5[i];
-			 frictionAnglex[i] = temp6[i];
-			 peakShearStrainx[i] = temp7[i];
-			 refPressurex[i] = temp8[i];
-			 cohesionx[i] = temp9[i];
-			 pressDependCoeffx[i] = temp10[i];
-			 numOfSurfacesx[i] = temp11[i];
-			 residualPressx[i] = temp12[i];
-			 phaseTransfAnglex[i] = temp13[i];
-			 contractParam1x[i] = temp14[i];
-	         contractParam2x[i] = temp14a[i];
-			 contractParam3x[i] = temp14b[i];
-			 dilateParam1x[i] = temp15[i];
-			 dilateParam2x[i] = temp16[i];
-			 liquefyParam1x[i] = temp17[i];
-			 liquefyParam2x[i] = temp18[i];
-	         dilateParam3x[i] = temp19[i];
-			 einitx[i] = temp20[i];    //initial void ratio
-			 volLimit1x[i] = temp21[i];
-			 volLimit2x[i] = temp22[i];
-			 volLimit3x[i] = temp23[i];
-			 stressRatioPTx[i] = temp24[i];
-			 Hvx[i] = temp25[i];
-			 Pvx[i] = temp26[i];
-			 
-			 mTypex[i] = temp27[i];
-			 contractParam4x[i] = temp28[i];
-			 contractParam5x[i] = temp29[i];
-			 
-		 }
-
-	     delete [] temp1; delete [] temp2; delete [] temp3; delete [] temp4;
-	     delete [] temp5; delete [] temp6; delete [] temp7; delete [] temp8;
-	     delete [] temp9; delete [] temp10; delete [] temp11; delete [] temp12;
-	     delete [] temp13; delete [] temp14; delete [] temp15; delete [] temp16;
-	     delete [] temp14a;
-	     delete [] temp17; delete [] temp18; delete [] temp19; delete [] temp20;
-	     delete [] temp21; delete [] temp22; delete [] temp23; delete [] temp24;
-         delete [] temp25; delete [] temp26;
-		 delete[] temp27; delete[] temp28; delete[] temp29; delete[] temp30; delete[] temp31;
-     }
-	 matCount = otherMatCount;
-  }
-
-    loadStagex[matN] = loadStage;
-    ndmx[matN] = ndm;
-	rhox[matN] = rho;
-    residualPressx[matN] = residualPress;
-    numOfSurfacesx[matN] = numOfSurfaces;
-    refPressurex[matN] = refPressure;
-    pressDependCoeffx[matN] =pressDependCoeff;
-    refShearModulusx[matN] = refShearModulus;
-	refBulkModulusx[matN] = refBulkModulus;
-    frictionAnglex[matN] = frictionAngle;
-	cohesionx[matN] = cohesion;
-    peakShearStrainx[matN] = peakShearStrain;
-    phaseTransfAnglex[matN] = phaseTransfAngle;
-	stressRatioPTx[matN] = stressRatioPT;
-	contractParam1x[matN] = contractParam1;
-	contractParam2x[matN] = contractParam2;
-	contractParam3x[matN] = contractParam3;
-    dilateParam1x[matN] = dilateParam1;
-    dilateParam2x[matN] = dilateParam2;
-	liquefyParam1x[matN] = liquefyParam1;
-	liquefyParam2x[matN] = liquefyParam2;
-	dilateParam3x[matN] = dilateParam3;
-	einitx[matN] = einit;
-	volLimit1x[matN] = volLimit1;
-	volLimit2x[matN] = volLimit2;
-	volLimit3x[matN] = volLimit3;
-
-	mTypex[matN] = mType;
-	contractParam4x[matN] = contractParam4;
-	contractParam5x[matN] = contractParam5;
+    params->loadStage = loadStage;
+    params->ndm = ndm;
+	params->rho = rho;
+    params->residualPress = residualPress;
+    params->numOfSurfaces = numOfSurfaces;
+    params->refPressure = refPressure;
+    params->pressDependCoeff =pressDependCoeff;
+    params->refShearModulus = refShearModulus;
+	params->refBulkModulus = refBulkModulus;
+    params->frictionAngle = frictionAngle;
+	params->cohesion = cohesion;
+    params->peakShearStrain = peakShearStrain;
+    params->phaseTransfAngle = phaseTransfAngle;
+	params->stressRatioPT = stressRatioPT;
+	params->contractParam1 = contractParam1;
+	params->contractParam2 = contractParam2;
+	params->contractParam3 = contractParam3;
+    params->dilateParam1 = dilateParam1;
+    params->dilateParam2 = dilateParam2;
+	params->liquefyParam1 = liquefyParam1;
+	params->liquefyParam2 = liquefyParam2;
+	params->dilateParam3 = dilateParam3;
+	params->einit = einit;
+	params->volLimit1 = volLimit1;
+	params->volLimit2 = volLimit2;
+	params->volLimit3 = volLimit3;
+
+	params->mType = mType;
+	params->contractParam4 = contractParam4;
+	params->contractParam5 = contractParam5;
 
   return res;
 }
@@ -1516,7 +1235,7 @@ PressureDependMultiYield03::setResponse (const char **argv, int argc, OPS_Stream
 		return new MaterialResponse(this, 3, this->getTangent());
 
 	else if (strcmp(argv[0],"backbone") == 0) {
-	    int numOfSurfaces = numOfSurfacesx[matN];
+	    int numOfSurfaces = params->numOfSurfaces;
 	    Matrix curv(numOfSurfaces+1,(argc-1)*2);
 		for (int i=1; i<argc; i++)
 			curv(0,(i-1)*2) = atoi(argv[i]);
@@ -1529,11 +1248,11 @@ PressureDependMultiYield03::setResponse (const char **argv, int argc, OPS_Stream
 
 void PressureDependMultiYield03::getBackbone (Matrix & bb)
 {
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  double refShearModulus = refShearModulusx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  double refShearModulus = params->refShearModulus;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double vol, conHeig, scale, factor, shearModulus, stress1,
 		     stress2, strain1, strain2, plastModulus, elast_plast, gre;
@@ -1627,15 +1346,15 @@ void PressureDependMultiYield03::Print(OPS_Stream &s, int flag )
 
 const Vector & PressureDependMultiYield03::getCommittedStress (void)
 {
-	int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
-	int numOfSurfaces = numOfSurfacesx[matN];
-    double residualPress = residualPressx[matN];
+	int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
+	int numOfSurfaces = params->numOfSurfaces;
+    double residualPress = params->residualPress;
 
 	double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
-	if (loadStagex[matN] != 1) scale = 0.;
+	if (params->loadStage != 1) scale = 0.;
   if (ndm==3) {
-		static Vector temp7(7);
+		static thread_local Vector temp7(7);
 		workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -1645,8 +1364,8 @@ const Vector & PressureDependMultiYield03::getCommittedStress (void)
     temp7[5] = workV6[5];
     temp7[6] = scale;
     /*temp7[7] = committedActiveSurf;
-	temp7[8] = stressRatioPTx[matN];
-	temp7[9] = currentStress.deviatorRatio(residualPressx[matN]);
+	temp7[8] = params->stressRatioPT;
+	temp7[9] = currentStress.deviatorRatio(params->residualPress);
     temp7[10] = pressureDCommitted;
     temp7[11] = cumuDilateStrainOctaCommitted;
     temp7[12] = maxCumuDilateStrainOctaCommitted;
@@ -1657,7 +1376,7 @@ const Vector & PressureDependMultiYield03::getCommittedStress (void)
 	}
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1683,15 +1402,15 @@ const Vector & PressureDependMultiYield03::getCommittedStress (void)
 const Vector &
 PressureDependMultiYield03::getStressToRecord (int numOutput)
 {
-  int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	static thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		static thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1709,18 +1428,18 @@ PressureDependMultiYield03::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		static thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		static thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1739,13 +1458,13 @@ PressureDependMultiYield03::getStressToRecord (int numOutput)
 
 const Vector & PressureDependMultiYield03::getCommittedStrain (void)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-		static Vector workV(3);
+		static thread_local Vector workV(3);
 		workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -1758,17 +1477,17 @@ const Vector & PressureDependMultiYield03::getCommittedStrain (void)
 // NOTE: surfaces[0] is not used
 void PressureDependMultiYield03::setUpSurfaces (double * gredu)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-    double peakShearStrain = peakShearStrainx[matN];
-    double phaseTransfAngle = phaseTransfAnglex[matN];
-	double stressRatioPT = stressRatioPTx[matN];
-	int mType = mTypex[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+    int numOfSurfaces = params->numOfSurfaces;
+    double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+    double peakShearStrain = params->peakShearStrain;
+    double phaseTransfAngle = params->phaseTransfAngle;
+	double stressRatioPT = params->stressRatioPT;
+	int mType = params->mType;
 
     double refStrain, peakShear, coneHeight;
     double stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
@@ -1801,7 +1520,7 @@ void PressureDependMultiYield03::setUpSurfaces (double * gredu)
 	// tao = cohesion * sqrt(8)/3.
     residualPress = 2 * cohesion / Mnys;
     // a small nonzero residualPress for numerical purpose only
-    if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+    if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
     coneHeight = - (refPressure - residualPress);
     peakShear = sqrt(2.) * coneHeight * Mnys / 3.;
     refStrain = (peakShearStrain * peakShear)
@@ -1842,7 +1561,7 @@ void PressureDependMultiYield03::setUpSurfaces (double * gredu)
 		double tmax = refShearModulus*gredu[ii]*gredu[ii+1];
 		double Mnys = -(sqrt(3.) * tmax - 2.* cohesion) / refPressure;
         residualPress = 2 * cohesion / Mnys;
-        if (residualPress < 0.0001*pAtm) residualPress = 0.0001*pAtm;
+        if (residualPress < 0.0001*params->pAtm) residualPress = 0.0001*params->pAtm;
         coneHeight = - (refPressure - residualPress);
 
         double sinPhi = 3*Mnys /(6+Mnys);
@@ -1904,11 +1623,11 @@ void PressureDependMultiYield03::setUpSurfaces (double * gredu)
 	}
   }
 
-  residualPressx[matN] = residualPress;
-  frictionAnglex[matN] = frictionAngle;
-  cohesionx[matN] = cohesion;
-  phaseTransfAnglex[matN] = phaseTransfAngle;
-  stressRatioPTx[matN] = stressRatioPT;
+  params->residualPress = residualPress;
+  params->frictionAngle = frictionAngle;
+  params->cohesion = cohesion;
+  params->phaseTransfAngle = phaseTransfAngle;
+  params->stressRatioPT = stressRatioPT;
 }
 
 
@@ -1916,7 +1635,7 @@ double PressureDependMultiYield03::yieldFunc(const T2Vector & stress,
 					   const MultiYieldSurface * surfaces,
 					   int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
+  double residualPress = params->residualPress;
 
   double coneHeight = stress.volume() - residualPress;
   //workV6 = stress.deviator() - surfaces[surfaceNum].center()*coneHeight;
@@ -1933,8 +1652,8 @@ void PressureDependMultiYield03::deviatorScaling(T2Vector & stress,
 					       const MultiYieldSurface * surfaces,
 					       int surfaceNum)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double diff = yieldFunc(stress, surfaces, surfaceNum);
   double coneHeight = stress.volume() - residualPress;
@@ -1942,7 +1661,7 @@ void PressureDependMultiYield03::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    static thread_local Vector devia(6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1966,13 +1685,13 @@ void PressureDependMultiYield03::deviatorScaling(T2Vector & stress,
 
 void PressureDependMultiYield03::initSurfaceUpdate(void)
 {
-  double residualPress = residualPressx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  static thread_local Vector devia(6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -1999,12 +1718,12 @@ void PressureDependMultiYield03::initSurfaceUpdate(void)
 
 void PressureDependMultiYield03::initStrainUpdate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
+    double stressRatioPT = params->stressRatioPT;
 
   // elastic strain state
   double stressRatio = currentStress.deviatorRatio(residualPress);
@@ -2048,9 +1767,9 @@ void PressureDependMultiYield03::initStrainUpdate(void)
 
 double PressureDependMultiYield03::getModulusFactor(T2Vector & stress)
 {
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
 
   double conHeig = stress.volume() - residualPress;
   double scale = conHeig / (refPressure-residualPress);
@@ -2062,8 +1781,8 @@ double PressureDependMultiYield03::getModulusFactor(T2Vector & stress)
 
 void PressureDependMultiYield03::setTrialStress(T2Vector & stress)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   modulusFactor = getModulusFactor(stress);
   //workV6 = stress.deviator()
@@ -2073,10 +1792,10 @@ void PressureDependMultiYield03::setTrialStress(T2Vector & stress)
 
   double B = refBulkModulus*modulusFactor;
 
-  if (Hvx[matN] != 0. && trialStress.volume()<=maxPress
-	  && subStrainRate.volume()<0. && loadStagex[matN] == 1) {
-     double tp = fabs(trialStress.volume() - residualPressx[matN]);
-     B = (B*Hvx[matN]*pow(tp,Pvx[matN]))/(B+Hvx[matN]*pow(tp,Pvx[matN]));
+  if (params->Hv != 0. && trialStress.volume()<=maxPress
+	  && subStrainRate.volume()<0. && params->loadStage == 1) {
+     double tp = fabs(trialStress.volume() - params->residualPress);
+     B = (B*params->Hv*pow(tp,params->Pv))/(B+params->Hv*pow(tp,params->Pv));
   }
 
   double volume = stress.volume() + subStrainRate.volume()*3.*B;
@@ -2088,9 +1807,9 @@ void PressureDependMultiYield03::setTrialStress(T2Vector & stress)
 
 int PressureDependMultiYield03::setSubStrainRate(void)
 {
-    double residualPress = residualPressx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    double refShearModulus = params->refShearModulus;
+	int numOfSurfaces = params->numOfSurfaces;
 
   //if (activeSurfaceNum==numOfSurfaces) return 1;
   if (strainRate.isZero()) return 0;
@@ -2130,10 +1849,10 @@ int PressureDependMultiYield03::setSubStrainRate(void)
 void
 PressureDependMultiYield03::getContactStress(T2Vector &contactStress)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -2166,11 +1885,11 @@ int PressureDependMultiYield03::isLoadReversal(const T2Vector & stress)
 void
 PressureDependMultiYield03::getSurfaceNormal(const T2Vector & stress, T2Vector &normal)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  static thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -2186,13 +1905,13 @@ PressureDependMultiYield03::getSurfaceNormal(const T2Vector & stress, T2Vector &
 double PressureDependMultiYield03::getPlasticPotential(const T2Vector & contactStress,
 						     const T2Vector & surfaceNormal)
 {
-    double residualPress = residualPressx[matN];
-    double stressRatioPT = stressRatioPTx[matN];
-	double contractParam1 = contractParam1x[matN];
-	double contractParam2 = contractParam2x[matN];
-	double contractParam3 = contractParam3x[matN];
-    double dilateParam1 = dilateParam1x[matN];
-    double dilateParam2 = dilateParam2x[matN];
+    double residualPress = params->residualPress;
+    double stressRatioPT = params->stressRatioPT;
+	double contractParam1 = params->contractParam1;
+	double contractParam2 = params->contractParam2;
+	double contractParam3 = params->contractParam3;
+    double dilateParam1 = params->dilateParam1;
+    double dilateParam2 = params->dilateParam2;
 
   double plasticPotential, contractRule, shearLoading, angle;
 
@@ -2213,8 +1932,8 @@ double PressureDependMultiYield03::getPlasticPotential(const T2Vector & contactS
 		  plasticPotential = 0.;
       else if (onPPZ==2) {
           factorPT -= 1.0;
-		    	double dilateParam3 = dilateParam3x[matN];
-		  double ppp=pow((fabs(contactStress.volume())+fabs(residualPress))/pAtm, -dilateParam3);
+		    	double dilateParam3 = params->dilateParam3;
+		  double ppp=pow((fabs(contactStress.volume())+fabs(residualPress))/params->pAtm, -dilateParam3);
           plasticPotential = ppp*factorPT*(factorPT)*(dilateParam1+pow(cumuDilateStrainOcta,dilateParam2));
           if (plasticPotential < 0.) plasticPotential = -plasticPotential;
 		  if (plasticPotential>5.0e4) plasticPotential = 5.0e4;
@@ -2239,7 +1958,7 @@ double PressureDependMultiYield03::getPlasticPotential(const T2Vector & contactS
 	  }
       factorPT = factorPT*angle - 1.0;
 
-	  contractRule = pow((fabs(contactStress.volume())+fabs(residualPress))/pAtm, contractParam3);
+	  contractRule = pow((fabs(contactStress.volume())+fabs(residualPress))/params->pAtm, contractParam3);
       if (contractRule < 0.1) contractRule = 0.1;
 
 	  //plasticPotential = factorPT*(contractParam1+pressureD*contractParam2)*contractRule;
@@ -2264,12 +1983,12 @@ double PressureDependMultiYield03::getPlasticPotential(const T2Vector & contactS
 
 double PressureDependMultiYield03::ContractionFactorC(void)
 {
-	double residualPress = residualPressx[matN];
-	double cd = contractParam4x[matN];
-	double ce = contractParam5x[matN];
+	double residualPress = params->residualPress;
+	double cd = params->contractParam4;
+	double ce = params->contractParam5;
 
 	// Start - by Arash K.
-	static Vector stress0 = currentStress.t2Vector();
+	static thread_local Vector stress0 = currentStress.t2Vector();
 	double sig110 = stress0[0];
 	double sig220 = stress0[1];
 	double sig330 = stress0[2];
@@ -2296,10 +2015,10 @@ double PressureDependMultiYield03::ContractionFactorC(void)
 
 int PressureDependMultiYield03::isCriticalState(const T2Vector & stress)
 {
-	double einit = einitx[matN];
-	double volLimit1 = volLimit1x[matN];
-	double volLimit2 = volLimit2x[matN];
-	double volLimit3 = volLimit3x[matN];
+	double einit = params->einit;
+	double volLimit1 = params->volLimit1;
+	double volLimit2 = params->volLimit2;
+	double volLimit3 = params->volLimit3;
 
   double vol = trialStrain.volume()*3.0;
 	double etria = einit + vol + vol*einit;
@@ -2308,11 +2027,11 @@ int PressureDependMultiYield03::isCriticalState(const T2Vector & stress)
 
 	double ecr1, ecr2;
 	if (volLimit3 != 0.) {
-		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/pAtm), volLimit3);
-	  ecr2 = volLimit1 - volLimit2*pow(fabs(-updatedTrialStress.volume()/pAtm), volLimit3);
+		ecr1 = volLimit1 - volLimit2*pow(fabs(-stress.volume()/params->pAtm), volLimit3);
+	  ecr2 = volLimit1 - volLimit2*pow(fabs(-updatedTrialStress.volume()/params->pAtm), volLimit3);
 	} else {
-		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/pAtm));
-	  ecr2 = volLimit1 - volLimit2*log(fabs(-updatedTrialStress.volume()/pAtm));
+		ecr1 = volLimit1 - volLimit2*log(fabs(-stress.volume()/params->pAtm));
+	  ecr2 = volLimit1 - volLimit2*log(fabs(-updatedTrialStress.volume()/params->pAtm));
 	}
 
 	if (ecurr < ecr2 && etria < ecr1) return 0;
@@ -2323,11 +2042,11 @@ int PressureDependMultiYield03::isCriticalState(const T2Vector & stress)
 
 void PressureDependMultiYield03::updatePPZ(const T2Vector & contactStress)
 {
-  double liquefyParam1 = liquefyParam1x[matN];
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  	double liquefyParam2 = liquefyParam2x[matN];
+  double liquefyParam1 = params->liquefyParam1;
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  	double liquefyParam2 = params->liquefyParam2;
 
   // onPPZ=-1 may not be needed. can start with onPPZ=0  ****
 
@@ -2441,9 +2160,9 @@ void PressureDependMultiYield03::updatePPZ(const T2Vector & contactStress)
 
 void PressureDependMultiYield03::PPZTranslation(const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
-  	double liquefyParam2 = liquefyParam2x[matN];
-    double residualPress = residualPressx[matN];
+	double liquefyParam1 = params->liquefyParam1;
+  	double liquefyParam2 = params->liquefyParam2;
+    double residualPress = params->residualPress;
 
 	//cumuDilateStrainOcta -= subStrainRate.octahedralShear(1);
     //if (cumuDilateStrainOcta < 0.) cumuDilateStrainOcta = 0.;
@@ -2484,9 +2203,9 @@ void PressureDependMultiYield03::PPZTranslation(const T2Vector & contactStress)
 
 double PressureDependMultiYield03::getPPZLimits(int which, const T2Vector & contactStress)
 {
-	double liquefyParam1 = liquefyParam1x[matN];
-	double liquefyParam2 = liquefyParam2x[matN];
-	double dilateParam3 = dilateParam3x[matN];
+	double liquefyParam1 = params->liquefyParam1;
+	double liquefyParam2 = params->liquefyParam2;
+	double dilateParam3 = params->dilateParam3;
 
   double PPZLimit, temp;
   double volume = -contactStress.volume();
@@ -2517,9 +2236,9 @@ double PressureDependMultiYield03::getLoadingFunc(const T2Vector & contactStress
 						double * plasticPotential,
 						int crossedSurface)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
   double loadingFunc, limit;
   double modul = theSurfaces[activeSurfaceNum].modulus();
@@ -2559,12 +2278,12 @@ double PressureDependMultiYield03::getLoadingFunc(const T2Vector & contactStress
 
 int PressureDependMultiYield03::stressCorrection(int crossedSurface)
 {
-    double refShearModulus = refShearModulusx[matN];
-	double refBulkModulus = refBulkModulusx[matN];
+    double refShearModulus = params->refShearModulus;
+	double refBulkModulus = params->refBulkModulus;
 
-  static T2Vector contactStress;
+  static thread_local T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  static thread_local T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   double tVolume = trialStress.volume();
@@ -2606,16 +2325,16 @@ int PressureDependMultiYield03::stressCorrection(int crossedSurface)
 
 void PressureDependMultiYield03::updateActiveSurface(void)
 {
-    double residualPress = residualPressx[matN];
-    int numOfSurfaces = numOfSurfacesx[matN];
+    double residualPress = params->residualPress;
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  static thread_local Vector t1(6);
+  static thread_local Vector t2(6);
+  static thread_local Vector center(6);
+  static thread_local Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2684,11 +2403,11 @@ void PressureDependMultiYield03::updateActiveSurface(void)
 
 void PressureDependMultiYield03::updateInnerSurface(void)
 {
-    double residualPress = residualPressx[matN];
+    double residualPress = params->residualPress;
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	static thread_local Vector devia(6);
+	static thread_local Vector center(6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
@@ -2711,7 +2430,7 @@ void PressureDependMultiYield03::updateInnerSurface(void)
 
 int PressureDependMultiYield03:: isCrossingNextSurface(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return 0;
 
@@ -18,19 +18,8 @@
 #include <MultiYieldSurface.h>
 
 
-Matrix PressureIndependMultiYield::theTangent(6,6);
-T2Vector PressureIndependMultiYield::subStrainRate;
-int     PressureIndependMultiYield::matCount=0;
-int*    PressureIndependMultiYield::loadStagex=0;  //=0 if elastic; =1 if plastic
-int*    PressureIndependMultiYield::ndmx=0;        //num of dimensions (2 or 3)
-double* PressureIndependMultiYield::rhox=0;
-double* PressureIndependMultiYield::frictionAnglex=0;
-double* PressureIndependMultiYield::peakShearStrainx=0;
-double* PressureIndependMultiYield::refPressurex=0;
-double* PressureIndependMultiYield::cohesionx=0;
-double* PressureIndependMultiYield::pressDependCoeffx=0;
-int*    PressureIndependMultiYield::numOfSurfacesx=0;
-double* PressureIndependMultiYield::residualPressx=0;
+thread_local Matrix PressureIndependMultiYield::theTangent(6,6);
+thread_local T2Vector PressureIndependMultiYield::subStrainRate;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_PressureIndependMultiYield)
 {
@@ -83,7 +72,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PressureIndependMultiYield)
 	return 0;
     }
 
-    static double * gredu = 0;
+    static thread_local double * gredu = 0;
     // user defined yield surfaces
     if (numberOfYieldSurf < 0 && numberOfYieldSurf > -40) {
 	numberOfYieldSurf = -int(numberOfYieldSurf);
@@ -177,64 +166,21 @@ PressureIndependMultiYield::PressureIndependMultiYield (int tag, int nd,
     r = 0.;
   }
 
-  int * temp1 = loadStagex;
-  int * temp2 = ndmx;
-  double * temp3 = rhox;
-  double * temp6 = frictionAnglex;
-  double * temp7 = peakShearStrainx;
-  double * temp8 = refPressurex;
-  double * temp9 = cohesionx;
-  double * temp10 = pressDependCoeffx;
-  int * temp11 = numOfSurfacesx;
-  double * temp12 = residualPressx;
-  
-  int newCount = matCount+1;
-  loadStagex = new int[newCount];
-  ndmx = new int[newCount];
-  rhox = new double[newCount];
-  frictionAnglex = new double[newCount];
-  peakShearStrainx = new double[newCount];
-  refPressurex = new double[newCount];
-  cohesionx = new double[newCount];
-  pressDependCoeffx = new double[newCount];
-  numOfSurfacesx = new int[newCount];
-  residualPressx = new double[newCount];
-
-  for (int i=0; i<matCount; i++) {
-    loadStagex[i] = temp1[i];
-    ndmx[i] = temp2[i];
-    rhox[i] = temp3[i];
-    frictionAnglex[i] = temp6[i];
-    peakShearStrainx[i] = temp7[i];
-    refPressurex[i] = temp8[i];
-    cohesionx[i] = temp9[i];
-    pressDependCoeffx[i] = temp10[i];
-    numOfSurfacesx[i] = temp11[i];
-    residualPressx[i] = temp12[i];
-  }
-
-  if (matCount > 0) {
-    delete [] temp1; delete [] temp2; delete [] temp3;
-    delete [] temp6; delete [] temp7; delete [] temp8;
-    delete [] temp9; delete [] temp10; delete [] temp11;
-    delete [] temp12;
-  }
+  params = std::make_shared<Parameters>();
 
-  ndmx[matCount] = nd;
-  loadStagex[matCount] = 0;   //default
+  params->ndm = nd;
+  params->loadStage = 0;   //default
   refShearModulus = refShearModul;
   refBulkModulus = refBulkModul;
-  frictionAnglex[matCount] = frictionAng;
-  peakShearStrainx[matCount] = peakShearStra;
-  refPressurex[matCount] = -refPress;  //compression is negative
-  cohesionx[matCount] = cohesi;
-  pressDependCoeffx[matCount] = pressDependCoe;
-  numOfSurfacesx[matCount] = numberOfYieldSurf;
-  rhox[matCount] = r;
+  params->frictionAngle = frictionAng;
+  params->peakShearStrain = peakShearStra;
+  params->refPressure = -refPress;  //compression is negative
+  params->cohesion = cohesi;
+  params->pressDependCoeff = pressDependCoe;
+  params->numOfSurfaces = numberOfYieldSurf;
+  params->rho = r;
 
   e2p = 0;
-  matN = matCount;
-  matCount=newCount;
 
   theSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numberOfYieldSurf+1];
@@ -259,12 +205,12 @@ PressureIndependMultiYield::PressureIndependMultiYield (const PressureIndependMu
    currentStress(a.currentStress), trialStress(a.trialStress),
   currentStrain(a.currentStrain), strainRate(a.strainRate)
 {
-  matN = a.matN;
+  params = a.params;
   e2p = a.e2p;
   refShearModulus = a.refShearModulus;
   refBulkModulus = a.refBulkModulus;
 
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   committedActiveSurf = a.committedActiveSurf;
   activeSurfaceNum = a.activeSurfaceNum;
@@ -287,9 +233,9 @@ PressureIndependMultiYield::~PressureIndependMultiYield ()
 
 void PressureIndependMultiYield::elast2Plast(void)
 {
-  int loadStage = loadStagex[matN];
-  double frictionAngle = frictionAnglex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  double frictionAngle = params->frictionAngle;
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (loadStage != 1 || e2p == 1) return;
   e2p = 1;
@@ -320,10 +266,10 @@ void PressureIndependMultiYield::elast2Plast(void)
 
 int PressureIndependMultiYield::setTrialStrain (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
-  static Vector temp(6);
+  static thread_local Vector temp(6);
   if (ndm==3 && strain.Size()==6)
     temp = strain;
   else if (ndm==2 && strain.Size()==3) {
@@ -356,10 +302,10 @@ int PressureIndependMultiYield::setTrialStrain (const Vector &strain, const Vect
 
 int PressureIndependMultiYield::setTrialStrainIncr (const Vector &strain)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
-  static Vector temp(6);
+  static thread_local Vector temp(6);
   if (ndm==3 && strain.Size()==6)
     temp = strain;
   else if (ndm==2 && strain.Size()==3) {
@@ -386,9 +332,9 @@ int PressureIndependMultiYield::setTrialStrainIncr (const Vector &strain, const
 
 const Matrix & PressureIndependMultiYield::getTangent (void)
 {
-  int loadStage = loadStagex[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   if (loadStage == 1 && e2p == 0) elast2Plast();
 
@@ -404,7 +350,7 @@ const Matrix & PressureIndependMultiYield::getTangent (void)
   }
   else {
     double coeff;
-    static Vector devia(6);
+    static thread_local Vector devia(6);
 
     /*if (committedActiveSurf > 0) {
       //devia = currentStress.deviator()-committedSurfaces[committedActiveSurf].center();
@@ -439,7 +385,7 @@ const Matrix & PressureIndependMultiYield::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -456,8 +402,8 @@ const Matrix & PressureIndependMultiYield::getTangent (void)
 
 const Matrix & PressureIndependMultiYield::getInitialTangent (void)
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   for (int i=0;i<6;i++)
     for (int j=0;j<6;j++) {
@@ -470,7 +416,7 @@ const Matrix & PressureIndependMultiYield::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    static thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -487,10 +433,10 @@ const Matrix & PressureIndependMultiYield::getInitialTangent (void)
 
 const Vector & PressureIndependMultiYield::getStress (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 3;
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 3;
 
   int i;
   if (loadStage == 1 && e2p == 0) elast2Plast();
@@ -498,7 +444,7 @@ const Vector & PressureIndependMultiYield::getStress (void)
   if (loadStage!=1) {  //linear elastic
     //trialStrain.setData(currentStrain.t2Vector() + strainRate.t2Vector());
     getTangent();
-    static Vector a(6);
+    static thread_local Vector a(6);
     a = currentStress.t2Vector();
 	a.addMatrixVector(1.0, theTangent, strainRate.t2Vector(1), 1.0);
     trialStress.setData(a);
@@ -535,7 +481,7 @@ const Vector & PressureIndependMultiYield::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-    static Vector workV(3);
+    static thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -552,13 +498,13 @@ const Vector & PressureIndependMultiYield::getStrain (void)
 
 int PressureIndependMultiYield::commitState (void)
 {
-  int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int loadStage = params->loadStage;
+  int numOfSurfaces = params->numOfSurfaces;
 
   currentStress = trialStress;
 
   //currentStrain = T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
-  static Vector temp(6);
+  static thread_local Vector temp(6);
   temp = currentStrain.t2Vector();
   temp += strainRate.t2Vector();
   currentStrain.setData(temp);
@@ -601,8 +547,8 @@ NDMaterial * PressureIndependMultiYield::getCopy (const char *code)
 
 const char * PressureIndependMultiYield::getType (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? "PlaneStrain" : "ThreeDimensional";
 }
@@ -610,8 +556,8 @@ const char * PressureIndependMultiYield::getType (void) const
 
 int PressureIndependMultiYield::getOrder (void) const
 {
-  int ndm = ndmx[matN];
-  if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+  if (params->ndm == 0) ndm = 2;
 
   return (ndm == 2) ? 3 : 6;
 }
@@ -646,19 +592,19 @@ int PressureIndependMultiYield::setParameter(const char **argv, int argc, Parame
 int PressureIndependMultiYield::updateParameter(int responseID, Information &info)
 {    
   if (responseID == 1) {
-    loadStagex[matN] = info.theInt;
+    params->loadStage = info.theInt;
   } else if (responseID==10) {
     refShearModulus = info.theDouble;
   } else if (responseID==11) {
     refBulkModulus = info.theDouble;
   } else if (responseID==12) {
-    frictionAnglex[matN] = info.theDouble;
+    params->frictionAngle = info.theDouble;
     double *g = 0;
     setUpSurfaces(g);
     paramScaling();
     initSurfaceUpdate();
   } else if (responseID==13) {
-    cohesionx[matN] = info.theDouble;
+    params->cohesion = info.theDouble;
     double *g = 0;
     setUpSurfaces(g);
     paramScaling();
@@ -666,8 +612,8 @@ int PressureIndependMultiYield::updateParameter(int responseID, Information &inf
   }
 
   // used by BBarFourNodeQuadUP element
-  else if (responseID==20 && ndmx[matN] == 2)
-		ndmx[matN] = 0;
+  else if (responseID==20 && params->ndm == 2)
+		params->ndm = 0;
 
   return 0;
 }
@@ -675,26 +621,24 @@ int PressureIndependMultiYield::updateParameter(int responseID, Information &inf
 
 int PressureIndependMultiYield::sendSelf(int commitTag, Channel &theChannel)
 {
-  int loadStage = loadStagex[matN];
-  int ndm = ndmx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
-  double rho = rhox[matN];
-  double frictionAngle = frictionAnglex[matN];
-  double peakShearStrain = peakShearStrainx[matN];
-  double refPressure = refPressurex[matN];
-  double cohesion = cohesionx[matN];
-  double pressDependCoeff = pressDependCoeffx[matN];
-  double residualPress = residualPressx[matN];
+  int loadStage = params->loadStage;
+  int ndm = params->ndm;
+  int numOfSurfaces = params->numOfSurfaces;
+  double rho = params->rho;
+  double frictionAngle = params->frictionAngle;
+  double peakShearStrain = params->peakShearStrain;
+  double refPressure = params->refPressure;
+  double cohesion = params->cohesion;
+  double pressDependCoeff = params->pressDependCoeff;
+  double residualPress = params->residualPress;
 
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
   idData(3) = ndm;
-  idData(4) = matN;
-  idData(5) = matCount;
 
   res += theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -703,7 +647,7 @@ int PressureIndependMultiYield::sendSelf(int commitTag, Channel &theChannel)
   }
 
   Vector data(24+numOfSurfaces*8);
-  static Vector temp(6);
+  static thread_local Vector temp(6);
   data(0) = rho;
   data(1) = refShearModulus;
   data(2) = refBulkModulus;
@@ -751,7 +695,7 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(6);
+  static thread_local ID idData(4);
 
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -763,12 +707,10 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
   int numOfSurfaces = idData(1);
   int loadStage = idData(2);
   int ndm = idData(3);
-  matN = idData(4);
-
-  int matCountSendSide = idData(5);
+  params = std::make_shared<Parameters>();
 
   Vector data(24+idData(1)*8);
-  static Vector temp(6);
+  static thread_local Vector temp(6);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -816,64 +758,16 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
     committedSurfaces[i+1].setData(temp, data(k), data(k+1));
   }
 
-  int *temp1, *temp2, *temp11;
-  double *temp3, *temp6, *temp7, *temp8, *temp9, *temp10, *temp12;
-
-  if (matCountSendSide > matCount) {
-
-	 temp1 = loadStagex;
-	 temp2 = ndmx;
-	 temp3 = rhox;
-	 temp6 = frictionAnglex;
-	 temp7 = peakShearStrainx;
-	 temp8 = refPressurex;
-	 temp9 = cohesionx;
-	 temp10 = pressDependCoeffx;
-	 temp11 = numOfSurfacesx;
-	 temp12 = residualPressx;
-
-	 loadStagex = new int[matCountSendSide];
-	 ndmx = new int[matCountSendSide];
-	 rhox = new double[matCountSendSide];
-	 frictionAnglex = new double[matCountSendSide];
-	 peakShearStrainx = new double[matCountSendSide];
-	 refPressurex = new double[matCountSendSide];
-	 cohesionx = new double[matCountSendSide];
-	 pressDependCoeffx = new double[matCountSendSide];
-	 numOfSurfacesx = new int[matCountSendSide];
-	 residualPressx = new double[matCountSendSide];
-	 
-	 for (int i=0; i<matCount; i++) {
-	   loadStagex[i] = temp1[i];
-	   ndmx[i] = temp2[i];
-	   rhox[i] = temp3[i];
-	   frictionAnglex[i] = temp6[i];
-	   peakShearStrainx[i] = temp7[i];
-	   refPressurex[i] = temp8[i];
-	   cohesionx[i] = temp9[i];
-	   pressDependCoeffx[i] = temp10[i];
-	   numOfSurfacesx[i] = temp11[i];
-	   residualPressx[i] = temp12[i];
-	 }
-	 if( matCount > 0 ) {
-	   delete [] temp1; delete [] temp2; delete [] temp3;
-	   delete [] temp6; delete [] temp7; delete [] temp8;
-	   delete [] temp9; delete [] temp10; delete [] temp11;
-	   delete [] temp12;
-	 }
-	 matCount = matCountSendSide;
-  }
-  
-  loadStagex[matN] = loadStage;
-  ndmx[matN] = ndm;
-  numOfSurfacesx[matN] = numOfSurfaces;
-  rhox[matN] = rho;
-  frictionAnglex[matN] = frictionAngle;
-  peakShearStrainx[matN] = peakShearStrain;
-  refPressurex[matN] = refPressure;
-  cohesionx[matN] = cohesion;
-  pressDependCoeffx[matN] = pressDependCoeff;
-  residualPressx[matN] = residualPress;
+  params->loadStage = loadStage;
+  params->ndm = ndm;
+  params->numOfSurfaces = numOfSurfaces;
+  params->rho = rho;
+  params->frictionAngle = frictionAngle;
+  params->peakShearStrain = peakShearStrain;
+  params->refPressure = refPressure;
+  params->cohesion = cohesion;
+  params->pressDependCoeff = pressDependCoeff;
+  params->residualPress = residualPress;
 
   return res;
 }
@@ -898,8 +792,8 @@ PressureIndependMultiYield::setResponse (const char **argv, int argc, OPS_Stream
     return new MaterialResponse(this, 3, this->getTangent());
 
   else if (strcmp(argv[0],"backbone") == 0) {
-    int numOfSurfaces = numOfSurfacesx[matN];
-    static Matrix curv(numOfSurfaces+1,(argc-1)*2);
+    int numOfSurfaces = params->numOfSurfaces;
+    static thread_local Matrix curv(numOfSurfaces+1,(argc-1)*2);
     for (int i=1; i<argc; i++)
       curv(0,(i-1)*2) = atoi(argv[i]);
     return new MaterialResponse(this, 4, curv);
@@ -960,10 +854,10 @@ int PressureIndependMultiYield::getResponse (int responseID, Information &matInf
 
 void PressureIndependMultiYield::getBackbone (Matrix & bb)
 {
-  double residualPress = residualPressx[matN];
-  double refPressure = refPressurex[matN];
-  double pressDependCoeff =pressDependCoeffx[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
+  double residualPress = params->residualPress;
+  double refPressure = params->refPressure;
+  double pressDependCoeff =params->pressDependCoeff;
+  int numOfSurfaces = params->numOfSurfaces;
 
   double vol, conHeig, scale, factor, shearModulus, stress1,
 		     stress2, strain1, strain2, plastModulus, elast_plast, gre;
@@ -1002,23 +896,23 @@ void PressureIndependMultiYield::Print(OPS_Stream &s, int flag )
 {
   // TODO: impolement JSON
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
-    s << "          {\"type\": \"PressureIndependMultiYield\", \"loadStage\": " <<  loadStagex[matN] << "}";
+    s << "          {\"type\": \"PressureIndependMultiYield\", \"loadStage\": " <<  params->loadStage << "}";
     return;
   }
-  s << "PressureIndependMultiYield - loadStage: " <<  loadStagex[matN] << endln;
+  s << "PressureIndependMultiYield - loadStage: " <<  params->loadStage << endln;
 }
 
 
 const Vector & PressureIndependMultiYield::getCommittedStress (void)
 {
-	int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
+	int numOfSurfaces = params->numOfSurfaces;
 
 	double scale = sqrt(3./2.)*currentStress.deviatorLength()/committedSurfaces[numOfSurfaces].size();
-	if (loadStagex[matN] != 1) scale = 0.;
+	if (params->loadStage != 1) scale = 0.;
 	if (ndm==3) {
-		static Vector temp7(7), temp6(6);
+		static thread_local Vector temp7(7), temp6(6);
 		temp6 = currentStress.t2Vector();
         temp7[0] = temp6[0];
         temp7[1] = temp6[1];
@@ -1030,7 +924,7 @@ const Vector & PressureIndependMultiYield::getCommittedStress (void)
 	    return temp7;
 	}
     else {
-        static Vector temp5(5), temp6(6);
+        static thread_local Vector temp5(5), temp6(6);
 		temp6 = currentStress.t2Vector();
         temp5[0] = temp6[0];
         temp5[1] = temp6[1];
@@ -1044,15 +938,15 @@ const Vector & PressureIndependMultiYield::getCommittedStress (void)
 // begin change by Alborz Ghofrani - UW --- get 6 components of stress
 const Vector & PressureIndependMultiYield::getStressToRecord (int numOutput)
 {
-  int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
+  int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	static thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		static thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1070,18 +964,18 @@ const Vector & PressureIndependMultiYield::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    static thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		static thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		static thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1100,13 +994,13 @@ const Vector & PressureIndependMultiYield::getStressToRecord (int numOutput)
 
 const Vector & PressureIndependMultiYield::getCommittedStrain (void)
 {
-	int ndm = ndmx[matN];
-    if (ndmx[matN] == 0) ndm = 2;
+	int ndm = params->ndm;
+    if (params->ndm == 0) ndm = 2;
 
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-    static Vector workV(3), temp6(6);
+    static thread_local Vector workV(3), temp6(6);
 		temp6 = currentStrain.t2Vector(1);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -1119,13 +1013,13 @@ const Vector & PressureIndependMultiYield::getCommittedStrain (void)
 // NOTE: surfaces[0] is not used
 void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 {
-	double residualPress = residualPressx[matN];
-	double refPressure = refPressurex[matN];
-	double pressDependCoeff =pressDependCoeffx[matN];
-	int numOfSurfaces = numOfSurfacesx[matN];
-	double frictionAngle = frictionAnglex[matN];
-	double cohesion = cohesionx[matN];
-	double peakShearStrain = peakShearStrainx[matN];
+	double residualPress = params->residualPress;
+	double refPressure = params->refPressure;
+	double pressDependCoeff =params->pressDependCoeff;
+	int numOfSurfaces = params->numOfSurfaces;
+	double frictionAngle = params->frictionAngle;
+	double cohesion = params->cohesion;
+	double peakShearStrain = params->peakShearStrain;
 
 	double  stress1, stress2, strain1, strain2, size, elasto_plast_modul, plast_modul;
 	double pi = 3.14159265358979;
@@ -1170,7 +1064,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 			if (plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
 			if (ii==numOfSurfaces) plast_modul = 0;
 
-			static Vector temp(6);
+			static thread_local Vector temp(6);
 			committedSurfaces[ii] = MultiYieldSurface(temp,size,plast_modul);
 		}  // ii
 	}
@@ -1232,7 +1126,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 			}
 			if (plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
 
-			static Vector temp(6);
+			static thread_local Vector temp(6);
 			committedSurfaces[i] = MultiYieldSurface(temp,size,plast_modul);
 
 			if (i==(numOfSurfaces-1)) {
@@ -1243,16 +1137,16 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 		}
 	}
 
-	residualPressx[matN] = residualPress;
-	frictionAnglex[matN] = frictionAngle;
-	cohesionx[matN] = cohesion;
+	params->residualPress = residualPress;
+	params->frictionAngle = frictionAngle;
+	params->cohesion = cohesion;
 }
 
 
 double PressureIndependMultiYield::yieldFunc(const T2Vector & stress,
 											 const MultiYieldSurface * surfaces, int surfaceNum)
 {
-	static Vector temp(6);
+	static thread_local Vector temp(6);
 	//temp = stress.deviator() - surfaces[surfaceNum].center();
 	temp = stress.deviator();
 	temp -= surfaces[surfaceNum].center();
@@ -1266,16 +1160,16 @@ void PressureIndependMultiYield::deviatorScaling(T2Vector & stress, const MultiY
 																			int surfaceNum, int count)
 {
 	count++;
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
 
 	double diff = yieldFunc(stress, surfaces, surfaceNum);
 
 	if ( surfaceNum < numOfSurfaces && diff < 0. ) {
 		double sz = surfaces[surfaceNum].size();
 		double deviaSz = sqrt(sz*sz + diff);
-		static Vector devia(6);
+		static thread_local Vector devia(6);
 		devia = stress.deviator();
-		static Vector temp(6);
+		static thread_local Vector temp(6);
 		temp = devia - surfaces[surfaceNum].center();
 		double coeff = (sz-deviaSz) / deviaSz;
 		if (coeff < 1.e-13) coeff = 1.e-13;
@@ -1286,7 +1180,7 @@ void PressureIndependMultiYield::deviatorScaling(T2Vector & stress, const MultiY
 
 	if (surfaceNum==numOfSurfaces && fabs(diff) > LOW_LIMIT) {
 		double sz = surfaces[surfaceNum].size();
-		static Vector newDevia(6);
+		static thread_local Vector newDevia(6);
 		newDevia.addVector(0.0, stress.deviator(), sz/sqrt(diff+sz*sz));
 		stress.setData(newDevia, stress.volume());
 	}
@@ -1297,12 +1191,12 @@ void PressureIndependMultiYield::initSurfaceUpdate()
 {
 	if (committedActiveSurf == 0) return;
 
-	int numOfSurfaces = numOfSurfacesx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
 
-	static Vector devia(6);
+	static thread_local Vector devia(6);
 	devia = currentStress.deviator();
 	double Ms = sqrt(3./2.*(devia && devia));
-	static Vector newCenter(6);
+	static thread_local Vector newCenter(6);
 
 	if (committedActiveSurf < numOfSurfaces) { // failure surface can't move
 		//newCenter = devia * (1. - committedSurfaces[activeSurfaceNum].size() / Ms);
@@ -1319,11 +1213,11 @@ void PressureIndependMultiYield::initSurfaceUpdate()
 
 void PressureIndependMultiYield::paramScaling(void)
 {
-	int numOfSurfaces = numOfSurfacesx[matN];
-	double frictionAngle = frictionAnglex[matN];
-    double residualPress = residualPressx[matN];
-    double refPressure = refPressurex[matN];
-    double pressDependCoeff =pressDependCoeffx[matN];
+	int numOfSurfaces = params->numOfSurfaces;
+	double frictionAngle = params->frictionAngle;
+    double residualPress = params->residualPress;
+    double refPressure = params->refPressure;
+    double pressDependCoeff =params->pressDependCoeff;
 
 	if (frictionAngle == 0.) return;
 
@@ -1335,7 +1229,7 @@ void PressureIndependMultiYield::paramScaling(void)
    	refBulkModulus *= scale;
 
 	double plastModul, size;
-	static Vector temp(6);
+	static thread_local Vector temp(6);
 	for (int i=1; i<=numOfSurfaces; i++) {
 	  plastModul = committedSurfaces[i].modulus() * scale;
 	  size = committedSurfaces[i].size() * conHeig;
@@ -1347,7 +1241,7 @@ void PressureIndependMultiYield::paramScaling(void)
 
 void PressureIndependMultiYield::setTrialStress(T2Vector & stress)
 {
-  static Vector devia(6);
+  static thread_local Vector devia(6);
   //devia = stress.deviator() + subStrainRate.deviator()*2.*refShearModulus;
   devia = stress.deviator();
   devia.addVector(1.0, subStrainRate.deviator(), 2.*refShearModulus);
@@ -1358,7 +1252,7 @@ void PressureIndependMultiYield::setTrialStress(T2Vector & stress)
 
 int PressureIndependMultiYield::setSubStrainRate(void)
 {
-    int numOfSurfaces = numOfSurfacesx[matN];
+    int numOfSurfaces = params->numOfSurfaces;
 
 	//if (activeSurfaceNum==numOfSurfaces) return 1;
 
@@ -1373,11 +1267,11 @@ int PressureIndependMultiYield::setSubStrainRate(void)
 	  elast_plast_modulus = 2*refShearModulus*plast_modulus
 	    / (2*refShearModulus+plast_modulus);
 	}
-	static Vector incre(6);
+	static thread_local Vector incre(6);
 	//incre = strainRate.deviator()*elast_plast_modulus;
 	incre.addVector(0.0, strainRate.deviator(),elast_plast_modulus);
 
-	static T2Vector increStress;
+	static thread_local T2Vector increStress;
 	increStress.setData(incre, 0);
 	double singleCross = theSurfaces[numOfSurfaces].size() / numOfSurfaces;
 	double totalCross = 3.*increStress.octahedralShear() / sqrt(2.);
@@ -1395,9 +1289,9 @@ int PressureIndependMultiYield::setSubStrainRate(void)
 void
 PressureIndependMultiYield::getContactStress(T2Vector &contactStress)
 {
-	static Vector center(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
-	static Vector devia(6);
+	static thread_local Vector devia(6);
 	//devia = trialStress.deviator() - center;
 	devia = trialStress.deviator();
 	devia -= center;
@@ -1415,12 +1309,12 @@ int PressureIndependMultiYield::isLoadReversal(void)
 {
   if(activeSurfaceNum == 0) return 0;
 
-  static Vector surfaceNormal(6);
+  static thread_local Vector surfaceNormal(6);
   getSurfaceNormal(currentStress, surfaceNormal);
 
   //(((trialStress.deviator() - currentStress.deviator()) && surfaceNormal) < 0)
   // return 1;
-  static Vector a(6);
+  static thread_local Vector a(6);
   a = trialStress.deviator();
   a-= currentStress.deviator();
   if((a && surfaceNormal) < 0)
@@ -1452,7 +1346,7 @@ double PressureIndependMultiYield::getLoadingFunc(const T2Vector & contactStress
   //for crossing first surface
   double temp = temp1 + temp2;
   //loadingFunc = (surfaceNormal && (trialStress.deviator()-contactStress.deviator()))/temp;
-  static Vector tmp(6);
+  static thread_local Vector tmp(6);
   tmp =trialStress.deviator();
   tmp -= contactStress.deviator();
   loadingFunc = (surfaceNormal && tmp)/temp;
@@ -1468,12 +1362,12 @@ double PressureIndependMultiYield::getLoadingFunc(const T2Vector & contactStress
 
 void PressureIndependMultiYield::stressCorrection(int crossedSurface)
 {
-	static T2Vector contactStress;
+	static thread_local T2Vector contactStress;
 	this->getContactStress(contactStress);
-	static Vector surfaceNormal(6);
+	static thread_local Vector surfaceNormal(6);
 	this->getSurfaceNormal(contactStress, surfaceNormal);
 	double loadingFunc = getLoadingFunc(contactStress, surfaceNormal, crossedSurface);
-	static Vector devia(6);
+	static thread_local Vector devia(6);
 
 	//devia = trialStress.deviator() - surfaceNormal * 2 * refShearModulus * loadingFunc;
 	devia.addVector(0.0, surfaceNormal, -2*refShearModulus*loadingFunc);
@@ -1491,19 +1385,19 @@ void PressureIndependMultiYield::stressCorrection(int crossedSurface)
 
 void PressureIndependMultiYield::updateActiveSurface(void)
 {
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
 
   if (activeSurfaceNum == numOfSurfaces) return;
 
 	double A, B, C, X;
-	static T2Vector direction;
-	static Vector t1(6);
-	static Vector t2(6);
-	static Vector temp(6);
-	static Vector center(6);
+	static thread_local T2Vector direction;
+	static thread_local Vector t1(6);
+	static thread_local Vector t2(6);
+	static thread_local Vector temp(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector outcenter(6);
+	static thread_local Vector outcenter(6);
 	outcenter= theSurfaces[activeSurfaceNum+1].center();
 	double outsize = theSurfaces[activeSurfaceNum+1].size();
 
@@ -1568,12 +1462,12 @@ void PressureIndependMultiYield::updateInnerSurface(void)
 {
 	if (activeSurfaceNum <= 1) return;
 
-	static Vector devia(6);
+	static thread_local Vector devia(6);
 	devia = currentStress.deviator();
-	static Vector center(6);
+	static thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector newcenter(6);
+	static thread_local Vector newcenter(6);
 
 	for (int i=1; i<activeSurfaceNum; i++) {
 		//newcenter = devia - (devia - center) * theSurfaces[i].size() / size;
@@ -1589,7 +1483,7 @@ void PressureIndependMultiYield::updateInnerSurface(void)
 
 int PressureIndependMultiYield:: isCrossingNextSurface(void)
 {
-  int numOfSurfaces = numOfSurfacesx[matN];
+  int numOfSurfaces = params->numOfSurfaces;
   if (activeSurfaceNum == numOfSurfaces) return 0;
 
   if(yieldFunc(trialStress, theSurfaces, activeSurfaceNum+1) > 0) return 1;
@@ -7,6 +7,7 @@
 #ifndef PressureIndependMultiYield_h
 #define PressureIndependMultiYield_h
 
+#include <memory>
 #include <NDMaterial.h>
 #include "soil/T2Vector.h"
 #include <Matrix.h>
@@ -41,7 +42,7 @@ public:
 
      const char *getClassType(void) const {return "PressureIndependMultiYield";};
 
-     double getRho(void) {return rhox[matN];} ;
+     double getRho(void) {return params->rho;} ;
 
      // Sets the values of the trial strain tensor.
      int setTrialStrain (const Vector &strain);
@@ -107,24 +108,24 @@ protected:
 
 private:
 
-	static int matCount;
-	static int* loadStagex;  //=0 if elastic; =1 if plastic
-
-  // user supplied
-	static int* ndmx;  //num of dimensions (2 or 3)
-	static double* rhox;
-	static double* frictionAnglex;
-	static double* peakShearStrainx;
-	static double* refPressurex;
-	static double* cohesionx;
-	static double* pressDependCoeffx;
-	static int*    numOfSurfacesx;
+	// Parameters shared by a material and its copies
+	struct Parameters {
+	  int    loadStage;  //=0 if elastic; =1 if plastic
+	  int    ndm;  //num of dimensions (2 or 3)
+	  double rho;
+	  double frictionAngle;
+	  double peakShearStrain;
+	  double refPressure;
+	  double cohesion;
+	  double pressDependCoeff;
+	  int    numOfSurfaces;
+	  double residualPress;
+	};
 
 	// internal
-	static double* residualPressx;
-	static Matrix theTangent;  //classwise member
+	static thread_local Matrix theTangent;  //classwise member
 	int e2p;
-	int matN;
+	std::shared_ptr<Parameters> params;
 	double refShearModulus;
 	double refBulkModulus;
 	MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
@@ -135,7 +136,7 @@ private:
 	T2Vector trialStress;
 	T2Vector currentStrain;
 	T2Vector strainRate;
-	static T2Vector subStrainRate;
+	static thread_local T2Vector subStrainRate;
     double * mGredu;
 
 	void elast2Plast(void);
@@ -39,7 +39,7 @@
 #define OPS_Export 
 OPS_Export void * OPS_ADD_RUNTIME_VPV(OPS_StressDensityMaterial)
 {
-	static int numStressDensityModel = 0;
+	static thread_local int numStressDensityModel = 0;
 
 	if(numStressDensityModel == 0) {
 		opserr << "StressDensityModel nDmaterial - Written: Saumyasuchi Das, U.Canterbury\n" << endln;
@@ -177,7 +177,7 @@ StressDensityModel2D::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
 
     // place data in a vector
-    static Vector vData(318);
+    static thread_local Vector vData(318);
 
 	vData(0)  = this->getTag();
 	vData(1)  = theStage;
@@ -239,7 +239,7 @@ StressDensityModel2D::recvSelf(int commitTag, Channel &theChannel,FEM_ObjectBrok
     int res = 0;
 
     // place data in a vector
-    static Vector vData(318);
+    static thread_local Vector vData(318);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, vData);
 	if (res < 0) {
@@ -177,7 +177,7 @@ StressDensityModel3D::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
 
     // place data in a vector
-    static Vector vData(563);
+    static thread_local Vector vData(563);
 
 	vData(0)  = this->getTag();
 	vData(1)  = theStage;
@@ -251,7 +251,7 @@ StressDensityModel3D::recvSelf(int commitTag, Channel &theChannel,FEM_ObjectBrok
     int res = 0;
 
     // place data in a vector
-    static Vector vData(563);
+    static thread_local Vector vData(563);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, vData);
 	if (res < 0) {
@@ -35,7 +35,7 @@
 #define OPS_Export
 OPS_Export void * OPS_ADD_RUNTIME_VPV(OPS_StressDensityMaterial)
 {
-    static int numStressDensity = 0;
+    static thread_local int numStressDensity = 0;
 
     if(numStressDensity == 0) {
         opserr << "stressDensity nDMaterial - Written: Saumyasuchi Das, U.Canterbury\n" << endln;
@@ -274,7 +274,7 @@ int
 stressDensity::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector vData(798);
+    static thread_local Vector vData(798);
 
     vData(0)  = this->getTag();
     vData(1)  = theStage;
@@ -347,7 +347,7 @@ stressDensity::recvSelf(int commitTag, Channel &theChannel,FEM_ObjectBroker &the
     int res = 0;
 
     // place data in a vector
-    static Vector vData(798);
+    static thread_local Vector vData(798);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, vData);
 	if (res < 0) {
@@ -23,9 +23,9 @@
 #include <Channel.h>
 #include <elementAPI.h>
 
-Vector Bidirectional::s(2);
-Matrix Bidirectional::ks(2,2);
-ID Bidirectional::code(2);
+thread_local Vector Bidirectional::s(2);
+thread_local Matrix Bidirectional::ks(2,2);
+thread_local ID Bidirectional::code(2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_Bidirectional)
 {
@@ -157,7 +157,7 @@ Bidirectional::getSectionTangent(void)
     s(0) = E*(e_n1[0]-eP_n[0]);
     s(1) = E*(e_n1[1]-eP_n[1]);
 
-    static Vector xsi(2);
+    static thread_local Vector xsi(2);
 
     // Predicted stress minus back stress
     xsi(0) = s(0) - q_n[0];
@@ -237,7 +237,7 @@ Bidirectional::getStressResultant(void)
     s(0) = E*(e_n1[0]-eP_n[0]);
     s(1) = E*(e_n1[1]-eP_n[1]);
 
-    static Vector xsi(2);
+    static thread_local Vector xsi(2);
 
     // Predicted stress minus back stress
     xsi(0) = s(0) - q_n[0];
@@ -382,7 +382,7 @@ Bidirectional::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(12);
+  static thread_local Vector data(12);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -410,7 +410,7 @@ Bidirectional::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
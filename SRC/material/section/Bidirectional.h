@@ -84,9 +84,9 @@ class Bidirectional : public SectionForceDeformation
 	
 	int code1, code2;
 
-	static Vector s;
-	static Matrix ks;
-	static ID code;
+	static thread_local Vector s;
+	static thread_local Matrix ks;
+	static thread_local ID code;
 };
 
 
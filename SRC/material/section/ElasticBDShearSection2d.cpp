@@ -30,8 +30,8 @@
 
 #include <classTags.h>
 
-Vector ElasticBDShearSection2d::s(3);
-Matrix ElasticBDShearSection2d::ks(3,3);
+thread_local Vector ElasticBDShearSection2d::s(3);
+thread_local Matrix ElasticBDShearSection2d::ks(3,3);
 ID ElasticBDShearSection2d::code(3);
 
 ElasticBDShearSection2d::ElasticBDShearSection2d()
@@ -206,7 +206,7 @@ ElasticBDShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -232,7 +232,7 @@ ElasticBDShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -323,7 +323,7 @@ const Vector&
 ElasticBDShearSection2d::getStressResultantSensitivity(int gradIndex,
                                                        bool conditional)
 {
-  static Vector dsdh(3);
+  static thread_local Vector dsdh(3);
   dsdh.Zero();
 
   double A = b*d;
@@ -34,8 +34,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection3d::s(4);
-Matrix ElasticSection3d::ks(4,4);
+thread_local Vector ElasticSection3d::s(4);
+thread_local Matrix ElasticSection3d::ks(4,4);
 ID ElasticSection3d::code(4);
 
 void *
@@ -255,7 +255,7 @@ ElasticSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
     
@@ -282,7 +282,7 @@ ElasticSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
     
-	static Vector data(7);
+	static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -80,8 +80,8 @@ class ElasticSection3d : public FrameSection
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
 
   int parameterID;
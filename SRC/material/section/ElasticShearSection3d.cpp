@@ -30,8 +30,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticShearSection3d::s(6);
-Matrix ElasticShearSection3d::ks(6,6);
+thread_local Vector ElasticShearSection3d::s(6);
+thread_local Matrix ElasticShearSection3d::ks(6,6);
 ID ElasticShearSection3d::code(6);
 
 void *
@@ -264,7 +264,7 @@ ElasticShearSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(9);
+    static thread_local Vector data(9);
 
     int dataTag = this->getDbTag();
     
@@ -293,7 +293,7 @@ ElasticShearSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
     
-    static Vector data(9);
+    static thread_local Vector data(9);
 
     int dataTag = this->getDbTag();
 
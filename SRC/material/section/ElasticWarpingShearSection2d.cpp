@@ -71,8 +71,8 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticWarpingShearSection2d)
 
 }
 
-Vector ElasticWarpingShearSection2d::s(5);
-Matrix ElasticWarpingShearSection2d::ks(5,5);
+thread_local Vector ElasticWarpingShearSection2d::s(5);
+thread_local Matrix ElasticWarpingShearSection2d::ks(5,5);
 ID ElasticWarpingShearSection2d::code(5);
 
 ElasticWarpingShearSection2d::ElasticWarpingShearSection2d(void)
@@ -287,7 +287,7 @@ ElasticWarpingShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
   
   int dataTag = this->getDbTag();
   
@@ -321,7 +321,7 @@ ElasticWarpingShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(14);
+  static thread_local Vector data(14);
   
   int dataTag = this->getDbTag();
   
@@ -270,8 +270,8 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  static thread_local double kInitial[4];
+  static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
 
@@ -460,7 +460,7 @@ FiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3
@@ -516,7 +516,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  static thread_local ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -966,7 +966,7 @@ FiberSection2d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  static thread_local Vector dummy(2);
 
   return dummy;
 }
@@ -974,7 +974,7 @@ FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  static thread_local Vector ds(2);
   
   ds.Zero();
   
@@ -1032,7 +1032,7 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  static thread_local Matrix dksdh(2,2);
   
   dksdh.Zero();
 
@@ -1493,7 +1493,7 @@ FiberSection2dInt::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   int dbTag = this->getDbTag();
@@ -1548,7 +1548,7 @@ FiberSection2dInt::recvSelf(int commitTag, Channel &theChannel,
              FEM_ObjectBroker &theBroker)                        
 {
   int res = 0;
-  static ID data(3);
+  static thread_local ID data(3);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -2140,21 +2140,21 @@ FiberSection2dInt::getResponse(int responseID, Information &sectInfo)
 const Vector &
 FiberSection2dInt::getSectionDeformationSensitivity(int gradNumber)
 {
-    static Vector dummy(2);
+    static thread_local Vector dummy(2);
     return dummy;
 }
 
 const Vector &
 FiberSection2dInt::getStressResultantSensitivity(int gradNumber, bool conditional)
 {
-    static Vector dummy(2);    
+    static thread_local Vector dummy(2);    
     return dummy;
 }
 
 const Matrix &
 FiberSection2dInt::getSectionTangentSensitivity(int gradNumber)
 {
-    static Matrix something(2,2);
+    static thread_local Matrix something(2,2);
     something.Zero();
     return something;
 }
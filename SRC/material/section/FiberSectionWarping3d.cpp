@@ -465,8 +465,8 @@ FiberSectionWarping3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FiberSectionWarping3d::getInitialTangent()
 {
-  static double kInitialData[36];
-  static Matrix kInitial(kInitialData, 6, 6);
+  static thread_local double kInitialData[36];
+  static thread_local Matrix kInitial(kInitialData, 6, 6);
   for (int i=0; i<36; i++)
     kInitialData[i]=0.0;
 
@@ -737,7 +737,7 @@ FiberSectionWarping3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 5 so no conflict with matData below if just 1 fiber
-  static ID data(5);
+  static thread_local ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;  
@@ -799,7 +799,7 @@ FiberSectionWarping3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  static thread_local ID data(5);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1220,7 +1220,7 @@ FiberSectionWarping3d::setParameter(const char **argv, int argc, Parameter &para
 const Vector &
 FiberSectionWarping3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(3);
+  static thread_local Vector dummy(3);
   dummy.Zero();
   if (SHVs !=0) {
     dummy(0) = (*SHVs)(0,gradIndex);
@@ -1235,7 +1235,7 @@ const Vector &
 FiberSectionWarping3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
   
-  static Vector ds(3);
+  static thread_local Vector ds(3);
   
   ds.Zero();
   
@@ -1262,7 +1262,7 @@ FiberSectionWarping3d::getStressResultantSensitivity(int gradIndex, bool conditi
 const Matrix &
 FiberSectionWarping3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(2,2);
+  static thread_local Matrix something(2,2);
   
   something.Zero();
   
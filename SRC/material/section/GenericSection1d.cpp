@@ -39,9 +39,9 @@
 #include <string.h>
 #include <stdlib.h>
 
-Vector GenericSection1d::s(1);
-Matrix GenericSection1d::ks(1,1);
-ID GenericSection1d::c(1);
+thread_local Vector GenericSection1d::s(1);
+thread_local Matrix GenericSection1d::ks(1,1);
+thread_local ID GenericSection1d::c(1);
 
 GenericSection1d::GenericSection1d(int tag, UniaxialMaterial &m, int type)
 :SectionForceDeformation(tag,SEC_TAG_Generic1d), code(type)
@@ -75,7 +75,7 @@ GenericSection1d::setTrialSectionDeformation (const Vector& def)
 const Vector&
 GenericSection1d::getSectionDeformation ()
 {
-	static Vector e(1);	// static for class-wide returns
+	static thread_local Vector e(1);	// static for class-wide returns
 
 	e(0) = theModel->getStrain();
 
@@ -175,7 +175,7 @@ GenericSection1d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-	static ID data(4);
+	static thread_local ID data(4);
 
 	data(0) = this->getTag();
 	data(1) = code;
@@ -214,7 +214,7 @@ GenericSection1d::recvSelf(int cTag, Channel &theChannel,
 {
 	int res = 0;
 
-    static ID data(4);
+    static thread_local ID data(4);
 
     res += theChannel.recvID(this->getDbTag(), cTag, data);
 	if (res < 0) {
@@ -272,7 +272,7 @@ const Vector&
 GenericSection1d::getStressResultantSensitivity(int gradIndex,
 						bool conditional)
 {
-  static Vector dsdh(1);
+  static thread_local Vector dsdh(1);
 
   dsdh(0) = theModel->getStressSensitivity(gradIndex, conditional);
 
@@ -157,7 +157,7 @@ GenericSectionNd::sendSelf(int cTag, Channel &theChannel)
     if (otherDbTag == 0) 
       otherDbTag = theChannel.getDbTag();
 
-	static ID data(5);
+	static thread_local ID data(5);
 
 	data(0) = this->getTag();
 	data(1) = order;
@@ -207,7 +207,7 @@ GenericSectionNd::recvSelf(int cTag, Channel &theChannel,
 {
 	int res = 0;
 
-    static ID data(5);
+    static thread_local ID data(5);
 
 	// Receive the data ID
     res += theChannel.recvID(this->getDbTag(), cTag, data);
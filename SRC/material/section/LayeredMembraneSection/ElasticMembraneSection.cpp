@@ -65,7 +65,7 @@ void* OPS_ElasticMembraneSection()
 }
 
 //static vector and matrices
-ID ElasticMembraneSection::array(3);
+thread_local ID ElasticMembraneSection::array(3);
 
 // Full constructor
 ElasticMembraneSection::ElasticMembraneSection(int tag,		// section tag
@@ -223,7 +223,7 @@ SectionForceDeformation* ElasticMembraneSection::getCopy(void)
 
 const ID& ElasticMembraneSection::getType(void)
 {
-	static bool initialized = false;
+	static thread_local bool initialized = false;
 	if (!initialized) {
 		array(0) = SECTION_RESPONSE_FXX;
 		array(1) = SECTION_RESPONSE_FYY;
@@ -284,7 +284,7 @@ int ElasticMembraneSection::sendSelf(int commitTag, Channel& theChannel)
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static Vector data(5);
+	static thread_local Vector data(5);
 	data(0) = this->getTag();
 	data(1) = E;
 	data(2) = nu;
@@ -305,7 +305,7 @@ int ElasticMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static Vector data(5);
+	static thread_local Vector data(5);
 
 	res += theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
@@ -89,7 +89,7 @@ private:
 	Matrix TSectionTangent;															// Store the trial tangent of the membrane section
 	Matrix InitialTangent;															// Store the initial tangent of the membrane section
 
-	static ID array;
+	static thread_local ID array;
 };
 
 #endif // !ElasticMembraneSection_h
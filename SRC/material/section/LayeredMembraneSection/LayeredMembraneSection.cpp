@@ -129,7 +129,7 @@ void* OPS_ADD_RUNTIME_VPV(OPS_LayeredMembraneSection)
 }
 
 //static vector and matrices
-ID LayeredMembraneSection::array(3);
+thread_local ID LayeredMembraneSection::array(3);
 
 // Full constructor
 LayeredMembraneSection::LayeredMembraneSection(int tag,		                                    // section tag
@@ -348,7 +348,7 @@ SectionForceDeformation* LayeredMembraneSection::getCopy(void)
 
 const ID& LayeredMembraneSection::getType(void)
 {
-	static bool initialized = false;
+	static thread_local bool initialized = false;
 	if (!initialized) {
 		array(0) = SECTION_RESPONSE_FXX;
 		array(1) = SECTION_RESPONSE_FYY;
@@ -424,7 +424,7 @@ int LayeredMembraneSection::sendSelf(int commitTag, Channel& theChannel)
 	int dataTag = this->getDbTag();
 
 	//static ID iData(4);
-	static Vector iData(4);
+	static thread_local Vector iData(4);
 	iData(0) = this->getTag();
 	iData(1) = t_total;
 	iData(2) = numberLayers;
@@ -482,7 +482,7 @@ int LayeredMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 
 	int dataTag = this->getDbTag();
 
-	static Vector iData(4);
+	static thread_local Vector iData(4);
 	res += theChannel.recvVector(dataTag, commitTag, iData);
 
 	if (res < 0) {
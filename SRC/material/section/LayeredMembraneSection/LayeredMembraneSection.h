@@ -106,7 +106,7 @@ private:
 
 	double* t;																		// Store the layers thicknesses
 
-	static ID array;
+	static thread_local ID array;
 };
 
 #endif // !LayeredMembraneSection_h
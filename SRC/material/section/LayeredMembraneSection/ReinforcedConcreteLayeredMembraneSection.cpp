@@ -142,7 +142,7 @@ void* OPS_ADD_RUNTIME_VPV(OPS_ReinforcedConcreteLayeredMembraneSection)
 }
 
 //static vector and matrices
-ID ReinforcedConcreteLayeredMembraneSection::array(3);
+thread_local ID ReinforcedConcreteLayeredMembraneSection::array(3);
 
 // Full constructor
 ReinforcedConcreteLayeredMembraneSection::ReinforcedConcreteLayeredMembraneSection(int tag,							// section tag
@@ -489,7 +489,7 @@ SectionForceDeformation* ReinforcedConcreteLayeredMembraneSection::getCopy(void)
 
 const ID& ReinforcedConcreteLayeredMembraneSection::getType(void)
 {
-	static bool initialized = false;
+	static thread_local bool initialized = false;
 	if (!initialized) {
 		array(0) = SECTION_RESPONSE_FXX;
 		array(1) = SECTION_RESPONSE_FYY;
@@ -578,7 +578,7 @@ int ReinforcedConcreteLayeredMembraneSection::sendSelf(int commitTag, Channel& t
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	static thread_local ID iData(3);
 	iData(0) = this->getTag();
 	iData(1) = numberReinforcedSteelLayers;
 	iData(2) = numberConcreteLayers;
@@ -669,7 +669,7 @@ int ReinforcedConcreteLayeredMembraneSection::recvSelf(int commitTag, Channel& t
 
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	static thread_local ID iData(3);
 	res += theChannel.recvID(dataTag, commitTag, iData);
 
 	if (res < 0) {
@@ -128,7 +128,7 @@ private:
 
 	const double pi;
 
-	static ID array;
+	static thread_local ID array;
 };
 
 #endif // !ReinforcedConcreteLayeredMembraneSection_h
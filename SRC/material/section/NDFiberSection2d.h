@@ -108,7 +108,7 @@ class NDFiberSection2d : public FrameSection
     Vector *s;         // section resisting forces  (axial force, bending moment)
     Matrix *ks;        // section stiffness
 
-    static Matrix fs;
+    static thread_local Matrix fs;
 
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -300,7 +300,7 @@ NDFiberSectionWarping2d::setTrialSectionDeformation(const Vector &deforms)
         }
     }
 
-    static Vector eps(2);
+    static thread_local Vector eps(2);
 
     // h ~ parameter equals Height/2 for symmetric cases
     double maxLoc(fiberLocs[1] - yBarZero), minLoc(fiberLocs[1] - yBarZero); 
@@ -436,8 +436,8 @@ NDFiberSectionWarping2d::getRho(void)
 const Matrix&
 NDFiberSectionWarping2d::getInitialTangent(void)
 {
-    static double kInitial[25];
-    static Matrix kInitialMatrix(kInitial, 5, 5);
+    static thread_local double kInitial[25];
+    static thread_local Matrix kInitialMatrix(kInitial, 5, 5);
     kInitial[0] = 0.0; 
     kInitial[1] = 0.0;
     kInitial[2] = 0.0;
@@ -977,7 +977,7 @@ NDFiberSectionWarping2d::sendSelf(int commitTag, Channel &theChannel)
 
     // create an id to send objects tag and numFibers, 
     //     size 3 so no conflict with matData below if just 1 fiber
-    static ID data(3);
+    static thread_local ID data(3);
     data(0) = this->getTag();
     data(1) = numFibers;
     int dbTag = this->getDbTag();
@@ -1032,7 +1032,7 @@ NDFiberSectionWarping2d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
 
-    static ID data(3);
+    static thread_local ID data(3);
 
     int dbTag = this->getDbTag();
     res += theChannel.recvID(dbTag, commitTag, data);
@@ -1330,15 +1330,15 @@ NDFiberSectionWarping2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSectionWarping2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-    static Vector ds(5);
+    static thread_local Vector ds(5);
 
     ds.Zero();
 
     double y, A;
-    static Vector stress(2);
-    static Vector dsigdh(2);
-    static Vector sig_dAdh(2);
-    static Matrix tangent(2,2);
+    static thread_local Vector stress(2);
+    static thread_local Vector dsigdh(2);
+    static thread_local Vector sig_dAdh(2);
+    static thread_local Matrix tangent(2,2);
 
     static double fiberLocs[10000];
     static double fiberArea[10000];
@@ -1421,7 +1421,7 @@ NDFiberSectionWarping2d::getStressResultantSensitivity(int gradIndex, bool condi
 const Matrix &
 NDFiberSectionWarping2d::getInitialTangentSensitivity(int gradIndex)
 {
-    static Matrix dksdh(5,5);
+    static thread_local Matrix dksdh(5,5);
 
     dksdh.Zero();
     /*
@@ -1511,7 +1511,7 @@ NDFiberSectionWarping2d::commitSensitivity(const Vector& defSens,
     double phi      = e(3);
     double phiprime = e(4);
 
-    static Vector depsdh(2);
+    static thread_local Vector depsdh(2);
 
     double rootAlpha = 1.0;
     if (alpha != 1.0)
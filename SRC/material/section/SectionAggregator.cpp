@@ -765,7 +765,7 @@ SectionAggregator::sendSelf(int cTag, Channel &theChannel)
     otherDbTag = theChannel.getDbTag();
   
   // Create ID for tag and section order data
-  static ID data(5);
+  static thread_local ID data(5);
   
   int order = this->getOrder();
   
@@ -863,7 +863,7 @@ SectionAggregator::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
   int res = 0;
 
   // Create an ID and receive tag and section order
-  static ID data(5);
+  static thread_local ID data(5);
   res += theChannel.recvID(this->getDbTag(), cTag, data);
   if (res < 0) {
     opserr << "SectionAggregator::recvSelf -- could not receive data ID\n";
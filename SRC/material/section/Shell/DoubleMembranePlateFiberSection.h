@@ -125,11 +125,11 @@ class DoubleMembranePlateFiberSection : public SectionForceDeformation{
 
     Vector strainResultant ;
 
-    static Vector stressResultant ;
+    static thread_local Vector stressResultant ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
-    static ID array ;  
+    static thread_local ID array ;  
 
 } ; //end of DoubleMembranePlateFiberSection declarations
 
@@ -18,9 +18,9 @@
 
 const double ElasticMembranePlateSection::five6 = 5.0/6.0 ; // shear correction
 
-Vector  ElasticMembranePlateSection::stress(8) ;
-Matrix  ElasticMembranePlateSection::tangent(8,8) ;
-ID      ElasticMembranePlateSection::array(8) ;
+thread_local Vector  ElasticMembranePlateSection::stress(8) ;
+thread_local Matrix  ElasticMembranePlateSection::tangent(8,8) ;
+thread_local ID      ElasticMembranePlateSection::array(8) ;
 
 
 ElasticMembranePlateSection::ElasticMembranePlateSection( ) : 
@@ -87,7 +87,7 @@ ElasticMembranePlateSection::getOrder() const
 //send back order of strain in vector form
 const ID& ElasticMembranePlateSection::getType()
 {
-    static bool initialized = false;
+    static thread_local bool initialized = false;
     if (!initialized) {
         array(0) = SECTION_RESPONSE_FXX;
         array(1) = SECTION_RESPONSE_FYY;
@@ -308,7 +308,7 @@ int
 ElasticMembranePlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = Em;
   data(2) = nu;
@@ -329,7 +329,7 @@ ElasticMembranePlateSection::recvSelf(int cTag, Channel &theChannel,
 				      FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticMembranePlateSection::recvSelf() - failed to recv data\n";
@@ -68,9 +68,9 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticPlateSection)
 const double ElasticPlateSection::five6 = 5.0/6.0 ; //shear correction
 
 //static vector and matrices
-Vector ElasticPlateSection::stress(5) ;
-Matrix ElasticPlateSection::tangent(5,5) ;
-ID     ElasticPlateSection::array(5) ;
+thread_local Vector ElasticPlateSection::stress(5) ;
+thread_local Matrix ElasticPlateSection::tangent(5,5) ;
+thread_local ID     ElasticPlateSection::array(5) ;
 
 
 //null constructor
@@ -126,7 +126,7 @@ int ElasticPlateSection::getOrder( ) const
 //send back order of strain in vector form
 const ID& ElasticPlateSection::getType( ) 
 {
-    static bool initialized = false;
+    static thread_local bool initialized = false;
     if (!initialized) {
         array(0) = SECTION_RESPONSE_MXX;
         array(1) = SECTION_RESPONSE_MYY;
@@ -283,7 +283,7 @@ int
 ElasticPlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(4);
+  static thread_local Vector data(4);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = nu;
@@ -301,7 +301,7 @@ int
 ElasticPlateSection::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(4);
+  static thread_local Vector data(4);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticPlateSection::recvSelf() - failed to recv data\n";
@@ -103,11 +103,11 @@ class ElasticPlateSection : public SectionForceDeformation {
 
     Vector strain ;
 
-    static Vector stress ;
+    static thread_local Vector stress ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
-    static ID array ;  
+    static thread_local ID array ;  
 
 };
 
@@ -121,11 +121,11 @@ class LayeredShellFiberSection : public SectionForceDeformation{
 
     Vector strainResultant ;
 
-    static Vector stressResultant ;
+    static thread_local Vector stressResultant ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
-    static ID array ;  
+    static thread_local ID array ;  
 
 } ; //end of LayeredShellFiberSection declarations
 
@@ -127,12 +127,12 @@ class LayeredShellFiberSectionThermal : public SectionForceDeformation{
 
     Vector strainResultant ;
 
-    static Vector stressResultant ;
+    static thread_local Vector stressResultant ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 	static const double root56 ; // =sqrt(5/6) 
 
-    static ID array ;  
+    static thread_local ID array ;  
 
 	Vector  *sT;  //  Pointer to sTData
 	double  *ThermalElongation; // thermal elongation
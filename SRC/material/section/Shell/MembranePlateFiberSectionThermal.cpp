@@ -43,9 +43,9 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 const double MembranePlateFiberSectionThermal::root56 = sqrt(5.0/6.0) ; //shear correction
 
 //static vector and matrices
-Vector  MembranePlateFiberSectionThermal::stressResultant(8) ;
-Matrix  MembranePlateFiberSectionThermal::tangent(8,8) ;
-ID      MembranePlateFiberSectionThermal::array(8) ;
+thread_local Vector  MembranePlateFiberSectionThermal::stressResultant(8) ;
+thread_local Matrix  MembranePlateFiberSectionThermal::tangent(8,8) ;
+thread_local ID      MembranePlateFiberSectionThermal::array(8) ;
 
 
 const double  MembranePlateFiberSectionThermal::sg[] = { -1, 
@@ -150,7 +150,7 @@ int MembranePlateFiberSectionThermal::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& MembranePlateFiberSectionThermal::getType( ) 
 {
-    static bool initialized = false;
+    static thread_local bool initialized = false;
     if (!initialized) {
         array(0) = SECTION_RESPONSE_FXX;
         array(1) = SECTION_RESPONSE_FYY;
@@ -244,7 +244,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
   seestrain[6] = strainResultant(6);
   seestrain[7] = strainResultant(7);
 
-  static Vector strain(5) ;
+  static thread_local Vector strain(5) ;
 
   int success = 0 ;
 
@@ -300,7 +300,7 @@ const Vector& MembranePlateFiberSectionThermal::getSectionDeformation( )
 const Vector&  MembranePlateFiberSectionThermal::getStressResultant( )
 {
 
-  static Vector stress(5) ;
+  static thread_local Vector stress(5) ;
 
   int i ;
 
@@ -441,11 +441,11 @@ MembranePlateFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
 //send back the tangent 
 const Matrix&  MembranePlateFiberSectionThermal::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  static thread_local Matrix dd(5,5) ;
 
-  static Matrix Aeps(5,8) ;
+  static thread_local Matrix Aeps(5,8) ;
 
-  static Matrix Asig(8,5) ;
+  static thread_local Matrix Asig(8,5) ;
 
   int i ;
 
@@ -633,7 +633,7 @@ MembranePlateFiberSectionThermal::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(11);
+  static thread_local ID idData(11);
   
   int i;
   for (i = 0; i < 5; i++) {
@@ -678,7 +678,7 @@ MembranePlateFiberSectionThermal::recvSelf(int commitTag, Channel &theChannel, F
   
   int dataTag = this->getDbTag();
 
-  static ID idData(11);
+  static thread_local ID idData(11);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -122,11 +122,11 @@ class MembranePlateFiberSectionThermal : public SectionForceDeformation{
 
     Vector strainResultant ;
 
-    static Vector stressResultant ;
+    static thread_local Vector stressResultant ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
-    static ID array ; 
+    static thread_local ID array ; 
 
 	double   sTData[2];   //Data for section resisting force due to thermal load 
 	Vector  *sT;  //  Pointer to sTData
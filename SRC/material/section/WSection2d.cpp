@@ -42,8 +42,8 @@
 #include <NDMaterial.h>
 
 ID WSection2d::code(6);
-Vector WSection2d::s(6);
-Matrix WSection2d::ks(6,6);
+thread_local Vector WSection2d::s(6);
+thread_local Matrix WSection2d::ks(6,6);
 
 // constructors:
 WSection2d::WSection2d(int tag, NDMaterial &theMat,
@@ -145,7 +145,7 @@ int WSection2d::setTrialSectionDeformation (const Vector &deforms)
   
   e = deforms; 
   // Material strain vector
-  static Vector eps(3);
+  static thread_local Vector eps(3);
 
   double root56 = sqrt(shapeFactor);
 
@@ -88,8 +88,8 @@ class WSection2d : public SectionForceDeformation
 
   static ID code;
   
-  static Vector s;  // section resisting forces
-  static Matrix ks; // section stiffness
+  static thread_local Vector s;  // section resisting forces
+  static thread_local Matrix ks; // section stiffness
 };
 
 #endif
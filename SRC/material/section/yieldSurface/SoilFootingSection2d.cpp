@@ -2017,7 +2017,7 @@ SoilFootingSection2d::getSectionTangent(void)
 const Matrix &
 SoilFootingSection2d::getSectionFlexibility (void)
 {
-  static Matrix fs(3,3);
+  static thread_local Matrix fs(3,3);
 //  invert2by2Matrix(ks, fs);
   ks.Invert(fs); 
   return fs;
@@ -2039,7 +2039,7 @@ SoilFootingSection2d::getOrder () const
 const Matrix& 
 SoilFootingSection2d::getInitialTangent()
 {
-  static Matrix IniTan(3,3);
+  static thread_local Matrix IniTan(3,3);
                  
   return IniTan;
 }
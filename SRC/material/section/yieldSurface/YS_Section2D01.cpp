@@ -62,6 +62,7 @@ SectionForceDeformation* YS_Section2D01::getCopy ()
     new YS_Section2D01 (this->getTag(), E, A, I, ys, use_Kr_orig);
     theCopy->eCommit = eCommit;
     theCopy->sCommit = sCommit;
+    theCopy->closest_return = closest_return;
 
     return theCopy;
 }
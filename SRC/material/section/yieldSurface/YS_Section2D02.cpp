@@ -93,6 +93,7 @@ SectionForceDeformation* YS_Section2D02::getCopy ()
     new YS_Section2D02 (this->getTag(), E, A, I, maxPlstkRot, ys, use_Kr_orig);
     theCopy->eCommit = eCommit;
     theCopy->sCommit = sCommit;
+    theCopy->closest_return = closest_return;
     theCopy->peakPlstkRot =  peakPlstkRot;
 
     return theCopy;
@@ -14,15 +14,15 @@
 #include <classTags.h>
 
 ID      YieldSurfaceSection2d::code(2);
-Vector  YieldSurfaceSection2d::dele(2);
-Vector  YieldSurfaceSection2d::surfaceForce(2);
-Matrix  YieldSurfaceSection2d::G(2,1);
-Matrix  YieldSurfaceSection2d::Ktp(2,2);
+thread_local Vector  YieldSurfaceSection2d::dele(2);
+thread_local Vector  YieldSurfaceSection2d::surfaceForce(2);
+thread_local Matrix  YieldSurfaceSection2d::G(2,1);
+thread_local Matrix  YieldSurfaceSection2d::Ktp(2,2);
 
 YieldSurfaceSection2d::YieldSurfaceSection2d(void)
   :SectionForceDeformation(0, SEC_TAG_YieldSurface2d),
    use_Kr_orig(true), ys(0), e(2), s(2),
-   eCommit(2), sCommit(2), ks(2,2),
+   eCommit(2), sCommit(2), ks(2,2), closest_return(false),
    use_Kr(true), split_step(false)
 {
   code(0) = SECTION_RESPONSE_P;	// P is the first quantity
@@ -33,7 +33,7 @@ YieldSurfaceSection2d::YieldSurfaceSection2d
 (int tag, int classtag, YieldSurface_BC *ptrys, bool use_kr)
   :SectionForceDeformation(tag, classtag),
    use_Kr_orig(use_kr), ys(0), e(2), s(2),
-   eCommit(2), sCommit(2), ks(2,2),
+   eCommit(2), sCommit(2), ks(2,2), closest_return(false),
    use_Kr(use_kr), split_step(false)
 {
   code(0) = SECTION_RESPONSE_P;	// P is the first quantity
@@ -182,7 +182,15 @@ YieldSurfaceSection2d::setTrialSectionDeformation (const Vector &def)
 	s = surfaceForce + ks*dele;
     }
   
-  ys->setToSurface(s, ys->ConstantYReturn);
+  // optionally return to the closest point in the energy norm of the
+  // section stiffness; fall back on constantP where the Newton iterations
+  // fail (kinks of the surface)
+  double k_data[2] = {EA, EI};
+  Vector k(k_data, 2);
+  if(!closest_return)
+    ys->setToSurface(s, ys->ConstantYReturn);
+  else if(ys->getTrialForceLocation(s) != 0 && ys->closestPointReturn(s, k) < 0)
+    ys->setToSurface(s, ys->ConstantYReturn);
   // used to do centroid return
   // then force-balance using ConstantYReturn
   // comp/tension issue: always use constantP
@@ -211,7 +219,7 @@ YieldSurfaceSection2d::getSectionTangent(void)
 const Matrix &
 YieldSurfaceSection2d::getSectionFlexibility (void)
 {
-  static Matrix fs(2,2);
+  static thread_local Matrix fs(2,2);
   // invert2by2Matrix(ks, fs);
   ks.Invert(fs); 
   return fs;
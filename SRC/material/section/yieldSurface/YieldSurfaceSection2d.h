@@ -43,6 +43,10 @@ class YieldSurfaceSection2d: public SectionForceDeformation
   virtual void Print (OPS_Stream &s, int flag =0);
   
   virtual SectionForceDeformation *getCopy (void)=0;
+
+  // return trial forces to the closest point of the surface instead of
+  // at constant P (the default)
+  void setClosestPointReturn (bool flag) {closest_return = flag;}
   
  protected:
   virtual void getSectionStiffness(Matrix &Ks)=0;
@@ -53,16 +57,17 @@ class YieldSurfaceSection2d: public SectionForceDeformation
   Vector eCommit;
   Vector sCommit;
   Matrix ks;
+  bool closest_return;
   
  private:
   //    int algo;
   bool use_Kr, split_step;
   
   static ID code;
-  static Vector dele;
-  static Vector surfaceForce;
-  static Matrix G;
-  static Matrix Ktp;
+  static thread_local Vector dele;
+  static thread_local Vector surfaceForce;
+  static thread_local Matrix G;
+  static thread_local Matrix Ktp;
 };
 
 #endif
@@ -492,7 +492,7 @@ APDFMD::revertToStart(void)
 int
 APDFMD::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(20);
+  static thread_local Vector data(20);
   data(0) = Fy1;
   data(1) = E1;
   data(2) = Fy2;
@@ -525,7 +525,7 @@ int
 APDFMD::recvSelf(int commitTag, Channel &theChannel,
              FEM_ObjectBroker &theBroker)
 {
-  static Vector data(20);
+  static thread_local Vector data(20);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "APDFMD::recvSelf() - failed to recvSelf\n";
@@ -10,7 +10,7 @@
 void *
 OPS_ADD_RUNTIME_VPV(OPS_APDMD)
 {
-    static int numAPDMD = 0;
+    static thread_local int numAPDMD = 0;
     if (numAPDMD == 0) {
         opserr << "APDMD unaxial material - Written by BUCEA 2024; \n";
         numAPDMD++;
@@ -473,7 +473,7 @@ APDMD::revertToStart(void)
 int
 APDMD::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(20);
+  static thread_local Vector data(20);
   data(0) = Fy1;
   data(1) = E1;
   data(2) = Fy2;
@@ -506,7 +506,7 @@ int
 APDMD::recvSelf(int commitTag, Channel &theChannel,
              FEM_ObjectBroker &theBroker)
 {
-  static Vector data(20);
+  static thread_local Vector data(20);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "APDMD::recvSelf() - failed to recvSelf\n";
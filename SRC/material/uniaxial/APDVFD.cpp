@@ -38,7 +38,7 @@
 void *
 OPS_ADD_RUNTIME_VPV(OPS_APDVFD)
 {
-  static int numAPDVFD = 0;
+  static thread_local int numAPDVFD = 0;
   if (numAPDVFD == 0) {
     numAPDVFD++;
     opserr << "APDVFD Model by BUCEA\n";
@@ -531,7 +531,7 @@ int
 APDVFD::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(28);
+  static thread_local Vector data(28);
   data(0) = this->getTag();
 
   // Material properties
@@ -578,7 +578,7 @@ APDVFD::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(28);
+  static thread_local Vector data(28);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -161,7 +161,7 @@ namespace {
 void* OPS_ADD_RUNTIME_VPV(OPS_ASDConcrete1DMaterial)
 {
 	// some kudos
-	static bool first_done = false;
+	static thread_local bool first_done = false;
 	if (!first_done) {
 		opserr << "Using ASDConcrete1D - Developed by: Massimo Petracca, Guido Camata, ASDEA Software Technology\n";
 		first_done = true;
@@ -1200,7 +1200,7 @@ int ASDConcrete1DMaterial::sendSelf(int commitTag, Channel &theChannel)
 		hc.serializationDataSize();
 
 	// send INT data
-	static ID idata(9);
+	static thread_local ID idata(9);
 	counter = 0;
 	idata(counter++) = getTag();
 	idata(counter++) = static_cast<int>(implex);
@@ -1264,7 +1264,7 @@ int ASDConcrete1DMaterial::recvSelf(int commitTag, Channel& theChannel, FEM_Obje
 	int counter;
 
 	// recv INT data
-	static ID idata(9);
+	static thread_local ID idata(9);
 	if (theChannel.recvID(getDbTag(), commitTag, idata) < 0) {
 		opserr << "ASDConcrete1DMaterial::recvSelf() - failed to receive INT data\n";
 		return -1;
@@ -1419,7 +1419,7 @@ Response* ASDConcrete1DMaterial::setResponse(const char** argv, int argc, OPS_St
 	static std::vector<std::string> lb_time = { "dTime", "dTimeCommit", "dTimeInitial" };
 	static std::vector<std::string> lb_crack_strain = { "CS+", "LchRef" };
 	static std::vector<std::string> lb_crush_strain = { "CS-", "LchRef" };
-	static Vector Cinfo(2);
+	static thread_local Vector Cinfo(2);
 
 	// check specific responses
 	if (argc > 0) {
@@ -1640,7 +1640,7 @@ Vector ASDConcrete1DMaterial::getHardeningLawVector(HardeningLawType ltype, Hard
 
 const Vector& ASDConcrete1DMaterial::getStrainMeasure() const
 {
-	static Vector d(2);
+	static thread_local Vector d(2);
 	d(0) = xt;
 	d(1) = xc;
 	return d;
@@ -1648,7 +1648,7 @@ const Vector& ASDConcrete1DMaterial::getStrainMeasure() const
 
 const Vector& ASDConcrete1DMaterial::getDamage() const
 {
-	static Vector d(2);
+	static thread_local Vector d(2);
 	const Vector& x = getStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).crackingDamage();
 	d(1) = hc.evaluateAt(x(1)).crackingDamage();
@@ -1657,7 +1657,7 @@ const Vector& ASDConcrete1DMaterial::getDamage() const
 
 const Vector& ASDConcrete1DMaterial::getEquivalentPlasticStrain() const
 {
-	static Vector d(2);
+	static thread_local Vector d(2);
 	const Vector& x = getStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).plasticStrain(E);
 	d(1) = hc.evaluateAt(x(1)).plasticStrain(E);
@@ -1666,7 +1666,7 @@ const Vector& ASDConcrete1DMaterial::getEquivalentPlasticStrain() const
 
 const Vector& ASDConcrete1DMaterial::getCrackWidth() const
 {
-	static Vector d(1);
+	static thread_local Vector d(1);
 	d.Zero();
 	if (ht.hasStrainSoftening()) {
 		double e0 = ht.strainAtOnsetOfCrack();
@@ -1678,7 +1678,7 @@ const Vector& ASDConcrete1DMaterial::getCrackWidth() const
 
 const Vector& ASDConcrete1DMaterial::getCrushWidth() const
 {
-	static Vector d(1);
+	static thread_local Vector d(1);
 	d.Zero();
 	if (hc.hasStrainSoftening()) {
 		double e0 = hc.strainAtOnsetOfCrack();
@@ -1690,14 +1690,14 @@ const Vector& ASDConcrete1DMaterial::getCrushWidth() const
 
 const Vector& ASDConcrete1DMaterial::getImplexError() const
 {
-	static Vector d(1);
+	static thread_local Vector d(1);
 	d(0) = implex_error;
 	return d;
 }
 
 const Vector& ASDConcrete1DMaterial::getTimeIncrements() const
 {
-	static Vector d(3);
+	static thread_local Vector d(3);
 	d(0) = dtime_n;
 	d(1) = dtime_n_commit;
 	d(2) = dtime_0;
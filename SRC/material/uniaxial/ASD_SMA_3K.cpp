@@ -512,7 +512,7 @@ ASD_SMA_3K::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(25);
+  static thread_local Vector data(25);
   
   data(0) = this->getTag();
   data(1) = k1;
@@ -553,7 +553,7 @@ ASD_SMA_3K::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(25);
+  static thread_local Vector data(25);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
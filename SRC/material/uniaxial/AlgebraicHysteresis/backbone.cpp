@@ -28,6 +28,7 @@ extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
 #include <ReeseSandBackbone.h>
 #include <ManderBackbone.h>
 #include <RaynorBackbone.h>
+#include <TabulatedBackbone.h>
 #include <string.h>
 
 extern OPS_Routine OPS_ArctangentBackbone;
@@ -407,10 +408,80 @@ TclCommand_addHystereticBackbone(ClientData clientData,
     theBackbone = 0;
   }
 
+  else if (strcmp(argv[1], "Tabulated") == 0) {
+    if (argc < 6) {
+      opserr << "WARNING insufficient arguments\n";
+      opserr << "Want: hystereticBackbone Tabulated tag? backboneTag? eMin? eMax? "
+                "<-tolerance tol?> <-intervals n?>"
+             << endln;
+      return TCL_ERROR;
+    }
+
+    int tag, bTag;
+    double eMin, eMax;
+    double tol = 1.0e-6;
+    int numIntervals = 64;
+
+    if (Tcl_GetInt(interp, argv[2], &tag) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated tag" << endln;
+      return TCL_ERROR;
+    }
+
+    if (Tcl_GetInt(interp, argv[3], &bTag) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated backboneTag"
+             << endln;
+      return TCL_ERROR;
+    }
+
+    if (Tcl_GetDouble(interp, argv[4], &eMin) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated eMin" << endln;
+      return TCL_ERROR;
+    }
+
+    if (Tcl_GetDouble(interp, argv[5], &eMax) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated eMax" << endln;
+      return TCL_ERROR;
+    }
+
+    for (int i = 6; i < argc; i++) {
+      if (strcmp(argv[i], "-tolerance") == 0 && i+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK || tol <= 0.0) {
+          opserr << "WARNING invalid hystereticBackbone Tabulated tolerance" << endln;
+          return TCL_ERROR;
+        }
+      }
+      else if (strcmp(argv[i], "-intervals") == 0 && i+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &numIntervals) != TCL_OK || numIntervals < 1) {
+          opserr << "WARNING invalid hystereticBackbone Tabulated intervals" << endln;
+          return TCL_ERROR;
+        }
+      }
+      else {
+        opserr << "WARNING unknown hystereticBackbone Tabulated option " << argv[i] << endln;
+        return TCL_ERROR;
+      }
+    }
+
+    if (eMax == eMin) {
+      opserr << "WARNING hystereticBackbone Tabulated requires eMax != eMin" << endln;
+      return TCL_ERROR;
+    }
+
+    HystereticBackbone *backbone = builder->getTypedObject<HystereticBackbone>(bTag);
+    if (backbone == nullptr) {
+      opserr << "WARNING hystereticBackbone does not exist\n";
+      opserr << "hystereticBackbone: " << bTag;
+      opserr << "\nhystereticBackbone Tabulated: " << tag << endln;
+      return TCL_ERROR;
+    }
+
+    theBackbone = new TabulatedBackbone(tag, *backbone, eMin, eMax, tol, numIntervals);
+  }
+
   else {
     opserr << "WARNING unknown type of hystereticBackbone: " << argv[1];
     opserr << "\nValid types: Bilinear, Trilinear, Arctangent," << endln;
-    opserr << "\tCapped, LinearCapped, Material" << endln;
+    opserr << "\tCapped, LinearCapped, Material, Tabulated" << endln;
     return TCL_ERROR;
   }
 
@@ -32,9 +32,12 @@
 #include <MultilinearBackbone.h>
 #include <Vector.h>
 #include <Channel.h>
+#include <ID.h>
 
 #include <elementAPI.h>
 
+#include <algorithm>
+
 void *
 OPS_MultilinearBackbone(void)
 {
@@ -150,13 +153,19 @@ MultilinearBackbone::~MultilinearBackbone()
     delete [] c;
 }
 
+int
+MultilinearBackbone::findSegment (double strain) const
+{
+  // First point with e[i] > strain; e[1..numPoints] is sorted
+  return std::upper_bound(e+1, e+numPoints+1, strain) - e;
+}
+
 double
 MultilinearBackbone::getTangent (double strain)
 {
-  for (int i = 1; i <= numPoints; ++i) {
-    if (strain < e[i])
-      return E[i-1];
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return E[i-1];
   
   return E[0]*1.0e-9;
 }
@@ -164,10 +173,9 @@ MultilinearBackbone::getTangent (double strain)
 double
 MultilinearBackbone::getStress (double strain)
 {
-  for (int i = 1; i <= numPoints; ++i) {
-    if (strain < e[i])
-      return s[i-1] + E[i-1]*(strain-e[i-1]);
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return s[i-1] + E[i-1]*(strain-e[i-1]);
   
   return s[numPoints];
 }
@@ -175,10 +183,9 @@ MultilinearBackbone::getStress (double strain)
 double
 MultilinearBackbone::getEnergy (double strain)
 {
-  for (int i = 1; i <= numPoints; ++i) {
-    if (strain < e[i])
-      return c[i-1] + 0.5*E[i-1]*(strain-e[i-1])*(strain-e[i-1]);
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return c[i-1] + 0.5*E[i-1]*(strain-e[i-1])*(strain-e[i-1]);
   
   return c[numPoints] + s[numPoints]*(strain-e[numPoints]);
 }
@@ -236,12 +243,79 @@ MultilinearBackbone::getVariable (int varID, double &theValue)
 int
 MultilinearBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
-  return -1;
+  int dbTag = this->getDbTag();
+  
+  ID idata(2);
+  idata(0) = this->getTag();
+  idata(1) = numPoints;
+
+  if (theChannel.sendID(dbTag, commitTag, idata) < 0) {
+    opserr << "MultilinearBackbone::sendSelf - failed to send ID data" << endln;
+    return -1;
+  }
+
+  Vector data(4*numPoints + 3);
+  for (int i = 0; i < numPoints; i++) {
+    data(i) = e[i];
+    data(numPoints+1 + i) = s[i];
+    data(2*(numPoints+1) + i) = c[i];
+    data(3*(numPoints+1) + i) = E[i];
+  }
+  data(numPoints) = e[numPoints];
+  data(2*numPoints+1) = s[numPoints];
+  data(3*numPoints+2) = c[numPoints];
+
+  if (theChannel.sendVector(dbTag, commitTag, data) < 0) {
+    opserr << "MultilinearBackbone::sendSelf - failed to send data" << endln;
+    return -2;
+  }
+  
+  return 0;
 }
 
 int
 MultilinearBackbone::recvSelf(int commitTag, Channel &theChannel, 
 			      FEM_ObjectBroker &theBroker)
 {
-  return -1;
+  int dbTag = this->getDbTag();
+  
+  ID idata(2);
+
+  if (theChannel.recvID(dbTag, commitTag, idata) < 0) {
+    opserr << "MultilinearBackbone::recvSelf -- could not receive ID data" << endln;
+    return -1;
+  }
+
+  this->setTag(idata(0));
+  numPoints = idata(1);
+
+  Vector data(4*numPoints + 3);
+  if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
+    opserr << "MultilinearBackbone::recvSelf -- could not receive data" << endln;
+    return -2;
+  }  
+  
+  if (numPoints > 0) {
+    if (e != 0) delete [] e;
+    if (s != 0) delete [] s;
+    if (c != 0) delete [] c;
+    if (E != 0) delete [] E;
+
+    e = new double[numPoints+1];
+    s = new double[numPoints+1];
+    c = new double[numPoints+1];
+    E = new double[numPoints];    
+    
+    for (int i = 0; i < numPoints; i++) {
+      e[i] = data(i);
+      s[i] = data(numPoints+1 + i);
+      c[i] = data(2*(numPoints+1) + i);
+      E[i] = data(3*(numPoints+1) + i);
+    }
+    e[numPoints] = data(numPoints);
+    s[numPoints] = data(2*numPoints+1);
+    c[numPoints] = data(3*numPoints+2);
+  }
+
+  return 0;
 }
@@ -326,7 +326,7 @@ ManderBackbone::sendSelf(int commitTag, Channel &theChannel)
 
   
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   
 
@@ -370,7 +370,7 @@ ManderBackbone::recvSelf(int commitTag, Channel &theChannel,
 
   
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   
 
@@ -151,7 +151,7 @@ RaynorBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(8);
+  static thread_local Vector data(8);
   
   data(0) = this->getTag();
   data(1) = Es;
@@ -178,7 +178,7 @@ RaynorBackbone::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(8);
+  static thread_local Vector data(8);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -156,7 +156,7 @@ ReeseSandBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   data(0) = this->getTag();
   data(1) = kx;
@@ -181,7 +181,7 @@ ReeseSandBackbone::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
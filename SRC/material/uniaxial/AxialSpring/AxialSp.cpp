@@ -567,7 +567,7 @@ AxialSp::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
 
   data(0)  = this->getTag();
   data(1)  = sce;
@@ -599,7 +599,7 @@ AxialSp::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
   if ( res < 0 ) {
@@ -178,7 +178,7 @@ BackboneMaterial::sendSelf(int cTag, Channel &theChannel)
   /*
   int res = 0;
 
-  static ID classTags(3);
+  static thread_local ID classTags(3);
 
   int clTag = theBackbone->getClassTag();
   int dbTag = theBackbone->getDbTag();
@@ -219,7 +219,7 @@ BackboneMaterial::recvSelf(int cTag, Channel &theChannel,
   /*
   int res = 0;
   
-  static ID classTags(3);
+  static thread_local ID classTags(3);
 
   int dbTag = this->getDbTag();
 
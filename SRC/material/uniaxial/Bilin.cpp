@@ -1547,7 +1547,7 @@ Bilin::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(166);      // Updated: Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(166);      // Updated: Filipe Ribeiro and Andre Barbosa
    data(0) = this->getTag();
    data(1)=Ke0;         // Updated: Filipe Ribeiro and Andre Barbosa
    data(2)=AsPos;
@@ -1732,7 +1732,7 @@ Bilin::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(166);  // Updated: Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(166);  // Updated: Filipe Ribeiro and Andre Barbosa
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
  
   if (res < 0) {
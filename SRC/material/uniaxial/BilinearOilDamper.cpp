@@ -493,7 +493,7 @@ int
 BilinearOilDamper::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(16);
+  static thread_local Vector data(16);
   data(0) = this->getTag();
 
   // Material properties
@@ -527,7 +527,7 @@ BilinearOilDamper::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(16);
+  static thread_local Vector data(16);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -313,7 +313,7 @@ int
 BoucWenMaterial::sendSelf(int cTag, Channel &theChannel)
 {
     // SAJalali
-    static Vector data(21);
+    static thread_local Vector data(21);
     data(0) = alpha;
     data(1) = ko;
     data(2) = n;
@@ -348,7 +348,7 @@ int
 BoucWenMaterial::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     // SAJalali
-    static Vector data(21);
+    static thread_local Vector data(21);
 
     if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
         opserr << "BoucWenMaterial::recvSelf() - failed to recvSelf\n";
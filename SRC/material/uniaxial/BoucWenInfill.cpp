@@ -407,7 +407,7 @@ int
 BoucWenInfill::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(1+15+4);
+  static thread_local Vector data(1+15+4);
   data(0) = this->getTag();
   
   data(1) = mass;
@@ -442,7 +442,7 @@ int
 BoucWenInfill::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(20);
+  static thread_local Vector data(20);
   
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -275,7 +275,7 @@ int BoucWenOriginal::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
     
-    static Vector data(13);
+    static thread_local Vector data(13);
     data(0) = this->getTag();
     data(1) = Ei;
     data(2) = fy;
@@ -303,7 +303,7 @@ int BoucWenOriginal::sendSelf(int cTag, Channel &theChannel)
 int BoucWenOriginal::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(11);
+    static thread_local Vector data(11);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
     
     if (res < 0) {
@@ -596,7 +596,7 @@ BraceMaterial::recvSelf(int commitTag, Channel &theChannel,
 			FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(31);
+  static thread_local Vector data(31);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "BraceMaterial::recvSelf() - failed to receive data\n";
@@ -44,7 +44,7 @@
 
 void * OPS_ADD_RUNTIME_VPV(OPS_CFSSSWP)
 {
-  static int numCFSSSWP = 0;
+  static thread_local int numCFSSSWP = 0;
   // print out some KUDO's
   if (numCFSSSWP == 0) {
     opserr << "Cold Formed Steel Steel-Sheathed Shear Wall Panel uniaxialMaterial - Written by Smail KECHIDI Ph.D Student at University of Blida 1 - Please when using this make reference as: Smail Kechidi and Nouredine Bourahla (2016), Deteriorating hysteresis model for cold-formed steel shear wall panel based on its physical and mechanical characteristics, Journal of Thin-Walled Structures, DOI: 10.1016/j.tws.2015.09.022\n";
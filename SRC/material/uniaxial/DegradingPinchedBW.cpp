@@ -348,7 +348,7 @@ int
 DegradingPinchedBW::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-  static Vector data(2);
+  static thread_local Vector data(2);
   data(0) = this->getTag();
   data(1) = xmaxp;
   res = theChannel.sendVector(this->getDbTag(), cTag, data);
@@ -362,7 +362,7 @@ int
 DegradingPinchedBW::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-  static Vector data(2);
+  static thread_local Vector data(2);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   this->setTag(int(data(0)));
   xmaxp = data(1);
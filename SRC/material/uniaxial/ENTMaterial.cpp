@@ -149,7 +149,7 @@ ENTMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(5);
+  static thread_local Vector data(5);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = a;
@@ -168,7 +168,7 @@ ENTMaterial::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(5);
+  static thread_local Vector data(5);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -202,7 +202,7 @@ int
 ElasticBilin::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(7);
+  static thread_local Vector data(7);
   data(0) = this->getTag();
   data(1) = E1P;
   data(2) = E1N;
@@ -223,7 +223,7 @@ ElasticBilin::recvSelf(int cTag, Channel &theChannel,
 				 FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(7);
+  static thread_local Vector data(7);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticBilin::recvSelf() - failed to recv data\n";
@@ -252,7 +252,7 @@ UniaxialMaterial *ElasticMultiLinear::getCopy()
 int ElasticMultiLinear::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector data(6);
+    static thread_local Vector data(6);
     data(0) = this->getTag();
     data(1) = trialIDmin;
     data(2) = trialIDmax;
@@ -274,7 +274,7 @@ int ElasticMultiLinear::recvSelf(int cTag, Channel &theChannel,
     FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(6);
+    static thread_local Vector data(6);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) 
         opserr << "ElasticMultiLinear::recvSelf() - failed to recv data.\n";
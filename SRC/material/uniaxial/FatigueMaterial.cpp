@@ -735,7 +735,7 @@ FatigueMaterial::sendSelf(int cTag, Channel &theChannel)
 {
     int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -749,7 +749,7 @@ FatigueMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(21);
+  static thread_local Vector dataVec(21);
   dataVec(0)  = DI;
   dataVec(1)  = X;
   dataVec(2)  = Y;
@@ -795,7 +795,7 @@ FatigueMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "FatigueMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -814,7 +814,7 @@ FatigueMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(21);
+  static thread_local Vector dataVec(21);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "FatigueMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -956,8 +956,8 @@ FatigueMaterial::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int 
 FatigueMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector cyclesAndRange(6);
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector cyclesAndRange(6);
 
   // each subclass must implement its own stuff    
   switch (responseID) {
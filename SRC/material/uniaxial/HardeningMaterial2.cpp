@@ -205,7 +205,7 @@ HardeningMaterial2::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(12);
+  static thread_local Vector data(12);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -233,7 +233,7 @@ HardeningMaterial2::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
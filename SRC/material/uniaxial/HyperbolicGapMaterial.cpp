@@ -277,7 +277,7 @@ int
 HyperbolicGapMaterial::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector data(15);
+    static thread_local Vector data(15);
     data(0) = this->getTag();
     data(1) = Cstrain;
     data(2) = Kmax;
@@ -306,7 +306,7 @@ HyperbolicGapMaterial::recvSelf(int cTag, Channel &theChannel,
     FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(15);
+    static thread_local Vector data(15);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0)
         opserr << "HyperbolicGapMaterial::recvSelf() - failed to recv data\n";
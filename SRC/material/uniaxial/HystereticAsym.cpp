@@ -267,7 +267,7 @@ UniaxialMaterial* HystereticAsym::getCopy ()
 int HystereticAsym::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(11);
+   static thread_local Vector data(11);
    data(0) = this->getTag();
 
    // Material properties
@@ -301,7 +301,7 @@ int HystereticAsym::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(11);
+   static thread_local Vector data(11);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
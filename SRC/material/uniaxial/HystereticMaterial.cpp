@@ -523,7 +523,7 @@ HystereticMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(27);
+  static thread_local Vector data(27);
   
   data(0) = this->getTag();
   data(1) = mom1p;
@@ -567,7 +567,7 @@ HystereticMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(27);
+  static thread_local Vector data(27);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -274,7 +274,7 @@ UniaxialMaterial* HystereticPoly::getCopy ()
 int HystereticPoly::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(10);
+   static thread_local Vector data(10);
    data(0) = this->getTag();
 
    // Material properties
@@ -306,7 +306,7 @@ int HystereticPoly::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(10);
+   static thread_local Vector data(10);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
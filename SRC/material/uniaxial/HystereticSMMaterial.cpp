@@ -90,7 +90,7 @@ void* OPS_ADD_RUNTIME_VPV(OPS_HystereticSMMaterial)
     int printInput = 0;
     int YXorder = 1;
 
-    static Vector internalValues(43);
+    static thread_local Vector internalValues(43);
     std::map<const char*, std::vector<double>> returnData;
 
 
@@ -1291,7 +1291,7 @@ HystereticSMMaterial::sendSelf(int commitTag, Channel& theChannel)
 {
     int res = 0;
 
-    static Vector data(45);
+    static thread_local Vector data(45);
 
     data(0) = this->getTag();
     data(1) = mom1p;
@@ -1354,7 +1354,7 @@ HystereticSMMaterial::recvSelf(int commitTag, Channel& theChannel,
 {
     int res = 0;
 
-    static Vector data(45);
+    static thread_local Vector data(45);
     res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
     if (res < 0) {
@@ -2234,7 +2234,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
 
     // current
     else if (responseID == 311) {
-        static Vector data(7);
+        static thread_local Vector data(7);
         if (Cstrain > 0) {
             data(0) = this->Cstrain / rot1p;
             data(1) = this->Cstrain / rot2p;
@@ -2258,7 +2258,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
     }
     // max
     else if (responseID == 312) {
-        static Vector data(14);
+        static thread_local Vector data(14);
         data(0) = this->CrotPu / rot1p;
         data(0 + 7) = this->CrotNu / rot1n;
         data(1) = this->CrotPu / rot2p;
@@ -2287,7 +2287,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
     }
     // current step
     else if (responseID == 961) {
-        static Vector data(nDefoLimitStates);
+        static thread_local Vector data(nDefoLimitStates);
         for (int i = 0; i < nDefoLimitStates; i++) {
             data(i) = this->Cstrain / defoLimitStates[i];
         }
@@ -2296,7 +2296,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
 
     // Maximum value
     else if (responseID == 962) {
-        static Vector data(nDefoLimitStates);
+        static thread_local Vector data(nDefoLimitStates);
         for (int i = 0; i < nDefoLimitStates; i++) {
             if (defoLimitStates[i] > 0) {
                 data(i) = this->CrotPu / defoLimitStates[i];
@@ -2310,7 +2310,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
 
     // Maximum absolute
     else if (responseID == 963) {
-        static Vector data(nDefoLimitStates);
+        static thread_local Vector data(nDefoLimitStates);
         for (int i = 0; i < nDefoLimitStates; i++) {
             data(i) = fabs(CrotNu / defoLimitStates[i]);
             if (fabs(CrotPu / defoLimitStates[i]) > data(i)) {
@@ -2330,7 +2330,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
     }
     // current step
     else if (responseID == 971) {
-        static Vector data(nForceLimitStates);
+        static thread_local Vector data(nForceLimitStates);
         for (int i = 0; i < nForceLimitStates; i++) {
             data(i) = this->Cstress / forceLimitStates[i];
         }
@@ -2355,7 +2355,7 @@ HystereticSMMaterial::getResponse(int responseID, Information& matInfo)
         //stressStrainTangent(2) = this->getTangent();
         //matInfo.setVector(stressStrainTangent);
 
-        static Vector data(43);
+        static thread_local Vector data(43);
 
         data(0) = this->getTag();
         data(1) = mom1p;
@@ -593,7 +593,7 @@ int IMKPeakOriented::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(70);
+    static thread_local Vector data(70);
     data(0) = this->getTag();
 // 23 Fixed Input Material Parameters 1-25
     data(1) = Ke;
@@ -722,7 +722,7 @@ int IMKPeakOriented::sendSelf(int cTag, Channel &theChannel)
 int IMKPeakOriented::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(70);
+    static thread_local Vector data(70);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
     if (res < 0) {
@@ -656,7 +656,7 @@ int IMKPinching::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(137);
+    static thread_local Vector data(137);
     data(0) = this->getTag();
 // 25 Fixed Input Material Parameters 1-25
     data(1) = Ke;
@@ -792,7 +792,7 @@ int IMKPinching::sendSelf(int cTag, Channel &theChannel)
 int IMKPinching::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(137);
+    static thread_local Vector data(137);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
     if (res < 0) {
@@ -208,7 +208,7 @@ InitStressMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -222,7 +222,7 @@ InitStressMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   dataVec(0) = epsInit;
 
   if (theChannel.sendVector(dbTag, cTag, dataVec) < 0) {
@@ -244,7 +244,7 @@ InitStressMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "InitStressMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -263,7 +263,7 @@ InitStressMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "InitStressMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -265,7 +265,7 @@ int
 JankowskiImpact::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0)  = this->getTag();
   data(1)  = Kh;
   data(2)  = xi;
@@ -292,7 +292,7 @@ JankowskiImpact::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(14);
+  static thread_local Vector data(14);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "JankowskiImpact::recvSelf() - failed to recv data\n";
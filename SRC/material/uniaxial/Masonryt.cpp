@@ -466,7 +466,7 @@ Masonryt::getCopy(void)
  int 
  Masonryt::sendSelf(int commitTag, Channel &theChannel) 
  { 
-   static Vector data(53); 
+   static thread_local Vector data(53); 
    data(0)   = this->getTag(); 
    data(1)   = Fm; 
    data(2)   = Ft; 
@@ -534,7 +534,7 @@ return 0;
  Masonryt::recvSelf(int commitTag, Channel &theChannel,  
                          FEM_ObjectBroker &theBroker) 
  { 
-   static Vector data(53); 
+   static thread_local Vector data(53); 
    if (theChannel.recvVector(this->getDbTag(), commitTag, data)<0) 
    { 
      opserr << "Masonryt::recvSelf() - failed to recvSelf\n"; 
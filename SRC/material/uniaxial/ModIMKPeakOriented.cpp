@@ -1153,7 +1153,7 @@ int
 ModIMKPeakOriented::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(76);			// Updated: Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(76);			// Updated: Filipe Ribeiro and Andre Barbosa
   data(0) = this->getTag();
  
   // Material properties
@@ -1265,7 +1265,7 @@ ModIMKPeakOriented::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(76);
+  static thread_local Vector data(76);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
  
   if (res < 0) {
@@ -1261,7 +1261,7 @@ int
 ModIMKPeakOriented02::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(78);                       // Updated:Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(78);                       // Updated:Filipe Ribeiro and Andre Barbosa
   data(0) = this->getTag();
  
   // Material properties
@@ -1375,7 +1375,7 @@ ModIMKPeakOriented02::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(78);
+  static thread_local Vector data(78);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
  
   if (res < 0) {
@@ -1270,7 +1270,7 @@ int
 ModIMKPinching02::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
   data(0) = this->getTag();
  
   // Material properties
@@ -1379,7 +1379,7 @@ ModIMKPinching02::recvSelf(int cTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
+  static thread_local Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
  
   if (res < 0) {
@@ -237,7 +237,7 @@ MultiplierMaterial::sendSelf(int cTag, Channel &theChannel)
   
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -251,7 +251,7 @@ MultiplierMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   dataVec(0) = multiplier;
 
   if (theChannel.sendVector(dbTag, cTag, dataVec) < 0) {
@@ -273,7 +273,7 @@ MultiplierMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "MultiplierMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -292,7 +292,7 @@ MultiplierMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "MultiplierMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -134,7 +134,7 @@ class PyLiq1 : public PySimple1
   // Function for obtaining effective stresses from adjoining solid soil elements
   double getEffectiveStress(void);
   double getEffectiveStress(TimeSeries *theSeries);
-  static Vector stressV3;
+  static thread_local Vector stressV3;
 };
 
 #endif // PYLIQ1_H
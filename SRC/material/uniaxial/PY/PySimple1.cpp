@@ -774,7 +774,7 @@ PySimple1::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(39);
+  static thread_local Vector data(39);
   
   data(0) = this->getTag();
   data(1) = soilType;
@@ -837,7 +837,7 @@ PySimple1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(39);
+  static thread_local Vector data(39);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -40,7 +40,7 @@
 // Control on internal iteration between spring components
 
 int QzLiq1::loadStage = 0;
-Vector QzLiq1::stressV3(3);
+thread_local Vector QzLiq1::stressV3(3);
 int QzConstructorType = 0;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_QzLiq1)
@@ -650,7 +650,7 @@ QzLiq1::sendSelf(int cTag, Channel &theChannel)
 	//
 	int res =0;
 
-	static Vector data(17);
+	static thread_local Vector data(17);
 
 	QzSimple1::sendSelf(cTag, theChannel);
 
@@ -694,7 +694,7 @@ QzLiq1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(17);
+  static thread_local Vector data(17);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -111,7 +111,7 @@ class QzLiq1 : public QzSimple1
 	// Function for obtaining effective stresses from adjoining solid soil elements
 	double getEffectiveStress(void);
 	double getEffectiveStress(TimeSeries *theSeries);
-	static Vector stressV3;
+	static thread_local Vector stressV3;
 	
 };
 
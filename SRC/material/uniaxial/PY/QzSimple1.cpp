@@ -819,7 +819,7 @@ QzSimple1::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(38);
+  static thread_local Vector data(38);
   
   data(0) = this->getTag();
   data(1) = QzType;
@@ -881,7 +881,7 @@ QzSimple1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(38);
+  static thread_local Vector data(38);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
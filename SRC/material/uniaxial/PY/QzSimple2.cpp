@@ -811,7 +811,7 @@ QzSimple2::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(38);
+  static thread_local Vector data(38);
   
   data(0) = this->getTag();
   data(1) = QzType;
@@ -873,7 +873,7 @@ QzSimple2::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(38);
+  static thread_local Vector data(38);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -42,7 +42,7 @@
 #include <TimeSeries.h>
 
 int TzLiq1::loadStage = 0;
-Vector TzLiq1::stressV3(3);
+thread_local Vector TzLiq1::stressV3(3);
 int TzConstructorType = 0;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_TzLiq1)
@@ -648,7 +648,7 @@ TzLiq1::sendSelf(int cTag, Channel &theChannel)
 	//
 	int res =0;
 
-	static Vector data(16);
+	static thread_local Vector data(16);
 
 	TzSimple1::sendSelf(cTag, theChannel);
 
@@ -691,7 +691,7 @@ TzLiq1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
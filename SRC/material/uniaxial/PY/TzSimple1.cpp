@@ -518,7 +518,7 @@ TzSimple1::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
   
-	static Vector data(20);
+	static thread_local Vector data(20);
   
 	data(0) = this->getTag();
 	data(1) = tzType;
@@ -559,7 +559,7 @@ TzSimple1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(20);
+  static thread_local Vector data(20);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -506,7 +506,7 @@ TzSimple2::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
   
-	static Vector data(20);
+	static thread_local Vector data(20);
   
 	data(0) = this->getTag();
 	data(1) = tzType;
@@ -547,7 +547,7 @@ TzSimple2::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(20);
+  static thread_local Vector data(20);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
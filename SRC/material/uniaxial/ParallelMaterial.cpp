@@ -349,7 +349,7 @@ ParallelMaterial::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static ID data(3);
+    static thread_local ID data(3);
 
     // send ID of size 3 so no possible conflict with classTags ID
     int dbTag = this->getDbTag();
@@ -406,7 +406,7 @@ ParallelMaterial::recvSelf(int cTag, Channel &theChannel,
 				FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static ID data(3);
+    static thread_local ID data(3);
     int dbTag = this->getDbTag();
 
     res = theChannel.recvID(dbTag, cTag, data);
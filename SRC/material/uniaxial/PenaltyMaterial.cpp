@@ -225,7 +225,7 @@ PenaltyMaterial::sendSelf(int cTag, Channel &theChannel)
   
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -239,7 +239,7 @@ PenaltyMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   dataVec(0) = penalty;
 
   if (theChannel.sendVector(dbTag, cTag, dataVec) < 0) {
@@ -261,7 +261,7 @@ PenaltyMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "PenaltyMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -280,7 +280,7 @@ PenaltyMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(1);
+  static thread_local Vector dataVec(1);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "PenaltyMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -570,7 +570,7 @@ int Pinching4Material::sendSelf(int commitTag, Channel &theChannel)
 {
 
     // Instantiate a Vector to store the relevant class attributes
-    static Vector data(119);
+    static thread_local Vector data(119);
 
     // Fill the Vector with class attributes.
 	int indx = 0;
@@ -688,7 +688,7 @@ int Pinching4Material::recvSelf(
 {
 
 	// Instantiate a Vector to store the relevant class attributes
-    static Vector data(119);
+    static thread_local Vector data(119);
 
     int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
     if (res < 0) 
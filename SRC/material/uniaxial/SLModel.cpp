@@ -1109,7 +1109,7 @@ int
 SLModel::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(182);
+	static thread_local Vector data(182);
 	data(0) = this->getTag();
 	
 	// constaint variables
@@ -1316,7 +1316,7 @@ int
 SLModel::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(182);
+  static thread_local Vector data(182);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "SLModel::recvSelf() - failed to recv data\n";
@@ -433,7 +433,7 @@ SeriesMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int dataTag = this->getDbTag();
   
-  static Vector data(8);
+  static thread_local Vector data(8);
   
   data(0) = this->getTag();
   data(1) = numMaterials;
@@ -498,7 +498,7 @@ SeriesMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dataTag = this->getDbTag();
 
-  static Vector data(8);
+  static thread_local Vector data(8);
 
   if (theChannel.recvVector(dataTag, cTag, data) < 0) {
     opserr << "SeriesMaterial::recvSelf -- failed to receive data Vector" << endln;
@@ -569,7 +569,7 @@ trilinwpd::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(30);
+  static thread_local Vector data(30);
   
   data(0) = this->getTag();
   data(1) = mom1p;
@@ -616,7 +616,7 @@ trilinwpd::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(30);
+  static thread_local Vector data(30);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -37,7 +37,7 @@ sgn(T val) {
 // NOTE: Do not use the OPS_GetNumRemainingInputArgs() function or the
 // OPS_GetString() function: causes crash with .dll
 void * OPS_ADD_RUNTIME_VPV(OPS_UVCuniaxial) {
-  static int numUVCuniaxial = 0;
+  static thread_local int numUVCuniaxial = 0;
   if (numUVCuniaxial == 0) {
     opserr << "Using the UVCuniaxial material, see "
       "https://www.epfl.ch/labs/resslab/resslab-tools/" << endln;
@@ -470,7 +470,7 @@ UniaxialMaterial* UVCuniaxial::getCopy() {
  */
 int UVCuniaxial::sendSelf(int commitTag, Channel& theChannel) {
 
-  static Vector data(15 + 2*MAX_BACKSTRESSES);  // enough space for 8 backstresses
+  static thread_local Vector data(15 + 2*MAX_BACKSTRESSES);  // enough space for 8 backstresses
   // Material properties
   data(0) = elasticModulus;
   data(1) = yieldStress;
@@ -519,7 +519,7 @@ int UVCuniaxial::sendSelf(int commitTag, Channel& theChannel) {
  */
 int UVCuniaxial::recvSelf(int commitTag, Channel& theChannel,
   FEM_ObjectBroker& theBroker) {
-  static Vector data(15 + 2*MAX_BACKSTRESSES);
+  static thread_local Vector data(15 + 2*MAX_BACKSTRESSES);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "UVCuniaxial::recvSelf() - failed to recvSelf\n";
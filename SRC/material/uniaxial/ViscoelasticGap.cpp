@@ -252,7 +252,7 @@ int
 ViscoelasticGap::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(12);
+  static thread_local Vector data(12);
   data(0)  = this->getTag();
   data(1)  = K;
   data(2)  = C;
@@ -277,7 +277,7 @@ ViscoelasticGap::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "ViscoelasticGap::recvSelf() - failed to recv data\n";
@@ -482,7 +482,7 @@ int
 ViscousDamper::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(15);
+  static thread_local Vector data(15);
   data(0) = this->getTag();
 
   // Material properties
@@ -516,7 +516,7 @@ ViscousDamper::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(15);
+  static thread_local Vector data(15);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -214,7 +214,7 @@ int CementedSoil::getVariable(int varID, double &theValue) { return -1; }
 int CementedSoil::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
 
   data(0) = this->getTag();
   data(1) = pm;
@@ -237,7 +237,7 @@ int CementedSoil::recvSelf(int commitTag, Channel &theChannel,
                            FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -325,7 +325,7 @@ ManderBackbone::sendSelf(int commitTag, Channel &theChannel)
 
   
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   
 
@@ -369,7 +369,7 @@ ManderBackbone::recvSelf(int commitTag, Channel &theChannel,
 
   
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   
 
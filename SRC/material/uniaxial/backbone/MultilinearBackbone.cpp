@@ -34,6 +34,8 @@
 #include <ID.h>
 #include <Channel.h>
 
+#include <algorithm>
+
 #include <elementAPI.h>
 
 void * OPS_ADD_RUNTIME_VPV(OPS_MultilinearBackbone)
@@ -149,13 +151,19 @@ MultilinearBackbone::~MultilinearBackbone()
     delete [] c;
 }
 
+int
+MultilinearBackbone::findSegment (double strain) const
+{
+  // First point with e[i] > strain; e[1..numPoints] is sorted
+  return std::upper_bound(e+1, e+numPoints+1, strain) - e;
+}
+
 double
 MultilinearBackbone::getTangent (double strain)
 {
-  for (int i = 1; i <= numPoints; i++) {
-    if (strain < e[i])
-      return E[i-1];
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return E[i-1];
   
   return E[0]*1.0e-9;
 }
@@ -163,10 +171,9 @@ MultilinearBackbone::getTangent (double strain)
 double
 MultilinearBackbone::getStress (double strain)
 {
-  for (int i = 1; i <= numPoints; i++) {
-    if (strain < e[i])
-      return s[i-1] + E[i-1]*(strain-e[i-1]);
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return s[i-1] + E[i-1]*(strain-e[i-1]);
   
   return s[numPoints];
 }
@@ -174,10 +181,9 @@ MultilinearBackbone::getStress (double strain)
 double
 MultilinearBackbone::getEnergy (double strain)
 {
-  for (int i = 1; i <= numPoints; i++) {
-    if (strain < e[i])
-      return c[i-1] + 0.5*E[i-1]*(strain-e[i-1])*(strain-e[i-1]);
-  }
+  const int i = this->findSegment(strain);
+  if (i <= numPoints)
+    return c[i-1] + 0.5*E[i-1]*(strain-e[i-1])*(strain-e[i-1]);
   
   return c[numPoints] + s[numPoints]*(strain-e[numPoints]);
 }
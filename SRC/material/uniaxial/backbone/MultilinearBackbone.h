@@ -64,6 +64,8 @@ class MultilinearBackbone : public HystereticBackbone
  protected:
   
  private:
+  int findSegment(double strain) const;
+
   double *E;
   double *e;
   double *s;
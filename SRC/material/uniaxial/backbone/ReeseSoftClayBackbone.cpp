@@ -142,7 +142,7 @@ ReeseSoftClayBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(4);
+  static thread_local Vector data(4);
   
   data(0) = this->getTag();
   data(1) = pu;
@@ -165,7 +165,7 @@ ReeseSoftClayBackbone::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(4);
+  static thread_local Vector data(4);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
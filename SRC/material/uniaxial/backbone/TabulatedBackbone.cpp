@@ -0,0 +1,317 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// TabulatedBackbone, a uniform-grid cubic Hermite table of
+// another backbone.
+//
+// Written: cmp
+//
+#include <TabulatedBackbone.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#include <math.h>
+#include <algorithm>
+
+#include <OPS_Globals.h>
+
+//
+// Cubic Hermite interpolant on the interval [i, i+1] at local
+// coordinate u in [0,1), and its derivative with respect to strain.
+//
+static inline double
+hermiteValue(const double *s, const double *t, int i, double u, double h)
+{
+  const double v = 1.0 - u;
+  return  (1.0 + 2.0*u)*v*v*s[i]   + u*v*v*h*t[i]
+        + u*u*(3.0 - 2.0*u)*s[i+1] - u*u*v*h*t[i+1];
+}
+
+static inline double
+hermiteSlope(const double *s, const double *t, int i, double u, double hinv)
+{
+  return  6.0*u*(u - 1.0)*hinv*(s[i] - s[i+1])
+        + (u*(3.0*u - 4.0) + 1.0)*t[i]
+        + u*(3.0*u - 2.0)*t[i+1];
+}
+
+std::shared_ptr<const TabulatedBackbone::Table>
+TabulatedBackbone::fit(HystereticBackbone &backbone, double eMin, double eMax,
+                       double tol, int n, int nmax)
+{
+  // Interior points at which the interpolant is checked
+  static constexpr double check[] = {0.25, 0.5, 0.75};
+
+  std::shared_ptr<Table> table;
+  n = std::max(n, 1);
+
+  while (true) {
+    table = std::make_shared<Table>();
+    table->eMin = eMin;
+    table->eMax = eMax;
+    table->n    = n;
+    table->h    = (eMax - eMin)/n;
+    table->hinv = 1.0/table->h;
+    table->s.resize(n+1);
+    table->t.resize(n+1);
+
+    double scale = 0.0;
+    for (int i = 0; i <= n; i++) {
+      const double e = eMin + i*table->h;
+      table->s[i] = backbone.getStress(e);
+      table->t[i] = backbone.getTangent(e);
+      scale = std::max(scale, fabs(table->s[i]));
+    }
+    if (scale == 0.0)
+      scale = 1.0;
+
+    double error = 0.0;
+    for (int i = 0; i < n; i++)
+      for (double u : check) {
+        const double e = eMin + (i + u)*table->h;
+        const double s = hermiteValue(table->s.data(), table->t.data(), i, u, table->h);
+        error = std::max(error, fabs(s - backbone.getStress(e)));
+      }
+    table->error = error/scale;
+
+    if (table->error <= tol || 2*n > nmax)
+      break;
+    n *= 2;
+  }
+
+  if (table->error > tol)
+    opserr << "TabulatedBackbone -- could not reach tolerance " << tol
+           << " with " << n << " intervals; error is " << table->error << endln;
+
+  return table;
+}
+
+TabulatedBackbone::TabulatedBackbone(int tag, HystereticBackbone &backbone,
+                                     double eMin, double eMax,
+                                     double tol, int n, int nmax)
+ : HystereticBackbone(tag, BACKBONE_TAG_Tabulated),
+   theBackbone(nullptr)
+{
+  theBackbone = backbone.getCopy();
+  if (theBackbone == nullptr) {
+    opserr << "TabulatedBackbone::TabulatedBackbone -- failed to get copy of backbone" << endln;
+    return;
+  }
+
+  if (eMax < eMin)
+    std::swap(eMin, eMax);
+
+  table = fit(*theBackbone, eMin, eMax, tol, n, nmax);
+}
+
+TabulatedBackbone::TabulatedBackbone(int tag, HystereticBackbone *backbone,
+                                     std::shared_ptr<const Table> table)
+ : HystereticBackbone(tag, BACKBONE_TAG_Tabulated),
+   theBackbone(backbone), table(table)
+{
+
+}
+
+TabulatedBackbone::TabulatedBackbone()
+ : HystereticBackbone(0, BACKBONE_TAG_Tabulated),
+   theBackbone(nullptr)
+{
+
+}
+
+TabulatedBackbone::~TabulatedBackbone()
+{
+  if (theBackbone != nullptr)
+    delete theBackbone;
+}
+
+double
+TabulatedBackbone::getStress(double strain)
+{
+  const Table &T = *table;
+  const double x = (strain - T.eMin)*T.hinv;
+  if (!(x >= 0.0 && x < T.n))
+    return theBackbone->getStress(strain);
+
+  const int i = (int)x;
+  return hermiteValue(T.s.data(), T.t.data(), i, x - i, T.h);
+}
+
+double
+TabulatedBackbone::getTangent(double strain)
+{
+  const Table &T = *table;
+  const double x = (strain - T.eMin)*T.hinv;
+  if (!(x >= 0.0 && x < T.n))
+    return theBackbone->getTangent(strain);
+
+  const int i = (int)x;
+  return hermiteSlope(T.s.data(), T.t.data(), i, x - i, T.hinv);
+}
+
+double
+TabulatedBackbone::getEnergy(double strain)
+{
+  // Energy is only needed for output and damage indices
+  return theBackbone->getEnergy(strain);
+}
+
+double
+TabulatedBackbone::getYieldStrain(void)
+{
+  return theBackbone->getYieldStrain();
+}
+
+double
+TabulatedBackbone::getError() const
+{
+  return table ? table->error : 0.0;
+}
+
+int
+TabulatedBackbone::getNumIntervals() const
+{
+  return table ? table->n : 0;
+}
+
+HystereticBackbone*
+TabulatedBackbone::getCopy(void)
+{
+  HystereticBackbone *copy = theBackbone->getCopy();
+  if (copy == nullptr)
+    return nullptr;
+
+  return new TabulatedBackbone(this->getTag(), copy, table);
+}
+
+void
+TabulatedBackbone::Print(OPS_Stream &s, int flag)
+{
+  s << "TabulatedBackbone, tag: " << this->getTag() << endln;
+  s << "\tBackbone: " << theBackbone->getTag() << endln;
+  if (table) {
+    s << "\tRange: " << table->eMin << " to " << table->eMax << endln;
+    s << "\tIntervals: " << table->n << endln;
+    s << "\tRelative error: " << table->error << endln;
+  }
+}
+
+int
+TabulatedBackbone::setVariable(char *argv)
+{
+  return theBackbone->setVariable(argv);
+}
+
+int
+TabulatedBackbone::getVariable(int varID, double &theValue)
+{
+  return theBackbone->getVariable(varID, theValue);
+}
+
+int
+TabulatedBackbone::sendSelf(int cTag, Channel &theChannel)
+{
+  const int n = table->n;
+
+  static thread_local ID idata(4);
+  idata(0) = this->getTag();
+  idata(1) = n;
+  idata(2) = theBackbone->getClassTag();
+
+  int dbTag = theBackbone->getDbTag();
+  if (dbTag == 0) {
+    dbTag = theChannel.getDbTag();
+    if (dbTag != 0)
+      theBackbone->setDbTag(dbTag);
+  }
+  idata(3) = dbTag;
+
+  int res = theChannel.sendID(this->getDbTag(), cTag, idata);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send ID" << endln;
+    return res;
+  }
+
+  Vector data(3 + 2*(n+1));
+  data(0) = table->eMin;
+  data(1) = table->eMax;
+  data(2) = table->error;
+  for (int i = 0; i <= n; i++) {
+    data(3 + i)       = table->s[i];
+    data(3 + n+1 + i) = table->t[i];
+  }
+
+  res = theChannel.sendVector(this->getDbTag(), cTag, data);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send Vector" << endln;
+    return res;
+  }
+
+  res = theBackbone->sendSelf(cTag, theChannel);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send HystereticBackbone" << endln;
+    return res;
+  }
+
+  return 0;
+}
+
+int
+TabulatedBackbone::recvSelf(int cTag, Channel &theChannel,
+                            FEM_ObjectBroker &theBroker)
+{
+  static thread_local ID idata(4);
+  int res = theChannel.recvID(this->getDbTag(), cTag, idata);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive ID" << endln;
+    return res;
+  }
+
+  this->setTag(idata(0));
+  const int n = idata(1);
+
+  Vector data(3 + 2*(n+1));
+  res = theChannel.recvVector(this->getDbTag(), cTag, data);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive Vector" << endln;
+    return res;
+  }
+
+  std::shared_ptr<Table> received = std::make_shared<Table>();
+  received->eMin  = data(0);
+  received->eMax  = data(1);
+  received->error = data(2);
+  received->n     = n;
+  received->h     = (received->eMax - received->eMin)/n;
+  received->hinv  = 1.0/received->h;
+  received->s.resize(n+1);
+  received->t.resize(n+1);
+  for (int i = 0; i <= n; i++) {
+    received->s[i] = data(3 + i);
+    received->t[i] = data(3 + n+1 + i);
+  }
+  table = received;
+
+  // The wrapped backbone can only be received into one of the right
+  // type; FEM_ObjectBroker cannot create HystereticBackbones
+  if (theBackbone == nullptr || theBackbone->getClassTag() != idata(2)) {
+    //theBackbone = theBroker.getNewHystereticBackbone(idata(2));
+    opserr << "TabulatedBackbone::recvSelf -- could not get a HystereticBackbone" << endln;
+    return -1;
+  }
+
+  theBackbone->setDbTag(idata(3));
+  res = theBackbone->recvSelf(cTag, theChannel, theBroker);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive HystereticBackbone" << endln;
+    return res;
+  }
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: TabulatedBackbone replaces the closed-form evaluation of
+// another backbone by a piecewise cubic Hermite interpolant on a uniform
+// strain grid. The stress and tangent of the wrapped backbone are sampled
+// once; evaluation is then an index computation and a few multiplications,
+// and the tangent returned is the exact derivative of the interpolated
+// stress. The grid is refined until the sampled interpolation error,
+// relative to the peak stress in the range, is below the requested
+// tolerance. Strains outside the tabulated range are handed to the
+// wrapped backbone.
+//
+// Copies share the table, so a backbone tabulated once may be used by
+// every fiber or spring of a model without repeating the work.
+//
+// Written: cmp
+//
+#ifndef TabulatedBackbone_h
+#define TabulatedBackbone_h
+
+#include <memory>
+#include <vector>
+#include <HystereticBackbone.h>
+
+#define BACKBONE_TAG_Tabulated 1201
+
+class TabulatedBackbone : public HystereticBackbone
+{
+ public:
+  TabulatedBackbone(int tag, HystereticBackbone &backbone,
+                    double eMin, double eMax,
+                    double tol = 1.0e-6,
+                    int numIntervals = 64,
+                    int maxIntervals = 1<<16);
+  TabulatedBackbone();
+  ~TabulatedBackbone();
+
+  double getStress(double strain);
+  double getTangent(double strain);
+  double getEnergy(double strain);
+
+  double getYieldStrain(void);
+
+  HystereticBackbone *getCopy(void);
+
+  void Print(OPS_Stream &s, int flag = 0);
+
+  int setVariable(char *argv);
+  int getVariable(int varID, double &theValue);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+               FEM_ObjectBroker &theBroker);
+
+  // largest sampled interpolation error, relative to the peak stress
+  double getError() const;
+  int    getNumIntervals() const;
+
+ private:
+  struct Table {
+    double eMin, eMax;
+    double h, hinv;
+    int    n;                    // number of intervals
+    double error;
+    std::vector<double> s, t;    // stress and tangent at the n+1 nodes
+  };
+
+  TabulatedBackbone(int tag, HystereticBackbone *backbone,
+                    std::shared_ptr<const Table> table);
+
+  static std::shared_ptr<const Table>
+  fit(HystereticBackbone &, double eMin, double eMax, double tol, int n, int nmax);
+
+  HystereticBackbone *theBackbone;
+  std::shared_ptr<const Table> table;
+};
+
+#endif
@@ -180,7 +180,7 @@ int WeakRock::getVariable(int varID, double &theValue) { return -1; }
 int WeakRock::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   data(0) = this->getTag();
   data(1) = Kir;
@@ -201,7 +201,7 @@ int WeakRock::recvSelf(int commitTag, Channel &theChannel,
                        FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(4);
+  static thread_local Vector data(4);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
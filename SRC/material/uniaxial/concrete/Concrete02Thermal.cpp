@@ -612,7 +612,7 @@ Concrete02Thermal::revertToStart(void)
 int 
 Concrete02Thermal::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) =fc;    
   data(1) =epsc0; 
   data(2) =fcu;   
@@ -639,7 +639,7 @@ Concrete02Thermal::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(13);
+  static thread_local Vector data(13);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Concrete02Thermal::recvSelf() - failed to recvSelf\n";
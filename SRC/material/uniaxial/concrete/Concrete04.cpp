@@ -441,7 +441,7 @@ int Concrete04::sendSelf (int commitTag, Channel& theChannel)
 {   
   int res = 0;   
 
-  static Vector data(16);   
+  static thread_local Vector data(16);   
   data(0) = this->getTag();
   
   /* Material properties*/   
@@ -477,7 +477,7 @@ int Concrete04::recvSelf (int commitTag, Channel& theChannel,
 			  FEM_ObjectBroker& theBroker)
 {
   int res = 0;
-  static Vector data(16);
+  static thread_local Vector data(16);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
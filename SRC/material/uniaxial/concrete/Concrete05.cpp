@@ -3018,7 +3018,7 @@ UniaxialMaterial* Concrete05::getCopy ()
 int Concrete05::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(29);	//come back to 29 (see below)
+   static thread_local Vector data(29);	//come back to 29 (see below)
    data(0) = this->getTag();
 
    // Material properties
@@ -3070,7 +3070,7 @@ int Concrete05::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(29);		//come back to 29 (originally 24, data(23 max) above and below) )
+   static thread_local Vector data(29);		//come back to 29 (originally 24, data(23 max) above and below) )
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
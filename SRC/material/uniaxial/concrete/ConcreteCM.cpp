@@ -4308,7 +4308,7 @@ int ConcreteCM::setTrialStrain (double strain, double strainRate)
 	int ConcreteCM::sendSelf (int commitTag, Channel& theChannel)
 	{
 		int res = 0;
-		static Vector data(31);
+		static thread_local Vector data(31);
 		data(0) = this->getTag();
 
 		// Material properties
@@ -4361,7 +4361,7 @@ int ConcreteCM::setTrialStrain (double strain, double strainRate)
 		FEM_ObjectBroker& theBroker)
 	{
 		int res = 0;
-		static Vector data(31);
+		static thread_local Vector data(31);
 		res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
 		if (res < 0) {
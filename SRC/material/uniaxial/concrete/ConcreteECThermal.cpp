@@ -456,7 +456,7 @@ ConcreteECThermal::revertToStart(void)
 int 
 ConcreteECThermal::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) =fc;    
   data(1) =epsc0; 
   data(2) =fcu;   
@@ -483,7 +483,7 @@ ConcreteECThermal::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(13);
+  static thread_local Vector data(13);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "ConcreteECThermal::recvSelf() - failed to recvSelf\n";
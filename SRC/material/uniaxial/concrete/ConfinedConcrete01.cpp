@@ -1190,7 +1190,7 @@ UniaxialMaterial* ConfinedConcrete01::getCopy ()
 int ConfinedConcrete01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(11);
+   static thread_local Vector data(11);
    data(0) = this->getTag();
 
    // Material properties
@@ -1223,7 +1223,7 @@ int ConfinedConcrete01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(11);
+   static thread_local Vector data(11);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -0,0 +1,244 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of CreepSeries and
+// CreepChain.
+
+#include "CreepSeries.h"
+
+#include <math.h>
+#include <string.h>
+#include <OPS_Globals.h>
+#include <elementAPI.h>
+
+// Fit errors above this fraction of the largest sample are reported
+static const double fitTolerance = 0.01;
+
+CreepSeries::CreepSeries(int n, double tmin, double tmax)
+  : numTerms(n), numPoints(0), tauMin(tmin), tauMax(tmax), warned(false)
+{
+  if (numTerms < 1)
+    numTerms = 1;
+  if (numTerms > MaxTerms)
+    numTerms = MaxTerms;
+
+  // Retardation times, log-spaced over [tauMin, tauMax]
+  tau.resize(numTerms);
+  const double ratio = log(tauMax/tauMin);
+  for (int k = 0; k < numTerms; k++)
+    tau[k] = (numTerms == 1) ? sqrt(tauMin*tauMax)
+                             : tauMin*exp(ratio*k/(numTerms - 1));
+
+  // Sample durations, log-spaced from a decade below tauMin up to tauMax
+  const double pmin = 0.1*tauMin;
+  numPoints = (int)ceil(log10(tauMax/pmin)*PointsPerDecade) + 1;
+  if (numPoints < 2*numTerms)
+    numPoints = 2*numTerms;
+  if (numPoints > MaxPoints)
+    numPoints = MaxPoints;
+  points.resize(numPoints);
+  for (int j = 0; j < numPoints; j++)
+    points[j] = pmin*exp(log(tauMax/pmin)*j/(numPoints - 1));
+
+  basis.resize(numPoints*numTerms);
+  for (int j = 0; j < numPoints; j++)
+    for (int k = 0; k < numTerms; k++)
+      basis[j*numTerms + k] = 1.0 - exp(-points[j]/tau[k]);
+
+  //
+  // Least-squares operator pinv = R^-1 Q^T from a thin QR factorization
+  // of the basis (Gram-Schmidt, orthogonalized twice)
+  //
+  std::vector<double> Q(basis), R(numTerms*numTerms, 0.0);
+  for (int k = 0; k < numTerms; k++) {
+    for (int pass = 0; pass < 2; pass++)
+      for (int l = 0; l < k; l++) {
+        double dot = 0.0;
+        for (int j = 0; j < numPoints; j++)
+          dot += Q[j*numTerms + l]*Q[j*numTerms + k];
+        for (int j = 0; j < numPoints; j++)
+          Q[j*numTerms + k] -= dot*Q[j*numTerms + l];
+        R[l*numTerms + k] += dot;
+      }
+    double norm = 0.0;
+    for (int j = 0; j < numPoints; j++)
+      norm += Q[j*numTerms + k]*Q[j*numTerms + k];
+    norm = sqrt(norm);
+    R[k*numTerms + k] = norm;
+    for (int j = 0; j < numPoints; j++)
+      Q[j*numTerms + k] /= norm;
+  }
+
+  pinv.resize(numTerms*numPoints);
+  for (int j = 0; j < numPoints; j++)
+    for (int k = numTerms - 1; k >= 0; k--) {
+      double x = Q[j*numTerms + k];
+      for (int l = k + 1; l < numTerms; l++)
+        x -= R[k*numTerms + l]*pinv[l*numPoints + j];
+      pinv[k*numPoints + j] = x/R[k*numTerms + k];
+    }
+}
+
+double
+CreepSeries::fit(const double *phi, double *a) const
+{
+  for (int k = 0; k < numTerms; k++) {
+    const double *row = &pinv[k*numPoints];
+    double sum = 0.0;
+    for (int j = 0; j < numPoints; j++)
+      sum += row[j]*phi[j];
+    a[k] = sum;
+  }
+
+  // Accuracy of the series against the exact creep function
+  double maxPhi = 0.0, maxError = 0.0;
+  for (int j = 0; j < numPoints; j++) {
+    const double *row = &basis[j*numTerms];
+    double sum = 0.0;
+    for (int k = 0; k < numTerms; k++)
+      sum += row[k]*a[k];
+    maxError = fmax(maxError, fabs(sum - phi[j]));
+    maxPhi = fmax(maxPhi, fabs(phi[j]));
+  }
+  const double error = (maxPhi > 0.0) ? maxError/maxPhi : 0.0;
+
+  if (error > fitTolerance && !warned) {
+    warned = true;
+    opserr << "WARNING CreepSeries - the creep function is fitted with a relative error of "
+           << error << " over [" << 0.1*tauMin << ", " << tauMax
+           << "]; use more terms or a different range of retardation times" << endln;
+  }
+  return error;
+}
+
+CreepChain::CreepChain(void)
+  : tRef(0.0)
+{
+
+}
+
+void
+CreepChain::setSeries(const std::shared_ptr<const CreepSeries> &theSeries)
+{
+  series = theSeries;
+  const int n = series ? series->getNumTerms() : 0;
+  S.assign(n, 0.0);
+  H.assign(n, 0.0);
+  tRef = 0.0;
+}
+
+double
+CreepChain::addIncrement(double tp, double dsig, const double *phi)
+{
+  double a[CreepSeries::MaxTerms];
+  const double error = series->fit(phi, a);
+
+  const int n = series->getNumTerms();
+  for (int k = 0; k < n; k++) {
+    const double w = dsig*a[k];
+    H[k] = H[k]*exp(-(tp - tRef)/series->getTau(k)) + w;
+    S[k] += w;
+  }
+  tRef = tp;
+  return error;
+}
+
+double
+CreepChain::getCreep(double t) const
+{
+  double creep = 0.0;
+  const int n = (int)S.size();
+  for (int k = 0; k < n; k++)
+    creep += S[k] - H[k]*exp(-(t - tRef)/series->getTau(k));
+  return creep;
+}
+
+void
+CreepChain::reset(void)
+{
+  tRef = 0.0;
+  S.assign(S.size(), 0.0);
+  H.assign(H.size(), 0.0);
+}
+
+int
+CreepChain::getNumState(void) const
+{
+  return series ? 1 + 2*(int)S.size() : 0;
+}
+
+void
+CreepChain::getState(double *data) const
+{
+  const int n = (int)S.size();
+  data[0] = tRef;
+  for (int k = 0; k < n; k++) {
+    data[1 + k] = S[k];
+    data[1 + n + k] = H[k];
+  }
+}
+
+void
+CreepChain::setState(const double *data)
+{
+  const int n = (int)S.size();
+  tRef = data[0];
+  for (int k = 0; k < n; k++) {
+    S[k] = data[1 + k];
+    H[k] = data[1 + n + k];
+  }
+}
+
+int
+OPS_GetCreepSeries(std::shared_ptr<const CreepSeries> &series)
+{
+  series.reset();
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *flag = OPS_GetString();
+    if (strcmp(flag, "-creepSeries") != 0) {
+      opserr << "WARNING unknown option " << flag << endln;
+      return -1;
+    }
+
+    int numData = 1;
+    int numTerms = 0;
+    if (OPS_GetIntInput(&numData, &numTerms) != 0 || numTerms < 1
+        || numTerms > CreepSeries::MaxTerms) {
+      opserr << "WARNING -creepSeries needs a number of terms between 1 and "
+             << CreepSeries::MaxTerms << endln;
+      return -1;
+    }
+
+    // Retardation times in the time unit of the model (days)
+    double tau[2] = {0.001, 1.0e4};
+    if (OPS_GetNumRemainingInputArgs() >= 2) {
+      numData = 2;
+      if (OPS_GetDoubleInput(&numData, tau) != 0 || tau[0] <= 0.0
+          || tau[1] <= tau[0]) {
+        opserr << "WARNING -creepSeries needs 0 < tauMin < tauMax" << endln;
+        return -1;
+      }
+    }
+
+    series = std::make_shared<CreepSeries>(numTerms, tau[0], tau[1]);
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definitions for CreepSeries
+// and CreepChain, used by the TDConcrete materials and CreepMaterial to
+// replace the summation over the whole stress history by a recursive
+// update with a fixed number of internal variables.
+//
+// A creep function phi(t,t') is approximated for each loading age t' by
+// a Dirichlet series (Kelvin chain)
+//
+//   phi(t,t') ~ sum_k a_k(t') [1 - exp(-(t-t')/tau_k)]
+//
+// with fixed retardation times tau_k, log-spaced between tauMin and
+// tauMax. The coefficients a_k(t') are found by least squares from
+// samples of phi at durations t-t' log-spaced over the same range, so
+// aging creep functions are handled as well. Since every term depends on
+// t only through exp(-t/tau_k), the creep strain of a stress history is
+//
+//   eps_cr(t) = sum_k [S_k - H_k exp(-(t-tRef)/tau_k)]
+//
+// where S_k and H_k are updated once per stress increment.
+
+#ifndef CreepSeries_h
+#define CreepSeries_h
+
+#include <memory>
+#include <vector>
+
+class CreepSeries
+{
+  public:
+    enum {MaxTerms = 20, PointsPerDecade = 8, MaxPoints = 200};
+
+    CreepSeries(int numTerms, double tauMin, double tauMax);
+
+    int getNumTerms(void) const {return numTerms;}
+    double getTauMin(void) const {return tauMin;}
+    double getTauMax(void) const {return tauMax;}
+    double getTau(int k) const {return tau[k];}
+
+    // Durations t-t' at which the creep function is sampled
+    int getNumPoints(void) const {return numPoints;}
+    double getPoint(int j) const {return points[j];}
+
+    // Coefficients of the series from the samples phi(t'+point_j, t');
+    // returns the largest error at the samples relative to the largest sample
+    double fit(const double *phi, double *a) const;
+
+  private:
+    int numTerms;
+    int numPoints;
+    double tauMin;
+    double tauMax;
+    std::vector<double> tau;
+    std::vector<double> points;
+    std::vector<double> basis;   // 1 - exp(-point_j/tau_k), numPoints x numTerms
+    std::vector<double> pinv;    // least-squares solution operator, numTerms x numPoints
+    mutable bool warned;         // a poor fit has been reported
+};
+
+class CreepChain
+{
+  public:
+    CreepChain(void);
+
+    void setSeries(const std::shared_ptr<const CreepSeries> &series);
+
+    // Add a stress increment dsig applied at time tp, given the creep
+    // function sampled at the points of the series; returns the fit error
+    double addIncrement(double tp, double dsig, const double *phi);
+
+    // Creep strain at time t of all the increments added so far
+    double getCreep(double t) const;
+
+    void reset(void);
+
+    // Internal variables (tRef, S_k, H_k), 1 + 2*numTerms values
+    int getNumState(void) const;
+    void getState(double *data) const;
+    void setState(const double *data);
+
+  private:
+    std::shared_ptr<const CreepSeries> series;
+    double tRef;
+    std::vector<double> S;
+    std::vector<double> H;
+};
+
+// Parse the optional arguments -creepSeries numTerms <tauMin tauMax>;
+// returns 0 and leaves series empty if the flag is not given, -1 on error
+int OPS_GetCreepSeries(std::shared_ptr<const CreepSeries> &series);
+
+#endif
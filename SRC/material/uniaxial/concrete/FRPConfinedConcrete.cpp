@@ -879,7 +879,7 @@ UniaxialMaterial* FRPConfinedConcrete::getCopy()
 int FRPConfinedConcrete::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(31);
+   static thread_local Vector data(31);
    data(0) = this->getTag();
 
    // Material properties
@@ -932,7 +932,7 @@ int FRPConfinedConcrete::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(31);
+   static thread_local Vector data(31);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -1526,7 +1526,7 @@ int
 GMG_CyclicReinforcedConcrete::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(180);
+	static thread_local Vector data(180);
 	data(0) = this->getTag();
 
 	// Monotonic Backbone
@@ -1739,7 +1739,7 @@ GMG_CyclicReinforcedConcrete::recvSelf(int cTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(180);
+	static thread_local Vector data(180);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
 	if (res < 0) {
@@ -182,7 +182,7 @@ SecantConcrete::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(5);
+  static thread_local Vector data(5);
   
   data(0) = this->getTag();
   data(1) = fc;
@@ -203,7 +203,7 @@ SecantConcrete::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(5);
+  static thread_local Vector data(5);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -107,7 +107,7 @@ OPS_ADD_RUNTIME_VPV(OPS_TDConcreteEXP)
 
   numArgs = OPS_GetNumRemainingInputArgs();
 
-  if (numArgs == 14) {
+  if (numArgs >= 14) {
     //TDConcreteEXP(int tag, double _fc, double _epsc0, double _fcu,
     //double _epscu, double _tcr, double _ft, double _Ets, double _Ec, double _age, double _epsshu)
     double dData[13];
@@ -126,11 +126,19 @@ OPS_ADD_RUNTIME_VPV(OPS_TDConcreteEXP)
       return 0;
     }
 
+    //Optional recursive creep: -creepSeries numTerms <tauMin tauMax>
+    std::shared_ptr<const CreepSeries> series;
+    if (OPS_GetCreepSeries(series) != 0) {
+      opserr << "WARNING: invalid uniaxialMaterial TDConcreteEXP " << iData
+             << " options\n";
+      return 0;
+    }
+
     //Create a new materiadouble
     theMaterial =
         new TDConcreteEXP(iData, dData[0], dData[1], dData[2], dData[3],
                           dData[4], dData[5], dData[6], dData[7], dData[8],
-                          dData[9], dData[10], dData[11], dData[12]);
+                          dData[9], dData[10], dData[11], dData[12], series);
     if (theMaterial == 0) {
       opserr << "WARNING: could not create uniaxialMaterial of type "
                 "TDConcreteEXP \n";
@@ -148,11 +156,12 @@ TDConcreteEXP::TDConcreteEXP(int tag, double _fc, double _ft, double _Ec,
                              double _beta, double _age, double _epsshu,
                              double _epssha, double _tcr, double _epscru,
                              double _sigCr, double _epscra, double _epscrd,
-                             double _tcast)
+                             double _tcast,
+                             std::shared_ptr<const CreepSeries> _series)
     : UniaxialMaterial(tag, MAT_TAG_TDConcreteEXP), fc(_fc), ft(_ft), Ec(_Ec),
       beta(_beta), age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr),
       epscru(_epscru), sigCr(_sigCr), epscra(_epscra), epscrd(_epscrd),
-      tcast(_tcast)
+      tcast(_tcast), tLast(0.0), series(_series)
 {
   ecminP = 0.0;
   deptP  = 0.0;
@@ -182,13 +191,16 @@ TDConcreteEXP::TDConcreteEXP(int tag, double _fc, double _ft, double _Ec,
   crack_flag = 0;
   iter       = 0;
 
+  chain.setSeries(series);
+
   //Change inputs into the proper sign convention:
   fc     = -1.0 * fabs(fc);
   epsshu = -1.0 * fabs(epsshu);
   epscru = 1.0 * fabs(epscru);
 }
 
-TDConcreteEXP::TDConcreteEXP(void) : UniaxialMaterial(0, MAT_TAG_TDConcreteEXP)
+TDConcreteEXP::TDConcreteEXP(void)
+    : UniaxialMaterial(0, MAT_TAG_TDConcreteEXP), tLast(0.0)
 {
 }
 
@@ -202,7 +214,7 @@ TDConcreteEXP::getCopy(void)
 {
   TDConcreteEXP *theCopy =
       new TDConcreteEXP(this->getTag(), fc, ft, Ec, beta, age, epsshu, epssha,
-                        tcr, epscru, sigCr, epscra, epscrd, tcast);
+                        tcr, epscru, sigCr, epscra, epscrd, tcast, series);
 
   return theCopy;
 }
@@ -232,14 +244,14 @@ TDConcreteEXP::setCreepStrain(double time, double stress)
   double creep;
   double runSum = 0.0;
 
-  DTIME_i[count] = ops_Dt;
-
-  for (int i = 1; i <= count; i++) {
-    PHI_i[i] = setPhi(time, TIME_i[i]);     //Determine PHI
-    runSum += PHI_i[i] * DSIG_i[i] / sigCr; //CONSTANT STRESS
+  if (series) {
+    runSum = chain.getCreep(time); //Internal variables of the fitted series
+  } else {
+    for (int i = 1; i <= count; i++)
+      runSum += setPhi(time, TIME_i[i]) * DSIG_i[i] / sigCr; //CONSTANT STRESS
   }
 
-  phi_i = PHI_i[count];
+  phi_i = (count > 0) ? setPhi(time, tLast) : 0.0; //Determine PHI
   creep = runSum;
   return creep;
 }
@@ -312,7 +324,7 @@ TDConcreteEXP::setTrialStrain(double trialStrain, double strainRate)
     // Calculate creep and mechanical strain,
     // assuming stress remains constant in a time step:
     if (ops_Creep == 1) {
-      if (fabs(t - TIME_i[count]) <= 0.0001) {
+      if (fabs(t - tLast) <= 0.0001) {
         //If t = t(i-1), use creep/shrinkage from last calculated time step
         eps_cr = epsP_cr;
         eps_sh = epsP_sh;
@@ -439,9 +451,21 @@ TDConcreteEXP::commitState(void)
   ecmaxP = ecmax;
   deptP  = dept;
 
-  dsig_i[count]     = sig - sigP;
-  DSIG_i[count + 1] = sig - sigP;
-  TIME_i[count + 1] = getCurrentTime();
+  tLast = getCurrentTime();
+  if (series) {
+    //Recursive creep: fold the increment into the internal variables
+    if (sig != sigP) {
+      double phi[CreepSeries::MaxPoints];
+      for (int j = 0; j < series->getNumPoints(); j++)
+        phi[j] = setPhi(tLast + series->getPoint(j), tLast);
+      chain.addIncrement(tLast, (sig - sigP) / sigCr, phi);
+    }
+  } else {
+    DSIG_i.resize(count + 2);
+    TIME_i.resize(count + 2);
+    DSIG_i[count + 1] = sig - sigP;
+    TIME_i[count + 1] = tLast;
+  }
 
   eP   = e;
   sigP = sig;
@@ -521,6 +545,12 @@ TDConcreteEXP::revertToStart(void)
   } else {
     count = 1;
   }
+  if ((int)TIME_i.size() < count + 1) {
+    DSIG_i.resize(count + 1);
+    TIME_i.resize(count + 1);
+  }
+  tLast = 0.0;
+  chain.reset();
 
   return 0;
 }
@@ -528,7 +558,7 @@ TDConcreteEXP::revertToStart(void)
 int
 TDConcreteEXP::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(11);
+  static thread_local Vector data(18);
   data(0)  = ft;
   data(1)  = Ec;
   data(2)  = beta;
@@ -543,11 +573,50 @@ TDConcreteEXP::sendSelf(int commitTag, Channel &theChannel)
   data(11) = fc;
   data(12) = tcast;
   data(13) = count;
+  data(14) = sigCr;
+  data(15) = series ? series->getNumTerms() : 0;
+  data(16) = series ? series->getTauMin() : 0.0;
+  data(17) = series ? series->getTauMax() : 0.0;
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteEXP::sendSelf() - failed to sendSelf\n";
     return -1;
   }
+
+  // Committed history, then the creep history: the internal variables
+  // of the creep series, or the stress increments of the summation
+  Vector state(16 + (series ? chain.getNumState() : 2*count));
+  int i = 0;
+  state(i++) = tLast;
+  state(i++) = t_load;
+  state(i++) = Et;
+  state(i++) = epsInit;
+  state(i++) = sigInit;
+  state(i++) = epsP_total;
+  state(i++) = epsP_m;
+  state(i++) = crackP_flag;
+  state(i++) = ecminP;
+  state(i++) = ecmaxP;
+  state(i++) = deptP;
+  state(i++) = epsP;
+  state(i++) = sigP;
+  state(i++) = eP;
+  state(i++) = epsP_cr;
+  state(i++) = epsP_sh;
+  if (series) {
+    chain.getState(&state(i));
+    i += chain.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      state(i++) = DSIG_i[j];
+      state(i++) = TIME_i[j];
+    }
+  }
+
+  if (theChannel.sendVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteEXP::sendSelf() - failed to send history\n";
+    return -1;
+  }
   return 0;
 }
 
@@ -556,7 +625,7 @@ TDConcreteEXP::recvSelf(int commitTag, Channel &theChannel,
                         FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(14);
+  static thread_local Vector data(18);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteEXP::recvSelf() - failed to recvSelf\n";
@@ -574,6 +643,49 @@ TDConcreteEXP::recvSelf(int commitTag, Channel &theChannel,
   epscra = data(8);
   epscrd = data(9);
   this->setTag(data(10));
+  fc     = data(11);
+  tcast  = data(12);
+  count  = (int)data(13);
+  sigCr  = data(14);
+  DSIG_i.resize(count + 1);
+  TIME_i.resize(count + 1);
+  series.reset();
+  if (data(15) > 0)
+    series = std::make_shared<CreepSeries>((int)data(15), data(16), data(17));
+  chain.setSeries(series);
+
+  Vector state(16 + (series ? chain.getNumState() : 2*count));
+  if (theChannel.recvVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteEXP::recvSelf() - failed to receive history\n";
+    return -1;
+  }
+
+  int i = 0;
+  tLast = state(i++);
+  t_load = state(i++);
+  Et = state(i++);
+  epsInit = state(i++);
+  sigInit = state(i++);
+  epsP_total = state(i++);
+  epsP_m = state(i++);
+  crackP_flag = (int)state(i++);
+  ecminP = state(i++);
+  ecmaxP = state(i++);
+  deptP = state(i++);
+  epsP = state(i++);
+  sigP = state(i++);
+  eP = state(i++);
+  epsP_cr = state(i++);
+  epsP_sh = state(i++);
+  if (series) {
+    chain.setState(&state(i));
+    i += chain.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      DSIG_i[j] = state(i++);
+      TIME_i[j] = state(i++);
+    }
+  }
 
   e   = eP;
   sig = sigP;
@@ -710,9 +822,9 @@ TDConcreteEXP::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int
 TDConcreteEXP::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(6); //Added by AMK
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
+  static thread_local Vector CreepStressStrainTangent(6); //Added by AMK
   // each subclass must implement its own stuff
 
   // added for sensitivity recorder. Quan 2009
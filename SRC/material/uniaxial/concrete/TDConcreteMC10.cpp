@@ -107,7 +107,7 @@ OPS_ADD_RUNTIME_VPV(OPS_TDConcreteMC10)
 
   numArgs = OPS_GetNumRemainingInputArgs();
   //ntosic
-  if (numArgs == 17) {
+  if (numArgs >= 17) {
     //TDConcreteMC10(int tag, double _fc, double _epsc0, double _fcu,
     //double _epscu, double _tcr, double _ft, double _Ets, double _Ec, double _age, double _epsshu)
     double dData[16];
@@ -126,12 +126,20 @@ OPS_ADD_RUNTIME_VPV(OPS_TDConcreteMC10)
       return 0;
     }
 
+    //Optional recursive creep: -creepSeries numTerms <tauMin tauMax>
+    std::shared_ptr<const CreepSeries> series;
+    if (OPS_GetCreepSeries(series) != 0) {
+      opserr << "WARNING: invalid uniaxialMaterial TDConcreteMC10 " << iData
+             << " options\n";
+      return 0;
+    }
+
     //Create a new materiadouble
     //ntosic
     theMaterial = new TDConcreteMC10(
         iData, dData[0], dData[1], dData[2], dData[3], dData[4], dData[5],
         dData[6], dData[7], dData[8], dData[9], dData[10], dData[11], dData[12],
-        dData[13], dData[14], dData[15]);
+        dData[13], dData[14], dData[15], series);
     if (theMaterial == 0) {
       opserr << "WARNING: could not create uniaxialMaterial of type "
                 "TDConcreteMC10 \n";
@@ -150,11 +158,12 @@ TDConcreteMC10::TDConcreteMC10(int tag, double _fc, double _ft, double _Ec,
                                double _epsba, double _epsbb, double _epsda,
                                double _epsdb, double _phiba, double _phibb,
                                double _phida, double _phidb, double _tcast,
-                               double _cem)
+                               double _cem,
+                               std::shared_ptr<const CreepSeries> _series)
     : UniaxialMaterial(tag, MAT_TAG_TDConcreteMC10), fc(_fc), ft(_ft), Ec(_Ec),
       Ecm(_Ecm), beta(_beta), age(_age), epsba(_epsba), epsbb(_epsbb),
       epsda(_epsda), epsdb(_epsdb), phiba(_phiba), phibb(_phibb), phida(_phida),
-      phidb(_phidb), tcast(_tcast), cem(_cem)
+      phidb(_phidb), tcast(_tcast), cem(_cem), tLast(0.0), series(_series)
 {
   ecminP = 0.0;
   ecmaxP = 0.0; //ntosic
@@ -188,6 +197,9 @@ TDConcreteMC10::TDConcreteMC10(int tag, double _fc, double _ft, double _Ec,
   crack_flag = 0;
   iter       = 0;
 
+  chainBasic.setSeries(series);
+  chainDrying.setSeries(series);
+
   //Change inputs into the proper sign convention: ntosic: changed
   fc    = -1.0 * fabs(fc);
   epsba = -1.0 * fabs(epsba);
@@ -197,7 +209,7 @@ TDConcreteMC10::TDConcreteMC10(int tag, double _fc, double _ft, double _Ec,
 }
 
 TDConcreteMC10::TDConcreteMC10(void)
-    : UniaxialMaterial(0, MAT_TAG_TDConcreteMC10)
+    : UniaxialMaterial(0, MAT_TAG_TDConcreteMC10), tLast(0.0)
 {
 }
 
@@ -211,7 +223,7 @@ TDConcreteMC10::getCopy(void)
 {
   TDConcreteMC10 *theCopy = new TDConcreteMC10(
       this->getTag(), fc, ft, Ec, Ecm, beta, age, epsba, epsbb, epsda, epsdb,
-      phiba, phibb, phida, phidb, tcast, cem); //ntosic
+      phiba, phibb, phida, phidb, tcast, cem, series); //ntosic
 
   return theCopy;
 }
@@ -241,16 +253,17 @@ TDConcreteMC10::setCreepBasicStrain(double time, double stress)
   double creepBasic;
   double runSum = 0.0;
 
-  DTIME_i[count] = ops_Dt;
-
-  for (int i = 1; i <= count; i++) {
-    PHIB_i[i] = setPhiBasic(time, TIME_i[i]); //Determine PHI //ntosic: PHIB
-    runSum +=
-        PHIB_i[i] * DSIG_i[i] /
-        Ecm; //CONSTANT STRESS within Time interval //ntosic: changed to Ecm from Ec (according to Model Code formulation of phi basic)
+  if (series) {
+    runSum = chainBasic.getCreep(time); //Internal variables of the fitted series
+  } else {
+    for (int i = 1; i <= count; i++) {
+      runSum +=
+          setPhiBasic(time, TIME_i[i]) * DSIG_i[i] /
+          Ecm; //CONSTANT STRESS within Time interval //ntosic: changed to Ecm from Ec (according to Model Code formulation of phi basic)
+    }
   }
 
-  phib_i     = PHIB_i[count];
+  phib_i     = (count > 0) ? setPhiBasic(time, tLast) : 0.0; //Determine PHI //ntosic: PHIB
   creepBasic = runSum;
   return creepBasic;
 }
@@ -261,16 +274,17 @@ TDConcreteMC10::setCreepDryingStrain(double time, double stress)
   double creepDrying;
   double runSum = 0.0;
 
-  DTIME_i[count] = ops_Dt;
-
-  for (int i = 1; i <= count; i++) {
-    PHID_i[i] = setPhiDrying(time, TIME_i[i]); //Determine PHI //ntosic: PHID
-    runSum +=
-        PHID_i[i] * DSIG_i[i] /
-        Ecm; //CONSTANT STRESS within Time interval //ntosic: changed to Ecm from Ec (according to Model Code formulation of phi drying)
+  if (series) {
+    runSum = chainDrying.getCreep(time); //Internal variables of the fitted series
+  } else {
+    for (int i = 1; i <= count; i++) {
+      runSum +=
+          setPhiDrying(time, TIME_i[i]) * DSIG_i[i] /
+          Ecm; //CONSTANT STRESS within Time interval //ntosic: changed to Ecm from Ec (according to Model Code formulation of phi drying)
+    }
   }
 
-  phid_i      = PHID_i[count];
+  phid_i      = (count > 0) ? setPhiDrying(time, tLast) : 0.0; //Determine PHI //ntosic: PHID
   creepDrying = runSum;
   return creepDrying;
 }
@@ -366,7 +380,7 @@ TDConcreteMC10::setTrialStrain(double trialStrain, double strainRate)
 
     // Calculate creep and mechanical strain, assuming stress remains constant in a time step:
     if (ops_Creep == 1) {
-      if (fabs(t - TIME_i[count]) <=
+      if (fabs(t - tLast) <=
           0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
         eps_crb = epsP_crb;                                          //ntosic
         eps_crd = epsP_crd;                                          //ntosic
@@ -528,7 +542,6 @@ TDConcreteMC10::commitState(void)
   ecmaxP = ecmax;
   deptP  = dept;
 
-  dsig_i[count] = sig - sigP;
   /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
   //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
   //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
@@ -543,21 +556,25 @@ TDConcreteMC10::commitState(void)
   //} else { //concrete is uncracked, DSIG = sig - sigP
   //	DSIG_i[count+1] = sig-sigP;
   //}
-  DSIG_i[count + 1] = sig - sigP;
-
-  //Secant Stiffness for determination of creep strain:
-  if (fabs(eps_m / sig) > Ec) { //ntosic: originaly was eps_m/sig
-    E_i[count + 1] = Ec;
+  tLast = getCurrentTime();
+  if (series) {
+    //Recursive creep: fold the increment into the internal variables
+    if (sig != sigP) {
+      double phi[CreepSeries::MaxPoints];
+      for (int j = 0; j < series->getNumPoints(); j++)
+        phi[j] = setPhiBasic(tLast + series->getPoint(j), tLast);
+      chainBasic.addIncrement(tLast, (sig - sigP) / Ecm, phi);
+      for (int j = 0; j < series->getNumPoints(); j++)
+        phi[j] = setPhiDrying(tLast + series->getPoint(j), tLast);
+      chainDrying.addIncrement(tLast, (sig - sigP) / Ecm, phi);
+    }
   } else {
-    E_i[count + 1] = fabs(sig / eps_m); //ADDED 7/22
+    DSIG_i.resize(count + 2);
+    TIME_i.resize(count + 2);
+    DSIG_i[count + 1] = sig - sigP;
+    TIME_i[count + 1] = tLast;
   }
 
-  if (isnan(E_i[count + 1])) {
-    E_i[count + 1] = Ec;
-  }
-
-  TIME_i[count + 1] = getCurrentTime();
-
   eP   = e;
   sigP = sig;
   epsP = eps;
@@ -646,6 +663,13 @@ TDConcreteMC10::revertToStart(void)
   } else {
     count = 1;
   }
+  if ((int)TIME_i.size() < count + 1) {
+    DSIG_i.resize(count + 1);
+    TIME_i.resize(count + 1);
+  }
+  tLast = 0.0;
+  chainBasic.reset();
+  chainDrying.reset();
 
   return 0;
 }
@@ -653,7 +677,7 @@ TDConcreteMC10::revertToStart(void)
 int
 TDConcreteMC10::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(21); //ntosic
+  static thread_local Vector data(27); //ntosic
   data(0)  = ft;
   data(1)  = Ec;
   data(2)  = Ecm; //ntosic
@@ -678,11 +702,47 @@ TDConcreteMC10::sendSelf(int commitTag, Channel &theChannel)
   data(21) = fc;
   data(22) = count;
   data(23) = tcast;
+  data(24) = series ? series->getNumTerms() : 0;
+  data(25) = series ? series->getTauMin() : 0.0;
+  data(26) = series ? series->getTauMax() : 0.0;
   
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteMC10::sendSelf() - failed to sendSelf\n";
     return -1;
   }
+
+  // Committed history, then the creep history: the internal variables
+  // of the creep series, or the stress increments of the summation
+  Vector state(12 + (series ? chainBasic.getNumState() + chainDrying.getNumState() : 2*count));
+  int i = 0;
+  state(i++) = tLast;
+  state(i++) = t_load;
+  state(i++) = Et;
+  state(i++) = epsInit;
+  state(i++) = sigInit;
+  state(i++) = epsP_total;
+  state(i++) = epsP_m;
+  state(i++) = crackP_flag;
+  state(i++) = epsP_crb;
+  state(i++) = epsP_crd;
+  state(i++) = epsP_shb;
+  state(i++) = epsP_shd;
+  if (series) {
+    chainBasic.getState(&state(i));
+    i += chainBasic.getNumState();
+    chainDrying.getState(&state(i));
+    i += chainDrying.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      state(i++) = DSIG_i[j];
+      state(i++) = TIME_i[j];
+    }
+  }
+
+  if (theChannel.sendVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteMC10::sendSelf() - failed to send history\n";
+    return -1;
+  }
   return 0;
 }
 
@@ -691,7 +751,7 @@ TDConcreteMC10::recvSelf(int commitTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(24); //ntosic
+  static thread_local Vector data(27); //ntosic
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteMC10::recvSelf() - failed to recvSelf\n";
@@ -719,6 +779,47 @@ TDConcreteMC10::recvSelf(int commitTag, Channel &theChannel,
   sigP   = data(18); //ntosic
   eP     = data(19); //ntosic
   this->setTag(data(20));
+  fc     = data(21);
+  count  = (int)data(22);
+  tcast  = data(23);
+  DSIG_i.resize(count + 1);
+  TIME_i.resize(count + 1);
+  series.reset();
+  if (data(24) > 0)
+    series = std::make_shared<CreepSeries>((int)data(24), data(25), data(26));
+  chainBasic.setSeries(series);
+  chainDrying.setSeries(series);
+
+  Vector state(12 + (series ? chainBasic.getNumState() + chainDrying.getNumState() : 2*count));
+  if (theChannel.recvVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteMC10::recvSelf() - failed to receive history\n";
+    return -1;
+  }
+
+  int i = 0;
+  tLast = state(i++);
+  t_load = state(i++);
+  Et = state(i++);
+  epsInit = state(i++);
+  sigInit = state(i++);
+  epsP_total = state(i++);
+  epsP_m = state(i++);
+  crackP_flag = (int)state(i++);
+  epsP_crb = state(i++);
+  epsP_crd = state(i++);
+  epsP_shb = state(i++);
+  epsP_shd = state(i++);
+  if (series) {
+    chainBasic.setState(&state(i));
+    i += chainBasic.getNumState();
+    chainDrying.setState(&state(i));
+    i += chainDrying.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      DSIG_i[j] = state(i++);
+      TIME_i[j] = state(i++);
+    }
+  }
 
   e   = eP;
   sig = sigP;
@@ -885,9 +986,9 @@ TDConcreteMC10::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int
 TDConcreteMC10::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
+  static thread_local Vector CreepStressStrainTangent(
       8); //Added by AMK //ntosic: modified number
   // each subclass must implement its own stuff
 
@@ -61,11 +61,15 @@
 
 #include <UniaxialMaterial.h>
 #include <Domain.h> //Added by AMK
+#include <CreepSeries.h>
+#include <memory>
+#include <vector>
 
 class TDConcreteMC10 : public UniaxialMaterial //ntosic: changed name
 {
   public:
-    TDConcreteMC10(int tag, double _fc, double _ft, double _Ec, double _Ecm, double _beta, double _age, double _epsba, double _epsbb, double _epsda, double _epsdb, double _phiba, double _phibb, double _phida, double _phidb, double _tcast, double _cem);
+    TDConcreteMC10(int tag, double _fc, double _ft, double _Ec, double _Ecm, double _beta, double _age, double _epsba, double _epsbb, double _epsda, double _epsdb, double _phiba, double _phibb, double _phida, double _phidb, double _tcast, double _cem,
+                   std::shared_ptr<const CreepSeries> _series = nullptr);
 
     TDConcreteMC10(void);
 
@@ -188,15 +192,16 @@ class TDConcreteMC10 : public UniaxialMaterial //ntosic: changed name
 	int crack_flag;
 	int crackP_flag;
     int iter; //Iteration number
+    double tLast; //Time of the last committed step
     
-    float PHIB_i[5000]; //ntosic: split into basic and drying creep
-	float PHID_i[5000]; //ntosic: split into basic and drying creep
-    float E_i[5000];
-    float DSIG_i[5000];
-    float dsig_i[5000];
-    float TIME_i[5000]; //Time from the previous time step
-    float DTIME_i[5000];
-    float kappa[5000];
+    // Stress history for the summation of creep strains
+    std::vector<float> DSIG_i;
+    std::vector<float> TIME_i;
+
+    // Optional recursive creep with a fixed number of internal variables
+    std::shared_ptr<const CreepSeries> series;
+    CreepChain chainBasic;
+    CreepChain chainDrying;
 };
 
 
@@ -107,7 +107,7 @@
 		
 			numArgs = OPS_GetNumRemainingInputArgs();
 		
-			if (numArgs == 15) {
+			if (numArgs >= 15) {
 				//TDConcreteNL(int tag, double _fc, double _epsc0, double _fcu,
 				//double _epscu, double _tcr, double _ft, double _Ets, double _Ec, double _age, double _epsshu)
 				double dData[14];
@@ -125,9 +125,16 @@
 					opserr << "WARNING: invalid material property definition\n";
 					return 0;
 				}
+
+				//Optional recursive creep: -creepSeries numTerms <tauMin tauMax>
+				std::shared_ptr<const CreepSeries> series;
+				if (OPS_GetCreepSeries(series) != 0) {
+					opserr << "WARNING: invalid uniaxialMaterial TDConcreteNL " << iData << " options\n";
+					return 0;
+				}
 			
 				//Create a new materiadouble
-				theMaterial = new TDConcreteNL(iData,dData[0],dData[1],dData[2],dData[3],dData[4],dData[5],dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13]);
+				theMaterial = new TDConcreteNL(iData,dData[0],dData[1],dData[2],dData[3],dData[4],dData[5],dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13],series);
                 if (theMaterial == 0) {
 					opserr << "WARNING: could not create uniaxialMaterial of type TDConcreteNL \n";
 					return 0;
@@ -143,9 +150,10 @@
 //-----------------------------------------------------------------------
 
 
-TDConcreteNL::TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast): 
+TDConcreteNL::TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast, std::shared_ptr<const CreepSeries> _series): 
   UniaxialMaterial(tag, MAT_TAG_TDConcreteNL),
-  fc(_fc), fcu(_fcu), epscu(_epscu), ft(_ft), Ec(_Ec), beta(_beta), age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast)
+  fc(_fc), fcu(_fcu), epscu(_epscu), ft(_ft), Ec(_Ec), beta(_beta), age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast),
+  tLast(0.0), series(_series)
 {
   ecminP = 0.0;
   ecmaxP = 0.0;
@@ -176,7 +184,7 @@ TDConcreteNL::TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, doub
 	crack_flag = 0;
     iter = 0;
 	
-	
+	chain.setSeries(series);
 	
 	//Change inputs into the proper sign convention:
 		fc = -fabs(fc); 
@@ -185,7 +193,7 @@ TDConcreteNL::TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, doub
 }
 
 TDConcreteNL::TDConcreteNL(void):
-  UniaxialMaterial(0, MAT_TAG_TDConcreteNL)
+  UniaxialMaterial(0, MAT_TAG_TDConcreteNL), tLast(0.0)
 {
  
 }
@@ -198,7 +206,7 @@ TDConcreteNL::~TDConcreteNL(void)
 UniaxialMaterial*
 TDConcreteNL::getCopy(void)
 {
-  TDConcreteNL *theCopy = new TDConcreteNL(this->getTag(), fc, fcu, epscu, ft, Ec, beta, age, epsshu, epssha, tcr, epscru, epscra, epscrd, tcast); 
+  TDConcreteNL *theCopy = new TDConcreteNL(this->getTag(), fc, fcu, epscu, ft, Ec, beta, age, epsshu, epssha, tcr, epscru, epscra, epscrd, tcast, series); 
   
   return theCopy;
 }
@@ -228,14 +236,15 @@ TDConcreteNL::setCreepStrain(double time, double stress)
     double creep;
     double runSum = 0.0;
     
-    DTIME_i[count] = ops_Dt;
-    
-    for (int i = 1; i<=count; i++) {
-                PHI_i[i] = setPhi(time,TIME_i[i]); //Determine PHI
-                runSum += PHI_i[i]*DSIG_i[i]/Ec; //CONSTANT STRESS within Time interval
+    if (series) {
+        runSum = chain.getCreep(time); //Internal variables of the fitted creep series
+    } else {
+        for (int i = 1; i<=count; i++) {
+                runSum += setPhi(time,TIME_i[i])*DSIG_i[i]/Ec; //CONSTANT STRESS within Time interval
+        }
     }
     
-    phi_i = PHI_i[count];
+    phi_i = (count > 0) ? setPhi(time,tLast) : 0.0; //Determine PHI
     creep = runSum;
     return creep;
     
@@ -304,7 +313,7 @@ TDConcreteNL::setTrialStrain(double trialStrain, double strainRate)
 
     	// Calculate creep and mechanical strain, assuming stress remains constant in a time step:
     	if (ops_Creep == 1) {
-        	if (fabs(t-TIME_i[count]) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
+        	if (fabs(t-tLast) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
             	eps_cr = epsP_cr;
             	eps_sh = epsP_sh;
             	eps_m = eps_total - eps_cr - eps_sh;
@@ -440,7 +449,6 @@ TDConcreteNL::commitState(void)
   ecmaxP = ecmax;
   deptP = dept;
   
-  dsig_i[count]=sig-sigP;
   /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
   //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
   //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
@@ -455,21 +463,21 @@ TDConcreteNL::commitState(void)
   //} else { //concrete is uncracked, DSIG = sig - sigP
   //	DSIG_i[count+1] = sig-sigP;
   //}
-  DSIG_i[count+1] = sig-sigP;
-  
-  //Secant Stiffness for determination of creep strain:
-      if (fabs(eps_m/sig)>Ec) {
-          E_i[count+1] = Ec;
-      } else {
-          E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
+  tLast = getCurrentTime();
+  if (series) {
+      //Recursive creep: fold the increment into the internal variables
+      if (sig != sigP) {
+          double phi[CreepSeries::MaxPoints];
+          for (int j = 0; j < series->getNumPoints(); j++)
+              phi[j] = setPhi(tLast+series->getPoint(j),tLast);
+          chain.addIncrement(tLast,(sig-sigP)/Ec,phi);
       }
-  
-      if (isnan(E_i[count+1])) {
-          E_i[count+1] = Ec;
-      }
-  
-  
-  TIME_i[count+1] = getCurrentTime();
+  } else {
+      DSIG_i.resize(count+2);
+      TIME_i.resize(count+2);
+      DSIG_i[count+1] = sig-sigP;
+      TIME_i[count+1] = tLast;
+  }
     
   eP = e;
   sigP = sig;
@@ -554,6 +562,12 @@ TDConcreteNL::revertToStart(void)
 	} else {
 		count = 1;
 	}
+	if ((int)TIME_i.size() < count+1) {
+		DSIG_i.resize(count+1);
+		TIME_i.resize(count+1);
+	}
+	tLast = 0.0;
+	chain.reset();
 	
   return 0;
 }
@@ -561,7 +575,7 @@ TDConcreteNL::revertToStart(void)
 int 
 TDConcreteNL::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(16);
+  static thread_local Vector data(19);
   data(0) =ft;    
   data(1) =Ec; 
   data(2) =beta;   
@@ -578,11 +592,49 @@ TDConcreteNL::sendSelf(int commitTag, Channel &theChannel)
   data(13) = fcu;
   data(14) = epscu;
   data(15) = tcast;
+  data(16) = series ? series->getNumTerms() : 0;
+  data(17) = series ? series->getTauMin() : 0.0;
+  data(18) = series ? series->getTauMax() : 0.0;
   
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteNL::sendSelf() - failed to sendSelf\n";
     return -1;
   }
+
+  // Committed history, then the creep history: the internal variables
+  // of the creep series, or the stress increments of the summation
+  Vector state(16 + (series ? chain.getNumState() : 2*count));
+  int i = 0;
+  state(i++) = tLast;
+  state(i++) = t_load;
+  state(i++) = Et;
+  state(i++) = epsInit;
+  state(i++) = sigInit;
+  state(i++) = epsP_total;
+  state(i++) = epsP_m;
+  state(i++) = crackP_flag;
+  state(i++) = ecminP;
+  state(i++) = ecmaxP;
+  state(i++) = deptP;
+  state(i++) = epsP;
+  state(i++) = sigP;
+  state(i++) = eP;
+  state(i++) = epsP_cr;
+  state(i++) = epsP_sh;
+  if (series) {
+    chain.getState(&state(i));
+    i += chain.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      state(i++) = DSIG_i[j];
+      state(i++) = TIME_i[j];
+    }
+  }
+
+  if (theChannel.sendVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteNL::sendSelf() - failed to send history\n";
+    return -1;
+  }
   return 0;
 }
 
@@ -591,7 +643,7 @@ TDConcreteNL::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(16);
+  static thread_local Vector data(19);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteNL::recvSelf() - failed to recvSelf\n";
@@ -614,6 +666,45 @@ TDConcreteNL::recvSelf(int commitTag, Channel &theChannel,
   fcu = data(13);
   epscu = data(14);
   tcast = data(15);
+  DSIG_i.resize(count+1);
+  TIME_i.resize(count+1);
+  series.reset();
+  if (data(16) > 0)
+    series = std::make_shared<CreepSeries>((int)data(16), data(17), data(18));
+  chain.setSeries(series);
+
+  Vector state(16 + (series ? chain.getNumState() : 2*count));
+  if (theChannel.recvVector(this->getDbTag(), commitTag, state) < 0) {
+    opserr << "TDConcreteNL::recvSelf() - failed to receive history\n";
+    return -1;
+  }
+
+  int i = 0;
+  tLast = state(i++);
+  t_load = state(i++);
+  Et = state(i++);
+  epsInit = state(i++);
+  sigInit = state(i++);
+  epsP_total = state(i++);
+  epsP_m = state(i++);
+  crackP_flag = (int)state(i++);
+  ecminP = state(i++);
+  ecmaxP = state(i++);
+  deptP = state(i++);
+  epsP = state(i++);
+  sigP = state(i++);
+  eP = state(i++);
+  epsP_cr = state(i++);
+  epsP_sh = state(i++);
+  if (series) {
+    chain.setState(&state(i));
+    i += chain.getNumState();
+  } else {
+    for (int j = 1; j <= count; j++) {
+      DSIG_i[j] = state(i++);
+      TIME_i[j] = state(i++);
+    }
+  }
   
   e = eP;
   sig = sigP;
@@ -821,9 +912,9 @@ TDConcreteNL::setResponse(const char **argv, int argc,
 int 
 TDConcreteNL::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector stressStrainTangent(3);
-	static Vector CreepStressStrainTangent(6); //Added by AMK
+	static thread_local Vector stressStrain(2);
+	static thread_local Vector stressStrainTangent(3);
+	static thread_local Vector CreepStressStrainTangent(6); //Added by AMK
 	// each subclass must implement its own stuff   
 	
 	// added for sensitivity recorder. Quan 2009
@@ -62,11 +62,15 @@
 
 #include <UniaxialMaterial.h>
 #include <Domain.h> //Added by AMK
+#include <CreepSeries.h>
+#include <memory>
+#include <vector>
 
 class TDConcreteNL : public UniaxialMaterial
 {
   public:
-  TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast);
+  TDConcreteNL(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast,
+               std::shared_ptr<const CreepSeries> _series = nullptr);
 
     TDConcreteNL(void);
 
@@ -173,13 +177,15 @@ class TDConcreteNL : public UniaxialMaterial
 	int crack_flag;
 	int crackP_flag;
     int iter; //Iteration number
+    double tLast; //Time of the last committed step
     
-    float PHI_i[5000];
-    float E_i[5000];
-    float DSIG_i[5000];
-    float dsig_i[5000];
-    float TIME_i[5000]; //Time from the previous time step
-    float DTIME_i[5000];
+    // Stress history for the summation of creep strains
+    std::vector<float> DSIG_i;
+    std::vector<float> TIME_i;
+
+    // Optional recursive creep with a fixed number of internal variables
+    std::shared_ptr<const CreepSeries> series;
+    CreepChain chain;
 };
 
 
@@ -246,7 +246,7 @@ DegradingUniaxialWrapper::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -260,7 +260,7 @@ DegradingUniaxialWrapper::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(3);
+  static thread_local Vector dataVec(3);
   // dataVec(0) = minStrain;
   // dataVec(1) = maxStrain;
   dataVec(2) = 0.0;
@@ -286,7 +286,7 @@ DegradingUniaxialWrapper::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  static thread_local ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << WRAPPER_CMD "::recvSelf() - failed to get the ID\n";
     return -1;
@@ -305,7 +305,7 @@ DegradingUniaxialWrapper::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(3);
+  static thread_local Vector dataVec(3);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr
         << WRAPPER_CMD "::recvSelf() - failed to get the Vector\n";
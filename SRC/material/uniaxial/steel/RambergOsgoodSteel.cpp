@@ -362,7 +362,7 @@ RambergOsgoodSteel::revertToStart(void)
 int
 RambergOsgoodSteel::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(15);
+  static thread_local Vector data(15);
   data(0) = Fy;
   data(1) = E0;
   data(2) = epsminP;;
@@ -391,7 +391,7 @@ int
 RambergOsgoodSteel::recvSelf(int commitTag, Channel &theChannel,
              FEM_ObjectBroker &theBroker)
 {
-  static Vector data(15);
+  static thread_local Vector data(15);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "RambergOsgoodSteel::recvSelf() - failed to recvSelf\n";
@@ -738,7 +738,7 @@ UniaxialMaterial* StainlessECThermal::getCopy ()
 int StainlessECThermal::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(17);
+   static thread_local Vector data(17);
    data(0) = this->getTag();
 
    // Material properties
@@ -773,7 +773,7 @@ int StainlessECThermal::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   static thread_local Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
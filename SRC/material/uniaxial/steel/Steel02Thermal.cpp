@@ -606,7 +606,7 @@ Steel02Thermal::revertToStart(void)
 int 
 Steel02Thermal::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(23);
+  static thread_local Vector data(23);
   data(0) = Fy;
   data(1) = E0;
   data(2) = b;
@@ -642,7 +642,7 @@ int
 Steel02Thermal::recvSelf(int commitTag, Channel &theChannel, 
 	     FEM_ObjectBroker &theBroker)
 {
-  static Vector data(23);
+  static thread_local Vector data(23);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02Thermal::recvSelf() - failed to recvSelf\n";
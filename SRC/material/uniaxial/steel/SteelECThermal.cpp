@@ -610,7 +610,7 @@ UniaxialMaterial* SteelECThermal::getCopy ()
 int SteelECThermal::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(16);
+   static thread_local Vector data(16);
    data(0) = this->getTag();
 
    // Material properties
@@ -648,7 +648,7 @@ int SteelECThermal::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   static thread_local Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
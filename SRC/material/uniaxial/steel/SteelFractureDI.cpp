@@ -655,7 +655,7 @@ SteelFractureDI::revertToStart(void)
 int
 SteelFractureDI::sendSelf(int commitTag, Channel &theChannel)
 {
-	static Vector data(39);
+	static thread_local Vector data(39);
 
 	data(0) = this->getTag();
 
@@ -717,7 +717,7 @@ int
 SteelFractureDI::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
-	static Vector data(39);
+	static thread_local Vector data(39);
 
 	// opserr << "recvSelf SteelFractureDI started\n";
 
@@ -906,8 +906,8 @@ SteelFractureDI::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int
 SteelFractureDI::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector cyclesAndRange(6);
+	static thread_local Vector stressStrain(2);
+	static thread_local Vector cyclesAndRange(6);
 
 	// each subclass must implement its own stuff    
 	switch (responseID) {
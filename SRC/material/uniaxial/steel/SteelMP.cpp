@@ -445,7 +445,7 @@ UniaxialMaterial* SteelMP::getCopy ()
 int SteelMP::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(20);
+   static thread_local Vector data(20);
    data(0) = this->getTag();
 
    // Material properties
@@ -488,7 +488,7 @@ int SteelMP::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(20);
+   static thread_local Vector data(20);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
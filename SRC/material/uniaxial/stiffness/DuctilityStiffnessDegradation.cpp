@@ -171,7 +171,7 @@ DuctilityStiffnessDegradation::getCopy(void)
 int
 DuctilityStiffnessDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   
   data(0) = this->getTag();
   data(1) = alpha;
@@ -191,7 +191,7 @@ int
 DuctilityStiffnessDegradation::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -173,7 +173,7 @@ ACIStrengthDegradation::getCopy(void)
 int
 ACIStrengthDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   data(0) = this->getTag();
   data(1) = oneOverKy;
@@ -194,7 +194,7 @@ int
 ACIStrengthDegradation::recvSelf(int commitTag, Channel &theChannel, 
 				 FEM_ObjectBroker &theBroker)
 {
-  static Vector data(6);
+  static thread_local Vector data(6);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -162,7 +162,7 @@ PetrangeliStrengthDegradation::getCopy(void)
 int
 PetrangeliStrengthDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   
   data(0) = this->getTag();
   data(1) = e1;
@@ -182,7 +182,7 @@ int
 PetrangeliStrengthDegradation::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
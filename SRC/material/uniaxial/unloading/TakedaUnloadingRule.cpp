@@ -167,7 +167,7 @@ TakedaUnloadingRule::getCopy(void)
 int
 TakedaUnloadingRule::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   
   data(0) = this->getTag();
   data(1) = C;
@@ -187,7 +187,7 @@ int
 TakedaUnloadingRule::recvSelf(int commitTag, Channel &theChannel, 
 			      FEM_ObjectBroker &theBroker)
 {
-  static Vector data(5);
+  static thread_local Vector data(5);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -79,7 +79,7 @@ OPS_ADD_RUNTIME_VPV(OPS_CreepMaterial)
   
   numArgs = OPS_GetNumRemainingInputArgs();
   
-  if (numArgs == 15) {
+  if (numArgs >= 15) {
     //CreepMaterial(int tag, double _fc, double _epsc0, double _fcu,
     //double _epscu, double _tcr, double _ft, double _Ets, double _Ec, double _age, double _epsshu)
     double dData[14];
@@ -97,9 +97,16 @@ OPS_ADD_RUNTIME_VPV(OPS_CreepMaterial)
       opserr << "WARNING: invalid material property definition\n";
       return 0;
     }
+
+    //Optional recursive creep: -creepSeries numTerms <tauMin tauMax>
+    std::shared_ptr<const CreepSeries> series;
+    if (OPS_GetCreepSeries(series) != 0) {
+      opserr << "WARNING: invalid uniaxialMaterial CreepMaterial " << iData << " options\n";
+      return 0;
+    }
     
     //Create a new materiadouble
-    theMaterial = new CreepMaterial(iData,dData[0],dData[1],dData[2],dData[3],dData[4],dData[5],dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13]);
+    theMaterial = new CreepMaterial(iData,dData[0],dData[1],dData[2],dData[3],dData[4],dData[5],dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13],series);
     if (theMaterial == 0) {
       opserr << "WARNING: could not create uniaxialMaterial of type CreepMaterial \n";
       return 0;
@@ -108,7 +115,7 @@ OPS_ADD_RUNTIME_VPV(OPS_CreepMaterial)
     //Return new material:
     return theMaterial;
   }
-  if (numArgs == 10) {
+  if (numArgs >= 10) {
     //CreepMaterial(int tag, double _fc, double _epsc0, double _fcu,
     //double _epscu, double _tcr, double _ft, double _Ets, double _Ec, double _age, double _epsshu)
     double dData[14];
@@ -138,9 +145,16 @@ OPS_ADD_RUNTIME_VPV(OPS_CreepMaterial)
       opserr << "WARNING: invalid material property definition\n";
       return 0;
     }
+
+    //Optional recursive creep: -creepSeries numTerms <tauMin tauMax>
+    std::shared_ptr<const CreepSeries> series;
+    if (OPS_GetCreepSeries(series) != 0) {
+      opserr << "WARNING: invalid uniaxialMaterial CreepMaterial " << iData << " options\n";
+      return 0;
+    }
     
     //Create a new materiadouble
-    theMaterial = new CreepMaterial(iData,*matl,dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13]);
+    theMaterial = new CreepMaterial(iData,*matl,dData[6],dData[7],dData[8],dData[9],dData[10],dData[11],dData[12],dData[13],series);
     if (theMaterial == 0) {
       opserr << "WARNING: could not create uniaxialMaterial of type CreepMaterial \n";
       return 0;
@@ -156,10 +170,10 @@ OPS_ADD_RUNTIME_VPV(OPS_CreepMaterial)
 //-----------------------------------------------------------------------
 
 
-CreepMaterial::CreepMaterial(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast): 
+CreepMaterial::CreepMaterial(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast, std::shared_ptr<const CreepSeries> _series): 
   UniaxialMaterial(tag, MAT_TAG_CreepMaterial), wrappedMaterial(0),
-  fc(_fc), fcu(_fcu), epscu(_epscu), ft(_ft), Ec(_Ec), beta(_beta), age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast), maxSize(startSize),
-  PHI_i(0), E_i(0), DSIG_i(0), TIME_i(0), DTIME_i(0)
+  fc(_fc), fcu(_fcu), epscu(_epscu), ft(_ft), Ec(_Ec), beta(_beta), age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast),
+  tLast(0.0), series(_series)
 {
   wrappedMaterial = new Concrete02IS(0,Ec,fc,2*fc/Ec,fcu,epscu);
   //wrappedMaterial = new ElasticMaterial(0,Ec);
@@ -200,68 +214,13 @@ CreepMaterial::CreepMaterial(int tag, double _fc, double _fcu, double _epscu, do
   epsshu = -fabs(epsshu);
   epscru = fabs(epscru);
 
-  this->expandArrays();
-}
-
-void
-CreepMaterial::expandArrays()
-{
-  if (PHI_i == 0)
-    PHI_i = new float[maxSize];
-
-  if (E_i == 0)
-    E_i = new float[maxSize];
-
-  if (DSIG_i == 0)
-    DSIG_i = new float[maxSize];
-
-  if (TIME_i == 0)
-    TIME_i = new float[maxSize];
-
-  if (DTIME_i == 0)
-    DTIME_i = new float[maxSize];
-
-  if (count+1 >= maxSize) {
-    maxSize += growSize;
-
-    float *a = new float[maxSize];
-    float *b = new float[maxSize];
-    float *c = new float[maxSize];
-    float *e = new float[maxSize];
-    float *f = new float[maxSize];
-
-    for (int i = 0; i <= count; i++) {
-      a[i] = PHI_i[i];
-      b[i] = E_i[i];
-      c[i] = DSIG_i[i];
-      e[i] = TIME_i[i];
-      f[i] = DTIME_i[i];
-    }
-
-    if (PHI_i != 0)
-      delete [] PHI_i;
-    if (E_i != 0)
-      delete [] E_i;
-    if (DSIG_i != 0)
-      delete [] DSIG_i;
-    if (TIME_i != 0)
-      delete [] TIME_i;
-    if (DTIME_i != 0)
-      delete [] DTIME_i;
-
-    PHI_i = a;
-    E_i = b;
-    DSIG_i = c;
-    TIME_i = e;
-    DTIME_i = f;    
-  }
-  
+  chain.setSeries(series);
 }
 
-CreepMaterial::CreepMaterial(int tag, UniaxialMaterial &matl, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast): 
+CreepMaterial::CreepMaterial(int tag, UniaxialMaterial &matl, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast, std::shared_ptr<const CreepSeries> _series): 
   UniaxialMaterial(tag, MAT_TAG_CreepMaterial), wrappedMaterial(0),
-  age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast), maxSize(startSize),
-  PHI_i(0), E_i(0), DSIG_i(0), TIME_i(0), DTIME_i(0)  
+  age(_age), epsshu(_epsshu), epssha(_epssha), tcr(_tcr), epscru(_epscru), epscra(_epscra), epscrd(_epscrd), tcast(_tcast),
+  tLast(0.0), series(_series)
 {
   wrappedMaterial = matl.getCopy();
   if (wrappedMaterial == 0) {
@@ -304,12 +263,11 @@ CreepMaterial::CreepMaterial(int tag, UniaxialMaterial &matl, double _age, doubl
   epsshu = -fabs(epsshu);
   epscru = fabs(epscru);
 
-  this->expandArrays();  
+  chain.setSeries(series);
 }
 
 CreepMaterial::CreepMaterial(void):
-  UniaxialMaterial(0, MAT_TAG_CreepMaterial), wrappedMaterial(0), maxSize(startSize),
-  PHI_i(0), E_i(0), DSIG_i(0), TIME_i(0), DTIME_i(0)
+  UniaxialMaterial(0, MAT_TAG_CreepMaterial), wrappedMaterial(0), tLast(0.0)
 {
  
 }
@@ -318,26 +276,18 @@ CreepMaterial::~CreepMaterial(void)
 {
   if (wrappedMaterial != 0)
     delete wrappedMaterial;
-
-  if (PHI_i != 0)
-    delete [] PHI_i;
-  if (E_i != 0)
-    delete [] E_i;
-  if (DSIG_i != 0)
-    delete [] DSIG_i;
-  if (TIME_i != 0)
-    delete [] TIME_i;
-  if (DTIME_i != 0)
-    delete [] DTIME_i;
 }
 
 UniaxialMaterial*
 CreepMaterial::getCopy(void)
 {
-  CreepMaterial *theCopy = new CreepMaterial(this->getTag(), *wrappedMaterial, age, epsshu, epssha, tcr, epscru, epscra, epscrd, tcast); 
+  CreepMaterial *theCopy = new CreepMaterial(this->getTag(), *wrappedMaterial, age, epsshu, epssha, tcr, epscru, epscra, epscrd, tcast, series); 
 
-  theCopy->maxSize = maxSize;
   theCopy->count = count;
+  theCopy->DSIG_i = DSIG_i;
+  theCopy->TIME_i = TIME_i;
+  theCopy->tLast = tLast;
+  theCopy->chain = chain;
   
   return theCopy;
 }
@@ -367,14 +317,15 @@ CreepMaterial::setCreepStrain(double time, double stress)
   double creep;
   double runSum = 0.0;
   
-  DTIME_i[count] = ops_Dt;
-  
-  for (int i = 1; i<=count; i++) {
-    PHI_i[i] = setPhi(time,TIME_i[i]); //Determine PHI
-    runSum += PHI_i[i]*DSIG_i[i]/Ec; //CONSTANT STRESS within Time interval
+  if (series) {
+    runSum = chain.getCreep(time); //Internal variables of the fitted creep series
+  } else {
+    for (int i = 1; i<=count; i++) {
+      runSum += setPhi(time,TIME_i[i])*DSIG_i[i]/Ec; //CONSTANT STRESS within Time interval
+    }
   }
   
-  phi_i = PHI_i[count];
+  phi_i = (count > 0) ? setPhi(time,tLast) : 0.0; //Determine PHI
   creep = runSum;
   return creep;
 }
@@ -431,7 +382,7 @@ CreepMaterial::setTrialStrain(double trialStrain, double strainRate)
     
     // Calculate creep and mechanical strain, assuming stress remains constant in a time step:
     if (ops_Creep == 1) {
-      if (fabs(t-TIME_i[count]) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
+      if (fabs(t-tLast) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
 	eps_cr = epsP_cr;
 	eps_sh = epsP_sh;
 	eps_m = eps_total - eps_cr - eps_sh;
@@ -514,9 +465,6 @@ CreepMaterial::commitState(void)
   ecminP = ecmin;
   ecmaxP = ecmax;
   deptP = dept;
-
-  // Make sure enough room to write into count+1 -- MHS
-  this->expandArrays();
     
   //dsig_i[count]=sig-sigP; // Unused -- MHS
   /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
@@ -534,22 +482,23 @@ CreepMaterial::commitState(void)
   //	DSIG_i[count+1] = sig-sigP;
   //}
 
-  DSIG_i[count+1] = sig-sigP;
-  
-  //Secant Stiffness for determination of creep strain:
-  if (fabs(eps_m/sig)>Ec) {
-    E_i[count+1] = Ec;
+  tLast = getCurrentTime();
+  if (series) {
+    //Recursive creep: fold the increment into the internal variables
+    if (sig != sigP) {
+      double phi[CreepSeries::MaxPoints];
+      for (int j = 0; j < series->getNumPoints(); j++)
+	phi[j] = setPhi(tLast+series->getPoint(j),tLast);
+      chain.addIncrement(tLast,(sig-sigP)/Ec,phi);
+    }
   } else {
-    E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
-  }
-  
-  if (isnan(E_i[count+1])) {
-    E_i[count+1] = Ec;
+    // Grow the history to hold count+1 -- MHS
+    DSIG_i.resize(count+2);
+    TIME_i.resize(count+2);
+    DSIG_i[count+1] = sig-sigP;
+    TIME_i[count+1] = tLast;
   }
   
-  
-  TIME_i[count+1] = getCurrentTime();
-  
   eP = e;
   sigP = sig;
   epsP = eps;
@@ -640,6 +589,12 @@ CreepMaterial::revertToStart(void)
   } else {
     count = 1;
   }
+  if ((int)TIME_i.size() < count+1) {
+    DSIG_i.resize(count+1);
+    TIME_i.resize(count+1);
+  }
+  tLast = 0.0;
+  chain.reset();
 
   wrappedMaterial->revertToStart();
   
@@ -653,7 +608,7 @@ CreepMaterial::sendSelf(int commitTag, Channel &theChannel)
 
   int dbTag = this->getDbTag();
 
-  static ID classTags(4);
+  static thread_local ID classTags(5);
 
   classTags(0) = wrappedMaterial->getClassTag();
 
@@ -665,7 +620,9 @@ CreepMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
   classTags(1) = matDbTag;
   classTags(2) = this->getTag();
-  classTags(3) = maxSize;
+  const int numHistory = (int)TIME_i.size();
+  classTags(3) = numHistory;
+  classTags(4) = series ? series->getNumTerms() : 0;
   
   res = theChannel.sendID(dbTag, commitTag, classTags);
   if (res < 0) {
@@ -673,7 +630,8 @@ CreepMaterial::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  Vector data(16 + 6 + 21 + maxSize*5);
+  const int numState = chain.getNumState();
+  Vector data(16 + 6 + 21 + 3 + numHistory*2 + numState);
   data(0) = fc;    
   data(1) = epsc0; 
   data(2) = fcu;   
@@ -719,14 +677,16 @@ CreepMaterial::sendSelf(int commitTag, Channel &theChannel)
   data(40) = crack_flag;
   data(41) = crackP_flag;
   data(42) = iter;
+  data(43) = tLast;
+  data(44) = series ? series->getTauMin() : 0.0;
+  data(45) = series ? series->getTauMax() : 0.0;
   
-  for (int i = 0; i < maxSize; i++) {
-    data(43             + i) = PHI_i[i];
-    data(43 +   maxSize + i) = E_i[i];
-    data(43 + 2*maxSize + i) = DSIG_i[i];
-    data(43 + 3*maxSize + i) = TIME_i[i];
-    data(43 + 4*maxSize + i) = DTIME_i[i];            
+  for (int i = 0; i < numHistory; i++) {
+    data(46              + i) = DSIG_i[i];
+    data(46 + numHistory + i) = TIME_i[i];
   }
+  if (numState > 0)
+    chain.getState(&data(46 + 2*numHistory));
   
   res = theChannel.sendVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -749,7 +709,7 @@ CreepMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID idata(4);
+  static thread_local ID idata(5);
   int dbTag = this->getDbTag();
 
   res = theChannel.recvID(dbTag, commitTag, idata);
@@ -759,8 +719,10 @@ CreepMaterial::recvSelf(int commitTag, Channel &theChannel,
   }
 
   this->setTag(idata(2));  
-  maxSize = idata(3);
-  Vector data(16 + 6 + 21 + maxSize*5);
+  const int numHistory = idata(3);
+  const int numTerms = idata(4);
+  const int numState = (numTerms > 0) ? 1 + 2*numTerms : 0;
+  Vector data(16 + 6 + 21 + 3 + numHistory*2 + numState);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "CreepMaterial::recvSelf() - failed to recvSelf\n";
@@ -812,26 +774,22 @@ CreepMaterial::recvSelf(int commitTag, Channel &theChannel,
   crack_flag = data(40);
   crackP_flag = data(41);
   iter = data(42);
+  tLast = data(43);
 
-  if (PHI_i != 0) delete [] PHI_i;
-  PHI_i = new float [maxSize];
-  if (E_i != 0) delete [] E_i;
-  E_i = new float [maxSize];
-  if (DSIG_i != 0) delete [] DSIG_i;
-  DSIG_i = new float [maxSize];
-  if (TIME_i != 0) delete [] TIME_i;
-  TIME_i = new float [maxSize];
-  if (DTIME_i != 0) delete [] DTIME_i;
-  DTIME_i = new float [maxSize];  
-  
-  for (int i = 0; i < maxSize; i++) {
-    PHI_i[i]   = data(43             + i);
-    E_i[i]     = data(43 +   maxSize + i);
-    DSIG_i[i]  = data(43 + 2*maxSize + i);
-    TIME_i[i]  = data(43 + 3*maxSize + i);
-    DTIME_i[i] = data(43 + 4*maxSize + i);
+  DSIG_i.resize(numHistory);
+  TIME_i.resize(numHistory);
+  for (int i = 0; i < numHistory; i++) {
+    DSIG_i[i]  = data(46              + i);
+    TIME_i[i]  = data(46 + numHistory + i);
   }
 
+  series.reset();
+  if (numTerms > 0)
+    series = std::make_shared<CreepSeries>(numTerms, data(44), data(45));
+  chain.setSeries(series);
+  if (numState > 0)
+    chain.setState(&data(46 + 2*numHistory));
+
   e = eP;
   sig = sigP;
   eps = epsP;
@@ -969,9 +927,9 @@ CreepMaterial::setResponse(const char **argv, int argc,
 int 
 CreepMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(6); //Added by AMK
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
+  static thread_local Vector CreepStressStrainTangent(6); //Added by AMK
   // each subclass must implement its own stuff   
   
   // added for sensitivity recorder. Quan 2009
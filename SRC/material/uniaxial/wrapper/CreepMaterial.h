@@ -42,12 +42,17 @@
 
 #include <UniaxialMaterial.h>
 #include <Domain.h> //Added by AMK
+#include <CreepSeries.h>
+#include <memory>
+#include <vector>
 
 class CreepMaterial : public UniaxialMaterial
 {
 public:
-  CreepMaterial(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast);
-  CreepMaterial(int tag, UniaxialMaterial &matl, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast);
+  CreepMaterial(int tag, double _fc, double _fcu, double _epscu, double _ft, double _Ec, double _beta, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast,
+                std::shared_ptr<const CreepSeries> _series = nullptr);
+  CreepMaterial(int tag, UniaxialMaterial &matl, double _age, double _epsshu, double _epssha, double _tcr, double _epscru, double _epscra, double _epscrd, double _tcast,
+                std::shared_ptr<const CreepSeries> _series = nullptr);
   
   CreepMaterial(void);
   
@@ -152,17 +157,15 @@ private:
   int crack_flag;
   int crackP_flag;
   int iter; //Iteration number
+  double tLast; //Time of the last committed step
 
-  enum{startSize=500, growSize=200};
-  int maxSize;
-  
-  float *PHI_i;
-  float *E_i;
-  float *DSIG_i;
-  float *TIME_i;
-  float *DTIME_i;
+  // Stress history for the summation of creep strains
+  std::vector<float> DSIG_i;
+  std::vector<float> TIME_i;
 
-  void expandArrays();
+  // Optional recursive creep with a fixed number of internal variables
+  std::shared_ptr<const CreepSeries> series;
+  CreepChain chain;
 };
 
 
@@ -0,0 +1,64 @@
+#ifndef MPM_LOAD_BALANCER_H_
+#define MPM_LOAD_BALANCER_H_
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// MPI
+#ifdef USE_MPI
+#include "mpi.h"
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! Incremental load balancer
+//! \brief Diffusion-based rebalancing of cells between neighbouring ranks
+//! \details Each rank measures its load as the sum of the costs of its cells.
+//! If the largest load exceeds the mean by more than the allowed imbalance,
+//! every rank sends boundary cells to lighter neighbouring ranks, the amount
+//! being given by a first-order diffusion step on the graph of ranks. Only
+//! the moved cells are communicated, so the cells that keep their rank, and
+//! their particles, stay where they are.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class LoadBalancer {
+ public:
+  //! Constructor with the allowed imbalance
+  //! \param[in] imbalance Largest load / mean load - 1 allowed before cells
+  //! are moved
+  explicit LoadBalancer(double imbalance) : imbalance_{imbalance} {}
+
+  //! Measure the imbalance and move boundary cells if it is too large
+  //! \param[in] cells Cells of the mesh, identical on all ranks; any
+  //! container of pointers to cells with id(), rank(), rank(unsigned) and
+  //! neighbours(), such as mpm::Vector<Cell<Tdim>>
+  //! \param[in] cell_costs Cost of each cell of this rank, keyed by cell id
+  //! \param[in] comm MPI communicator
+  //! \retval exchange_cells Ids of the cells that changed rank, identical on
+  //! all ranks
+  template <typename Tcells, typename Tcosts>
+  std::vector<mpm::Index> rebalance(const Tcells& cells,
+                                    const Tcosts& cell_costs, MPI_Comm comm);
+
+  //! Imbalance measured by the last call to rebalance
+  double measured_imbalance() const { return measured_imbalance_; }
+
+ private:
+  //! Allowed imbalance
+  double imbalance_{0.05};
+  //! Measured imbalance
+  double measured_imbalance_{0.};
+};  // LoadBalancer class
+}  // namespace mpm
+
+#include "load_balancer.tcc"
+#endif  // USE_MPI
+
+#endif  // MPM_LOAD_BALANCER_H_
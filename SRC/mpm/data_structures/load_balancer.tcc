@@ -0,0 +1,104 @@
+//! Measure the imbalance and move boundary cells if it is too large
+template <unsigned Tdim>
+template <typename Tcells, typename Tcosts>
+std::vector<mpm::Index> mpm::LoadBalancer<Tdim>::rebalance(
+    const Tcells& cells, const Tcosts& cell_costs, MPI_Comm comm) {
+  int mpi_rank = 0;
+  int mpi_size = 1;
+  MPI_Comm_rank(comm, &mpi_rank);
+  MPI_Comm_size(comm, &mpi_size);
+
+  // Load of each rank
+  double load = 0.;
+  for (const auto& cell_cost : cell_costs) load += cell_cost.second;
+  std::vector<double> loads(mpi_size, 0.);
+  MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, comm);
+
+  const double mean_load =
+      std::accumulate(loads.begin(), loads.end(), 0.) / mpi_size;
+  const double max_load = *std::max_element(loads.begin(), loads.end());
+  measured_imbalance_ = (mean_load > 0.) ? max_load / mean_load - 1. : 0.;
+
+  std::vector<mpm::Index> exchange_cells;
+  if (measured_imbalance_ <= imbalance_) return exchange_cells;
+
+  // Cells by id
+  std::unordered_map<mpm::Index, std::decay_t<decltype(*cells.cbegin())>>
+      map_cells;
+  for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr)
+    map_cells.insert(std::make_pair((*citr)->id(), *citr));
+
+  // Graph of ranks, and the boundary cells of this rank with the number of
+  // their neighbours in each neighbouring rank
+  std::vector<std::set<int>> neighbour_ranks(mpi_size);
+  std::map<int, std::vector<std::pair<mpm::Index, unsigned>>> boundary_cells;
+  for (auto citr = cells.cbegin(); citr != cells.cend(); ++citr) {
+    const int rank = (*citr)->rank();
+    std::map<int, unsigned> nneighbours;
+    for (const auto neighbour : (*citr)->neighbours()) {
+      const int neighbour_rank = map_cells.at(neighbour)->rank();
+      if (neighbour_rank == rank) continue;
+      neighbour_ranks[rank].insert(neighbour_rank);
+      ++nneighbours[neighbour_rank];
+    }
+    if (rank == mpi_rank)
+      for (const auto& count : nneighbours)
+        boundary_cells[count.first].emplace_back((*citr)->id(), count.second);
+  }
+
+  // Diffusion step: send (load - neighbour load) / (max degree + 1) to each
+  // lighter neighbour, moving the cells most connected to it first
+  std::vector<mpm::Index> moves;
+  std::set<mpm::Index> moved;
+  for (const int neighbour_rank : neighbour_ranks[mpi_rank]) {
+    const double flow =
+        (loads[mpi_rank] - loads[neighbour_rank]) /
+        (std::max(neighbour_ranks[mpi_rank].size(),
+                  neighbour_ranks[neighbour_rank].size()) +
+         1.);
+    if (flow <= 0.) continue;
+
+    auto& candidates = boundary_cells[neighbour_rank];
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const std::pair<mpm::Index, unsigned>& a,
+                        const std::pair<mpm::Index, unsigned>& b) {
+                       return a.second > b.second;
+                     });
+
+    double sent = 0.;
+    for (const auto& candidate : candidates) {
+      const auto cost = cell_costs.find(candidate.first);
+      if (cost == cell_costs.end() || !(cost->second > 0.) ||
+          moved.count(candidate.first))
+        continue;
+      // Do not overshoot the flow by more than half a cell
+      if (sent + 0.5 * cost->second > flow) continue;
+
+      moves.emplace_back(candidate.first);
+      moves.emplace_back(static_cast<mpm::Index>(neighbour_rank));
+      moved.insert(candidate.first);
+      sent += cost->second;
+      if (sent >= flow) break;
+    }
+  }
+
+  // Share the moves, pairs of cell id and new rank, with all ranks
+  int nmoves = moves.size();
+  std::vector<int> counts(mpi_size, 0);
+  MPI_Allgather(&nmoves, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+  std::vector<int> displacements(mpi_size, 0);
+  for (int i = 1; i < mpi_size; ++i)
+    displacements[i] = displacements[i - 1] + counts[i - 1];
+  std::vector<mpm::Index> all_moves(displacements.back() + counts.back());
+  MPI_Allgatherv(moves.data(), nmoves, MPI_UNSIGNED_LONG_LONG,
+                 all_moves.data(), counts.data(), displacements.data(),
+                 MPI_UNSIGNED_LONG_LONG, comm);
+
+  // Assign the new ranks
+  exchange_cells.reserve(all_moves.size() / 2);
+  for (std::size_t i = 0; i + 1 < all_moves.size(); i += 2) {
+    map_cells.at(all_moves[i])->rank(static_cast<unsigned>(all_moves[i + 1]));
+    exchange_cells.emplace_back(all_moves[i]);
+  }
+  return exchange_cells;
+}
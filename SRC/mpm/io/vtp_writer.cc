@@ -0,0 +1,149 @@
+#include "vtp_writer.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+namespace {
+
+//! Byte order of this machine in VTK's notation
+const char* byte_order() {
+  const std::uint16_t one = 1;
+  return *reinterpret_cast<const unsigned char*>(&one) ? "LittleEndian"
+                                                       : "BigEndian";
+}
+
+//! Open a file with a large buffer; closed when the pointer is released
+std::unique_ptr<std::FILE, int (*)(std::FILE*)> open(
+    const std::string& filename) {
+  std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(
+      std::fopen(filename.c_str(), "wb"), &std::fclose);
+  if (file) std::setvbuf(file.get(), nullptr, _IOFBF, 1 << 20);
+  return file;
+}
+
+//! Write one appended block: its size in bytes followed by the data
+bool write_block(std::FILE* file, const void* data, std::uint64_t nbytes) {
+  return std::fwrite(&nbytes, sizeof(nbytes), 1, file) == 1 &&
+         (nbytes == 0 || std::fwrite(data, 1, nbytes, file) == nbytes);
+}
+
+//! Write the vertex cells 0, 1, ..., n-1 (connectivity or offsets)
+bool write_sequence(std::FILE* file, std::uint64_t n, std::int64_t first) {
+  const std::uint64_t nbytes = n * sizeof(std::int64_t);
+  if (std::fwrite(&nbytes, sizeof(nbytes), 1, file) != 1) return false;
+
+  std::int64_t buffer[4096];
+  for (std::uint64_t i = 0; i < n;) {
+    std::uint64_t count = 0;
+    for (; count < 4096 && i < n; ++count, ++i) buffer[count] = first + i;
+    if (std::fwrite(buffer, sizeof(std::int64_t), count, file) != count)
+      return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+//! Write a piece as VTK XML PolyData with all arrays in appended binary
+bool mpm::vtp::write_piece(const std::string& filename,
+                           const mpm::VtpPiece& piece) {
+  auto file = open(filename);
+  if (!file) return false;
+
+  const std::uint64_t npoints = piece.npoints();
+  const std::uint64_t header = sizeof(std::uint64_t);
+
+  // Offsets of each appended block
+  std::uint64_t offset = 0;
+  auto next = [&offset, header](std::uint64_t nbytes) {
+    const std::uint64_t current = offset;
+    offset += header + nbytes;
+    return current;
+  };
+
+  std::FILE* fp = file.get();
+  std::fprintf(fp,
+               "<?xml version=\"1.0\"?>\n"
+               "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"%s\" "
+               "header_type=\"UInt64\">\n"
+               "  <PolyData>\n"
+               "    <Piece NumberOfPoints=\"%llu\" NumberOfVerts=\"%llu\" "
+               "NumberOfLines=\"0\" NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n",
+               byte_order(), (unsigned long long)npoints,
+               (unsigned long long)npoints);
+
+  std::fprintf(fp,
+               "      <Points>\n"
+               "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+               "format=\"appended\" offset=\"%llu\"/>\n"
+               "      </Points>\n",
+               (unsigned long long)next(piece.points.size() * sizeof(double)));
+
+  std::fprintf(fp, "      <PointData>\n");
+  for (const auto& field : piece.fields)
+    std::fprintf(fp,
+                 "        <DataArray type=\"Float64\" Name=\"%s\" "
+                 "NumberOfComponents=\"%u\" format=\"appended\" "
+                 "offset=\"%llu\"/>\n",
+                 field.name.c_str(), field.ncomponents,
+                 (unsigned long long)next(field.values.size() * sizeof(double)));
+  std::fprintf(fp, "      </PointData>\n");
+
+  // One vertex per particle, so that the points are drawn
+  const std::uint64_t connectivity = next(npoints * sizeof(std::int64_t));
+  const std::uint64_t offsets = next(npoints * sizeof(std::int64_t));
+  std::fprintf(fp,
+               "      <Verts>\n"
+               "        <DataArray type=\"Int64\" Name=\"connectivity\" "
+               "format=\"appended\" offset=\"%llu\"/>\n"
+               "        <DataArray type=\"Int64\" Name=\"offsets\" "
+               "format=\"appended\" offset=\"%llu\"/>\n"
+               "      </Verts>\n"
+               "    </Piece>\n"
+               "  </PolyData>\n"
+               "  <AppendedData encoding=\"raw\">\n   _",
+               (unsigned long long)connectivity, (unsigned long long)offsets);
+
+  bool status = write_block(fp, piece.points.data(),
+                            piece.points.size() * sizeof(double));
+  for (const auto& field : piece.fields)
+    status = status && write_block(fp, field.values.data(),
+                                   field.values.size() * sizeof(double));
+  status = status && write_sequence(fp, npoints, 0) &&
+           write_sequence(fp, npoints, 1);
+
+  std::fprintf(fp, "\n  </AppendedData>\n</VTKFile>\n");
+  return status && !std::ferror(fp);
+}
+
+//! Write a parallel index (.pvtp) that refers to the pieces of each rank
+bool mpm::vtp::write_index(const std::string& filename,
+                           const mpm::VtpPiece& piece,
+                           const std::vector<std::string>& sources) {
+  auto file = open(filename);
+  if (!file) return false;
+
+  std::FILE* fp = file.get();
+  std::fprintf(fp,
+               "<?xml version=\"1.0\"?>\n"
+               "<VTKFile type=\"PPolyData\" version=\"1.0\" byte_order=\"%s\" "
+               "header_type=\"UInt64\">\n"
+               "  <PPolyData GhostLevel=\"0\">\n"
+               "    <PPoints>\n"
+               "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+               "    </PPoints>\n"
+               "    <PPointData>\n",
+               byte_order());
+  for (const auto& field : piece.fields)
+    std::fprintf(fp,
+                 "      <PDataArray type=\"Float64\" Name=\"%s\" "
+                 "NumberOfComponents=\"%u\"/>\n",
+                 field.name.c_str(), field.ncomponents);
+  std::fprintf(fp, "    </PPointData>\n");
+  for (const auto& source : sources)
+    std::fprintf(fp, "    <Piece Source=\"%s\"/>\n", source.c_str());
+  std::fprintf(fp, "  </PPolyData>\n</VTKFile>\n");
+
+  return !std::ferror(fp);
+}
@@ -0,0 +1,60 @@
+#ifndef MPM_VTP_WRITER_H_
+#define MPM_VTP_WRITER_H_
+
+#include <string>
+#include <vector>
+
+namespace mpm {
+
+//! Particle field gathered for output
+//! \brief Values of one particle attribute, stored by particle
+struct VtpField {
+  //! Kind of particle attribute
+  enum class Kind { Scalar, Vector, Tensor, StateVariable };
+
+  //! Attribute name on the particle
+  std::string attribute;
+  //! Array name in the output file
+  std::string name;
+  //! Kind of attribute
+  Kind kind{Kind::Scalar};
+  //! Phase of a state variable
+  unsigned phase{0};
+  //! Number of components per particle
+  unsigned ncomponents{1};
+  //! Values, ncomponents per particle
+  std::vector<double> values;
+};
+
+//! Particle data of one rank
+//! \brief Coordinates and fields of the particles written to one piece
+struct VtpPiece {
+  //! Coordinates, 3 per particle
+  std::vector<double> points;
+  //! Fields
+  std::vector<VtpField> fields;
+
+  //! Number of particles
+  std::size_t npoints() const { return points.size() / 3; }
+};
+
+namespace vtp {
+
+//! Write a piece as VTK XML PolyData with all arrays in appended binary
+//! \param[in] filename Output file (.vtp)
+//! \param[in] piece Coordinates and fields
+//! \retval status Return true if the file was written
+bool write_piece(const std::string& filename, const mpm::VtpPiece& piece);
+
+//! Write a parallel index (.pvtp) that refers to the pieces of each rank
+//! \param[in] filename Output file (.pvtp)
+//! \param[in] piece Piece of the writing rank; only the fields are used
+//! \param[in] sources File names of the pieces relative to the index
+//! \retval status Return true if the file was written
+bool write_index(const std::string& filename, const mpm::VtpPiece& piece,
+                 const std::vector<std::string>& sources);
+
+}  // namespace vtp
+}  // namespace mpm
+
+#endif  // MPM_VTP_WRITER_H_
@@ -1,6 +1,7 @@
 #ifndef MPM_MATERIAL_MATERIAL_H_
 #define MPM_MATERIAL_MATERIAL_H_
 
+#include <cmath>
 #include <limits>
 
 #include "Eigen/Dense"
@@ -61,6 +62,11 @@ class Material {
   template <typename Ttype>
   Ttype property(const std::string& key);
 
+  //! Return the P-wave velocity used to limit the time step
+  //! \details Estimated from the elastic properties of the material; returns
+  //! zero if they are not available
+  virtual double pwave_velocity() const;
+
   //! Initialise history variables
   virtual mpm::dense_map initialise_state_variables() = 0;
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -46,9 +47,26 @@ using Json = nlohmann::json;
 #include "traction.h"
 #include "vector.h"
 #include "velocity_constraint.h"
+#include "vtp_writer.h"
 
 namespace mpm {
 
+#ifdef USE_MPI
+//! Nodal property in transit between neighbouring ranks
+//! \tparam Ttype Type of property
+template <typename Ttype>
+struct NodalHaloExchange {
+  //! Property at the domain shared nodes
+  std::vector<Ttype> values;
+  //! Values sent to each neighbouring rank
+  std::vector<std::vector<Ttype>> send;
+  //! Values received from each neighbouring rank
+  std::vector<std::vector<Ttype>> recv;
+  //! Receive and send requests
+  std::vector<MPI_Request> requests;
+};
+#endif
+
 //! Mesh class
 //! \brief Base class that stores the information about meshes
 //! \details Mesh class which stores the particles, nodes, cells and neighbours
@@ -156,8 +174,41 @@ class Mesh {
   template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
             typename Tsetfunctor>
   void nodal_halo_exchange(Tgetfunctor getter, Tsetfunctor setter);
+
+  //! Start a nonblocking exchange of a nodal property with the neighbouring
+  //! ranks; work on interior nodes can proceed until it is finished
+  //! \tparam Ttype Type of property to accumulate
+  //! \tparam Tnparam Size of individual property
+  //! \tparam Tgetfunctor Functor for getter
+  //! \param[out] exchange Buffers and requests of the exchange
+  //! \param[in] getter Getter function
+  template <typename Ttype, unsigned Tnparam, typename Tgetfunctor>
+  void begin_nodal_halo_exchange(mpm::NodalHaloExchange<Ttype>& exchange,
+                                 Tgetfunctor getter);
+
+  //! Complete a nodal halo exchange and set the sum over all ranks
+  //! \tparam Ttype Type of property to accumulate
+  //! \tparam Tnparam Size of individual property
+  //! \tparam Tsetfunctor Functor for setter
+  //! \param[in,out] exchange Exchange started by begin_nodal_halo_exchange
+  //! \param[in] setter Setter function
+  template <typename Ttype, unsigned Tnparam, typename Tsetfunctor>
+  void finish_nodal_halo_exchange(mpm::NodalHaloExchange<Ttype>& exchange,
+                                  Tsetfunctor setter);
 #endif
 
+  //! Iterate over nodes that are not shared with other ranks
+  //! \tparam Toper Callable object typically a baseclass functor
+  //! \tparam Tpred Predicate
+  template <typename Toper, typename Tpred>
+  void iterate_over_interior_nodes_predicate(Toper oper, Tpred pred);
+
+  //! Iterate over nodes shared with other ranks
+  //! \tparam Toper Callable object typically a baseclass functor
+  //! \tparam Tpred Predicate
+  template <typename Toper, typename Tpred>
+  void iterate_over_domain_shared_nodes_predicate(Toper oper, Tpred pred);
+
   //! Create cells from list of nodes
   //! \param[in] gcid Global cell id
   //! \param[in] element Element type
@@ -190,6 +241,15 @@ class Mesh {
   //! Compute average cell size
   double compute_average_cell_size() const;
 
+  //! Compute the critical time step of the particles in this rank
+  //! \details Smallest cell length / (wave velocity + particle speed)
+  //! \param[in] wave_velocities P-wave velocity of each material id
+  //! \param[in] phase Phase of the particles
+  //! \retval dt Critical time step, or the largest double if no particle
+  //! limits it
+  double critical_time_step(const std::map<unsigned, double>& wave_velocities,
+                            unsigned phase = mpm::ParticlePhase::Solid);
+
   //! Iterate over cells
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
@@ -201,6 +261,15 @@ class Mesh {
   //! Find global nparticles across MPI ranks / cell
   void find_nglobal_particles_cells();
 
+  //! Compute the cost of each cell of this rank for load balancing
+  //! \param[in] material_costs Cost of a particle of each material id; other
+  //! materials cost 1
+  //! \param[in] phase Phase of the particles
+  //! \retval cell_costs Sum of the costs of the particles in each cell
+  tsl::robin_map<mpm::Index, double> compute_cell_costs(
+      const std::map<unsigned, double>& material_costs,
+      unsigned phase = mpm::ParticlePhase::Solid);
+
   //! Create particles from coordinates
   //! \param[in] particle_type Particle type
   //! \param[in] coordinates Nodal coordinates
@@ -311,6 +380,10 @@ class Mesh {
   std::vector<double> particles_statevars_data(
       const std::string& attribute, unsigned phase = mpm::ParticlePhase::Solid);
 
+  //! Gather coordinates and fields of all particles for output
+  //! \param[in,out] piece Fields to gather; coordinates and values are filled
+  void gather_particles_output(mpm::VtpPiece& piece) const;
+
   //! Compute and assign rotation matrix to nodes
   //! \param[in] euler_angles Map of node number and respective euler_angles
   bool compute_nodal_rotation_matrices(
@@ -676,6 +749,21 @@ class Mesh {
   bool locate_particle_cells(
       const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle);
 
+#ifdef USE_MPI
+  //! Send particles to other ranks and receive the particles sent to this
+  //! rank, unpacking each message as it arrives
+  //! \param[in] send_particles Ids of the particles sent to each rank; every
+  //! rank listed gets a message, even if it is empty
+  //! \param[in] recv_ranks Ranks that send a message to this rank
+  void exchange_particles(
+      const std::map<unsigned, std::vector<mpm::Index>>& send_particles,
+      const std::set<unsigned>& recv_ranks);
+
+  //! Create a particle from its serialized form and add it to the mesh
+  //! \param[in] buffer Serialized particle
+  void add_received_particle(const std::vector<uint8_t>& buffer);
+#endif
+
  private:
   //! mesh id
   unsigned id_{std::numeric_limits<unsigned>::max()};
@@ -733,10 +821,8 @@ class Mesh {
   std::shared_ptr<mpm::NodalProperties> nodal_properties_{nullptr};
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
-  //! Maximum number of halo nodes
-  unsigned nhalo_nodes_{0};
-  //! Maximum number of halo nodes
-  unsigned ncomms_{0};
+  //! Positions in domain_shared_nodes_ of the nodes shared with each rank
+  std::map<unsigned, std::vector<mpm::Index>> halo_nodes_;
 };  // Mesh class
 }  // namespace mpm
 
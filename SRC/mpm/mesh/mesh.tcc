@@ -120,90 +120,100 @@ void mpm::Mesh<Tdim>::iterate_over_active_nodes(Toper oper) {
 }
 
 #ifdef USE_MPI
-#ifdef USE_HALO_EXCHANGE
-//! Nodal halo exchange
+//! Start a nonblocking exchange of a nodal property with neighbouring ranks
 template <unsigned Tdim>
-template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
-          typename Tsetfunctor>
-void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
-                                          Tsetfunctor setter) {
-  // Create vector of nodal vectors
-  unsigned nnodes = this->domain_shared_nodes_.size();
+template <typename Ttype, unsigned Tnparam, typename Tgetfunctor>
+void mpm::Mesh<Tdim>::begin_nodal_halo_exchange(
+    mpm::NodalHaloExchange<Ttype>& exchange, Tgetfunctor getter) {
+  const unsigned nnodes = domain_shared_nodes_.size();
+  exchange.values.resize(nnodes);
+#pragma omp parallel for schedule(runtime)
+  for (unsigned i = 0; i < nnodes; ++i)
+    exchange.values[i] = getter(*(domain_shared_nodes_.cbegin() + i));
 
-  // Get number of MPI ranks
-  int mpi_size;
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-  int mpi_rank;
-  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  // One message each way per neighbouring rank, with the shared nodes in the
+  // same (node id) order on both sides
+  const unsigned nranks = halo_nodes_.size();
+  exchange.send.resize(nranks);
+  exchange.recv.resize(nranks);
+  exchange.requests.assign(2 * nranks, MPI_REQUEST_NULL);
 
-  if (mpi_size > 1) {
-    // Vector of send requests
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(ncomms_);
-
-    unsigned j = 0;
-    // Non-blocking send
-    for (unsigned i = 0; i < nnodes; ++i) {
-      Ttype property = getter(domain_shared_nodes_[i]);
-      std::set<unsigned> node_mpi_ranks = domain_shared_nodes_[i]->mpi_ranks();
-      for (auto& node_rank : node_mpi_ranks) {
-        if (node_rank != mpi_rank) {
-          MPI_Isend(&property, Tnparam, MPI_DOUBLE, node_rank, 0,
-                    MPI_COMM_WORLD, &send_requests[j]);
-          ++j;
-        }
-      }
-    }
+  unsigned i = 0;
+  for (const auto& halo : halo_nodes_) {
+    const int rank = halo.first;
+    const auto& indices = halo.second;
+    exchange.recv[i].resize(indices.size());
+    MPI_Irecv(exchange.recv[i].data(), indices.size() * Tnparam, MPI_DOUBLE,
+              rank, 2, MPI_COMM_WORLD, &exchange.requests[i]);
+
+    exchange.send[i].resize(indices.size());
+    for (unsigned j = 0; j < indices.size(); ++j)
+      exchange.send[i][j] = exchange.values[indices[j]];
+    MPI_Isend(exchange.send[i].data(), indices.size() * Tnparam, MPI_DOUBLE,
+              rank, 2, MPI_COMM_WORLD, &exchange.requests[nranks + i]);
+    ++i;
+  }
+}
 
-    // send complete
-    for (unsigned i = 0; i < ncomms_; ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-
-    for (unsigned i = 0; i < nnodes; ++i) {
-      // Get value at current node
-      Ttype property = getter(domain_shared_nodes_[i]);
-
-      std::set<unsigned> node_mpi_ranks = domain_shared_nodes_[i]->mpi_ranks();
-      // Receive from all shared ranks
-      for (auto& node_rank : node_mpi_ranks) {
-        if (node_rank != mpi_rank) {
-          Ttype value;
-          MPI_Recv(&value, Tnparam, MPI_DOUBLE, node_rank, 0, MPI_COMM_WORLD,
-                   MPI_STATUS_IGNORE);
-          property += value;
-        }
-      }
-      setter(domain_shared_nodes_[i], property);
-    }
+//! Complete a nodal halo exchange and set the sum over all ranks
+template <unsigned Tdim>
+template <typename Ttype, unsigned Tnparam, typename Tsetfunctor>
+void mpm::Mesh<Tdim>::finish_nodal_halo_exchange(
+    mpm::NodalHaloExchange<Ttype>& exchange, Tsetfunctor setter) {
+  MPI_Waitall(exchange.requests.size(), exchange.requests.data(),
+              MPI_STATUSES_IGNORE);
+
+  // Sum in rank order, so that the result does not depend on arrival order
+  unsigned i = 0;
+  for (const auto& halo : halo_nodes_) {
+    const auto& indices = halo.second;
+    for (unsigned j = 0; j < indices.size(); ++j)
+      exchange.values[indices[j]] += exchange.recv[i][j];
+    ++i;
   }
+
+  const unsigned nnodes = domain_shared_nodes_.size();
+#pragma omp parallel for schedule(runtime)
+  for (unsigned i = 0; i < nnodes; ++i)
+    setter(*(domain_shared_nodes_.cbegin() + i), exchange.values[i]);
 }
 
-#else
-//! All reduce over nodal scalar property
+//! Nodal halo exchange
 template <unsigned Tdim>
 template <typename Ttype, unsigned Tnparam, typename Tgetfunctor,
           typename Tsetfunctor>
 void mpm::Mesh<Tdim>::nodal_halo_exchange(Tgetfunctor getter,
                                           Tsetfunctor setter) {
-  // Create vector of nodal scalars
-  std::vector<Ttype> prop_get(nhalo_nodes_, mpm::zero<Ttype>());
-  std::vector<Ttype> prop_set(nhalo_nodes_, mpm::zero<Ttype>());
-
-#pragma omp parallel for schedule(runtime) shared(prop_get)
-  for (auto nitr = domain_shared_nodes_.cbegin();
-       nitr != domain_shared_nodes_.cend(); ++nitr)
-    prop_get.at((*nitr)->ghost_id()) = getter((*nitr));
+  mpm::NodalHaloExchange<Ttype> exchange;
+  this->template begin_nodal_halo_exchange<Ttype, Tnparam>(exchange, getter);
+  this->template finish_nodal_halo_exchange<Ttype, Tnparam>(exchange, setter);
+}
+#endif
 
-  MPI_Allreduce(prop_get.data(), prop_set.data(), nhalo_nodes_ * Tnparam,
-                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+//! Iterate over nodes that are not shared with other ranks
+template <unsigned Tdim>
+template <typename Toper, typename Tpred>
+void mpm::Mesh<Tdim>::iterate_over_interior_nodes_predicate(Toper oper,
+                                                            Tpred pred) {
+#pragma omp parallel for schedule(runtime)
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
+    if ((*nitr)->ghost_id() == std::numeric_limits<mpm::Index>::max() &&
+        pred(*nitr))
+      oper(*nitr);
+  }
+}
 
+//! Iterate over nodes shared with other ranks
+template <unsigned Tdim>
+template <typename Toper, typename Tpred>
+void mpm::Mesh<Tdim>::iterate_over_domain_shared_nodes_predicate(Toper oper,
+                                                                 Tpred pred) {
 #pragma omp parallel for schedule(runtime)
   for (auto nitr = domain_shared_nodes_.cbegin();
-       nitr != domain_shared_nodes_.cend(); ++nitr)
-    setter((*nitr), prop_set.at((*nitr)->ghost_id()));
+       nitr != domain_shared_nodes_.cend(); ++nitr) {
+    if (pred(*nitr)) oper(*nitr);
+  }
 }
-#endif
-#endif
 
 //! Create cells from node lists
 template <unsigned Tdim>
@@ -315,6 +325,26 @@ double mpm::Mesh<Tdim>::compute_average_cell_size() const {
   return mesh_size;
 }
 
+//! Compute the critical time step of the particles in this rank
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::critical_time_step(
+    const std::map<unsigned, double>& wave_velocities, unsigned phase) {
+  double dt = std::numeric_limits<double>::max();
+#pragma omp parallel for schedule(runtime) reduction(min : dt)
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    const auto cell_id = (*pitr)->cell_id();
+    if (cell_id == std::numeric_limits<mpm::Index>::max()) continue;
+
+    double velocity = (*pitr)->velocity().norm();
+    const auto wave = wave_velocities.find((*pitr)->material_id(phase));
+    if (wave != wave_velocities.end()) velocity += wave->second;
+
+    if (velocity > 0.)
+      dt = std::min(dt, map_cells_[cell_id]->mean_length() / velocity);
+  }
+  return dt;
+}
+
 //! Find global number of particles across MPI ranks / cell
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_nglobal_particles_cells() {
@@ -332,6 +362,30 @@ void mpm::Mesh<Tdim>::find_nglobal_particles_cells() {
 #endif
 }
 
+//! Compute the cost of each cell of this rank for load balancing
+template <unsigned Tdim>
+tsl::robin_map<mpm::Index, double> mpm::Mesh<Tdim>::compute_cell_costs(
+    const std::map<unsigned, double>& material_costs, unsigned phase) {
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+  tsl::robin_map<mpm::Index, double> cell_costs;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    if ((*citr)->rank() != mpi_rank) continue;
+
+    double cost = 0.;
+    for (const auto pid : (*citr)->particles()) {
+      const auto material_cost =
+          material_costs.find(map_particles_[pid]->material_id(phase));
+      cost += (material_cost != material_costs.end()) ? material_cost->second
+                                                      : 1.;
+    }
+    cell_costs.insert(std::make_pair((*citr)->id(), cost));
+  }
+  return cell_costs;
+}
+
 //! Find particle neighbours for all particle
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_particle_neighbours() {
@@ -738,121 +792,26 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
   // Get number of MPI ranks
   int mpi_size;
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-  int mpi_rank;
-  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(ghost_cells_.size());
-
-    unsigned i = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
+    // Particles that moved into cells of other ranks; every neighbouring
+    // rank gets a message, even if it is empty
+    std::map<unsigned, std::vector<mpm::Index>> send_particles;
     for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
-
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      unsigned nparticles = particle_ids.size();
-      MPI_Isend(&nparticles, 1, MPI_UNSIGNED, (*citr)->rank(), 1,
-                MPI_COMM_WORLD, &send_requests[i]);
-    }
-
-    // Iterate through the ghost cells and send particles
-    for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      for (auto& id : particle_ids) {
-        // Create a vector of serialized particle
-        std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-        MPI_Send(buffer.data(), buffer.size(), MPI_UINT8_T, (*citr)->rank(), 0,
-                 MPI_COMM_WORLD);
-        ++np;
-        // Particles to be removed from the current rank
-        remove_pids.emplace_back(id);
-      }
+         citr != this->ghost_cells_.cend(); ++citr) {
+      auto& pids = send_particles[(*citr)->rank()];
+      const auto particle_ids = (*citr)->particles();
+      pids.insert(pids.end(), particle_ids.begin(), particle_ids.end());
       (*citr)->clear_particle_ids();
     }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete
-    for (unsigned i = 0; i < this->ghost_cells_.size(); ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
 
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
-
-    // Iterate through the local ghost cells and receive particles
-    for (auto citr = this->local_ghost_cells_.cbegin();
-         citr != this->local_ghost_cells_.cend(); ++citr) {
-      std::vector<unsigned> neighbour_ranks =
-          ghost_cells_neighbour_ranks_[(*citr)->id()];
-      // Total number of particles
-      std::vector<unsigned> nrank_particles(neighbour_ranks.size(), 0);
-      for (unsigned i = 0; i < neighbour_ranks.size(); ++i)
-        MPI_Recv(&nrank_particles[i], 1, MPI_UNSIGNED, neighbour_ranks[i], 1,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-      // Receive number of particles
-      unsigned nrecv_particles =
-          std::accumulate(nrank_particles.begin(), nrank_particles.end(), 0);
-
-      for (unsigned j = 0; j < nrecv_particles; ++j) {
-        // Retrieve information about the incoming message
-        MPI_Status status;
-        MPI_Probe(MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
-
-        // Get buffer size
-        int size;
-        MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-        // Allocate the buffer now that we know how many elements there are
-        std::vector<uint8_t> buffer;
-        buffer.resize(size);
-
-        // Finally receive the message
-        MPI_Recv(buffer.data(), size, MPI_UINT8_T, MPI_ANY_SOURCE, 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-        int position = 0;
-
-        // Get particle type
-        int ptype;
-        MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                   MPI_COMM_WORLD);
-        std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-        // Get materials material id
-        int nmaterials = 0;
-        MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                   MPI_UNSIGNED, MPI_COMM_WORLD);
-        // Vector of materials
-        std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-        materials.reserve(nmaterials);
-        for (unsigned k = 0; k < nmaterials; ++k) {
-          int mat_id;
-          MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1, MPI_UNSIGNED,
-                     MPI_COMM_WORLD);
-          materials.emplace_back(materials_.at(mat_id));
-        }
+    // Neighbouring ranks of the cells of this rank
+    std::set<unsigned> recv_ranks;
+    for (const auto& neighbour_ranks : ghost_cells_neighbour_ranks_)
+      recv_ranks.insert(neighbour_ranks.second.begin(),
+                        neighbour_ranks.second.end());
 
-        // Create particle
-        auto particle =
-            Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                    const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(particle_type, static_cast<mpm::Index>(pid),
-                         pcoordinates);
-        particle->deserialize(buffer, materials);
-        // Add particle to mesh
-        this->add_particle(particle, true);
-      }
-    }
+    this->exchange_particles(send_particles, recv_ranks);
   }
 #endif
 }
@@ -869,124 +828,143 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(exchange_cells.size());
-    std::vector<MPI_Request> send_particle_requests;
-    send_particle_requests.reserve(exchange_cells.size() * 100);
-    unsigned nsend_requests = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
+    // Each cell that left this rank sends its particles to its new rank, and
+    // each cell that arrived receives from its previous rank
+    std::map<unsigned, std::vector<mpm::Index>> send_particles;
+    std::set<unsigned> recv_ranks;
     for (auto cid : exchange_cells) {
-      // Get cell pointer
       auto cell = map_cells_[cid];
-      // If the previous rank of cell is the current MPI rank,
-      // then send all particles
-      if ((cell->rank() != cell->previous_mpirank()) &&
-          (cell->previous_mpirank() == mpi_rank)) {
-
-        // Send number of particles to receiver rank
-        unsigned nparticles = cell->nparticles();
-        MPI_Ibsend(&nparticles, 1, MPI_UNSIGNED, cell->rank(), 0,
-                   MPI_COMM_WORLD, &send_requests[nsend_requests]);
-
-        auto particle_ids = cell->particles();
-        for (auto& id : particle_ids) {
-          // Create a vector of serialized particle
-          std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-          MPI_Ibsend(buffer.data(), buffer.size(), MPI_UINT8_T, cell->rank(), 0,
-                     MPI_COMM_WORLD, &send_particle_requests[np]);
-          ++np;
-
-          // Particles to be removed from the current rank
-          remove_pids.emplace_back(id);
-        }
+      if (cell->rank() == cell->previous_mpirank()) continue;
+
+      if (cell->previous_mpirank() == mpi_rank) {
+        auto& pids = send_particles[cell->rank()];
+        const auto particle_ids = cell->particles();
+        pids.insert(pids.end(), particle_ids.begin(), particle_ids.end());
         cell->clear_particle_ids();
-        ++nsend_requests;
-      }
+      } else if (cell->rank() == mpi_rank)
+        recv_ranks.insert(cell->previous_mpirank());
     }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete iterate only upto valid send requests
-    for (unsigned i = 0; i < nsend_requests; ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-    // Send particles complete
-    for (unsigned i = 0; i < np; ++i)
-      MPI_Wait(&send_particle_requests[i], MPI_STATUS_IGNORE);
 
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
+    this->exchange_particles(send_particles, recv_ranks);
+  }
+#endif
+}
 
-    // Iterate through the ghost cells and receive particles
-    for (auto cid : exchange_cells) {
-      // Get cell pointer
-      auto cell = map_cells_[cid];
-      // If the current rank is the MPI rank receive particles
-      if ((cell->rank() != cell->previous_mpirank()) &&
-          (cell->rank() == mpi_rank)) {
-        // Receive number of particles
-        unsigned nrecv_particles;
-        MPI_Recv(&nrecv_particles, 1, MPI_UNSIGNED, cell->previous_mpirank(), 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        for (unsigned j = 0; j < nrecv_particles; ++j) {
-          // Retrieve information about the incoming message
-          MPI_Status status;
-          MPI_Probe(cell->previous_mpirank(), 0, MPI_COMM_WORLD, &status);
-
-          // Get buffer size
-          int size;
-          MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-          // Allocate the buffer now that we know how many elements there are
-          std::vector<uint8_t> buffer;
-          buffer.resize(size);
-
-          // Finally receive the message
-          MPI_Recv(buffer.data(), size, MPI_UINT8_T, cell->previous_mpirank(),
-                   0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-          uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-          int position = 0;
-
-          // Get particle type
-          int ptype;
-          MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                     MPI_COMM_WORLD);
-          std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-          // Get materials material id
-          int nmaterials = 0;
-          MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                     MPI_UNSIGNED, MPI_COMM_WORLD);
-          std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-          materials.reserve(nmaterials);
-          for (unsigned k = 0; k < nmaterials; ++k) {
-            int mat_id;
-            MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1,
-                       MPI_UNSIGNED, MPI_COMM_WORLD);
-            // Get material
-            materials.emplace_back(materials_.at(mat_id));
-          }
+#ifdef USE_MPI
+//! Send particles to other ranks and receive the particles sent to this rank
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::exchange_particles(
+    const std::map<unsigned, std::vector<mpm::Index>>& send_particles,
+    const std::set<unsigned>& recv_ranks) {
+  const std::vector<unsigned> sources(recv_ranks.begin(), recv_ranks.end());
+  const unsigned nrecv = sources.size();
+  const unsigned nsend = send_particles.size();
+
+  // Post the receives of the message sizes first
+  std::vector<unsigned long long> recv_sizes(nrecv, 0);
+  std::vector<MPI_Request> size_requests(nrecv, MPI_REQUEST_NULL);
+  for (unsigned i = 0; i < nrecv; ++i)
+    MPI_Irecv(&recv_sizes[i], 1, MPI_UNSIGNED_LONG_LONG, sources[i], 3,
+              MPI_COMM_WORLD, &size_requests[i]);
+
+  // One message per destination: the serialized particles, each preceded by
+  // its size
+  std::vector<std::vector<uint8_t>> send_buffers(nsend);
+  std::vector<unsigned long long> send_sizes(nsend, 0);
+  std::vector<MPI_Request> send_requests(2 * nsend, MPI_REQUEST_NULL);
+  std::vector<mpm::Index> remove_pids;
+  unsigned i = 0;
+  for (const auto& destination : send_particles) {
+    auto& buffer = send_buffers[i];
+    for (const auto id : destination.second) {
+      const std::vector<uint8_t> particle = map_particles_[id]->serialize();
+      const unsigned long long size = particle.size();
+      const auto* bytes = reinterpret_cast<const uint8_t*>(&size);
+      buffer.insert(buffer.end(), bytes, bytes + sizeof(size));
+      buffer.insert(buffer.end(), particle.begin(), particle.end());
+      remove_pids.emplace_back(id);
+    }
+    send_sizes[i] = buffer.size();
+    MPI_Isend(&send_sizes[i], 1, MPI_UNSIGNED_LONG_LONG, destination.first, 3,
+              MPI_COMM_WORLD, &send_requests[2 * i]);
+    if (!buffer.empty())
+      MPI_Isend(buffer.data(), buffer.size(), MPI_UINT8_T, destination.first,
+                4, MPI_COMM_WORLD, &send_requests[2 * i + 1]);
+    ++i;
+  }
+  // Remove all sent particles
+  this->remove_particles(remove_pids);
+
+  // Post each receive as soon as its size is known
+  std::vector<std::vector<uint8_t>> recv_buffers(nrecv);
+  std::vector<MPI_Request> recv_requests(nrecv, MPI_REQUEST_NULL);
+  for (unsigned k = 0; k < nrecv; ++k) {
+    int index;
+    MPI_Waitany(nrecv, size_requests.data(), &index, MPI_STATUS_IGNORE);
+    if (recv_sizes[index] == 0) continue;
+    recv_buffers[index].resize(recv_sizes[index]);
+    MPI_Irecv(recv_buffers[index].data(), recv_sizes[index], MPI_UINT8_T,
+              sources[index], 4, MPI_COMM_WORLD, &recv_requests[index]);
+  }
 
-          // Create particle
-          auto particle =
-              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           pcoordinates);
-          particle->deserialize(buffer, materials);
-          // Add particle to mesh
-          this->add_particle(particle, true);
-        }
-      }
+  // Unpack the particles of each rank while the others are in flight
+  for (unsigned k = 0; k < nrecv; ++k) {
+    int index;
+    MPI_Waitany(nrecv, recv_requests.data(), &index, MPI_STATUS_IGNORE);
+    if (index == MPI_UNDEFINED) break;
+
+    const auto& buffer = recv_buffers[index];
+    std::size_t position = 0;
+    while (position + sizeof(unsigned long long) <= buffer.size()) {
+      unsigned long long size;
+      std::memcpy(&size, buffer.data() + position, sizeof(size));
+      position += sizeof(size);
+      this->add_received_particle(std::vector<uint8_t>(
+          buffer.begin() + position, buffer.begin() + position + size));
+      position += size;
     }
   }
-#endif
+
+  MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+}
+
+//! Create a particle from its serialized form and add it to the mesh
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::add_received_particle(const std::vector<uint8_t>& buffer) {
+  uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
+  int position = 0;
+
+  // Get particle type
+  int ptype;
+  MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
+             MPI_COMM_WORLD);
+  std::string particle_type = mpm::ParticleTypeName.at(ptype);
+
+  // Get materials material id
+  int nmaterials = 0;
+  MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1, MPI_UNSIGNED,
+             MPI_COMM_WORLD);
+  std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
+  materials.reserve(nmaterials);
+  for (unsigned k = 0; k < nmaterials; ++k) {
+    int mat_id;
+    MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1, MPI_UNSIGNED,
+               MPI_COMM_WORLD);
+    materials.emplace_back(materials_.at(mat_id));
+  }
+
+  // Create particle, with the id and coordinates set by deserialize
+  const Eigen::Matrix<double, Tdim, 1> pcoordinates =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+  auto particle = Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                          const Eigen::Matrix<double, Tdim, 1>&>::instance()
+                      ->create(particle_type, static_cast<mpm::Index>(0),
+                               pcoordinates);
+  particle->deserialize(buffer, materials);
+  // Add particle to mesh
+  this->add_particle(particle, true);
 }
+#endif
 
 //! Resume cell ranks and partitioned domain
 template <unsigned Tdim>
@@ -1059,37 +1037,31 @@ void mpm::Mesh<Tdim>::find_domain_shared_nodes() {
     (*citr)->assign_mpi_rank_to_nodes();
 
   this->domain_shared_nodes_.clear();
+  this->halo_nodes_.clear();
 
-#ifdef USE_HALO_EXCHANGE
-  ncomms_ = 0;
-  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
-    // If node has more than 1 MPI rank
-    std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
-    const unsigned nodal_mpi_ranks_size = nodal_mpi_ranks.size();
-    if (nodal_mpi_ranks_size > 1) {
-      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
-        // Create Ghost ID
-        (*nitr)->ghost_id(ncomms_);
-        // Add to list of shared nodes on local rank
-        domain_shared_nodes_.add(*nitr);
-        ncomms_ += nodal_mpi_ranks_size - 1;
-      }
-    }
-  }
-#else
-  nhalo_nodes_ = 0;
+  // Nodes on this rank that are shared with other ranks; the ghost id is the
+  // position in the list of domain shared nodes
+  mpm::Index nshared = 0;
   for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr) {
     std::set<unsigned> nodal_mpi_ranks = (*nitr)->mpi_ranks();
-    // If node has more than 1 MPI rank
-    if (nodal_mpi_ranks.size() > 1) {
-      (*nitr)->ghost_id(nhalo_nodes_);
-      nhalo_nodes_ += 1;
-      // Add to domain shared nodes only if active on current MPI rank
-      if (nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end())
-        domain_shared_nodes_.add(*nitr);
-    }
+    if (nodal_mpi_ranks.size() > 1 &&
+        nodal_mpi_ranks.find(mpi_rank) != nodal_mpi_ranks.end()) {
+      (*nitr)->ghost_id(nshared);
+      domain_shared_nodes_.add(*nitr);
+      for (auto rank : nodal_mpi_ranks)
+        if (rank != mpi_rank) halo_nodes_[rank].emplace_back(nshared);
+      ++nshared;
+    } else
+      (*nitr)->ghost_id(std::numeric_limits<mpm::Index>::max());
   }
-#endif
+
+  // Order the nodes shared with each rank by id, which both ranks agree on
+  for (auto& halo : halo_nodes_)
+    std::sort(halo.second.begin(), halo.second.end(),
+              [this](mpm::Index a, mpm::Index b) {
+                return (*(domain_shared_nodes_.cbegin() + a))->id() <
+                       (*(domain_shared_nodes_.cbegin() + b))->id();
+              });
 }
 
 //! Locate particles in a cell
@@ -1284,6 +1256,49 @@ std::vector<double> mpm::Mesh<Tdim>::particles_statevars_data(
   return statevars_data;
 }
 
+//! Gather coordinates and fields of all particles for output
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::gather_particles_output(mpm::VtpPiece& piece) const {
+  const std::size_t nparticles = particles_.size();
+  piece.points.assign(3 * nparticles, 0.);
+  for (auto& field : piece.fields)
+    field.values.assign(field.ncomponents * nparticles, 0.);
+
+  // Each particle fills its own slot, so the loop needs no synchronization
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < nparticles; ++i) {
+    const auto& particle = *(particles_.cbegin() + i);
+
+    const auto coordinates = particle->coordinates();
+    for (unsigned j = 0; j < Tdim; ++j)
+      piece.points[3 * i + j] = coordinates(j);
+
+    for (auto& field : piece.fields) {
+      double* values = field.values.data() + field.ncomponents * i;
+      switch (field.kind) {
+        case mpm::VtpField::Kind::Scalar:
+          values[0] = particle->scalar_data(field.attribute);
+          break;
+        case mpm::VtpField::Kind::Vector: {
+          const auto data = particle->vector_data(field.attribute);
+          for (unsigned j = 0; j < data.size() && j < field.ncomponents; ++j)
+            values[j] = data(j);
+          break;
+        }
+        case mpm::VtpField::Kind::Tensor: {
+          const auto data = particle->tensor_data(field.attribute);
+          for (unsigned j = 0; j < data.size() && j < field.ncomponents; ++j)
+            values[j] = data(j);
+          break;
+        }
+        case mpm::VtpField::Kind::StateVariable:
+          values[0] = particle->state_variable(field.attribute, field.phase);
+          break;
+      }
+    }
+  }
+}
+
 //! Assign particles volumes
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::assign_particles_volumes(
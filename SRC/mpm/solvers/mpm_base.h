@@ -1,6 +1,7 @@
 #ifndef MPM_MPM_BASE_H_
 #define MPM_MPM_BASE_H_
 
+#include <future>
 #include <numeric>
 
 #include <boost/lexical_cast.hpp>
@@ -14,6 +15,8 @@
 // MPI
 #ifdef USE_MPI
 #include "mpi.h"
+
+#include "load_balancer.h"
 #endif
 
 #ifdef USE_GRAPH_PARTITIONING
@@ -84,6 +87,12 @@ class MPMBase : public MPM {
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
 
+  //! Check whether the domain decomposition is due at the current step
+  //! \details Every nload_balance_steps for the graph partitioner; the
+  //! incremental load balancer instead measures the imbalance every
+  //! check_steps and only moves cells when it exceeds the threshold
+  bool load_balance_due() const;
+
   //! Output results
   //! \param[in] step Time step
   void write_outputs(mpm::Index step) override;
@@ -113,6 +122,14 @@ class MPMBase : public MPM {
           std::shared_ptr<mpm::SolverBase<Eigen::SparseMatrix<double>>>>&
           linear_solver);
 
+  //! Compute the time step from the CFL condition
+  //! \details Safety factor times the smallest cell length / (wave velocity +
+  //! particle speed) over all ranks, limited to the bounds of the analysis
+  //! \param[in] dt Time step kept if no particle limits it
+  //! \param[in] phase Phase of the particles
+  //! \retval dt Time step size
+  double cfl_time_step(double dt, unsigned phase = mpm::ParticlePhase::Solid);
+
   //! Write HDF5 files
   void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
 
@@ -282,6 +299,20 @@ class MPMBase : public MPM {
   tsl::robin_map<mpm::VariableType, std::vector<std::string>> vtk_vars_;
   //! VTK state variables
   tsl::robin_map<unsigned, std::vector<std::string>> vtk_statevars_;
+  //! Adapt the time step to the CFL condition
+  bool cfl_time_step_{false};
+  //! Safety factor applied to the critical time step
+  double cfl_safety_factor_{0.5};
+  //! Number of steps between updates of the time step
+  mpm::Index cfl_nsteps_{1};
+  //! Smallest time step size
+  double dt_min_{0.};
+  //! Largest time step size
+  double dt_max_{std::numeric_limits<double>::max()};
+  //! Write VTK output on a background thread
+  bool vtk_async_{false};
+  //! VTK output in progress
+  std::future<void> vtk_output_;
   //! Set node concentrated force
   bool set_node_concentrated_force_{false};
   //! Damping type
@@ -309,6 +340,15 @@ class MPMBase : public MPM {
   // graph pass the address of the container of cell
   std::shared_ptr<Graph<Tdim>> graph_{nullptr};
 #endif
+
+#ifdef USE_MPI
+  // Incremental load balancer, used after the initial decomposition if set
+  std::shared_ptr<LoadBalancer<Tdim>> load_balancer_{nullptr};
+  // Cost of a particle of each material for load balancing
+  std::map<unsigned, double> material_costs_;
+  // Number of steps between measurements of the imbalance
+  mpm::Index load_balance_check_steps_{1};
+#endif
 };  // MPMBase class
 }  // namespace mpm
 
@@ -47,10 +47,47 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
       nload_balance_steps_ =
           analysis_["nload_balance_steps"].template get<mpm::Index>();
 
+#ifdef USE_MPI
+    // Incremental load balancing, triggered by the imbalance measured every
+    // check_steps
+    if (analysis_.find("load_balancing") != analysis_.end()) {
+      const auto& balancing = analysis_["load_balancing"];
+      double imbalance = 0.05;
+      if (balancing.contains("imbalance"))
+        imbalance = balancing["imbalance"].template get<double>();
+      load_balancer_ = std::make_shared<LoadBalancer<Tdim>>(imbalance);
+
+      if (balancing.contains("check_steps"))
+        load_balance_check_steps_ = std::max<mpm::Index>(
+            1, balancing["check_steps"].template get<mpm::Index>());
+
+      if (balancing.contains("material_costs"))
+        for (const auto& material_cost : balancing["material_costs"])
+          material_costs_[material_cost.at("material_id")
+                              .template get<unsigned>()] =
+              material_cost.at("cost").template get<double>();
+    }
+#endif
+
     // Locate particles
     if (analysis_.find("locate_particles") != analysis_.end())
       locate_particles_ = analysis_["locate_particles"].template get<bool>();
 
+    // CFL-based adaptive time step, the input dt sets the output schedule
+    if (analysis_.find("cfl_time_step") != analysis_.end()) {
+      const auto& cfl = analysis_["cfl_time_step"];
+      cfl_time_step_ = true;
+      if (cfl.contains("safety_factor"))
+        cfl_safety_factor_ = cfl["safety_factor"].template get<double>();
+      if (cfl.contains("nsteps"))
+        cfl_nsteps_ =
+            std::max(cfl["nsteps"].template get<mpm::Index>(), mpm::Index(1));
+      if (cfl.contains("dt_min"))
+        dt_min_ = cfl["dt_min"].template get<double>();
+      if (cfl.contains("dt_max"))
+        dt_max_ = cfl["dt_max"].template get<double>();
+    }
+
     // Stress rate method (None/Jaumann)
     try {
       if (analysis_.find("stress_rate") != analysis_.end()) {
@@ -206,6 +243,10 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     console_->warn(
         "{} #{}: No VTK statevariable were specified, none will be generated",
         __FILE__, __LINE__);
+
+  // Write VTK output on a background thread
+  if (post_process_.contains("vtk_async"))
+    vtk_async_ = post_process_.at("vtk_async").template get<bool>();
 }
 
 // Initialise mesh
@@ -583,124 +624,94 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
 
-  // VTK PolyData writer
-  auto vtk_writer = std::make_unique<VtkWriter>(mesh_->particle_coordinates());
-
-  // Write mesh on step 0
+  // Write mesh on load balancing steps
   // Get active node pairs use true
-  if (step % nload_balance_steps_ == 0)
-    vtk_writer->write_mesh(
+  if (step % nload_balance_steps_ == 0) {
+    VtkWriter vtk_writer(std::vector<Eigen::Matrix<double, 3, 1>>{});
+    vtk_writer.write_mesh(
         io_->output_file("mesh", ".vtp", uuid_, step, max_steps).string(),
         mesh_->nodal_coordinates(), mesh_->node_pairs(true));
+  }
 
-  // Write input geometry to vtk file
-  const std::string extension = ".vtp";
-  const std::string attribute = "geometry";
-  auto meshfile =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  vtk_writer->write_geometry(meshfile);
+  // Particle fields, all written to a single piece
+  mpm::VtpPiece piece;
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar))
+    piece.fields.push_back(
+        {attribute, attribute, mpm::VtpField::Kind::Scalar, 0, 1, {}});
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector))
+    piece.fields.push_back(
+        {attribute, attribute, mpm::VtpField::Kind::Vector, 0, 3, {}});
+  // Tensors in Voigt order xx, yy, zz, xy, yz, xz
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor))
+    piece.fields.push_back(
+        {attribute, attribute, mpm::VtpField::Kind::Tensor, 0, 6, {}});
+  for (auto const& vtk_statevar : vtk_statevars_) {
+    unsigned phase_id = vtk_statevar.first;
+    for (const auto& attribute : vtk_statevar.second)
+      piece.fields.push_back(
+          {attribute, "phase" + std::to_string(phase_id) + attribute,
+           mpm::VtpField::Kind::StateVariable, phase_id, 1, {}});
+  }
 
-  // MPI parallel vtk file
-  int mpi_rank = 0;
-  int mpi_size = 1;
-  bool write_mpi_rank = false;
+  // Gather straight from the particles into the output buffers
+  mesh_->gather_particles_output(piece);
+
+  auto file =
+      io_->output_file("particles", ".vtp", uuid_, step, max_steps).string();
 
+  // MPI parallel vtk file, written by rank 0 and listing the piece of each
+  // rank
+  std::string parallel_file;
+  std::vector<std::string> sources;
 #ifdef USE_MPI
-  // Get MPI rank
+  int mpi_rank = 0;
+  int mpi_size = 1;
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  // Get number of MPI ranks
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-#endif
-
-  //! VTK scalar variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar)) {
-    // Write scalar
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_scalar_point_data(
-        file, mesh_->particles_scalar_data(attribute), attribute);
-
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps, 1);
-    }
-#endif
-  }
-
-  //! VTK vector variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_vector_point_data(
-        file, mesh_->particles_vector_data(attribute), attribute);
 
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps, 3);
+  if (mpi_size > 1) {
+    // Pieces are listed relative to the index, which is in the same directory
+    const unsigned length = 256;
+    std::vector<char> name(length, '\0');
+    const std::string filename =
+        boost::filesystem::path(file).filename().string();
+    filename.copy(name.data(), length - 1);
+
+    std::vector<char> names(mpi_rank == 0 ? length * mpi_size : 0);
+    MPI_Gather(name.data(), length, MPI_CHAR, names.data(), length, MPI_CHAR, 0,
+               MPI_COMM_WORLD);
+
+    if (mpi_rank == 0) {
+      for (int i = 0; i < mpi_size; ++i)
+        sources.emplace_back(names.data() + i * length);
+      parallel_file = io_->output_file("particles", ".pvtp", uuid_, step,
+                                       max_steps, false)
+                          .string();
     }
-#endif
   }
-
-  //! VTK tensor variables
-  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor)) {
-    // Write vector
-    auto file =
-        io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-    vtk_writer->write_tensor_point_data(
-        file, mesh_->template particles_tensor_data<6>(attribute), attribute);
-
-    // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-    if (mpi_rank == 0 && mpi_size > 1) {
-      auto parallel_file = io_->output_file(attribute, ".pvtp", uuid_, step,
-                                            max_steps, write_mpi_rank)
-                               .string();
-
-      vtk_writer->write_parallel_vtk(parallel_file, attribute, mpi_size, step,
-                                     max_steps, 9);
-    }
 #endif
-  }
 
-  // VTK state variables
-  for (auto const& vtk_statevar : vtk_statevars_) {
-    unsigned phase_id = vtk_statevar.first;
-    for (const auto& attribute : vtk_statevar.second) {
-      std::string phase_attribute =
-          "phase" + std::to_string(phase_id) + attribute;
-      // Write state variables
-      auto file =
-          io_->output_file(phase_attribute, extension, uuid_, step, max_steps)
-              .string();
-      vtk_writer->write_scalar_point_data(
-          file, mesh_->particles_statevars_data(attribute, phase_id),
-          phase_attribute);
-      // Write a parallel MPI VTK container file
-#ifdef USE_MPI
-      if (mpi_rank == 0 && mpi_size > 1) {
-        auto parallel_file = io_->output_file(phase_attribute, ".pvtp", uuid_,
-                                              step, max_steps, write_mpi_rank)
-                                 .string();
-        unsigned ncomponents = 1;
-        vtk_writer->write_parallel_vtk(parallel_file, phase_attribute, mpi_size,
-                                       step, max_steps, ncomponents);
-      }
-#endif
-    }
-  }
+  // Finish the previous output before starting this one
+  if (vtk_output_.valid()) vtk_output_.get();
+
+  auto write = [console = console_, file = std::move(file),
+                parallel_file = std::move(parallel_file),
+                sources = std::move(sources), piece = std::move(piece)]() {
+    if (!mpm::vtp::write_piece(file, piece))
+      console->error("{} #{}: Failed to write VTK file {}", __FILE__, __LINE__,
+                     file);
+    if (!parallel_file.empty() &&
+        !mpm::vtp::write_index(parallel_file, piece, sources))
+      console->error("{} #{}: Failed to write VTK file {}", __FILE__, __LINE__,
+                     parallel_file);
+  };
+
+  // The piece owns a copy of the data, so the analysis may continue while a
+  // background thread writes it
+  if (vtk_async_)
+    vtk_output_ = std::async(std::launch::async, std::move(write));
+  else
+    write();
 }
 #endif
 
@@ -730,6 +741,25 @@ void mpm::MPMBase<Tdim>::write_partio(mpm::Index step, mpm::Index max_steps) {
 }
 #endif  // USE_PARTIO
 
+//! Compute the time step from the CFL condition
+template <unsigned Tdim>
+double mpm::MPMBase<Tdim>::cfl_time_step(double dt, unsigned phase) {
+  // Wave velocity of each material
+  std::map<unsigned, double> wave_velocities;
+  for (const auto& material : materials_)
+    wave_velocities[material.first] = material.second->pwave_velocity();
+
+  double critical_dt = mesh_->critical_time_step(wave_velocities, phase);
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &critical_dt, 1, MPI_DOUBLE, MPI_MIN,
+                MPI_COMM_WORLD);
+#endif
+
+  if (critical_dt < std::numeric_limits<double>::max())
+    dt = cfl_safety_factor_ * critical_dt;
+  return std::min(std::max(dt, dt_min_), dt_max_);
+}
+
 //! Output results
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_outputs(mpm::Index step) {
@@ -1673,6 +1703,17 @@ bool mpm::MPMBase<Tdim>::initialise_damping(const Json& damping_props) {
   return status;
 }
 
+//! Check whether the domain decomposition is due at the current step
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::load_balance_due() const {
+  if (step_ == 0) return false;
+#ifdef USE_MPI
+  if (load_balancer_ != nullptr)
+    return step_ % load_balance_check_steps_ == 0;
+#endif
+  return step_ % nload_balance_steps_ == 0;
+}
+
 //! Domain decomposition
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
@@ -1688,6 +1729,35 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
 
   if (mpi_size > 1 && mesh_->ncells() > 1) {
 
+    // Incremental rebalancing after the initial decomposition
+    if (!initial_step && load_balancer_ != nullptr) {
+      auto mpi_balance_begin = std::chrono::steady_clock::now();
+
+      // Move boundary cells only if the measured imbalance is too large
+      auto exchange_cells = load_balancer_->rebalance(
+          mesh_->cells(), mesh_->compute_cell_costs(material_costs_),
+          MPI_COMM_WORLD);
+      if (exchange_cells.empty()) return;
+
+      // Identify shared nodes across MPI domains
+      mesh_->find_domain_shared_nodes();
+      // Identify ghost boundary cells
+      mesh_->find_ghost_boundary_cells();
+      // Transfer the particles of the moved cells
+      mesh_->transfer_nonrank_particles(exchange_cells);
+
+      auto mpi_balance_end = std::chrono::steady_clock::now();
+      console_->info(
+          "Rank {}, Load balancing at imbalance {}: {} cells moved in {} ms",
+          mpi_rank, load_balancer_->measured_imbalance(),
+          exchange_cells.size(),
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              mpi_balance_end - mpi_balance_begin)
+              .count());
+      return;
+    }
+
+#ifdef USE_GRAPH_PARTITIONING
     // Initialize MPI
     MPI_Comm comm;
     MPI_Comm_dup(MPI_COMM_WORLD, &comm);
@@ -1695,7 +1765,6 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
     auto mpi_domain_begin = std::chrono::steady_clock::now();
     console_->info("Rank {}, Domain decomposition started\n", mpi_rank);
 
-#ifdef USE_GRAPH_PARTITIONING
     // Create graph object if empty
     if (initial_step || graph_ == nullptr)
       graph_ = std::make_shared<Graph<Tdim>>(mesh_->cells());
@@ -1724,12 +1793,12 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
     else
       mesh_->transfer_nonrank_particles(exchange_cells);
 
-#endif
     auto mpi_domain_end = std::chrono::steady_clock::now();
     console_->info("Rank {}, Domain decomposition: {} ms", mpi_rank,
                    std::chrono::duration_cast<std::chrono::milliseconds>(
                        mpi_domain_end - mpi_domain_begin)
                        .count());
+#endif
   }
 #endif  // MPI
 }
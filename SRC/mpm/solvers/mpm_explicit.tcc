@@ -107,22 +107,43 @@ bool mpm::MPMExplicit<Tdim>::solve() {
   // Write initial outputs
   if (!resume) this->write_outputs(this->step_);
 
+  // With a CFL time step, the input dt still sets the output times and the
+  // duration of the analysis, and outputs are numbered by its steps
+  const bool cfl_time_step = this->cfl_time_step_;
+  const double dt_input = dt_;
+  const double end_time = nsteps_ * dt_input;
+  const double tolerance = 1.E-6 * dt_input;
+  const mpm::Index first_step = step_;
+  mpm::Index output_step = step_ - step_ % output_steps_;
+  double time = step_ * dt_input;
+  double dt_cfl = dt_input;
+
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
-
-    if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
+  for (; cfl_time_step ? time < end_time - tolerance : step_ < nsteps_;
+       ++step_) {
+
+    if (cfl_time_step) {
+      // Update the time step, ending it at the next output
+      if ((step_ - first_step) % this->cfl_nsteps_ == 0)
+        dt_cfl = this->cfl_time_step(dt_input);
+      const double output_time = (output_step + output_steps_) * dt_input;
+      dt_ = std::min(dt_cfl, output_time - time);
+      mpm_scheme_->assign_time_step(dt_, time);
+
+      if (mpi_rank == 0)
+        console_->info("Step: {}, time: {} of {}, dt: {}.\n", step_, time,
+                       end_time, dt_);
+    } else if (mpi_rank == 0)
+      console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
-      this->mpi_domain_decompose(false);
-#endif
+    if (this->load_balance_due()) this->mpi_domain_decompose(false);
 #endif
 
     // Inject particles
-    mesh_->inject_particles(step_ * dt_);
+    mesh_->inject_particles(time);
 
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
@@ -173,7 +194,17 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 #endif
 
     // Write outputs
-    this->write_outputs(this->step_ + 1);
+    if (cfl_time_step) {
+      time += dt_;
+      if (time >= (output_step + output_steps_) * dt_input - tolerance) {
+        output_step += output_steps_;
+        time = output_step * dt_input;
+        this->write_outputs(output_step);
+      }
+    } else {
+      time = (step_ + 1) * dt_;
+      this->write_outputs(this->step_ + 1);
+    }
   }
   auto solver_end = std::chrono::steady_clock::now();
   console_->info("Rank {}, Explicit {} solver duration: {} ms", mpi_rank,
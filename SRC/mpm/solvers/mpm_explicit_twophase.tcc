@@ -162,11 +162,8 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
-      this->mpi_domain_decompose(false);
-#endif
+    if (this->load_balance_due()) this->mpi_domain_decompose(false);
 #endif
 
     // Inject particles
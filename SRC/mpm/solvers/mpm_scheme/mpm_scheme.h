@@ -93,6 +93,23 @@ class MPMScheme {
   //! \retval scheme Stress update scheme
   virtual inline std::string scheme() const = 0;
 
+  //! Assign the time step size and the time at the start of the step
+  //! \details Used when the time step changes during the analysis; the time
+  //! of loads and constraints is then the assigned time instead of step * dt
+  //! \param[in] dt Time step size
+  //! \param[in] time Time at the start of the step
+  void assign_time_step(double dt, double time) {
+    dt_ = dt;
+    time_ = time;
+    variable_dt_ = true;
+  }
+
+  //! Time at the start of a step
+  //! \param[in] step Number of step in solver
+  double time(unsigned step) const {
+    return variable_dt_ ? time_ : step * dt_;
+  }
+
   /**
    * \defgroup Implicit Functions dealing with implicit MPM
    */
@@ -140,6 +157,10 @@ class MPMScheme {
   std::shared_ptr<mpm::Mesh<Tdim>> mesh_;
   //! Time increment
   double dt_;
+  //! Time at the start of the step, if the time step is variable
+  double time_{0.};
+  //! Time step assigned during the analysis
+  bool variable_dt_{false};
   //! MPI Size
   int mpi_size_ = 1;
   //! MPI rank
@@ -51,16 +51,38 @@ inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
   if (mpi_size_ > 1) {
-    // MPI all reduce nodal mass
-    mesh_->template nodal_halo_exchange<double, 1>(
-        std::bind(&mpm::NodeBase<Tdim>::mass, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_mass, std::placeholders::_1,
-                  false, phase, std::placeholders::_2));
-    // MPI all reduce nodal momentum
-    mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::momentum, std::placeholders::_1, phase),
+    // Exchange nodal mass and momentum with the neighbouring ranks
+    mpm::NodalHaloExchange<double> mass;
+    mesh_->template begin_nodal_halo_exchange<double, 1>(
+        mass,
+        std::bind(&mpm::NodeBase<Tdim>::mass, std::placeholders::_1, phase));
+    mpm::NodalHaloExchange<Eigen::Matrix<double, Tdim, 1>> momentum;
+    mesh_->template begin_nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>,
+                                              Tdim>(
+        momentum,
+        std::bind(&mpm::NodeBase<Tdim>::momentum, std::placeholders::_1, phase));
+
+    // Compute velocity of the interior nodes while the messages are in flight
+    mesh_->iterate_over_interior_nodes_predicate(
+        std::bind(&mpm::NodeBase<Tdim>::compute_velocity,
+                  std::placeholders::_1),
+        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+
+    mesh_->template finish_nodal_halo_exchange<double, 1>(
+        mass, std::bind(&mpm::NodeBase<Tdim>::update_mass, std::placeholders::_1,
+                        false, phase, std::placeholders::_2));
+    mesh_->template finish_nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>,
+                                               Tdim>(
+        momentum,
         std::bind(&mpm::NodeBase<Tdim>::update_momentum, std::placeholders::_1,
                   false, phase, std::placeholders::_2));
+
+    // Then the velocity of the nodes shared with other ranks
+    mesh_->iterate_over_domain_shared_nodes_predicate(
+        std::bind(&mpm::NodeBase<Tdim>::compute_velocity,
+                  std::placeholders::_1),
+        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+    return;
   }
 #endif
 
@@ -132,14 +154,14 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
                     std::placeholders::_1, gravity));
 
       // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
+      mesh_->apply_traction_on_particles(this->time(step));
 
       // Iterate over each node to add concentrated node force to external
       // force
       if (concentrated_nodal_forces)
         mesh_->iterate_over_nodes(
             std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+                      std::placeholders::_1, phase, this->time(step)));
     }
 
 #pragma omp section
@@ -198,7 +220,7 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
     bool update_defgrad) {
 
   // Update nodal acceleration constraints
-  mesh_->update_nodal_acceleration_constraints(step * dt_);
+  mesh_->update_nodal_acceleration_constraints(this->time(step));
 
   // Check if damping has been specified and accordingly Iterate over
   // active nodes to compute acceleratation and velocity
@@ -136,14 +136,14 @@ inline void mpm::MPMSchemeNewmark<Tdim>::compute_forces(
                       std::placeholders::_1));
 
       // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
+      mesh_->apply_traction_on_particles(this->time(step));
 
       // Iterate over each node to add concentrated node force to external
       // force
       if (concentrated_nodal_forces)
         mesh_->iterate_over_nodes(
             std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+                      std::placeholders::_1, phase, this->time(step)));
     }
 
 #pragma omp section
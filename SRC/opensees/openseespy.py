@@ -419,6 +419,62 @@ class Model:
     def lift(self, type_name: str, tag: int):
         return _lift(self._openseespy._interp._tcl.interpaddr(), type_name, tag)
 
+    def batch(self, records, dt, scale=1.0, response=(), dof=1, steps=0, workers=None):
+        """
+        Run the current transient analysis once for each record in ``records``,
+        each starting from the present committed state of the model.
+
+        ``response`` is a sequence of ``(node, dof, type)`` tuples where ``type``
+        is one of ``"displ"``, ``"veloc"``, ``"accel"`` or ``"react"``. Returns
+        an array of shape ``(len(records), steps, len(response))`` and an array
+        with the number of steps completed for each record.
+        """
+        import os
+        from opensees import OpenSeesPyRT as libOpenSeesRT
+        if workers is None:
+            workers = os.cpu_count() or 1
+        return libOpenSeesRT.run_batch(self._openseespy._interp._tcl.interpaddr(),
+                                       list(records), dt, scale,
+                                       [(int(n), int(d), str(t)) for n, d, t in response],
+                                       int(dof), int(steps), int(workers))
+
+    def modes(self, num_modes, shift=0.0, ncv=0, tolerance=1e-10, threads=1, reuse=False):
+        """
+        Find the ``num_modes`` modes with eigenvalues nearest ``shift`` by
+        shift-invert Lanczos on the sparse system of the current analysis.
+
+        Returns the eigenvalues, an array of shape ``(num_modes, equations)``
+        holding the mass-normalized mode shapes, and an array of shape
+        ``(equations, 2)`` with the node tag and dof of each equation. Only
+        converged modes are returned, so there may be fewer than ``num_modes``;
+        a warning is printed in that case. With ``reuse``, the factorization
+        left by the last converged static step is used if that step was taken
+        with Newton or Linear.
+        """
+        from opensees import OpenSeesPyRT as libOpenSeesRT
+        return libOpenSeesRT.solve_modes(self._openseespy._interp._tcl.interpaddr(),
+                                         int(num_modes), float(shift), int(ncv),
+                                         float(tolerance), int(threads), bool(reuse))
+
+    def analyze(self, *args, release_gil=False, **kwds):
+        """
+        Take ``steps`` steps of the current analysis, with a time step ``dt``
+        for transient analyses. Other options are passed on to the ``analyze``
+        command.
+
+        With ``release_gil``, the steps are taken with the GIL released so that
+        other Python threads can run meanwhile. Element scratch storage and
+        some globals are still shared by all models, so no other model may be
+        analyzed while these steps are taken.
+        """
+        if (release_gil and not kwds and 1 <= len(args) <= 2 and self._openseespy._echo is None
+                and all(isinstance(a, (int, float)) for a in args)):
+            from opensees import OpenSeesPyRT as libOpenSeesRT
+            return libOpenSeesRT.analyze(self._openseespy._interp._tcl.interpaddr(),
+                                         int(args[0]), float(args[1]) if len(args) > 1 else 0.0,
+                                         True)
+        return self._openseespy._invoke_proc("analyze", *args, **kwds)
+
     # def invoke(self, *args, **kwds):
     #     if len(args) == 2:
     #         from ._invoke import _Handle
@@ -666,6 +722,7 @@ __all__ = [
     "database",
     "save",
     "restore",
+    "snapshot",
     "eleForce",
     "eleDynamicalForce",
     "nodeUnbalance",
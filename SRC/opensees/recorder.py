@@ -67,10 +67,10 @@ class Recorder:
         if format is None:
             format = self.destination.split(".")[-1]
 
-        if format not in ["txt", "bin", "xml", "binary", "tcp"]:
+        if format not in ["txt", "bin", "xml", "binary", "tcp", "enc", "encoded"]:
             raise ValueError("Unable to deduce format")
 
-        format = {"txt": "file", "bin": "binary"}.get(format, format)
+        format = {"txt": "file", "bin": "binary", "enc": "encoded"}.get(format, format)
 
         self._args[0].flag = "-" + format
 
@@ -81,6 +81,8 @@ class Recorder:
         return runtime.send(self)
 
     def parse(self):
+        if self._args[0].flag == "-encoded":
+            return read_encoded(self.destination)
         if self.dest_txt:
             with open(self.dest_txt, "r") as f:
                 return self.parse_txt(f)
@@ -175,3 +177,95 @@ class Element:
 #         $arg1 $arg2 ...	arguments which are passed to the `setResponse()` element method
 # 
 
+
+
+#
+# Encoded binary output (recorder ... -encoded, or -binary with -float32,
+# -delta, -quantize or -compress); see EncodedFileStream.h for the layout.
+#
+_ENCODED_MAGIC = b"OPSENC01"
+_FLOAT32, _DELTA, _QUANTIZED = 1, 2, 4
+_ZSTD, _LZ4 = 1, 2
+
+def _decompress(codec, payload, size):
+    if codec == _ZSTD:
+        try:
+            import zstandard
+        except ImportError:
+            raise ImportError("reading zstd compressed output requires the zstandard package")
+        return zstandard.ZstdDecompressor().decompress(payload, max_output_size=size)
+    elif codec == _LZ4:
+        try:
+            import lz4.block
+        except ImportError:
+            raise ImportError("reading LZ4 compressed output requires the lz4 package")
+        return lz4.block.decompress(payload, uncompressed_size=size)
+    return payload
+
+def _decode_varints(data):
+    import numpy as np
+    b = np.frombuffer(data, dtype=np.uint8)
+    if len(b) == 0:
+        return np.zeros(0, dtype=np.int64)
+    end = (b & 0x80) == 0
+    start = np.flatnonzero(np.concatenate(([True], end[:-1])))
+    group = np.cumsum(np.concatenate(([0], end[:-1])))
+    shift = 7*(np.arange(len(b)) - start[group])
+    z = np.add.reduceat((b & 0x7f).astype(np.uint64) << shift.astype(np.uint64), start)
+    return (z >> np.uint64(1)).astype(np.int64) ^ -(z & np.uint64(1)).astype(np.int64)
+
+def read_encoded(filename):
+    """
+    Read the output of an encoded recorder as an array with one row per
+    record. If the number of columns changed during the analysis, a list
+    of arrays is returned, one for each run of records of equal width.
+    """
+    import numpy as np
+
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:8] != _ENCODED_MAGIC:
+        raise ValueError(f"{filename} is not an encoded recorder file")
+    flags, codec = np.frombuffer(data, dtype=np.int32, count=2, offset=8)
+
+    blocks = []
+    pos = 24
+    while pos + 24 <= len(data):
+        rows, cols = np.frombuffer(data, dtype=np.int32, count=2, offset=pos)
+        size, stored = np.frombuffer(data, dtype=np.int64, count=2, offset=pos + 8)
+        pos += 24
+        if flags & _QUANTIZED:
+            step = np.frombuffer(data, dtype=np.float64, count=cols, offset=pos)
+            pos += 8*cols
+        if pos + stored > len(data):
+            break # chunk cut short by an interrupted run
+
+        raw = _decompress(codec, data[pos:pos + stored], int(size))
+        pos += stored
+
+        if flags & _QUANTIZED:
+            q = _decode_varints(raw).reshape(cols, rows)
+            if flags & _DELTA:
+                q = np.cumsum(q, axis=1)
+            block = q*step[:, None]
+        else:
+            word = np.uint32 if flags & _FLOAT32 else np.uint64
+            real = np.float32 if flags & _FLOAT32 else np.float64
+            w = np.frombuffer(raw, dtype=word).reshape(cols, rows)
+            if flags & _DELTA:
+                w = np.bitwise_xor.accumulate(w, axis=1)
+            block = w.view(real)
+
+        block = block.T
+        if blocks and blocks[-1][-1].shape[1] == cols:
+            blocks[-1].append(block)
+        else:
+            blocks.append([block])
+
+    arrays = [np.concatenate(run) for run in blocks]
+    if len(arrays) == 0:
+        return np.zeros((0, 0))
+    elif len(arrays) == 1:
+        return arrays[0]
+    return arrays
@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of WeightedMetis.
+//
+#include <WeightedMetis.h>
+#include <OPS_Globals.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <ID.h>
+
+#include <math.h>
+#include <limits.h>
+#include <map>
+#include <vector>
+
+extern "C" {
+#include <metis.h>
+}
+
+// Integer weight given to the heaviest vertex
+static const double weightResolution = 1000.0;
+
+WeightedMetis::WeightedMetis(double imb)
+  : GraphPartitioner(), imbalance(imb)
+{
+  if (imbalance < 0.001)
+    imbalance = 0.001;
+}
+
+WeightedMetis::~WeightedMetis()
+{
+
+}
+
+int
+WeightedMetis::partition(Graph &theGraph, int numPart)
+{
+  idx_t numVertex = theGraph.getNumVertex();
+  if (numVertex == 0)
+    return 0;
+
+  //
+  // number the vertices 0 through numVertex-1 and collect their weights
+  //
+  std::map<int, idx_t> index;
+  std::vector<Vertex *> vertices;
+  vertices.reserve(numVertex);
+  double maxWeight = 0.0, minWeight = 0.0;
+
+  VertexIter &theVertices = theGraph.getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0) {
+    index[vertexPtr->getTag()] = (idx_t)vertices.size();
+    vertices.push_back(vertexPtr);
+    double weight = vertexPtr->getWeight();
+    if (weight > 0.0) {
+      maxWeight = (weight > maxWeight) ? weight : maxWeight;
+      minWeight = (minWeight == 0.0 || weight < minWeight) ? weight : minWeight;
+    }
+  }
+
+  if (numPart < 2) {
+    for (Vertex *vertex : vertices)
+      vertex->setColor(1);
+    return 0;
+  }
+
+  //
+  // adjacency in compressed row form
+  //
+  std::vector<idx_t> xadj(numVertex + 1, 0);
+  std::vector<idx_t> adjncy;
+  adjncy.reserve(2*theGraph.getNumEdge());
+  for (idx_t i = 0; i < numVertex; i++) {
+    const ID &adjacency = vertices[i]->getAdjacency();
+    for (int j = 0; j < adjacency.Size(); j++) {
+      auto other = index.find(adjacency(j));
+      if (other != index.end() && other->second != i)
+        adjncy.push_back(other->second);
+    }
+    xadj[i + 1] = (idx_t)adjncy.size();
+  }
+
+  //
+  // integer vertex weights, the sum of which must fit in an idx_t
+  //
+  std::vector<idx_t> vwgt;
+  if (maxWeight > 0.0) {
+    double resolution = weightResolution;
+    if (resolution*numVertex > (double)INT_MAX)
+      resolution = (double)INT_MAX/numVertex;
+    vwgt.resize(numVertex);
+    for (idx_t i = 0; i < numVertex; i++) {
+      double weight = vertices[i]->getWeight();
+      if (weight <= 0.0)
+        weight = minWeight;
+      idx_t w = (idx_t)floor(weight/maxWeight*resolution + 0.5);
+      vwgt[i] = (w < 1) ? 1 : w;
+    }
+  }
+
+  idx_t ncon = 1;
+  idx_t nparts = numPart;
+  real_t ubvec = 1.0 + imbalance;
+  idx_t options[METIS_NOPTIONS];
+  METIS_SetDefaultOptions(options);
+  options[METIS_OPTION_NUMBERING] = 0;
+
+  idx_t edgecut = 0;
+  std::vector<idx_t> part(numVertex, 0);
+  idx_t *weights = vwgt.empty() ? nullptr : vwgt.data();
+
+  int status;
+  if (numPart > 8)
+    status = METIS_PartGraphKway(&numVertex, &ncon, xadj.data(), adjncy.data(),
+                                 weights, nullptr, nullptr, &nparts, nullptr,
+                                 &ubvec, options, &edgecut, part.data());
+  else
+    status = METIS_PartGraphRecursive(&numVertex, &ncon, xadj.data(), adjncy.data(),
+                                      weights, nullptr, nullptr, &nparts, nullptr,
+                                      &ubvec, options, &edgecut, part.data());
+
+  if (status != METIS_OK) {
+    opserr << "WeightedMetis::partition - METIS failed with error " << status << endln;
+    return -1;
+  }
+
+  // parts are numbered from 1
+  for (idx_t i = 0; i < numVertex; i++)
+    vertices[i]->setColor(part[i] + 1);
+
+  return 0;
+}
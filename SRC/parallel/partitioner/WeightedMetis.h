@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the class definition for WeightedMetis,
+// a GraphPartitioner that calls METIS with the weights of the vertices, so
+// that the parts have equal total weight rather than an equal number of
+// vertices. When the element graph of a domain carries the cost of each
+// element as vertex weight, the subdomains get equal amounts of work.
+//
+// Vertices with no weight count as the lightest weighted vertex; if no
+// vertex has a weight the graph is partitioned by vertex count.
+//
+#ifndef WeightedMetis_h
+#define WeightedMetis_h
+
+#include <GraphPartitioner.h>
+
+class WeightedMetis : public GraphPartitioner
+{
+  public:
+    // imbalance: allowed ratio of the heaviest part to the mean, less 1
+    WeightedMetis(double imbalance = 0.03);
+    virtual ~WeightedMetis();
+
+    virtual int partition(Graph &theGraph, int numPart);
+
+  private:
+    double imbalance;
+};
+
+#endif
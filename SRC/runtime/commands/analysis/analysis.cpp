@@ -19,6 +19,7 @@
 #include <AnalysisModel.h>
 
 #include "BasicAnalysisBuilder.h"
+#include "LanczosEigen.h"
 
 #include <EigenSOE.h>
 #include <LinearSOE.h>
@@ -192,7 +193,101 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
       if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
         return TCL_ERROR;
 
-      if (argc == 6) {
+      // analyze numIncr dT dtMin dtMax Jd takes no options
+      double number;
+      bool variable = (argc == 6 && Tcl_GetDouble(nullptr, argv[3], &number) == TCL_OK);
+
+      bool adaptive = false;
+      BasicAnalysisBuilder::StepControl control;
+      BasicAnalysisBuilder::ModalControl modal;
+      for (int i=3; i<argc && !variable; i++) {
+        if (strcmp(argv[i], "-operation") == 0) {
+          // parsed above
+          i++;
+        }
+        else if (strcmp(argv[i], "-adaptive") == 0) {
+          adaptive = true;
+        }
+        else if (strcmp(argv[i], "-modal") == 0 && i+1 < argc) {
+          if (Tcl_GetInt(interp, argv[++i], &modal.numModes) != TCL_OK)
+            return TCL_ERROR;
+          if (modal.numModes < 1) {
+            opserr << G3_ERROR_PROMPT << "-modal needs a positive number of modes\n";
+            return TCL_ERROR;
+          }
+        }
+        else if (strcmp(argv[i], "-damping") == 0 && i+1 < argc) {
+          int n;
+          TCL_Char **items;
+          if (Tcl_SplitList(interp, argv[++i], &n, &items) != TCL_OK)
+            return TCL_ERROR;
+          modal.damping.resize(n);
+          for (int j=0; j<n; j++)
+            if (Tcl_GetDouble(interp, items[j], &modal.damping[j]) != TCL_OK) {
+              Tcl_Free((char *)items);
+              return TCL_ERROR;
+            }
+          Tcl_Free((char *)items);
+        }
+        else if (strcmp(argv[i], "-nonlinear") == 0 && i+1 < argc) {
+          int n;
+          TCL_Char **items;
+          if (Tcl_SplitList(interp, argv[++i], &n, &items) != TCL_OK)
+            return TCL_ERROR;
+          modal.nonlinear.resize(n);
+          for (int j=0; j<n; j++)
+            if (Tcl_GetInt(interp, items[j], &modal.nonlinear[j]) != TCL_OK) {
+              Tcl_Free((char *)items);
+              return TCL_ERROR;
+            }
+          Tcl_Free((char *)items);
+        }
+        else if (strcmp(argv[i], "-recover") == 0) {
+          modal.recover = true;
+        }
+        else if (strcmp(argv[i], "-tolerance") == 0 && i+1 < argc) {
+          if (Tcl_GetDouble(interp, argv[++i], &control.rtol) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else if (strcmp(argv[i], "-atol") == 0 && i+1 < argc) {
+          if (Tcl_GetDouble(interp, argv[++i], &control.atol) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else if (strcmp(argv[i], "-dtMin") == 0 && i+1 < argc) {
+          if (Tcl_GetDouble(interp, argv[++i], &control.dtMin) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else if (strcmp(argv[i], "-dtMax") == 0 && i+1 < argc) {
+          if (Tcl_GetDouble(interp, argv[++i], &control.dtMax) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else if (strcmp(argv[i], "-safety") == 0 && i+1 < argc) {
+          if (Tcl_GetDouble(interp, argv[++i], &control.safety) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else if (strcmp(argv[i], "-history") == 0 && i+1 < argc) {
+          if (Tcl_GetInt(interp, argv[++i], &control.maxHistory) != TCL_OK)
+            return TCL_ERROR;
+        }
+        else {
+          opserr << G3_ERROR_PROMPT << "transient analysis: unknown option or missing value '"
+                 << argv[i] << "'\n";
+          return TCL_ERROR;
+        }
+      }
+
+      if (modal.numModes > 0) {
+        if (modal.damping.size() > 1 && (int)modal.damping.size() != modal.numModes) {
+          opserr << G3_ERROR_PROMPT << "-damping needs one ratio or one per mode\n";
+          return TCL_ERROR;
+        }
+        result = builder->analyzeModal(numIncr, dT, modal);
+
+      } else if (adaptive) {
+        // numIncr*dT is the interval to cover; dT is the initial step
+        result = builder->analyzeAdaptive(numIncr*dT, dT, control);
+
+      } else if (variable) {
         int Jd;
         double dtMin, dtMax;
         if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)
@@ -222,6 +317,40 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 
+//
+// Return the steps attempted by adaptive analyses as a list of
+// {time dt error iterations accepted}
+//
+static int
+timeStepHistory(ClientData clientData, Tcl_Interp *interp, int argc,
+                TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+
+  bool accepted_only = false;
+  for (int i=1; i<argc; i++)
+    if (strcmp(argv[i], "-accepted") == 0)
+      accepted_only = true;
+
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  for (const auto& step : builder->getStepHistory()) {
+    if (accepted_only && !step.accepted)
+      continue;
+
+    Tcl_Obj *item[5] = {
+      Tcl_NewDoubleObj(step.time),
+      Tcl_NewDoubleObj(step.dt),
+      Tcl_NewDoubleObj(step.error),
+      Tcl_NewIntObj(step.iterations),
+      Tcl_NewBooleanObj(step.accepted)
+    };
+    Tcl_ListObjAppendElement(interp, list, Tcl_NewListObj(5, item));
+  }
+  Tcl_SetObjResult(interp, list);
+  return TCL_OK;
+}
+
 static int
 initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
                    TCL_Char ** const argv)
@@ -263,6 +392,12 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
   bool findSmallest = true;
   int numEigen = 0;
 
+  // shift-invert Lanczos on the LinearSOE of the analysis
+  bool lanczos = false;
+  bool reuse   = false;
+  int  threads = 1;
+  OpenSees::LanczosOptions options;
+
   // Check type of eigenvalue analysis
   while (loc < (argc - 1)) {
     if ((strcmp(argv[loc], "frequency") == 0) ||
@@ -280,6 +415,33 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
     else if ((strcmp(argv[loc], "-findLargest") == 0))
       findSmallest = false;
 
+    else if ((strcmp(argv[loc], "lanczos") == 0) ||
+             (strcmp(argv[loc], "-lanczos") == 0))
+      lanczos = true;
+
+    else if ((strcmp(argv[loc], "-reuse") == 0))
+      reuse = true;
+
+    else if ((strcmp(argv[loc], "-shift") == 0) && loc+2 < argc) {
+      if (Tcl_GetDouble(interp, argv[++loc], &shift) != TCL_OK)
+        return TCL_ERROR;
+    }
+
+    else if ((strcmp(argv[loc], "-ncv") == 0) && loc+2 < argc) {
+      if (Tcl_GetInt(interp, argv[++loc], &options.ncv) != TCL_OK)
+        return TCL_ERROR;
+    }
+
+    else if ((strcmp(argv[loc], "-tolerance") == 0) && loc+2 < argc) {
+      if (Tcl_GetDouble(interp, argv[++loc], &options.tolerance) != TCL_OK)
+        return TCL_ERROR;
+    }
+
+    else if ((strcmp(argv[loc], "-threads") == 0) && loc+2 < argc) {
+      if (Tcl_GetInt(interp, argv[++loc], &threads) != TCL_OK)
+        return TCL_ERROR;
+    }
+
     else if ((strcmp(argv[loc], "genBandArpack") == 0) ||
              (strcmp(argv[loc], "-genBandArpack") == 0) ||
              (strcmp(argv[loc], "genBandArpackEigen") == 0) ||
@@ -326,9 +488,30 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
   //
   // create a transient analysis if no analysis exists
   // 
-  builder->newEigenAnalysis(typeSolver, shift);
+  int result;
+  if (lanczos) {
+    if (!generalizedAlgo || !findSmallest) {
+      opserr << G3_ERROR_PROMPT << "eigen - lanczos finds the modes of the generalized problem nearest the shift\n";
+      return TCL_ERROR;
+    }
+    result = builder->eigenLanczos(numEigen, shift, reuse, threads, options);
+
+    // Only some modes converged; those are returned, nearest the shift
+    // first, after the warning printed by the builder
+    if (result == -3 && builder->getNumEigen() > 0) {
+      numEigen = builder->getNumEigen();
+      result = 0;
+    }
+    if (result < 0) {
+      if (result == -3)
+        opserr << G3_ERROR_PROMPT << "eigen - no mode converged\n";
+      return TCL_ERROR;
+    }
 
-  int result = builder->eigen(numEigen,generalizedAlgo,findSmallest);
+  } else {
+    builder->newEigenAnalysis(typeSolver, shift);
+    result = builder->eigen(numEigen,generalizedAlgo,findSmallest);
+  }
 
   if (result == 0) {
     const Vector &eigenvalues = domain->getEigenvalues();
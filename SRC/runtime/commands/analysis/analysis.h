@@ -20,6 +20,7 @@ static Tcl_CmdProc printB;
 static Tcl_CmdProc initializeAnalysis;
 static Tcl_CmdProc resetModel;
 static Tcl_CmdProc analyzeModel;
+static Tcl_CmdProc timeStepHistory;
 static Tcl_CmdProc specifyConstraintHandler;
 static Tcl_CmdProc modalDamping;
 
@@ -45,9 +46,13 @@ extern Tcl_CmdProc getCTestNorms;
 extern Tcl_CmdProc getCTestIter;
 extern Tcl_CmdProc TclCommand_algorithmRecorder;
 
+// from commands/analysis/snapshot.cpp
+extern Tcl_CmdProc TclCommand_snapshot;
+
 // from commands/analysis/sensitivity.cpp
 extern Tcl_CmdProc TclCommand_sensitivityAlgorithm;
 extern Tcl_CmdProc TclCommand_sensLambda;
+extern Tcl_CmdProc computeGradients;
 
 struct char_cmd {
   const char* name;
@@ -66,6 +71,7 @@ struct char_cmd {
     {"analysis",            &specifyAnalysis},
 
     {"analyze",             &analyzeModel},
+    {"timeStepHistory",     &timeStepHistory},
     {"initialize",          &initializeAnalysis},
     {"modalProperties",     &modalProperties},
     {"modalDamping",        &modalDamping},
@@ -85,8 +91,12 @@ struct char_cmd {
   // recorder.cpp
     {"algorithmRecorder",   &TclCommand_algorithmRecorder},
 
+  // snapshot.cpp
+    {"snapshot",             TclCommand_snapshot},
+
   // sensitivity
     {"sensitivityAlgorithm", TclCommand_sensitivityAlgorithm},
     {"sensLambda",           TclCommand_sensLambda},
+    {"computeGradients",     computeGradients},
 };
 
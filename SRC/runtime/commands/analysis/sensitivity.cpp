@@ -35,7 +35,7 @@ computeGradients(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char**
         return TCL_ERROR;
     }
 
-    if (theIntegrator->computeSensitivities() < 0) {
+    if (builder->computeSensitivities(*theIntegrator) < 0) {
       opserr << OpenSees::PromptValueError << "failed to compute sensitivities\n";
       return TCL_ERROR;
     }
@@ -0,0 +1,259 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Command to checkpoint and restart an analysis.
+//
+//   snapshot save    -file path ?-verify?
+//   snapshot restore -file path ?-verify?
+//
+// (The plain save/restore commands belong to the database.)
+//
+// The Domain (nodes, elements and their materials, constraints, load
+// patterns and the current time), followed by the active integrator, are
+// serialized with sendSelf() into a single binary file. The file may be
+// restored into the same interpreter, or into a new process in which the
+// same analysis has been configured.
+//
+// With -verify, the snapshot is read back into a scratch Domain and the
+// committed nodal response is compared against the live model. The largest
+// absolute difference is returned as the command result.
+//
+// Written: cmp
+//
+#include <tcl.h>
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+#include <algorithm>
+#include <G3_Logging.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Integrator.h>
+#include <StaticIntegrator.h>
+#include <TransientIntegrator.h>
+#include <BasicAnalysisBuilder.h>
+#include <TclPackageClassBroker.h>
+#include <utilities/BinaryFileChannel.h>
+#include "snapshot.h"
+
+static constexpr int SnapshotCommitTag = 0;
+
+static Integrator*
+activeIntegrator(BasicAnalysisBuilder* builder)
+{
+  switch (builder->CurrentAnalysisFlag) {
+    case BasicAnalysisBuilder::STATIC_ANALYSIS:
+      return builder->getStaticIntegrator();
+    case BasicAnalysisBuilder::TRANSIENT_ANALYSIS:
+      return builder->getTransientIntegrator();
+    default:
+      return nullptr;
+  }
+}
+
+//
+// Largest absolute difference in committed nodal response
+// between two domains; returns -1 if the node sets differ.
+//
+static double
+compareDomains(Domain& a, Domain& b)
+{
+  double diff = 0.0;
+
+  NodeIter &nodes = a.getNodes();
+  Node *node;
+  while ((node = nodes()) != nullptr) {
+    Node *other = b.getNode(node->getTag());
+    if (other == nullptr)
+      return -1.0;
+
+    const Vector* pairs[3][2] = {
+      {&node->getDisp(),  &other->getDisp()},
+      {&node->getVel(),   &other->getVel()},
+      {&node->getAccel(), &other->getAccel()}
+    };
+    for (auto& pair : pairs) {
+      if (pair[0]->Size() != pair[1]->Size())
+        return -1.0;
+      for (int i=0; i<pair[0]->Size(); i++)
+        diff = std::max(diff, fabs((*pair[0])(i) - (*pair[1])(i)));
+    }
+  }
+
+  diff = std::max(diff, fabs(a.getCurrentTime() - b.getCurrentTime()));
+  return diff;
+}
+
+static int
+verifySnapshot(Tcl_Interp* interp, const char* filename, Domain& domain)
+{
+  BinaryFileChannel channel(filename, BinaryFileChannel::Read);
+  if (!channel.isOpen())
+    return TCL_ERROR;
+
+  TclPackageClassBroker broker;
+  Domain scratch;
+  if (scratch.recvSelf(SnapshotCommitTag, channel, broker) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to read Domain from snapshot " << filename << "\n";
+    return TCL_ERROR;
+  }
+
+  double diff = compareDomains(domain, scratch);
+  if (diff < 0.0) {
+    opserr << G3_ERROR_PROMPT << "snapshot " << filename << " does not match the model\n";
+    return TCL_ERROR;
+  }
+
+  Tcl_SetObjResult(interp, Tcl_NewDoubleObj(diff));
+  return TCL_OK;
+}
+
+static int
+parseSnapshotArgs(int argc, TCL_Char ** const argv, const char** filename, bool* verify)
+{
+  *filename = nullptr;
+  *verify   = false;
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-file") == 0 && i+1 < argc)
+      *filename = argv[++i];
+    else if (strcmp(argv[i], "-verify") == 0)
+      *verify = true;
+    else if (*filename == nullptr)
+      *filename = argv[i];
+  }
+  return *filename == nullptr ? -1 : 0;
+}
+
+int
+saveSnapshot(BasicAnalysisBuilder& builder, const char* filename)
+{
+  BinaryFileChannel channel(filename, BinaryFileChannel::Write);
+  if (!channel.isOpen())
+    return -1;
+
+  if (builder.getDomain()->sendSelf(SnapshotCommitTag, channel) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to write Domain to snapshot " << filename << "\n";
+    return -1;
+  }
+
+  // Analysis state follows the domain so that a snapshot can be
+  // restored without an analysis having been configured
+  Integrator* integrator = activeIntegrator(&builder);
+  ID info(2);
+  info(0) = builder.CurrentAnalysisFlag;
+  info(1) = integrator != nullptr ? integrator->getClassTag() : -1;
+  if (channel.sendID(0, SnapshotCommitTag, info) < 0 ||
+      (integrator != nullptr && integrator->sendSelf(SnapshotCommitTag, channel) < 0)) {
+    opserr << G3_ERROR_PROMPT << "failed to write analysis state to snapshot " << filename << "\n";
+    return -1;
+  }
+  return 0;
+}
+
+int
+restoreSnapshot(BasicAnalysisBuilder& builder, const char* filename)
+{
+  BinaryFileChannel channel(filename, BinaryFileChannel::Read);
+  if (!channel.isOpen())
+    return -1;
+
+  TclPackageClassBroker broker;
+  if (builder.getDomain()->recvSelf(SnapshotCommitTag, channel, broker) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to read Domain from snapshot " << filename << "\n";
+    return -1;
+  }
+
+  ID info(2);
+  if (channel.recvID(0, SnapshotCommitTag, info) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to read analysis state from snapshot " << filename << "\n";
+    return -1;
+  }
+
+  // Restore the integrator only if the same one is configured;
+  // otherwise the one set up by the user is kept.
+  Integrator* integrator = activeIntegrator(&builder);
+  if (integrator != nullptr && info(0) == builder.CurrentAnalysisFlag
+                            && info(1) == integrator->getClassTag()) {
+    if (integrator->recvSelf(SnapshotCommitTag, channel, broker) < 0) {
+      opserr << G3_ERROR_PROMPT << "failed to restore integrator from snapshot " << filename << "\n";
+      return -1;
+    }
+  }
+
+  // Integrators take their state vectors from the committed state of
+  // the domain when the model changes
+  if (builder.CurrentAnalysisFlag != BasicAnalysisBuilder::EMPTY_ANALYSIS &&
+      builder.domainChanged() < 0)
+    return -1;
+
+  return 0;
+}
+
+static int
+saveState(BasicAnalysisBuilder* builder, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  const char* filename;
+  bool verify;
+  if (parseSnapshotArgs(argc, argv, &filename, &verify) != 0) {
+    opserr << G3_ERROR_PROMPT << "usage: snapshot save -file path ?-verify?\n";
+    return TCL_ERROR;
+  }
+
+  if (saveSnapshot(*builder, filename) < 0)
+    return TCL_ERROR;
+
+  if (verify)
+    return verifySnapshot(interp, filename, *builder->getDomain());
+
+  return TCL_OK;
+}
+
+static int
+restoreState(BasicAnalysisBuilder* builder, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  Domain* domain = builder->getDomain();
+
+  const char* filename;
+  bool verify;
+  if (parseSnapshotArgs(argc, argv, &filename, &verify) != 0) {
+    opserr << G3_ERROR_PROMPT << "usage: snapshot restore -file path ?-verify?\n";
+    return TCL_ERROR;
+  }
+
+  if (restoreSnapshot(*builder, filename) < 0)
+    return TCL_ERROR;
+
+  if (verify)
+    return verifySnapshot(interp, filename, *domain);
+
+  return TCL_OK;
+}
+
+int
+TclCommand_snapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder* builder = (BasicAnalysisBuilder*)clientData;
+
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "usage: snapshot save|restore -file path ?-verify?\n";
+    return TCL_ERROR;
+  }
+
+  // the sub-command takes the place of the command name
+  if (strcmp(argv[1], "save") == 0)
+    return saveState(builder, interp, argc-1, argv+1);
+
+  else if (strcmp(argv[1], "restore") == 0)
+    return restoreState(builder, interp, argc-1, argv+1);
+
+  opserr << G3_ERROR_PROMPT << "unknown snapshot operation " << argv[1]
+         << ", expected save or restore\n";
+  return TCL_ERROR;
+}
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Write the committed state of an analysis (the Domain and the
+// active integrator) to a binary file, and read it back; see snapshot.cpp
+//
+// Written: cmp
+//
+#ifndef snapshot_h
+#define snapshot_h
+
+class BasicAnalysisBuilder;
+
+// both return 0 on success, < 0 on failure
+int saveSnapshot(BasicAnalysisBuilder& builder, const char* filename);
+int restoreSnapshot(BasicAnalysisBuilder& builder, const char* filename);
+
+#endif
@@ -112,20 +112,20 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "eleResponse",         &eleResponse,         domain, nullptr);
   Tcl_CreateCommand(interp, "eleDynamicalForce",   &eleDynamicalForce,   domain, nullptr);
 
-  Tcl_CreateCommand(interp, "nodeDOFs",            &nodeDOFs,            domain, nullptr);
-  Tcl_CreateCommand(interp, "nodeCoord",           &nodeCoord,           domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeDOFs",           &nodeDOFs,            domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeCoord",          &nodeCoord,           domain, nullptr);
   Tcl_CreateCommand(interp, "nodeMass",            &nodeMass,            domain, nullptr);
-  Tcl_CreateCommand(interp, "nodeVel",             &nodeVel,             domain, nullptr);
-  Tcl_CreateCommand(interp, "nodeDisp",            &nodeDisp,            domain, nullptr);
-  Tcl_CreateCommand(interp, "nodeAccel",           &nodeAccel,           domain, nullptr);
-  Tcl_CreateCommand(interp, "nodeResponse",        &nodeResponse,        domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeVel",            &nodeVel,             domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeDisp",           &nodeDisp,            domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeAccel",          &nodeAccel,           domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeResponse",       &nodeResponse,        domain, nullptr);
   Tcl_CreateCommand(interp, "nodePressure",        &nodePressure,        domain, nullptr);
   Tcl_CreateCommand(interp, "nodeBounds",          &nodeBounds,          domain, nullptr);
   Tcl_CreateCommand(interp, "findNodeWithID",      &findID,              domain, nullptr);
   Tcl_CreateCommand(interp, "nodeUnbalance",       &nodeUnbalance,       domain, nullptr);
   Tcl_CreateCommand(interp, "nodeEigenvector",     &nodeEigenvector,     domain, nullptr);
 
-  Tcl_CreateCommand(interp, "nodeReaction",        &nodeReaction,            domain, nullptr);
+  Tcl_CreateObjCommand(interp, "nodeReaction",       &nodeReaction,            domain, nullptr);
   Tcl_CreateCommand(interp, "reactions",           &calculateNodalReactions, domain, nullptr);
 
   Tcl_CreateCommand(interp, "setNodeVel",          &setNodeVel,              domain, nullptr);
@@ -135,7 +135,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "nodeRotation",        &nodeRotation,            domain, nullptr);
 
   Tcl_CreateCommand(interp, "getEleTags",          &getEleTags,              domain, nullptr);
-  Tcl_CreateCommand(interp, "getNodeTags",         &getNodeTags,             domain, nullptr);
+  Tcl_CreateObjCommand(interp, "getNodeTags",        &getNodeTags,             domain, nullptr);
 
   Tcl_CreateCommand(interp, "getParamTags",        &getParamTags,            domain, nullptr);
   Tcl_CreateCommand(interp, "getParamValue",       &getParamValue,           domain, nullptr);
@@ -159,7 +159,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "getEleLoadClassTags", &getEleLoadClassTags, domain, nullptr);
 
 
-  Tcl_CreateCommand(interp, "sectionForce",        &sectionForce,        domain, nullptr);
+  Tcl_CreateObjCommand(interp, "sectionForce",       &sectionForce,        domain, nullptr);
   Tcl_CreateCommand(interp, "sectionTag",          &sectionTag,          domain, nullptr);
   Tcl_CreateCommand(interp, "sectionDisplacement", &sectionDisplacement, domain, nullptr);
   Tcl_CreateCommand(interp, "sectionDeformation",  &sectionDeformation,  domain, nullptr);
@@ -177,7 +177,6 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 
 
   // sensitivity
-  Tcl_CreateCommand(interp, "computeGradients",      &computeGradients, (ClientData)domain, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "sensitivityAlgorithm",  &TclCommand_sensitivityAlgorithm, (ClientData)domain, (Tcl_CmdDeleteProc *)NULL);
 //Tcl_CreateCommand(interp, "sensitivityIntegrator", &sensitivityIntegrator, (ClientData)domain, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "sensNodeDisp",          &sensNodeDisp, (ClientData)domain, (Tcl_CmdDeleteProc *)NULL);
@@ -6,12 +6,12 @@
 //
 
 // domain/node.cpp
-Tcl_CmdProc nodeCoord;
-Tcl_CmdProc nodeDOFs;
+Tcl_ObjCmdProc nodeCoord;
+Tcl_ObjCmdProc nodeDOFs;
 Tcl_CmdProc nodeMass;
 Tcl_CmdProc nodePressure;
-Tcl_CmdProc nodeDisp;
-Tcl_CmdProc nodeReaction;
+Tcl_ObjCmdProc nodeDisp;
+Tcl_ObjCmdProc nodeReaction;
 Tcl_CmdProc nodeUnbalance;
 Tcl_CmdProc nodeEigenvector;
 Tcl_CmdProc setNodeCoord;
@@ -31,7 +31,7 @@ Tcl_CmdProc getEleLoadTags;
 Tcl_CmdProc getEleLoadData;
 
 // domain/section.cpp
-Tcl_CmdProc sectionForce;
+Tcl_ObjCmdProc sectionForce;
 Tcl_CmdProc sectionDeformation;
 Tcl_CmdProc sectionStiffness;
 Tcl_CmdProc sectionFlexibility;
@@ -82,7 +82,7 @@ Tcl_CmdProc getEleTags;
 //
 Tcl_CmdProc nodeBounds;
 
-Tcl_CmdProc nodeVel;
+Tcl_ObjCmdProc nodeVel;
 
 Tcl_CmdProc setNodeVel;
 
@@ -90,13 +90,13 @@ Tcl_CmdProc setNodeDisp;
 
 Tcl_CmdProc setNodeAccel;
 
-Tcl_CmdProc nodeAccel;
+Tcl_ObjCmdProc nodeAccel;
 
-Tcl_CmdProc nodeResponse;
+Tcl_ObjCmdProc nodeResponse;
 
 Tcl_CmdProc calculateNodalReactions;
 
-Tcl_CmdProc getNodeTags;
+Tcl_ObjCmdProc getNodeTags;
 Tcl_CmdProc retainedNodes;
 
 // domain.cpp
@@ -37,6 +37,8 @@
 
 #include <Domain.h>
 #include <EquiSolnAlgo.h>
+#include <runtimeAPI.h>
+#include <G3_Runtime.h>
 
 // known databases
 #include <FileDatastore.h>
@@ -56,28 +58,23 @@ typedef struct databasePackageCommand {
 
 // static variables
 static DatabasePackageCommand *theDatabasePackageCommands = NULL;
-static bool createdDatabaseCommands = false;
 
 int save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv);
 
 int restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv);
 
-extern FE_Datastore *theDatabase;
-
 int
 TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv,
                Domain &theDomain, FEM_ObjectBroker &theBroker)
 {
-  if (createdDatabaseCommands == false) {
-
-    // create the commands to commit and reset
-    Tcl_CreateCommand(interp, "save", save, (ClientData)NULL,
-                      (Tcl_CmdDeleteProc *)NULL);
-    Tcl_CreateCommand(interp, "restore", restore, (ClientData)NULL,
-                      (Tcl_CmdDeleteProc *)NULL);
+  // the database belongs to the runtime of this interpreter
+  FE_Datastore *&theDatabase = G3_getRuntime(interp)->m_database;
 
-    createdDatabaseCommands = true;
-  }
+  // create the commands to commit and reset
+  Tcl_CreateCommand(interp, "save", save, (ClientData)NULL,
+                    (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "restore", restore, (ClientData)NULL,
+                    (Tcl_CmdDeleteProc *)NULL);
 
   // make sure at least one other argument to contain integrator
   if (argc < 2) {
@@ -167,6 +164,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
 int
 save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
+  FE_Datastore *theDatabase = G3_getRuntime(interp)->m_database;
 
   if (theDatabase == nullptr) {
     opserr << "WARNING: save - no database has been constructed\n";
@@ -197,6 +195,7 @@ save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv
 int
 restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
+  FE_Datastore *theDatabase = G3_getRuntime(interp)->m_database;
 
   if (theDatabase == 0) {
     opserr << "WARNING: restore - no database has been constructed\n";
@@ -0,0 +1,439 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of SharedPathSeries.
+//
+// Written: cmp
+//
+#include "SharedPathSeries.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_UNIX) || defined(__unix__) || defined(__APPLE__)
+#  define PATH_USE_MMAP
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+#include <ID.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <OPS_Globals.h>
+
+namespace {
+
+//
+// The contents of one binary file. The file should not be modified
+// while a series refers to it.
+//
+struct MappedFile {
+  const double *data  = nullptr;
+  int           count = 0;
+#ifdef PATH_USE_MMAP
+  void   *address = MAP_FAILED;
+  size_t  length  = 0;
+  ~MappedFile() {
+    if (address != MAP_FAILED)
+      munmap(address, length);
+  }
+#else
+  std::vector<double> buffer;
+#endif
+};
+
+static std::shared_ptr<const MappedFile>
+mapFile(const char *filename)
+{
+  auto file = std::make_shared<MappedFile>();
+
+#ifdef PATH_USE_MMAP
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    opserr << "SharedPathSeries -- could not open file " << filename << endln;
+    return nullptr;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size == 0 || info.st_size % sizeof(double) != 0) {
+    opserr << "SharedPathSeries -- file " << filename
+           << " does not hold a whole number of doubles" << endln;
+    close(fd);
+    return nullptr;
+  }
+
+  file->length  = static_cast<size_t>(info.st_size);
+  file->address = mmap(nullptr, file->length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (file->address == MAP_FAILED) {
+    opserr << "SharedPathSeries -- could not map file " << filename << endln;
+    return nullptr;
+  }
+  // The path is read front to back during an analysis
+  madvise(file->address, file->length, MADV_SEQUENTIAL);
+
+  file->data  = static_cast<const double*>(file->address);
+  file->count = static_cast<int>(file->length/sizeof(double));
+#else
+  FILE *fp = fopen(filename, "rb");
+  if (fp == nullptr) {
+    opserr << "SharedPathSeries -- could not open file " << filename << endln;
+    return nullptr;
+  }
+  fseek(fp, 0, SEEK_END);
+  long bytes = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (bytes <= 0 || bytes % sizeof(double) != 0) {
+    opserr << "SharedPathSeries -- file " << filename
+           << " does not hold a whole number of doubles" << endln;
+    fclose(fp);
+    return nullptr;
+  }
+  file->buffer.resize(bytes/sizeof(double));
+  size_t read = fread(file->buffer.data(), sizeof(double), file->buffer.size(), fp);
+  fclose(fp);
+  if (read != file->buffer.size()) {
+    opserr << "SharedPathSeries -- could not read file " << filename << endln;
+    return nullptr;
+  }
+  file->data  = file->buffer.data();
+  file->count = static_cast<int>(file->buffer.size());
+#endif
+
+  return file;
+}
+
+} // namespace
+
+
+std::shared_ptr<const SharedPathSeries::Path>
+SharedPathSeries::Borrow(const double *values, int size,
+                         std::shared_ptr<const void> owner,
+                         const double *times,
+                         std::shared_ptr<const void> timeOwner)
+{
+  if (values == nullptr || size < 1) {
+    opserr << "SharedPathSeries -- path is empty" << endln;
+    return nullptr;
+  }
+
+  auto path = std::make_shared<Path>();
+  path->values     = values;
+  path->times      = times;
+  path->size       = size;
+  path->valueOwner = std::move(owner);
+  path->timeOwner  = std::move(timeOwner);
+
+  for (int i = 0; i < size; i++)
+    if (fabs(values[i]) > path->peak)
+      path->peak = fabs(values[i]);
+
+  if (times != nullptr)
+    for (int i = 1; i < size; i++)
+      if (times[i] < times[i-1]) {
+        opserr << "SharedPathSeries -- times must not decrease; time " << i
+               << " is " << times[i] << " after " << times[i-1] << endln;
+        return nullptr;
+      }
+
+  return path;
+}
+
+std::shared_ptr<const SharedPathSeries::Path>
+SharedPathSeries::MapFile(const char *valueFile, const char *timeFile)
+{
+  // Paths that are in use, by file name; an entry expires when the
+  // last series referring to it is destroyed.
+  static std::mutex mutex;
+  static std::map<std::string, std::weak_ptr<const Path>> paths;
+
+  std::string key(valueFile);
+  if (timeFile != nullptr)
+    key.append(1, '\0').append(timeFile);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (std::shared_ptr<const Path> path = paths[key].lock())
+    return path;
+
+  std::shared_ptr<const MappedFile> values = mapFile(valueFile),
+                                    times;
+  if (values == nullptr)
+    return nullptr;
+
+  if (timeFile != nullptr) {
+    times = mapFile(timeFile);
+    if (times == nullptr)
+      return nullptr;
+    if (times->count != values->count) {
+      opserr << "SharedPathSeries -- number of times (" << times->count
+             << ") must equal the number of values (" << values->count << ")" << endln;
+      return nullptr;
+    }
+  }
+
+  std::shared_ptr<const Path> path = Borrow(values->data, values->count, values,
+                                            times ? times->data : nullptr, times);
+  if (path != nullptr)
+    paths[key] = path;
+
+  return path;
+}
+
+
+SharedPathSeries::SharedPathSeries(int tag, std::shared_ptr<const Path> path, double dt,
+                                   double factor, bool useLast, bool prependZero,
+                                   double startTime)
+ : TimeSeries(tag, TSERIES_TAG_SharedPathSeries),
+   path(path), dt(dt), cFactor(factor), startTime(startTime),
+   useLast(useLast), prependZero(prependZero), cursor(0)
+{
+
+}
+
+SharedPathSeries::SharedPathSeries(int tag, std::shared_ptr<const Path> path,
+                                   double factor, bool useLast)
+ : TimeSeries(tag, TSERIES_TAG_SharedPathSeries),
+   path(path), dt(0.0), cFactor(factor), startTime(0.0),
+   useLast(useLast), prependZero(false), cursor(0)
+{
+
+}
+
+SharedPathSeries::SharedPathSeries()
+ : TimeSeries(0, TSERIES_TAG_SharedPathSeries),
+   path(nullptr), dt(0.0), cFactor(1.0), startTime(0.0),
+   useLast(false), prependZero(false), cursor(0)
+{
+
+}
+
+SharedPathSeries::~SharedPathSeries()
+{
+
+}
+
+TimeSeries *
+SharedPathSeries::getCopy()
+{
+  // The copy refers to the same path
+  if (path != nullptr && path->times != nullptr)
+    return new SharedPathSeries(this->getTag(), path, cFactor, useLast);
+
+  return new SharedPathSeries(this->getTag(), path, dt, cFactor, useLast,
+                              prependZero, startTime);
+}
+
+double
+SharedPathSeries::getFactor(double pseudoTime)
+{
+  if (path == nullptr)
+    return 0.0;
+
+  const double *times = path->times;
+
+  //
+  // Constant time step
+  //
+  if (times == nullptr) {
+    const int size = path->size + (prependZero ? 1 : 0);
+
+    if (pseudoTime < startTime)
+      return 0.0;
+
+    const double x = (pseudoTime - startTime)/dt;
+    if (x >= size - 1)
+      return useLast ? cFactor*value(size - 1) : 0.0;
+
+    const int i = static_cast<int>(x);
+    const double v0 = value(i),
+                 v1 = value(i + 1);
+    return cFactor*(v0 + (v1 - v0)*(x - i));
+  }
+
+  //
+  // Arbitrary times
+  //
+  const int size = path->size;
+  const double *values = path->values;
+
+  if (pseudoTime < times[0])
+    return 0.0;
+
+  if (pseudoTime > times[size - 1])
+    return useLast ? cFactor*values[size - 1] : 0.0;
+
+  if (size == 1)
+    return cFactor*values[0];
+
+  // Move the cursor to the interval [times[i], times[i+1]) holding
+  // pseudoTime; analyses step forward, so this is usually one step
+  int i = cursor;
+  while (i < size - 2 && pseudoTime >= times[i + 1])
+    i++;
+  while (i > 0 && pseudoTime < times[i])
+    i--;
+  cursor = i;
+
+  const double t0 = times[i],
+               t1 = times[i + 1];
+  if (t1 == t0)
+    return cFactor*values[i + 1];
+
+  return cFactor*(values[i] + (values[i + 1] - values[i])*(pseudoTime - t0)/(t1 - t0));
+}
+
+double
+SharedPathSeries::getDuration()
+{
+  if (path == nullptr)
+    return 0.0;
+
+  if (path->times != nullptr)
+    return path->times[path->size - 1];
+
+  return (path->size + (prependZero ? 1 : 0))*dt;
+}
+
+double
+SharedPathSeries::getPeakFactor()
+{
+  return path ? cFactor*path->peak : 0.0;
+}
+
+double
+SharedPathSeries::getTimeIncr(double pseudoTime)
+{
+  if (path == nullptr || path->times == nullptr)
+    return dt;
+
+  if (path->size < 2)
+    return 0.0;
+
+  this->getFactor(pseudoTime);
+  return path->times[cursor + 1] - path->times[cursor];
+}
+
+int
+SharedPathSeries::sendSelf(int commitTag, Channel &theChannel)
+{
+  // The path is sent by value; the receiving process holds its own copy
+  const int size = path ? path->size : 0;
+  const int dbTag = this->getDbTag();
+
+  static ID idata(4);
+  idata(0) = this->getTag();
+  idata(1) = size;
+  idata(2) = (path && path->times) ? 1 : 0;
+  idata(3) = (useLast ? 1 : 0) + (prependZero ? 2 : 0);
+  if (theChannel.sendID(dbTag, commitTag, idata) < 0) {
+    opserr << "SharedPathSeries::sendSelf() - channel failed to send data" << endln;
+    return -1;
+  }
+
+  static Vector ddata(3);
+  ddata(0) = dt;
+  ddata(1) = cFactor;
+  ddata(2) = startTime;
+  if (theChannel.sendVector(dbTag, commitTag, ddata) < 0) {
+    opserr << "SharedPathSeries::sendSelf() - channel failed to send data" << endln;
+    return -1;
+  }
+
+  if (size == 0)
+    return 0;
+
+  Vector values(const_cast<double*>(path->values), size);
+  if (theChannel.sendVector(dbTag, commitTag, values) < 0) {
+    opserr << "SharedPathSeries::sendSelf() - channel failed to send the path" << endln;
+    return -1;
+  }
+
+  if (path->times != nullptr) {
+    Vector times(const_cast<double*>(path->times), size);
+    if (theChannel.sendVector(dbTag, commitTag, times) < 0) {
+      opserr << "SharedPathSeries::sendSelf() - channel failed to send the times" << endln;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+SharedPathSeries::recvSelf(int commitTag, Channel &theChannel,
+                           FEM_ObjectBroker &theBroker)
+{
+  const int dbTag = this->getDbTag();
+
+  static ID idata(4);
+  if (theChannel.recvID(dbTag, commitTag, idata) < 0) {
+    opserr << "SharedPathSeries::recvSelf() - channel failed to receive data" << endln;
+    return -1;
+  }
+  this->setTag(idata(0));
+  const int size = idata(1);
+  useLast     = (idata(3) & 1) != 0;
+  prependZero = (idata(3) & 2) != 0;
+  cursor      = 0;
+
+  static Vector ddata(3);
+  if (theChannel.recvVector(dbTag, commitTag, ddata) < 0) {
+    opserr << "SharedPathSeries::recvSelf() - channel failed to receive data" << endln;
+    return -1;
+  }
+  dt        = ddata(0);
+  cFactor   = ddata(1);
+  startTime = ddata(2);
+
+  path = nullptr;
+  if (size == 0)
+    return 0;
+
+  auto values = std::make_shared<std::vector<double>>(size);
+  Vector vvalues(values->data(), size);
+  if (theChannel.recvVector(dbTag, commitTag, vvalues) < 0) {
+    opserr << "SharedPathSeries::recvSelf() - channel failed to receive the path" << endln;
+    return -1;
+  }
+
+  std::shared_ptr<std::vector<double>> times;
+  if (idata(2) != 0) {
+    times = std::make_shared<std::vector<double>>(size);
+    Vector vtimes(times->data(), size);
+    if (theChannel.recvVector(dbTag, commitTag, vtimes) < 0) {
+      opserr << "SharedPathSeries::recvSelf() - channel failed to receive the times" << endln;
+      return -1;
+    }
+  }
+
+  path = Borrow(values->data(), size, values,
+                times ? times->data() : nullptr, times);
+
+  return path ? 0 : -1;
+}
+
+void
+SharedPathSeries::Print(OPS_Stream &s, int flag)
+{
+  s << "SharedPathSeries tag: " << this->getTag() << endln;
+  s << "\tFactor: " << cFactor << endln;
+  if (path == nullptr)
+    return;
+
+  s << "\tPoints: " << path->size << endln;
+  if (path->times == nullptr) {
+    s << "\tTime Incr: " << dt << endln;
+    s << "\tStart Time: " << startTime << endln;
+  }
+  s << "\tPeak: " << path->peak << endln;
+}
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SharedPathSeries is a path time series whose values (and
+// optionally times) are held in read-only memory that is shared between
+// copies of the series. The memory is either a binary file mapped into the
+// address space or a buffer borrowed from the caller (e.g., a NumPy array),
+// so long records are neither parsed nor copied, and all the patterns that
+// refer to one series use the same data.
+//
+// With a constant time step the factor is found by direct indexing. With
+// arbitrary times each copy keeps a cursor at the last interval used, which
+// makes the lookup amortized O(1) for the monotonic pseudo-times of an
+// analysis.
+//
+// A binary path file is a flat array of native doubles with no header, as
+// written for example by numpy.ndarray.tofile().
+//
+// Written: cmp
+//
+#ifndef SharedPathSeries_h
+#define SharedPathSeries_h
+
+#include <memory>
+#include <TimeSeries.h>
+
+#define TSERIES_TAG_SharedPathSeries 1301
+
+class Vector;
+
+class SharedPathSeries : public TimeSeries
+{
+ public:
+  struct Path {
+    const double *values = nullptr;
+    const double *times  = nullptr; // nullptr for a constant time step
+    int           size   = 0;
+    double        peak   = 0.0;     // max |value|
+    // Keep the memory behind values and times alive
+    std::shared_ptr<const void> valueOwner, timeOwner;
+  };
+
+  // Map a binary file of values, and optionally one of times. Mapping the
+  // same file twice returns the same data. Returns nullptr on error.
+  static std::shared_ptr<const Path> MapFile(const char *valueFile,
+                                             const char *timeFile = nullptr);
+
+  // Refer to memory owned by the caller; owner is held for as long as the
+  // path is in use and may be null if the caller outlives the series.
+  static std::shared_ptr<const Path> Borrow(const double *values, int size,
+                                            std::shared_ptr<const void> owner,
+                                            const double *times = nullptr,
+                                            std::shared_ptr<const void> timeOwner = nullptr);
+
+  // Constant time step
+  SharedPathSeries(int tag, std::shared_ptr<const Path> path, double dt,
+                   double factor = 1.0, bool useLast = false,
+                   bool prependZero = false, double startTime = 0.0);
+  // Times given with the path
+  SharedPathSeries(int tag, std::shared_ptr<const Path> path,
+                   double factor = 1.0, bool useLast = false);
+  SharedPathSeries();
+
+  ~SharedPathSeries();
+
+  TimeSeries *getCopy();
+
+  double getFactor(double pseudoTime);
+  double getDuration();
+  double getPeakFactor();
+  double getTimeIncr(double pseudoTime);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  void Print(OPS_Stream &s, int flag = 0);
+
+ private:
+  // Value k of the path, counting the prepended zero
+  double value(int k) const
+  {
+    if (prependZero)
+      return k == 0 ? 0.0 : path->values[k - 1];
+    return path->values[k];
+  }
+
+  std::shared_ptr<const Path> path;
+  double dt;
+  double cFactor;
+  double startTime;
+  bool   useLast;
+  bool   prependZero;
+  int    cursor;    // interval of the last lookup with arbitrary times
+};
+
+#endif
@@ -0,0 +1,220 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of DRMStream.
+//
+// Written: cmp
+//
+#include "DRMStream.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <OPS_Globals.h>
+
+#ifdef _WIN32
+#  define drm_fseek _fseeki64
+#else
+#  define drm_fseek fseeko
+#endif
+
+static const char DRMStreamMagic[8] = {'D','R','M','S','T','R','M','1'};
+
+DRMStream::DRMStream(const char *filename, int windowSteps)
+ : file(nullptr), dataOffset(0),
+   numNodes(0), numSteps(0), numComponents(0),
+   windowSteps(std::max(windowSteps, 1)),
+   dt(0.0), startTime(0.0),
+   currentIndex(-1), nextIndex(-1),
+   requested(-1), busy(false), stop(false)
+{
+  FILE *fp = fopen(filename, "rb");
+  if (fp == nullptr) {
+    opserr << "DRMStream -- could not open file " << filename << endln;
+    return;
+  }
+
+  char magic[8];
+  int32_t sizes[4];
+  double  times[2];
+  if (fread(magic, 1, 8, fp) != 8 || memcmp(magic, DRMStreamMagic, 8) != 0 ||
+      fread(sizes, sizeof(int32_t), 4, fp) != 4 ||
+      fread(times, sizeof(double), 2, fp) != 2) {
+    opserr << "DRMStream -- " << filename << " is not a DRM stream file" << endln;
+    fclose(fp);
+    return;
+  }
+
+  numNodes      = sizes[0];
+  numSteps      = sizes[1];
+  numComponents = sizes[2];
+  dt            = times[0];
+  startTime     = times[1];
+  if (numNodes < 1 || numSteps < 1 || numComponents < 1 || !(dt > 0.0)) {
+    opserr << "DRMStream -- invalid header in " << filename << endln;
+    fclose(fp);
+    return;
+  }
+
+  std::vector<int32_t> buffer(2*numNodes);
+  if (fread(buffer.data(), sizeof(int32_t), buffer.size(), fp) != buffer.size()) {
+    opserr << "DRMStream -- could not read the nodes of " << filename << endln;
+    fclose(fp);
+    return;
+  }
+  tags.assign(buffer.begin(), buffer.begin() + numNodes);
+  internal.assign(buffer.begin() + numNodes, buffer.end());
+  for (int i = 0; i < numNodes; i++)
+    nodeIndex[tags[i]] = i;
+
+  dataOffset = 8 + 4*sizeof(int32_t) + 2*sizeof(double) + 2*numNodes*sizeof(int32_t);
+
+  // Make sure every record is present before the analysis depends on it
+  const long long recordBytes = 2LL*numComponents*numNodes*sizeof(double);
+  if (drm_fseek(fp, dataOffset + numSteps*recordBytes - 1, SEEK_SET) != 0 ||
+      fgetc(fp) == EOF) {
+    opserr << "DRMStream -- " << filename << " is shorter than its "
+           << numSteps << " steps" << endln;
+    fclose(fp);
+    return;
+  }
+
+  file   = fp;
+  worker = std::thread(&DRMStream::work, this);
+  this->prefetch(0);
+}
+
+DRMStream::~DRMStream()
+{
+  if (worker.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    wake.notify_one();
+    worker.join();
+  }
+
+  if (file != nullptr)
+    fclose(file);
+}
+
+int
+DRMStream::findNode(int tag) const
+{
+  auto found = nodeIndex.find(tag);
+  return found == nodeIndex.end() ? -1 : found->second;
+}
+
+//
+// Window i holds steps i*W through (i+1)*W, so that both steps around
+// any time inside it are present.
+//
+int
+DRMStream::readWindow(int index, Window &window)
+{
+  const size_t record = 2*numComponents*numNodes;
+  const int first = index*windowSteps,
+            last  = std::min(first + windowSteps, numSteps - 1);
+
+  window.first = -1;
+  window.count = last - first + 1;
+  window.data.resize(window.count*record);
+
+  if (drm_fseek(file, dataOffset + (long long)first*record*sizeof(double), SEEK_SET) != 0 ||
+      fread(window.data.data(), sizeof(double), window.data.size(), file) != window.data.size())
+    return -1;
+
+  window.first = first;
+  return 0;
+}
+
+void
+DRMStream::prefetch(int index)
+{
+  if (index*windowSteps >= std::max(numSteps - 1, 1))
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    requested = index;
+    nextIndex = -1;
+    busy      = true;
+  }
+  wake.notify_one();
+}
+
+void
+DRMStream::work()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    wake.wait(lock, [this]{ return stop || requested >= 0; });
+    if (stop)
+      return;
+
+    const int index = requested;
+    requested = -1;
+
+    lock.unlock();
+    const int status = this->readWindow(index, next);
+    lock.lock();
+
+    nextIndex = (status == 0) ? index : -1;
+    busy      = false;
+    done.notify_all();
+  }
+}
+
+int
+DRMStream::getRecords(double time, const double *&r0, const double *&r1, double &alpha)
+{
+  if (file == nullptr)
+    return -1;
+
+  const size_t record = 2*numComponents*numNodes;
+
+  int step = 0;
+  alpha = 0.0;
+  if (numSteps > 1) {
+    const double x = (time - startTime)/dt;
+    if (x >= numSteps - 1) {
+      step  = numSteps - 2;
+      alpha = 1.0;
+    } else if (x > 0.0) {
+      step  = static_cast<int>(x);
+      alpha = x - step;
+    }
+  }
+
+  const int index = step/windowSteps;
+  if (index != currentIndex) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      done.wait(lock, [this]{ return !busy; });
+    }
+
+    // The worker is idle, so the file and both windows may be used here
+    if (nextIndex == index) {
+      std::swap(current, next);
+      nextIndex = -1;
+    }
+
+    else if (this->readWindow(index, current) != 0) {
+      opserr << "DRMStream -- could not read steps starting at "
+             << index*windowSteps << endln;
+      currentIndex = -1;
+      return -1;
+    }
+
+    currentIndex = index;
+    this->prefetch(index + 1);
+  }
+
+  r0 = current.data.data() + (step - current.first)*record;
+  r1 = (step + 1 < current.first + current.count) ? r0 + record : r0;
+  return 0;
+}
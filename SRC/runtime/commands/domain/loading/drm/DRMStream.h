@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: DRMStream reads the free-field motion of the nodes in a DRM
+// layer from a binary file one window of time steps at a time. While the
+// analysis works inside one window, the next is read by a background
+// thread, so the resident memory is two windows regardless of the length
+// of the record.
+//
+// File layout (native byte order):
+//
+//   char[8]   "DRMSTRM1"
+//   int32     number of nodes N
+//   int32     number of steps S
+//   int32     number of components C per node (e.g., 3)
+//   int32     0 (reserved)
+//   double    time step
+//   double    start time
+//   int32[N]  node tags
+//   int32[N]  1 for nodes on the interior boundary, 0 for exterior nodes
+//   S records, one per step, each holding for every node in order
+//             C displacements followed by C accelerations
+//
+// Written: cmp
+//
+#ifndef DRMStream_h
+#define DRMStream_h
+
+#include <stdio.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+
+class DRMStream
+{
+ public:
+  DRMStream(const char *filename, int windowSteps = 256);
+  ~DRMStream();
+
+  // true if the file was opened and its header is valid
+  bool isOpen() const {return file != nullptr;}
+
+  int    getNumNodes() const      {return numNodes;}
+  int    getNumSteps() const      {return numSteps;}
+  int    getNumComponents() const {return numComponents;}
+  double getTimeStep() const      {return dt;}
+  double getStartTime() const     {return startTime;}
+
+  // Index of the node with the given tag in each record, or -1
+  int  findNode(int tag) const;
+  bool isInternal(int index) const {return internal[index] != 0;}
+
+  // Records of the two steps that bracket time and the weight of the
+  // second; a record holds 2*C values for each node. Returns -1 if the
+  // data could not be read.
+  int getRecords(double time, const double *&r0, const double *&r1, double &alpha);
+
+ private:
+  struct Window {
+    int first = -1;              // first step held, -1 if empty
+    int count = 0;
+    std::vector<double> data;
+  };
+
+  int  readWindow(int index, Window &window);
+  void prefetch(int index);
+  void work();
+
+  FILE  *file;
+  long long dataOffset;
+  int    numNodes, numSteps, numComponents;
+  int    windowSteps;
+  double dt, startTime;
+  std::vector<int> tags, internal;
+  std::unordered_map<int, int> nodeIndex;
+
+  // current is only touched by the caller; next belongs to the worker
+  // while a request is pending
+  Window current, next;
+  int  currentIndex, nextIndex;  // window indices
+
+  std::thread             worker;
+  std::mutex              mutex;
+  std::condition_variable wake, done;
+  int  requested;                // window to read, -1 if none
+  bool busy, stop;
+};
+
+#endif
@@ -0,0 +1,217 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// StreamingDRMPattern.
+//
+// Written: cmp
+//
+#include "StreamingDRMPattern.h"
+#include "DRMStream.h"
+
+#include <algorithm>
+#include <Domain.h>
+#include <ElementIter.h>
+#include <Element.h>
+#include <Node.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+StreamingDRMPattern::StreamingDRMPattern(int tag, const char *filename,
+                                         double factor, int windowSteps)
+ : LoadPattern(tag, PATTERN_TAG_StreamingDRM),
+   stream(new DRMStream(filename, windowSteps)),
+   cFactor(factor), found(false)
+{
+
+}
+
+StreamingDRMPattern::~StreamingDRMPattern()
+{
+
+}
+
+bool
+StreamingDRMPattern::isValid() const
+{
+  return stream != nullptr && stream->isOpen();
+}
+
+//
+// Collect the elements of the DRM layer and keep their matrices
+//
+int
+StreamingDRMPattern::findLayer()
+{
+  Domain *domain = this->getDomain();
+  if (domain == nullptr)
+    return -1;
+
+  layer.clear();
+
+  ElementIter &elements = domain->getElements();
+  Element *element;
+  while ((element = elements()) != nullptr) {
+    const int numNodes = element->getNumExternalNodes();
+    const ID &tags = element->getExternalNodes();
+
+    LayerElement entry;
+    entry.index.resize(numNodes);
+
+    bool inStream = true, interior = false, exterior = false;
+    for (int i = 0; i < numNodes && inStream; i++) {
+      entry.index[i] = stream->findNode(tags(i));
+      if (entry.index[i] < 0)
+        inStream = false;
+      else if (stream->isInternal(entry.index[i]))
+        interior = true;
+      else
+        exterior = true;
+    }
+    if (!inStream || !interior || !exterior)
+      continue;
+
+    const int numDOF = element->getNumDOF();
+    if (numNodes == 0 || numDOF % numNodes != 0) {
+      opserr << "StreamingDRMPattern -- element " << element->getTag()
+             << " does not have the same number of dofs at each node; it is ignored" << endln;
+      continue;
+    }
+
+    entry.element = element;
+    entry.numDOF  = numDOF;
+    entry.nodeDOF = numDOF/numNodes;
+
+    Node **nodes = element->getNodePtrs();
+    entry.nodes.assign(nodes, nodes + numNodes);
+
+    const Matrix &K = element->getInitialStiff();
+    const Matrix &M = element->getMass();
+    entry.K.resize(numDOF*numDOF);
+    entry.M.resize(numDOF*numDOF);
+    for (int i = 0; i < numDOF; i++)
+      for (int j = 0; j < numDOF; j++) {
+        entry.K[i*numDOF + j] = K(i, j);
+        entry.M[i*numDOF + j] = M(i, j);
+      }
+
+    layer.push_back(std::move(entry));
+  }
+
+  found = true;
+
+  if (layer.empty()) {
+    opserr << "StreamingDRMPattern -- no elements of the domain lie in the DRM layer" << endln;
+    return -1;
+  }
+  return 0;
+}
+
+void
+StreamingDRMPattern::applyLoad(double pseudoTime)
+{
+  if (!this->isValid() || this->getDomain() == nullptr)
+    return;
+
+  if (!found)
+    this->findLayer();
+
+  if (layer.empty())
+    return;
+
+  const double *r0, *r1;
+  double alpha;
+  if (stream->getRecords(pseudoTime, r0, r1, alpha) != 0)
+    return;
+
+  const int nc = stream->getNumComponents();
+
+  std::vector<double> work;
+  for (LayerElement &entry : layer) {
+    const int n = entry.numDOF;
+    work.assign(3*n, 0.0);
+    double *u = work.data(),      // free-field motion of the other side
+           *a = work.data() + n,
+           *f = work.data() + 2*n;
+
+    //
+    // Interior rows are loaded by the exterior motion and exterior rows
+    // by the interior motion, so each row sees only the other side.
+    //
+    for (int side = 0; side < 2; side++) {
+      const bool interiorRows = (side == 0);
+
+      std::fill(u, u + 2*n, 0.0);
+      for (size_t i = 0; i < entry.nodes.size(); i++) {
+        const int k = entry.index[i];
+        if (stream->isInternal(k) == interiorRows)
+          continue;
+
+        const double *d0 = r0 + 2*nc*k,
+                     *d1 = r1 + 2*nc*k;
+        for (int c = 0; c < std::min(nc, entry.nodeDOF); c++) {
+          const int dof = i*entry.nodeDOF + c;
+          u[dof] = (1.0 - alpha)*d0[c]      + alpha*d1[c];
+          a[dof] = (1.0 - alpha)*d0[nc + c] + alpha*d1[nc + c];
+        }
+      }
+
+      const double sign = interiorRows ? -1.0 : 1.0;
+      for (size_t i = 0; i < entry.nodes.size(); i++) {
+        if (stream->isInternal(entry.index[i]) != interiorRows)
+          continue;
+
+        for (int r = i*entry.nodeDOF; r < (int)(i + 1)*entry.nodeDOF; r++) {
+          const double *Kr = &entry.K[r*n],
+                       *Mr = &entry.M[r*n];
+          double sum = 0.0;
+          for (int j = 0; j < n; j++)
+            sum += Kr[j]*u[j] + Mr[j]*a[j];
+          f[r] = sign*sum;
+        }
+      }
+    }
+
+    for (size_t i = 0; i < entry.nodes.size(); i++) {
+      Node *node = entry.nodes[i];
+      Vector load(node->getNumberDOF());
+      for (int c = 0; c < std::min(entry.nodeDOF, load.Size()); c++)
+        load(c) = f[i*entry.nodeDOF + c];
+      node->addUnbalancedLoad(load, cFactor);
+    }
+  }
+}
+
+int
+StreamingDRMPattern::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "StreamingDRMPattern::sendSelf() - not implemented" << endln;
+  return -1;
+}
+
+int
+StreamingDRMPattern::recvSelf(int commitTag, Channel &theChannel,
+                              FEM_ObjectBroker &theBroker)
+{
+  opserr << "StreamingDRMPattern::recvSelf() - not implemented" << endln;
+  return -1;
+}
+
+void
+StreamingDRMPattern::Print(OPS_Stream &s, int flag)
+{
+  s << "StreamingDRMPattern tag: " << this->getTag() << endln;
+  s << "\tFactor: " << cFactor << endln;
+  if (this->isValid()) {
+    s << "\tNodes: " << stream->getNumNodes() << endln;
+    s << "\tSteps: " << stream->getNumSteps()
+      << " at dt = " << stream->getTimeStep() << endln;
+  }
+  if (found)
+    s << "\tLayer elements: " << (int)layer.size() << endln;
+}
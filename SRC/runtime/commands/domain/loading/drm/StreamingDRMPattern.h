@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: StreamingDRMPattern applies the effective forces of the
+// Domain Reduction Method using free-field motions read from a DRMStream.
+// The elements of the DRM layer are those whose nodes are all in the
+// stream and include both interior boundary (b) and exterior (e) nodes;
+// for each of them
+//
+//    P_b = -M_be a_e - K_be u_e
+//    P_e =  M_eb a_b + K_eb u_b
+//
+// are added to the nodes, using the initial stiffness and the mass of the
+// element.
+//
+// Written: cmp
+//
+#ifndef StreamingDRMPattern_h
+#define StreamingDRMPattern_h
+
+#include <vector>
+#include <memory>
+#include <LoadPattern.h>
+
+#define PATTERN_TAG_StreamingDRM 1401
+
+class Node;
+class Element;
+class DRMStream;
+
+class StreamingDRMPattern : public LoadPattern
+{
+ public:
+  StreamingDRMPattern(int tag, const char *filename, double factor = 1.0,
+                      int windowSteps = 256);
+  ~StreamingDRMPattern();
+
+  // false if the stream could not be opened
+  bool isValid() const;
+
+  void applyLoad(double pseudoTime = 0.0);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+  void Print(OPS_Stream &s, int flag = 0);
+
+ private:
+  struct LayerElement {
+    Element *element;
+    int numDOF, nodeDOF;
+    std::vector<Node*> nodes;
+    std::vector<int>   index;    // of each node in the stream
+    std::vector<double> K, M;    // numDOF x numDOF, by rows
+  };
+
+  int findLayer();
+
+  std::unique_ptr<DRMStream> stream;
+  std::vector<LayerElement> layer;
+  double cFactor;
+  bool   found;
+};
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <runtimeAPI.h>
 #include <G3_Logging.h>
+#include <InputAPI.h>
 
 #include <Domain.h>
 #include <LoadPattern.h>
@@ -50,16 +51,19 @@
 #ifdef _H5DRM
 #  include <H5DRMLoadPattern.h>
 #endif
+#include "drm/StreamingDRMPattern.h"
 
 #include <NodalThermalAction.h>   //L.Jiang [SIF]
 #include <NodalLoad.h>
 
 #include <string.h>
+#include <string>
+#include <vector>
 
 
 
 Tcl_CmdProc TclCommand_addSP;
-Tcl_CmdProc TclCommand_addNodalLoad;
+Tcl_ObjCmdProc TclCommand_addNodalLoad;
 
 extern TimeSeriesIntegrator *TclDispatch_newSeriesIntegrator(ClientData clientData,
                                                         Tcl_Interp *interp,
@@ -364,6 +368,45 @@ TclCommand_addPattern(ClientData clientData, Tcl_Interp *interp, int argc,
   }
 
 
+  else if (strcmp(argv[1], "DRMStream") == 0) {
+    // pattern DRMStream tag file <-factor factor> <-window steps>
+    if (argc < 4) {
+      opserr << G3_ERROR_PROMPT << "insufficient arguments - want: pattern "
+             << "DRMStream tag file <-factor factor> <-window steps>\n";
+      return TCL_ERROR;
+    }
+
+    double fact = 1.0;
+    int window = 256;
+    for (commandEndMarker = 4; commandEndMarker < argc; commandEndMarker++) {
+      if ((strcmp(argv[commandEndMarker], "-fact") == 0) ||
+          (strcmp(argv[commandEndMarker], "-factor") == 0)) {
+        if (++commandEndMarker == argc ||
+            Tcl_GetDouble(interp, argv[commandEndMarker], &fact) != TCL_OK) {
+          opserr << G3_ERROR_PROMPT << "invalid factor for DRMStream pattern " << patternID << "\n";
+          return TCL_ERROR;
+        }
+      }
+      else if (strcmp(argv[commandEndMarker], "-window") == 0) {
+        if (++commandEndMarker == argc ||
+            Tcl_GetInt(interp, argv[commandEndMarker], &window) != TCL_OK || window < 1) {
+          opserr << G3_ERROR_PROMPT << "invalid window for DRMStream pattern " << patternID << "\n";
+          return TCL_ERROR;
+        }
+      }
+      else
+        break;
+    }
+
+    StreamingDRMPattern *pattern = new StreamingDRMPattern(patternID, argv[3], fact, window);
+    if (!pattern->isValid()) {
+      delete pattern;
+      return TCL_ERROR;
+    }
+    thePattern = pattern;
+    Tcl_SetAssocData(interp,"theTclMultiSupportPattern", NULL, (ClientData)0);
+  }
+
 #ifdef OPSDEF_DRM
   //////// //////// ///////// ////////// /////  // DRMLoadPattern add BEGIN
   else if (strcmp(argv[1], "DRMLoadPattern") == 0) {
@@ -393,14 +436,16 @@ TclCommand_addPattern(ClientData clientData, Tcl_Interp *interp, int argc,
       int n2;
       ifile >> n2;
 
-      std::string inps;
+      // as with the file names of the option form below, the handler is
+      // given names that live only as long as this command
       int nf = 6;
-      char **files = new char *[nf];
+      std::vector<std::string> names(nf);
+      std::vector<char *> files(nf);
       int *f_d = new int[3 * (nf - 1)];
       int ne1, ne2;
       for (int i = 0; i < nf; ++i) {
-        ifile >> inps;
-        files[i] = (char *)inps.c_str();
+        ifile >> names[i];
+        files[i] = &names[i][0];
         if (i < (nf - 1)) {
           ifile >> ne1;
           ifile >> ne2;
@@ -412,7 +457,7 @@ TclCommand_addPattern(ClientData clientData, Tcl_Interp *interp, int argc,
 
       Mesh3DSubdomain *myMesher = new Mesh3DSubdomain(domain);
       PlaneDRMInputHandler *patternhandler = new PlaneDRMInputHandler(
-          1.0, files, nf, dt, 0, num_steps, f_d, 15, n1, n2, drm_box_crds,
+          1.0, files.data(), nf, dt, 0, num_steps, f_d, 15, n1, n2, drm_box_crds,
           drm_box_crds, ele_d, myMesher, steps_cached, domain);
       DRMLoadPattern *ptr =
           new DRMLoadPattern(1, 1.0, patternhandler, domain);
@@ -781,7 +826,7 @@ TclCommand_addPattern(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 int
-TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   
@@ -806,36 +851,32 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc, TCL
 
     // get the id of the node
     int nodeId;
-    if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-      opserr << OpenSees::PromptValueError << "invalid nodeId: " << argv[1];
+    if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+      opserr << OpenSees::PromptValueError << "invalid nodeId: " << Tcl_GetString(objv[1]);
       opserr << " - load nodeId " << ndf << " forces\n";
       return TCL_ERROR;
     }
 
     // get the load vector
     Vector forces(ndf);
-    for (int i = 0; i < ndf; ++i) {
-      double theForce;
-      if (Tcl_GetDouble(interp, argv[2 + i], &theForce) != TCL_OK) {
-        opserr << OpenSees::PromptValueError << "invalid force " << i + 1 << " in load " << nodeId;
-        opserr << ", got " << ndf << " forces\n";
-        return TCL_ERROR;
-      } else
-        forces(i) = theForce;
+    if (G3_GetDoubleArray(interp, ndf, objv+2, &forces(0)) != TCL_OK) {
+      opserr << OpenSees::PromptValueError << "invalid force in load " << nodeId;
+      opserr << ", expected " << ndf << " forces\n";
+      return TCL_ERROR;
     }
 
     // allow some additional options at end of command
     int endMarker = 2 + ndf;
     while (endMarker != argc) {
-      if (strcmp(argv[endMarker], "-const") == 0) {
+      if (G3_ObjIs(objv[endMarker], "-const")) {
         // allow user to specify const load
         isLoadConst = true;
-      } else if (strcmp(argv[endMarker], "-pattern") == 0) {
+      } else if (G3_ObjIs(objv[endMarker], "-pattern")) {
         // allow user to specify load pattern other than current
         endMarker++;
         explicitPatternPassed = true;
         if (endMarker == argc ||
-            Tcl_GetInt(interp, argv[endMarker], &loadPatternTag) != TCL_OK) {
+            Tcl_GetIntFromObj(interp, objv[endMarker], &loadPatternTag) != TCL_OK) {
 
           opserr << OpenSees::PromptValueError << "invalid patternTag - load " << nodeId << " ";
           opserr << ndf << " forces pattern patterntag\n";
@@ -27,6 +27,7 @@
 #include <ConstantSeries.h>
 #include <PathTimeSeries.h>
 #include <PathSeries.h>
+#include "SharedPathSeries.h"
 #include <TrigSeries.h>
 #include <RectangularSeries.h>
 #include <PulseSeries.h>
@@ -457,6 +458,7 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
     Vector *dataTime = nullptr;
     bool useLast = false;
     bool prependZero = false;
+    bool binary = false;
     double startTime = 0.0;
 
     struct stat fileInfo;
@@ -616,6 +618,11 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
         prependZero = true;
       }
 
+      else if (strcmp(argv[endMarker], "-binary") == 0) {
+        // -filePath and -fileTime hold native doubles; map them
+        binary = true;
+      }
+
       else if (strcmp(argv[endMarker], "-startTime") == 0 ||
                strcmp(argv[endMarker], "-tStart") == 0) {
         // allow user to specify the start time
@@ -632,7 +639,26 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
       endMarker++;
     }
 
-    if (filePathName != 0 && fileTimeName == 0 && timeIncr != 0.0) {
+    if (binary) {
+      if (filePathName == 0 || (fileTimeName == 0 && timeIncr == 0.0)) {
+        opserr << G3_ERROR_PROMPT << "binary Path Series requires -filePath "
+                  "and one of -dt or -fileTime\n";
+        return nullptr;
+      }
+      std::shared_ptr<const SharedPathSeries::Path> path =
+          SharedPathSeries::MapFile(argv[filePathName],
+                                    fileTimeName != 0 ? argv[fileTimeName] : nullptr);
+      if (path == nullptr)
+        return nullptr;
+
+      if (fileTimeName != 0)
+        theSeries = new SharedPathSeries(tag, path, cFactor, useLast);
+      else
+        theSeries = new SharedPathSeries(tag, path, timeIncr, cFactor, useLast,
+                                         prependZero, startTime);
+    }
+
+    else if (filePathName != 0 && fileTimeName == 0 && timeIncr != 0.0) {
       theSeries = new PathSeries(tag, argv[filePathName], timeIncr, cFactor,
                                  useLast, prependZero, startTime);
     }
@@ -669,6 +695,8 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
       opserr << " \t -dt constTimeIncr -values {list of points on path}\n";
       opserr << " \t -time {list of time points} -values {list of points on "
                 "path}\n";
+      opserr << " \t -binary -dt constTimeIncr -filePath filePathName\n";
+      opserr << " \t -binary -fileTime fileTimeName -filePath filePathName\n";
       return 0;
     }
 
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <tcl.h>
 #include <Logging.h>
+#include <InputAPI.h>
 #include <ID.h>
 #include <Vector.h>
 #include <Matrix.h>
@@ -35,20 +36,19 @@ static int   resDataSize = 0;
 
 int
 getNodeTags(ClientData clientData, Tcl_Interp *interp, int argc,
-            TCL_Char ** const argv)
+            Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *the_domain = (Domain*)clientData;
 
   NodeIter &nodeIter = the_domain->getNodes();
 
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
   Node *node;
-  char buffer[20];
-  while ((node = nodeIter()) != nullptr) {
-    sprintf(buffer, "%d ", node->getTag());
-    Tcl_AppendResult(interp, buffer, NULL);
-  }
+  while ((node = nodeIter()) != nullptr)
+    Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(node->getTag()));
 
+  Tcl_SetObjResult(interp, list);
   return TCL_OK;
 }
 
@@ -146,62 +146,71 @@ setNodeCoord(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
-int
-nodeDisp(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+//
+// Common implementation of nodeDisp, nodeVel, nodeAccel and nodeReaction
+//
+//   <command> nodeTag? <dof?>
+//
+// Returns a single value when dof is given, otherwise a list
+// with one entry per degree of freedom.
+//
+static int
+nodalResponse(Tcl_Interp *interp, Domain *domain, NodeData type,
+              int argc, Tcl_Obj *const *objv)
 {
-  assert(clientData != nullptr);
-  Domain *domain = (Domain*)clientData;
+  const char *command = Tcl_GetString(objv[0]);
 
   if (argc < 2) {
-    opserr << "WARNING want - nodeDisp nodeTag? <dof?>\n";
+    opserr << G3_ERROR_PROMPT << "want - " << command << " nodeTag? <dof?>\n";
     return TCL_ERROR;
   }
 
   int tag;
   int dof = -1;
 
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-    opserr << "WARNING nodeDisp nodeTag? dof? - could not read nodeTag? \n";
+  if (Tcl_GetIntFromObj(interp, objv[1], &tag) != TCL_OK) {
+    opserr << G3_ERROR_PROMPT << command << " nodeTag? dof? - could not read nodeTag? \n";
     return TCL_ERROR;
   }
 
   if (argc > 2) {
-    if (Tcl_GetInt(interp, argv[2], &dof) != TCL_OK) {
-      opserr << "WARNING nodeDisp nodeTag? dof? - could not read dof? \n";
+    if (Tcl_GetIntFromObj(interp, objv[2], &dof) != TCL_OK) {
+      opserr << G3_ERROR_PROMPT << command << " nodeTag? dof? - could not read dof? \n";
       return TCL_ERROR;
     }
   }
 
   dof--;
 
-  const Vector *nodalResponse = domain->getNodeResponse(tag, NodeData::Disp);
+  const Vector *response = domain->getNodeResponse(tag, type);
 
-  if (nodalResponse == nullptr)
-    // TODO: add error message
+  if (response == nullptr) {
+    opserr << G3_ERROR_PROMPT << command << " - no response for node " << tag << "\n";
     return TCL_ERROR;
+  }
 
-  int size = nodalResponse->Size();
+  const int size = response->Size();
 
   if (dof >= 0) {
-
     if (dof >= size) {
-      opserr << "WARNING nodeDisp nodeTag? dof? - dofTag? too large\n";
+      opserr << G3_ERROR_PROMPT << command << " nodeTag? dof? - dofTag? too large\n";
       return TCL_ERROR;
     }
+    Tcl_SetObjResult(interp, Tcl_NewDoubleObj((*response)(dof)));
 
-    Tcl_SetObjResult(interp, Tcl_NewDoubleObj((*nodalResponse)(dof)));
-
-  } else {
-    char buffer[40];
-    for (int i = 0; i < size; ++i) {
-      sprintf(buffer, "%35.20f", (*nodalResponse)(i));
-      Tcl_AppendResult(interp, buffer, NULL);
-    }
-  }
+  } else
+    Tcl_SetObjResult(interp, G3_NewListObj(*response));
 
   return TCL_OK;
 }
 
+int
+nodeDisp(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
+{
+  assert(clientData != nullptr);
+  return nodalResponse(interp, (Domain*)clientData, NodeData::Disp, argc, objv);
+}
+
 int
 nodeMass(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
@@ -300,62 +309,10 @@ nodeBounds(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** cons
 }
 
 int
-nodeVel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+nodeVel(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
-  Domain *the_domain = (Domain*)clientData;
-
-  if (argc < 2) {
-    opserr << "WARNING want - nodeVel nodeTag? <dof?>\n";
-    return TCL_ERROR;
-  }
-
-  int tag;
-  int dof = -1;
-
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-    opserr << "WARNING nodeVel nodeTag? dof? - could not read nodeTag? \n";
-    return TCL_ERROR;
-  }
-  if (argc > 2) {
-    if (Tcl_GetInt(interp, argv[2], &dof) != TCL_OK) {
-      opserr << "WARNING nodeVel nodeTag? dof? - could not read dof? \n";
-      return TCL_ERROR;
-    }
-  }
-
-  dof--;
-
-  const Vector *nodalResponse = the_domain->getNodeResponse(tag, NodeData::Vel);
-
-  if (nodalResponse == nullptr)
-    // TODO: add error message
-    return TCL_ERROR;
-
-  int size = nodalResponse->Size();
-
-  if (dof >= 0) {
-    if (size < dof)
-    // TODO: add error message
-      return TCL_ERROR;
-
-    double value = (*nodalResponse)(dof);
-
-    // now we copy the value to the tcl string that is returned
-    char buffer[40];
-    sprintf(buffer, "%35.20f", value);
-    Tcl_SetResult(interp, buffer, TCL_VOLATILE);
-
-  } else {
-
-    char buffer[40];
-    for (int i = 0; i < size; ++i) {
-      sprintf(buffer, "%35.20f", (*nodalResponse)(i));
-      Tcl_AppendResult(interp, buffer, NULL);
-    }
-  }
-
-  return TCL_OK;
+  return nodalResponse(interp, (Domain*)clientData, NodeData::Vel, argc, objv);
 }
 
 int
@@ -536,55 +493,10 @@ setNodeAccel(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 int
-nodeAccel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+nodeAccel(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
-
-  Domain *the_domain = (Domain *)clientData;
-
-  if (argc < 2) {
-    opserr << "WARNING want - nodeAccel nodeTag? dof?\n";
-    return TCL_ERROR;
-  }
-
-  int tag;
-  int dof = -1;
-
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-    opserr << "WARNING nodeAccel nodeTag? dof? - could not read nodeTag? \n";
-    return TCL_ERROR;
-  }
-  if (argc > 2) {
-    if (Tcl_GetInt(interp, argv[2], &dof) != TCL_OK) {
-      opserr << "WARNING nodeAccel nodeTag? dof? - could not read dof? \n";
-      return TCL_ERROR;
-    }
-  }
-
-  dof--;
-
-  const Vector *nodalResponse = the_domain->getNodeResponse(tag, NodeData::Accel);
-  if (nodalResponse == nullptr)
-    // TODO: add error message
-    return TCL_ERROR;
-
-  int size = nodalResponse->Size();
-
-  if (dof >= 0) {
-    if (size < dof)
-      return TCL_ERROR;
-
-    Tcl_SetObjResult(interp, Tcl_NewDoubleObj((*nodalResponse)(dof)));
-
-  } else {
-    char buffer[40];
-    for (int i = 0; i < size; ++i) {
-      sprintf(buffer, "%35.20f", (*nodalResponse)(i));
-      Tcl_AppendResult(interp, buffer, NULL);
-    }
-  }
-
-  return TCL_OK;
+  return nodalResponse(interp, (Domain*)clientData, NodeData::Accel, argc, objv);
 }
 
 int
@@ -682,7 +594,7 @@ nodeRotation(ClientData clientData, Tcl_Interp *interp, int argc,
 
 int
 nodeResponse(ClientData clientData, Tcl_Interp *interp, int argc,
-             TCL_Char ** const argv)
+             Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *the_domain = (Domain *)clientData;
@@ -694,46 +606,36 @@ nodeResponse(ClientData clientData, Tcl_Interp *interp, int argc,
 
   int tag, dof, responseID;
 
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &tag) != TCL_OK) {
     opserr << "WARNING nodeResponse nodeTag? dof? - could not read nodeTag? \n";
     return TCL_ERROR;
   }
-  if (Tcl_GetInt(interp, argv[2], &dof) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[2], &dof) != TCL_OK) {
     opserr << "WARNING nodeResponse nodeTag? dof? - could not read dof? \n";
     return TCL_ERROR;
   }
 
-  if (Tcl_GetInt(interp, argv[3], &responseID) != TCL_OK) {
-    if (strcmp(argv[3], "displacement") == 0)
+  if (Tcl_GetIntFromObj(nullptr, objv[3], &responseID) != TCL_OK) {
+    if (G3_ObjIs(objv[3], "displacement"))
       responseID = (int)NodeData::Disp;
-    else if (strcmp(argv[3], "velocity") == 0)
+    else if (G3_ObjIs(objv[3], "velocity"))
       responseID = (int)NodeData::Vel;
-    else if (strcmp(argv[3], "acceleration") == 0)
+    else if (G3_ObjIs(objv[3], "acceleration"))
       responseID = (int)NodeData::Accel;
-    else if (strcmp(argv[3], "resiudal") == 0)
+    else if (G3_ObjIs(objv[3], "resiudal"))
       responseID = (int)NodeData::UnbalancedLoad;
     else {
-      opserr << "WARNING unknown response " << argv[3] << "\n";
+      opserr << "WARNING unknown response " << Tcl_GetString(objv[3]) << "\n";
       return TCL_ERROR;
     }
   }
 
   dof--;
 
-  const Vector *nodalResponse = nullptr;
-  if (false) {
-    // This would need some adjusting for PartitionedDomain
-    Node *theNode = the_domain->getNode(tag);
-    if (theNode == nullptr)
-      return TCL_ERROR;
-
-    nodalResponse = theNode->getResponse((NodeData)responseID);
-
-  } else
-    nodalResponse =
-        the_domain->getNodeResponse(tag, (NodeData)responseID);
+  const Vector *nodalResponse =
+      the_domain->getNodeResponse(tag, (NodeData)responseID);
 
-  if (nodalResponse == nullptr || nodalResponse->Size() < dof || dof < 0)
+  if (nodalResponse == nullptr || dof >= nodalResponse->Size() || dof < 0)
     // TODO: add error message
     return TCL_ERROR;
 
@@ -845,63 +747,14 @@ calculateNodalReactions(ClientData clientData, Tcl_Interp *interp, int argc,
 
 int
 nodeReaction(ClientData clientData, Tcl_Interp *interp, int argc,
-             TCL_Char ** const argv)
+             Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
-  Domain *domain = (Domain*)clientData;
-
-  if (argc < 2) {
-    opserr << "WARNING want - nodeReaction nodeTag? <dof?>\n";
-    return TCL_ERROR;
-  }
-
-  int tag;
-  int dof = -1;
-
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-    opserr << "WARNING nodeReaction nodeTag? dof? - could not read nodeTag? \n";
-    return TCL_ERROR;
-  }
-
-  if (argc > 2) {
-    if (Tcl_GetInt(interp, argv[2], &dof) != TCL_OK) {
-      opserr << "WARNING nodeReaction nodeTag? dof? - could not read dof? \n";
-      return TCL_ERROR;
-    }
-  }
-
-  dof--;
-
-  const Vector *nodalResponse = domain->getNodeResponse(tag, NodeData::Reaction);
-
-  if (nodalResponse == nullptr)
-    // TODO: add error message
-    return TCL_ERROR;
-
-  int size = nodalResponse->Size();
-
-  if (dof >= 0) {
-
-    if (dof >= size) {
-      opserr << "WARNING nodeReaction nodeTag? dof? - dofTag? too large\n";
-      return TCL_ERROR;
-    }
-
-    Tcl_SetObjResult(interp, Tcl_NewDoubleObj((*nodalResponse)(dof)));
-
-  } else {
-    char buffer[40];
-    for (int i = 0; i < size; ++i) {
-      sprintf(buffer, "%35.20f", (*nodalResponse)(i));
-      Tcl_AppendResult(interp, buffer, NULL);
-    }
-  }
-
-  return TCL_OK;
+  return nodalResponse(interp, (Domain*)clientData, NodeData::Reaction, argc, objv);
 }
 
 int
-nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *the_domain = (Domain*)clientData;
@@ -913,7 +766,7 @@ nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
 
   int tag;
 
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &tag) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "nodeCoord nodeTag? dim? - could not read nodeTag? \n";
     return TCL_ERROR;
   }
@@ -921,14 +774,15 @@ nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
   int dim = -1;
 
   if (argc > 2) {
-    if (strcmp(argv[2], "X") == 0 || strcmp(argv[2], "x") == 0 ||
-        strcmp(argv[2], "1") == 0)
+    const char *arg = Tcl_GetString(objv[2]);
+    if (strcmp(arg, "X") == 0 || strcmp(arg, "x") == 0 ||
+        strcmp(arg, "1") == 0)
       dim = 0;
-    else if (strcmp(argv[2], "Y") == 0 || strcmp(argv[2], "y") == 0 ||
-             strcmp(argv[2], "2") == 0)
+    else if (strcmp(arg, "Y") == 0 || strcmp(arg, "y") == 0 ||
+             strcmp(arg, "2") == 0)
       dim = 1;
-    else if (strcmp(argv[2], "Z") == 0 || strcmp(argv[2], "z") == 0 ||
-             strcmp(argv[2], "3") == 0)
+    else if (strcmp(arg, "Z") == 0 || strcmp(arg, "z") == 0 ||
+             strcmp(arg, "3") == 0)
       dim = 2;
     else {
       opserr << G3_ERROR_PROMPT << "" << "nodeCoord nodeTag? dim? - could not read dim? \n";
@@ -945,18 +799,12 @@ nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
 
   const Vector &coords = theNode->getCrds();
 
-  char buffer[40];
-  int size = coords.Size();
   if (dim == -1) {
-    for (int i = 0; i < size; ++i) {
-      sprintf(buffer, "%35.20f", coords(i));
-      Tcl_AppendResult(interp, buffer, NULL);
-    }
+    Tcl_SetObjResult(interp, G3_NewListObj(coords));
     return TCL_OK;
 
-  } else if (dim < size) {
-    double value = coords(dim);
-    Tcl_SetObjResult(interp, Tcl_NewDoubleObj(value));
+  } else if (dim < coords.Size()) {
+    Tcl_SetObjResult(interp, Tcl_NewDoubleObj(coords(dim)));
     return TCL_OK;
   }
 
@@ -1010,7 +858,7 @@ retainedNodes(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 int
-nodeDOFs(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+nodeDOFs(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *the_domain = (Domain*)clientData;
@@ -1023,7 +871,7 @@ nodeDOFs(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
   }
 
   int tag;
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &tag) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "nodeDOFs nodeTag?\n";
     return TCL_ERROR;
   }
@@ -1037,7 +885,6 @@ nodeDOFs(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
     return TCL_ERROR;
   }
 
-  int numDOF = theNode->getNumberDOF();
   DOF_Group *theDOFgroup = theNode->getDOF_GroupPtr();
   if (theDOFgroup == nullptr) {
     opserr << OpenSees::PromptValueError
@@ -1046,13 +893,7 @@ nodeDOFs(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
     return -1;
   }
 
-  char buffer[40];
-  const ID &eqnNumbers = theDOFgroup->getID();
-  for (int i = 0; i < numDOF; ++i) {
-    sprintf(buffer, "%d ", eqnNumbers(i));
-    Tcl_AppendResult(interp, buffer, NULL);
-  }
-
+  Tcl_SetObjResult(interp, G3_NewListObj(theDOFgroup->getID()));
   return TCL_OK;
 }
 
@@ -59,9 +59,10 @@
 #include <DamageRecorder.h>
 #include <MeshRegion.h>
 #include <RemoveRecorder.h>
+#include "recording/StatisticsRecorder.h"
+#include "recording/EncodedFileStream.h"
 
 #define MAX_NDF 6
-extern FE_Datastore    *theDatabase;
 extern FEM_ObjectBroker theBroker;
 
 OPS_Routine OPS_PVDRecorder;
@@ -101,6 +102,8 @@ struct OutputOptions {
 
   FE_Datastore *theDatabase = nullptr;
 
+  EncodedFileStream::Encoding encoding;
+
   enum Mode {
     STANDARD_STREAM,
     DATA_STREAM,
@@ -110,6 +113,7 @@ struct OutputOptions {
     DATA_STREAM_CSV,
     TCP_STREAM,
     DATA_STREAM_ADD,
+    ENCODED_STREAM,
     MODE_UNSPECIFIED
   } eMode = STANDARD_STREAM;
 };
@@ -119,11 +123,26 @@ static int
 createNodeRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
                   TCL_Char ** const argv, Recorder **theRecorder);
 
+static int
+createStatisticsRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
+                         TCL_Char ** const argv, Recorder **theRecorder);
+
 static OPS_Stream *
 createOutputStream(OutputOptions &options)
 {
   OPS_Stream *theOutputStream = nullptr;
 
+  // the encoding options only apply to binary output
+  const EncodedFileStream::Encoding encoding;
+  if ((options.encoding.flags != encoding.flags ||
+       options.encoding.codec != encoding.codec ||
+       options.encoding.chunkRows != encoding.chunkRows) &&
+      options.eMode != OutputOptions::BINARY_STREAM &&
+      options.eMode != OutputOptions::ENCODED_STREAM) {
+    opserr << G3_WARN_PROMPT << "-float32, -delta, -quantize, -compress and -chunk "
+           << "require -binary or -encoded output and are ignored\n";
+  }
+
   // construct the DataHandler
   if (options.filename != nullptr) {
     if (options.eMode == OutputOptions::DATA_STREAM) {
@@ -154,7 +173,14 @@ createOutputStream(OutputOptions &options)
       theOutputStream = new XmlFileStream(options.filename);
 
     } else if (options.eMode == OutputOptions::BINARY_STREAM) {
-      theOutputStream = new BinaryFileStream(options.filename);
+      // any encoding option selects the encoded binary form
+      if (options.encoding.flags != 0 || options.encoding.codec != EncodedFileStream::None)
+        theOutputStream = new EncodedFileStream(options.filename, options.encoding);
+      else
+        theOutputStream = new BinaryFileStream(options.filename);
+
+    } else if (options.eMode == OutputOptions::ENCODED_STREAM) {
+      theOutputStream = new EncodedFileStream(options.filename, options.encoding);
     }
 
   } else if (options.eMode == OutputOptions::TCP_STREAM && options.inetAddr != 0) {
@@ -295,6 +321,68 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       loc++;
     }
 
+    //
+    // Encoded binary output
+    //
+    else if (strcmp(argv[loc], "-float32") == 0) {
+      options->encoding.flags |= EncodedFileStream::Float32;
+      loc++;
+    }
+
+    else if (strcmp(argv[loc], "-delta") == 0) {
+      options->encoding.flags |= EncodedFileStream::Delta;
+      loc++;
+    }
+
+    else if (strcmp(argv[loc], "-quantize") == 0) {
+      // one tolerance per column as written, the last repeated; with
+      // -time the first column is the time, so its tolerance comes first
+      double tol;
+      options->encoding.tolerance.clear();
+      while (++loc < argc && Tcl_GetDouble(interp, argv[loc], &tol) == TCL_OK) {
+        if (tol <= 0.0) {
+          opserr << G3_ERROR_PROMPT << "-quantize tolerances must be positive\n";
+          return -1;
+        }
+        options->encoding.tolerance.push_back(tol);
+      }
+      Tcl_ResetResult(interp);
+      if (options->encoding.tolerance.empty()) {
+        opserr << G3_ERROR_PROMPT << "expected tolerance after flag -quantize\n";
+        return -1;
+      }
+      options->encoding.flags |= EncodedFileStream::Quantized;
+    }
+
+    else if (strcmp(argv[loc], "-compress") == 0) {
+      if (++loc >= argc) {
+        opserr << G3_ERROR_PROMPT << "expected zstd or lz4 after flag -compress\n";
+        return -1;
+      }
+      if (strcmp(argv[loc], "zstd") == 0)
+        options->encoding.codec = EncodedFileStream::Zstd;
+      else if (strcmp(argv[loc], "lz4") == 0)
+        options->encoding.codec = EncodedFileStream::LZ4;
+      else {
+        opserr << G3_ERROR_PROMPT << "unknown compression '" << argv[loc]
+               << "', expected zstd or lz4\n";
+        return -1;
+      }
+      loc++;
+      if (loc < argc && Tcl_GetInt(interp, argv[loc], &options->encoding.level) == TCL_OK)
+        loc++;
+      Tcl_ResetResult(interp);
+    }
+
+    else if (strcmp(argv[loc], "-chunk") == 0) {
+      if (++loc >= argc || Tcl_GetInt(interp, argv[loc], &options->encoding.chunkRows) != TCL_OK
+          || options->encoding.chunkRows < 1) {
+        opserr << G3_ERROR_PROMPT << "expected number of rows after flag -chunk\n";
+        return -1;
+      }
+      loc++;
+    }
+
     else if (strcmp(argv[loc], "-buffer") == 0 ||
              strcmp(argv[loc], "-bufferSize") == 0) {
       loc++;
@@ -323,6 +411,9 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       else if ((strcmp(argv[loc], "-binary") == 0)) {
         eMode = OutputOptions::BINARY_STREAM;
       }
+      else if ((strcmp(argv[loc], "-encoded") == 0)) {
+        eMode = OutputOptions::ENCODED_STREAM;
+      }
       else if ((strcmp(argv[loc], "-TCP") == 0) ||
                (strcmp(argv[loc], "-tcp") == 0)) {
         options->inetAddr = argv[loc + 1];
@@ -1140,6 +1231,10 @@ TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
     return createNodeRecorder(clientData, interp, argc, argv, theRecorder);
   }
 
+  else if (strcmp(argv[1], "Statistics") == 0) {
+    return createStatisticsRecorder(clientData, interp, argc, argv, theRecorder);
+  }
+
   else if (strcmp(argv[1], "Pattern") == 0) {
     if (argc < 4) {
       opserr << "WARNING recorder Pattern filename? <startFlag> patternTag?";
@@ -1828,3 +1923,258 @@ createNodeRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
 
   return TCL_OK;
 }
+
+// Read ints from argv[pos] on, up to the first argument that is not one
+static int
+parseIntegers(Tcl_Interp *interp, int argc, TCL_Char ** const argv, int pos, ID &values)
+{
+  int value;
+  int numValues = 0;
+  while (pos < argc && Tcl_GetInt(interp, argv[pos], &value) == TCL_OK) {
+    values[numValues++] = value;
+    pos++;
+  }
+  Tcl_ResetResult(interp);
+  return pos;
+}
+
+static int
+parseDoubles(Tcl_Interp *interp, int argc, TCL_Char ** const argv, int pos,
+             std::vector<double> &values)
+{
+  double value;
+  while (pos < argc && Tcl_GetDouble(interp, argv[pos], &value) == TCL_OK) {
+    values.push_back(value);
+    pos++;
+  }
+  Tcl_ResetResult(interp);
+  return pos;
+}
+
+//
+// recorder Statistics <output options>
+//     (-node {tags} -dof {dofs} <-timeSeries {tags}> response
+//    | -iNode {tags} -jNode {tags} -dof dof -perpDirn dirn)
+//     -stat name <args> ...
+//
+// where each -stat is one of
+//
+//   max | min | absMax | mean | rms
+//   spectrum -periods {periods} <-damping zeta>
+//   histogram numBins lower upper
+//   rainflow numBins maxRange
+//   exceedance {thresholds}
+//
+static int
+createStatisticsRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
+                         TCL_Char ** const argv, Recorder **theRecorder)
+{
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+  G3_Runtime *rt = G3_getRuntime(interp);
+
+  OutputOptions options;
+  TCL_Char *responseID = nullptr;
+  ID nodes(0, 16), dofs(0, MAX_NDF), seriesTags(0, MAX_NDF);
+  ID iNodes(0, 16), jNodes(0, 16);
+  int perpDirn = 2;
+  std::vector<StatisticsRecorder::Statistic> statistics;
+
+  int pos = 2;
+  while (pos < argc) {
+    int consumed;
+    if ((consumed = parseOutputOption(&options, interp, argc-pos, &argv[pos])) != 0) {
+      if (consumed > 0)
+        pos += consumed;
+      else
+        return TCL_ERROR;
+    }
+
+    else if ((strcmp(argv[pos], "-node") == 0) ||
+             (strcmp(argv[pos], "-nodes") == 0)) {
+      pos = parseIntegers(interp, argc, argv, pos + 1, nodes);
+      for (int i = 0; i < nodes.Size(); i++)
+        if (domain->getNode(nodes(i)) == nullptr) {
+          opserr << G3_ERROR_PROMPT << "cannot find node with tag " << nodes(i) << "\n";
+          return TCL_ERROR;
+        }
+    }
+
+    else if ((strcmp(argv[pos], "-iNode") == 0) ||
+             (strcmp(argv[pos], "-iNodes") == 0))
+      pos = parseIntegers(interp, argc, argv, pos + 1, iNodes);
+
+    else if ((strcmp(argv[pos], "-jNode") == 0) ||
+             (strcmp(argv[pos], "-jNodes") == 0))
+      pos = parseIntegers(interp, argc, argv, pos + 1, jNodes);
+
+    else if (strcmp(argv[pos], "-dof") == 0) {
+      dofs = ID(0, MAX_NDF);
+      pos = parseIntegers(interp, argc, argv, pos + 1, dofs);
+      for (int i = 0; i < dofs.Size(); i++)
+        dofs[i] -= 1; // C indexing
+    }
+
+    else if (strcmp(argv[pos], "-perpDirn") == 0) {
+      if (pos + 1 >= argc || Tcl_GetInt(interp, argv[pos + 1], &perpDirn) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "recorder Statistics -perpDirn dirn? - invalid direction\n";
+        return TCL_ERROR;
+      }
+      pos += 2;
+    }
+
+    else if (strcmp(argv[pos], "-timeSeries") == 0)
+      pos = parseIntegers(interp, argc, argv, pos + 1, seriesTags);
+
+    else if (strcmp(argv[pos], "-stat") == 0 ||
+             strcmp(argv[pos], "-statistic") == 0) {
+      if (++pos >= argc) {
+        opserr << G3_ERROR_PROMPT << "recorder Statistics -stat - missing statistic\n";
+        return TCL_ERROR;
+      }
+      typedef StatisticsRecorder::Statistic Statistic;
+      Statistic statistic;
+      TCL_Char *name = argv[pos++];
+
+      if (strcmp(name, "max") == 0)
+        statistic.type = Statistic::Max;
+      else if (strcmp(name, "min") == 0)
+        statistic.type = Statistic::Min;
+      else if (strcmp(name, "absMax") == 0)
+        statistic.type = Statistic::AbsMax;
+      else if (strcmp(name, "mean") == 0)
+        statistic.type = Statistic::Mean;
+      else if (strcmp(name, "rms") == 0)
+        statistic.type = Statistic::RMS;
+
+      else if (strcmp(name, "spectrum") == 0) {
+        statistic.type = Statistic::Spectrum;
+        while (pos < argc) {
+          if (strcmp(argv[pos], "-periods") == 0)
+            pos = parseDoubles(interp, argc, argv, pos + 1, statistic.values);
+          else if (strcmp(argv[pos], "-damping") == 0) {
+            if (pos + 1 >= argc || Tcl_GetDouble(interp, argv[pos + 1], &statistic.damping) != TCL_OK
+                || statistic.damping < 0.0) {
+              opserr << G3_ERROR_PROMPT << "recorder Statistics spectrum - invalid damping\n";
+              return TCL_ERROR;
+            }
+            pos += 2;
+          } else
+            break;
+        }
+        if (statistic.values.empty()) {
+          opserr << G3_ERROR_PROMPT << "recorder Statistics spectrum - no -periods given\n";
+          return TCL_ERROR;
+        }
+        for (double period : statistic.values)
+          if (period <= 0.0) {
+            opserr << G3_ERROR_PROMPT << "recorder Statistics spectrum - periods must be positive\n";
+            return TCL_ERROR;
+          }
+      }
+
+      else if (strcmp(name, "histogram") == 0) {
+        statistic.type = Statistic::Histogram;
+        if (pos + 2 >= argc
+            || Tcl_GetInt(interp, argv[pos], &statistic.numBins) != TCL_OK
+            || Tcl_GetDouble(interp, argv[pos + 1], &statistic.lower) != TCL_OK
+            || Tcl_GetDouble(interp, argv[pos + 2], &statistic.upper) != TCL_OK
+            || statistic.numBins < 1 || statistic.upper <= statistic.lower) {
+          opserr << G3_ERROR_PROMPT << "recorder Statistics -stat histogram numBins? lower? upper?\n";
+          return TCL_ERROR;
+        }
+        pos += 3;
+      }
+
+      else if (strcmp(name, "rainflow") == 0) {
+        statistic.type = Statistic::Rainflow;
+        if (pos + 1 >= argc
+            || Tcl_GetInt(interp, argv[pos], &statistic.numBins) != TCL_OK
+            || Tcl_GetDouble(interp, argv[pos + 1], &statistic.upper) != TCL_OK
+            || statistic.numBins < 1 || statistic.upper <= 0.0) {
+          opserr << G3_ERROR_PROMPT << "recorder Statistics -stat rainflow numBins? maxRange?\n";
+          return TCL_ERROR;
+        }
+        pos += 2;
+      }
+
+      else if (strcmp(name, "exceedance") == 0) {
+        statistic.type = Statistic::Exceedance;
+        pos = parseDoubles(interp, argc, argv, pos, statistic.values);
+        if (statistic.values.empty()) {
+          opserr << G3_ERROR_PROMPT << "recorder Statistics -stat exceedance - no thresholds given\n";
+          return TCL_ERROR;
+        }
+      }
+
+      else {
+        opserr << G3_ERROR_PROMPT << "recorder Statistics - unknown statistic '" << name << "'\n";
+        return TCL_ERROR;
+      }
+      statistics.push_back(statistic);
+    }
+
+    else if (responseID == nullptr && argv[pos][0] != '-') {
+      responseID = argv[pos];
+      pos++;
+    }
+
+    else {
+      opserr << G3_ERROR_PROMPT << "recorder Statistics - unknown argument " << argv[pos] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (statistics.empty()) {
+    opserr << G3_ERROR_PROMPT << "recorder Statistics - no -stat given\n";
+    return TCL_ERROR;
+  }
+
+  if (iNodes.Size() > 0 || jNodes.Size() > 0) {
+    if (iNodes.Size() != jNodes.Size() || nodes.Size() > 0 || dofs.Size() != 1) {
+      opserr << G3_ERROR_PROMPT << "recorder Statistics - drifts need as many -iNode as -jNode "
+             << "and one -dof, and no -node\n";
+      return TCL_ERROR;
+    }
+    (*theRecorder) = new StatisticsRecorder(iNodes, jNodes, dofs(0), perpDirn - 1,
+                                            statistics, *domain, *createOutputStream(options));
+    return TCL_OK;
+  }
+
+  if (nodes.Size() == 0 || dofs.Size() == 0) {
+    opserr << G3_ERROR_PROMPT << "recorder Statistics - no -node and -dof given\n";
+    return TCL_ERROR;
+  }
+
+  int dataIndex = -1;
+  NodeData dataFlag = getNodeDataFlag(responseID, *domain, &dataIndex);
+  if (dataFlag == NodeData::Unknown || dataFlag == NodeData::Empty) {
+    opserr << G3_ERROR_PROMPT << "invalid response ID '" << responseID << "'\n";
+    return TCL_ERROR;
+  }
+
+  TimeSeries **theSeries = nullptr;
+  if (seriesTags.Size() > 0) {
+    if (seriesTags.Size() != dofs.Size()) {
+      opserr << G3_ERROR_PROMPT << "recorder Statistics - # TimeSeries must equal # dof\n";
+      return TCL_ERROR;
+    }
+    theSeries = new TimeSeries *[dofs.Size()];
+    for (int j = 0; j < dofs.Size(); j++) {
+      TimeSeries *series = nullptr;
+      if (seriesTags(j) > 0 && (series = G3_getTimeSeries(rt, seriesTags(j))) == nullptr) {
+        opserr << G3_ERROR_PROMPT << "recorder Statistics - time series " << seriesTags(j)
+               << " not found\n";
+        for (int k = 0; k < j; k++)
+          delete theSeries[k];
+        delete[] theSeries;
+        return TCL_ERROR;
+      }
+      theSeries[j] = series != nullptr ? series->getCopy() : nullptr;
+    }
+  }
+
+  (*theRecorder) = new StatisticsRecorder(nodes, dofs, dataFlag, theSeries, statistics,
+                                          *domain, *createOutputStream(options));
+  return TCL_OK;
+}
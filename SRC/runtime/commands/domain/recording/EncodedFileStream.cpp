@@ -0,0 +1,265 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Encoded binary recorder output; see EncodedFileStream.h
+//
+// Written: cmp
+//
+#include "EncodedFileStream.h"
+
+#include <math.h>
+#include <string.h>
+#include <Vector.h>
+#include <Logging.h>
+#ifdef OPS_USE_ZSTD
+#  include <zstd.h>
+#endif
+#ifdef OPS_USE_LZ4
+#  include <lz4.h>
+#endif
+
+static const char magic[8] = {'O', 'P', 'S', 'E', 'N', 'C', '0', '1'};
+
+bool
+EncodedFileStream::haveCodec(int codec)
+{
+  switch (codec) {
+  case None:
+    return true;
+#ifdef OPS_USE_ZSTD
+  case Zstd:
+    return true;
+#endif
+#ifdef OPS_USE_LZ4
+  case LZ4:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+EncodedFileStream::EncodedFileStream(const char *fileName, const Encoding &options)
+  : OPS_Stream(OPS_STREAM_TAGS_EncodedFileStream),
+    theFile(nullptr), encoding(options), numColumns(0), numRows(0)
+{
+  if (!haveCodec(encoding.codec)) {
+    opserr << "WARNING EncodedFileStream - compression is not available in this build, "
+           << "writing " << fileName << " uncompressed\n";
+    encoding.codec = None;
+  }
+  if ((encoding.flags & Quantized) && encoding.tolerance.empty())
+    encoding.flags &= ~Quantized;
+  if (encoding.chunkRows < 1)
+    encoding.chunkRows = 1;
+
+  theFile = fopen(fileName, "wb");
+  if (theFile == nullptr) {
+    opserr << "WARNING EncodedFileStream - could not open file " << fileName << "\n";
+    return;
+  }
+
+  const int32_t header[4] = {encoding.flags, encoding.codec, 0, 0};
+  fwrite(magic, 1, sizeof(magic), theFile);
+  fwrite(header, sizeof(int32_t), 4, theFile);
+}
+
+EncodedFileStream::~EncodedFileStream()
+{
+  if (theFile != nullptr) {
+    this->writeChunk();
+    fclose(theFile);
+  }
+}
+
+int
+EncodedFileStream::flush()
+{
+  if (theFile == nullptr)
+    return -1;
+  if (this->writeChunk() < 0)
+    return -1;
+  return fflush(theFile) == 0 ? 0 : -1;
+}
+
+int
+EncodedFileStream::write(Vector &data)
+{
+  const int n = data.Size();
+  if (n > 0)
+    this->addRow(&data(0), n);
+  return 0;
+}
+
+OPS_Stream&
+EncodedFileStream::write(const double *s, int n)
+{
+  if (n > 0)
+    this->addRow(s, n);
+  return *this;
+}
+
+void
+EncodedFileStream::addRow(const double *row, int n)
+{
+  if (theFile == nullptr)
+    return;
+
+  // a change in the number of columns starts a new chunk
+  if (n != numColumns) {
+    this->writeChunk();
+    numColumns = n;
+  }
+
+  rows.insert(rows.end(), row, row + n);
+  if (++numRows >= encoding.chunkRows)
+    this->writeChunk();
+}
+
+namespace {
+
+template <typename Word> void
+putWord(std::vector<uint8_t> &out, Word word)
+{
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&word);
+  out.insert(out.end(), bytes, bytes + sizeof(Word));
+}
+
+void
+putVarint(std::vector<uint8_t> &out, int64_t value)
+{
+  uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+  while (zigzag >= 0x80) {
+    out.push_back((uint8_t)(zigzag | 0x80));
+    zigzag >>= 7;
+  }
+  out.push_back((uint8_t)zigzag);
+}
+
+} // namespace
+
+int
+EncodedFileStream::writeChunk()
+{
+  if (theFile == nullptr || numRows == 0)
+    return 0;
+
+  const int flags = encoding.flags;
+  const bool delta = (flags & Delta) != 0;
+
+  std::vector<double> step;
+  if (flags & Quantized) {
+    step.resize(numColumns);
+    for (int j = 0; j < numColumns; j++) {
+      const std::vector<double> &tol = encoding.tolerance;
+      step[j] = 2.0*tol[j < (int)tol.size() ? j : tol.size() - 1];
+    }
+  }
+
+  //
+  // Encode column by column
+  //
+  raw.clear();
+  for (int j = 0; j < numColumns; j++) {
+    if (flags & Quantized) {
+      // values beyond the range of the integers, or not finite, are stored as 0
+      const double limit = 4.0e18*step[j];
+      int64_t last = 0;
+      for (int i = 0; i < numRows; i++) {
+        const double x = rows[(size_t)i*numColumns + j];
+        const int64_t q = (isfinite(x) && fabs(x) < limit) ? llround(x/step[j]) : 0;
+        putVarint(raw, delta ? q - last : q);
+        last = q;
+      }
+    }
+    else if (flags & Float32) {
+      uint32_t last = 0;
+      for (int i = 0; i < numRows; i++) {
+        const float x = (float)rows[(size_t)i*numColumns + j];
+        uint32_t word;
+        memcpy(&word, &x, sizeof(word));
+        putWord(raw, delta ? word ^ last : word);
+        last = word;
+      }
+    }
+    else {
+      uint64_t last = 0;
+      for (int i = 0; i < numRows; i++) {
+        uint64_t word;
+        memcpy(&word, &rows[(size_t)i*numColumns + j], sizeof(word));
+        putWord(raw, delta ? word ^ last : word);
+        last = word;
+      }
+    }
+  }
+
+  //
+  // Compress
+  //
+  const uint8_t *payload = raw.data();
+  size_t size = raw.size();
+  switch (encoding.codec) {
+#ifdef OPS_USE_ZSTD
+  case Zstd: {
+    stored.resize(ZSTD_compressBound(raw.size()));
+    size = ZSTD_compress(stored.data(), stored.size(), raw.data(), raw.size(), encoding.level);
+    if (ZSTD_isError(size)) {
+      opserr << "WARNING EncodedFileStream - " << ZSTD_getErrorName(size) << "\n";
+      return -1;
+    }
+    payload = stored.data();
+    break;
+  }
+#endif
+#ifdef OPS_USE_LZ4
+  case LZ4: {
+    stored.resize(LZ4_compressBound((int)raw.size()));
+    size = LZ4_compress_default((const char *)raw.data(), (char *)stored.data(),
+                                (int)raw.size(), (int)stored.size());
+    if (size == 0) {
+      opserr << "WARNING EncodedFileStream - LZ4 compression failed\n";
+      return -1;
+    }
+    payload = stored.data();
+    break;
+  }
+#endif
+  default:
+    break;
+  }
+
+  const int32_t shape[2] = {numRows, numColumns};
+  const int64_t sizes[2] = {(int64_t)raw.size(), (int64_t)size};
+  bool ok = fwrite(shape, sizeof(int32_t), 2, theFile) == 2
+         && fwrite(sizes, sizeof(int64_t), 2, theFile) == 2;
+  if (ok && !step.empty())
+    ok = fwrite(step.data(), sizeof(double), step.size(), theFile) == step.size();
+  if (ok)
+    ok = fwrite(payload, 1, size, theFile) == size;
+
+  rows.clear();
+  numRows = 0;
+
+  if (!ok) {
+    opserr << "WARNING EncodedFileStream - could not write to the file\n";
+    return -1;
+  }
+  return 0;
+}
+
+int
+EncodedFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "WARNING EncodedFileStream::sendSelf() - not implemented\n";
+  return -1;
+}
+
+int
+EncodedFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "WARNING EncodedFileStream::recvSelf() - not implemented\n";
+  return -1;
+}
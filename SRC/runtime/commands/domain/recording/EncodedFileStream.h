@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: EncodedFileStream writes the records of a recorder in a
+// compact binary form, for recording large numbers of dofs that change
+// little from one step to the next. Records are gathered in chunks of
+// rows, stored column by column, and each chunk may be
+//
+//   float32   stored as single precision
+//   delta     XOR-ed with the previous row of the chunk, so that values
+//             that did not change are stored as zero words
+//   quantized rounded to a multiple of 2 tol for a tolerance tol given per
+//             column, so the error is at most tol; the integers are
+//             differenced (with delta) and written as zigzag varints
+//
+// Quantization tolerances are matched to the columns of the rows as the
+// recorder writes them, the last one repeated. A time column recorded
+// with -time is the first column and takes the first tolerance, so give
+// it one of its own (e.g. -quantize 1e-9 1e-4) unless the response
+// tolerance is also fine enough for the time.
+//
+// and then compressed with zstd or LZ4 when OpenSees is built with them.
+// Each chunk decodes on its own. The tags and attributes of the recorder
+// header are not written.
+//
+// File layout (native byte order):
+//
+//   "OPSENC01"   int32 flags   int32 codec   int32 0   int32 0
+//   chunks:      int32 rows    int32 cols    int64 rawBytes   int64 storedBytes
+//                [cols doubles, the quantization steps, if quantized]
+//                storedBytes of payload
+//
+// opensees.recorder.read_encoded reads the file back as a NumPy array.
+//
+// Written: cmp
+//
+#ifndef EncodedFileStream_h
+#define EncodedFileStream_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <OPS_Stream.h>
+
+#define OPS_STREAM_TAGS_EncodedFileStream 1321
+
+class Vector;
+class Channel;
+class FEM_ObjectBroker;
+
+class EncodedFileStream : public OPS_Stream
+{
+ public:
+  enum Flags {
+    Float32   = 1,
+    Delta     = 2,
+    Quantized = 4
+  };
+  enum Codec {
+    None = 0,
+    Zstd = 1,
+    LZ4  = 2
+  };
+
+  struct Encoding {
+    int  flags     = 0;
+    int  codec     = None;
+    int  level     = 3;            // zstd compression level
+    int  chunkRows = 256;
+    std::vector<double> tolerance; // per column, the last one repeated
+  };
+
+  static bool haveCodec(int codec);
+
+  EncodedFileStream(const char *fileName, const Encoding &encoding);
+  ~EncodedFileStream();
+
+  int flush();
+
+  // xml stuff
+  int tag(const char *) {return 0;}
+  int tag(const char *, const char *) {return 0;}
+  int endTag() {return 0;}
+  int attr(const char *name, int value) {return 0;}
+  int attr(const char *name, double value) {return 0;}
+  int attr(const char *name, const char *value) {return 0;}
+  int write(Vector &data);
+
+  // regular stuff; only rows of doubles are recorded
+  OPS_Stream& write(const char *s, int n) {return *this;}
+  OPS_Stream& write(const unsigned char *s, int n) {return *this;}
+  OPS_Stream& write(const signed char *s, int n) {return *this;}
+  OPS_Stream& write(const void *s, int n) {return *this;}
+  OPS_Stream& write(const double *s, int n);
+  OPS_Stream& operator<<(char c) {return *this;}
+  OPS_Stream& operator<<(unsigned char c) {return *this;}
+  OPS_Stream& operator<<(signed char c) {return *this;}
+  OPS_Stream& operator<<(const char *s) {return *this;}
+  OPS_Stream& operator<<(const unsigned char *s) {return *this;}
+  OPS_Stream& operator<<(const signed char *s) {return *this;}
+  OPS_Stream& operator<<(const void *p) {return *this;}
+  OPS_Stream& operator<<(int n) {return *this;}
+  OPS_Stream& operator<<(unsigned int n) {return *this;}
+  OPS_Stream& operator<<(long n) {return *this;}
+  OPS_Stream& operator<<(unsigned long n) {return *this;}
+  OPS_Stream& operator<<(short n) {return *this;}
+  OPS_Stream& operator<<(unsigned short n) {return *this;}
+  OPS_Stream& operator<<(bool b) {return *this;}
+  OPS_Stream& operator<<(double n) {return *this;}
+  OPS_Stream& operator<<(float n) {return *this;}
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+ private:
+  void addRow(const double *row, int n);
+  int  writeChunk();
+
+  FILE    *theFile;
+  Encoding encoding;
+  int      numColumns;
+  int      numRows;
+  std::vector<double>  rows;     // numRows x numColumns, by rows
+  std::vector<uint8_t> raw, stored;
+};
+
+#endif
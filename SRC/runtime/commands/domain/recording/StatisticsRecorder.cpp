@@ -0,0 +1,620 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Streaming statistics recorder; see StatisticsRecorder.h
+//
+// Written: cmp
+//
+#include "StatisticsRecorder.h"
+
+#include <math.h>
+#include <algorithm>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <TimeSeries.h>
+#include <OPS_Stream.h>
+#include <Logging.h>
+#include <utilities/spectrum.h>
+
+//
+// A reduction updates its state with the values of all the channels at one
+// time, and produces its rows of the table at any point of the analysis.
+//
+class StatisticsRecorder::Reduction
+{
+ public:
+  virtual ~Reduction() {}
+  virtual int  numRows() const = 0;
+  virtual void reset(int numChannels) = 0;
+  // dt is the time since the previous update, or 0 at the first one
+  virtual void update(double t, double dt, const double *x, int numChannels) = 0;
+  // rows is numRows() x numChannels, by rows
+  virtual void getRows(double *rows, int numChannels) const = 0;
+};
+
+namespace {
+
+class Peak : public StatisticsRecorder::Reduction
+{
+ public:
+  Peak(int kind) : kind(kind) {}
+
+  int numRows() const {return 2;}
+
+  void reset(int n) {
+    value.assign(n, 0.0);
+    time.assign(n, 0.0);
+    empty = true;
+  }
+
+  void update(double t, double, const double *x, int n) {
+    for (int c = 0; c < n; c++) {
+      const double y = (kind == StatisticsRecorder::Statistic::Min) ? -x[c]
+                     : (kind == StatisticsRecorder::Statistic::AbsMax) ? fabs(x[c]) : x[c];
+      if (empty || y > value[c]) {
+        value[c] = y;
+        time[c]  = t;
+      }
+    }
+    empty = false;
+  }
+
+  void getRows(double *rows, int n) const {
+    const double sign = (kind == StatisticsRecorder::Statistic::Min) ? -1.0 : 1.0;
+    for (int c = 0; c < n; c++) {
+      rows[c]     = sign*value[c];
+      rows[n + c] = time[c];
+    }
+  }
+
+ private:
+  int kind;
+  bool empty;
+  std::vector<double> value, time;
+};
+
+
+class TimeAverage : public StatisticsRecorder::Reduction
+{
+ public:
+  TimeAverage(bool square) : square(square) {}
+
+  int numRows() const {return 1;}
+
+  void reset(int n) {
+    integral.assign(n, 0.0);
+    last.assign(n, 0.0);
+    duration = 0.0;
+  }
+
+  void update(double, double dt, const double *x, int n) {
+    for (int c = 0; c < n; c++) {
+      const double y = square ? x[c]*x[c] : x[c];
+      integral[c] += 0.5*dt*(last[c] + y);
+      last[c] = y;
+    }
+    duration += dt;
+  }
+
+  void getRows(double *rows, int n) const {
+    for (int c = 0; c < n; c++) {
+      const double mean = duration > 0.0 ? integral[c]/duration : last[c];
+      rows[c] = square ? sqrt(mean) : mean;
+    }
+  }
+
+ private:
+  bool square;
+  double duration;
+  std::vector<double> integral, last;
+};
+
+
+//
+// Peak response of SDOF oscillators u'' + 2 z w u' + w^2 u = -x, stepped
+// with the exact piecewise-linear recurrence of sdof_step_coefficients().
+//
+class Spectrum : public StatisticsRecorder::Reduction
+{
+ public:
+  Spectrum(const std::vector<double> &periods, double damping)
+    : periods(periods), zeta(damping), dtCoef(-1.0), coef(8*periods.size())
+  {
+    for (double T : periods)
+      omega.push_back(2.0*M_PI/T);
+  }
+
+  int numRows() const {return 3*(int)periods.size();}
+
+  void reset(int n) {
+    const size_t size = n*periods.size();
+    u.assign(size, 0.0);
+    v.assign(size, 0.0);
+    Sd.assign(size, 0.0);
+    Sv.assign(size, 0.0);
+    Sa.assign(size, 0.0);
+    last.assign(n, 0.0);
+  }
+
+  void update(double, double dt, const double *x, int n) {
+    if (dt > 0.0) {
+      if (fabs(dt - dtCoef) > 1.0e-12*dt) {
+        for (size_t j = 0; j < periods.size(); j++)
+          OpenSees::sdof_step_coefficients(omega[j], zeta, dt, &coef[8*j]);
+        dtCoef = dt;
+      }
+
+      for (size_t j = 0; j < periods.size(); j++) {
+        const double *a = &coef[8*j];
+        const double w = omega[j];
+        double *uj = &u[j*n], *vj = &v[j*n];
+        for (int c = 0; c < n; c++) {
+          const double p0 = -last[c], p1 = -x[c];
+          const double u1 = a[0]*uj[c] + a[1]*vj[c] + a[4]*p0 + a[5]*p1;
+          const double v1 = a[2]*uj[c] + a[3]*vj[c] + a[6]*p0 + a[7]*p1;
+          uj[c] = u1;
+          vj[c] = v1;
+          const size_t k = j*n + c;
+          Sd[k] = std::max(Sd[k], fabs(u1));
+          Sv[k] = std::max(Sv[k], fabs(v1));
+          Sa[k] = std::max(Sa[k], fabs(2.0*zeta*w*v1 + w*w*u1));
+        }
+      }
+    }
+    std::copy(x, x + n, last.begin());
+  }
+
+  void getRows(double *rows, int n) const {
+    const size_t size = n*periods.size();
+    std::copy(Sd.begin(), Sd.end(), rows);
+    std::copy(Sv.begin(), Sv.end(), rows + size);
+    std::copy(Sa.begin(), Sa.end(), rows + 2*size);
+  }
+
+ private:
+  std::vector<double> periods, omega;
+  double zeta;
+  double dtCoef;
+  std::vector<double> coef;
+  std::vector<double> u, v, Sd, Sv, Sa, last;
+};
+
+
+class Histogram : public StatisticsRecorder::Reduction
+{
+ public:
+  Histogram(int numBins, double lower, double upper)
+    : numBins(numBins), lower(lower), upper(upper) {}
+
+  // below, the bins, above
+  int numRows() const {return numBins + 2;}
+
+  void reset(int n) {
+    counts.assign((numBins + 2)*n, 0.0);
+  }
+
+  void update(double, double, const double *x, int n) {
+    const double scale = numBins/(upper - lower);
+    for (int c = 0; c < n; c++) {
+      int row;
+      if (x[c] < lower)
+        row = 0;
+      else if (x[c] > upper)
+        row = numBins + 1;
+      else
+        row = 1 + std::min(numBins - 1, (int)((x[c] - lower)*scale));
+      counts[row*n + c] += 1.0;
+    }
+  }
+
+  void getRows(double *rows, int) const {
+    std::copy(counts.begin(), counts.end(), rows);
+  }
+
+ private:
+  int numBins;
+  double lower, upper;
+  std::vector<double> counts;
+};
+
+
+//
+// Rainflow counting (ASTM E1049 rule 5.4.4) on the reversals as they are
+// found. Each channel keeps the stack of reversals not yet paired, which
+// is short for any realistic history; cycles are added to the bins as soon
+// as they close.
+//
+class Rainflow : public StatisticsRecorder::Reduction
+{
+ public:
+  Rainflow(int numBins, double maxRange)
+    : numBins(numBins), maxRange(maxRange) {}
+
+  // the bins, then ranges above maxRange
+  int numRows() const {return numBins + 1;}
+
+  void reset(int n) {
+    channels.assign(n, Channel());
+    counts.assign((numBins + 1)*n, 0.0);
+  }
+
+  void update(double, double, const double *x, int n) {
+    for (int c = 0; c < n; c++) {
+      Channel &ch = channels[c];
+      if (ch.stack.empty()) {
+        ch.stack.push_back(x[c]);
+        ch.peak = x[c];
+      }
+      else if (ch.direction == 0) {
+        if (x[c] != ch.peak) {
+          ch.direction = (x[c] > ch.peak) ? 1 : -1;
+          ch.peak = x[c];
+        }
+      }
+      else if ((x[c] - ch.peak)*ch.direction >= 0.0)
+        ch.peak = x[c];
+      else {
+        // the last peak was a reversal
+        ch.stack.push_back(ch.peak);
+        pair(ch.stack, &counts[0], c, n);
+        ch.direction = -ch.direction;
+        ch.peak = x[c];
+      }
+    }
+  }
+
+  void getRows(double *rows, int n) const {
+    std::copy(counts.begin(), counts.end(), rows);
+
+    // the residual, ending at the current peak, as half cycles
+    for (int c = 0; c < n; c++) {
+      std::vector<double> stack = channels[c].stack;
+      if (channels[c].direction != 0) {
+        stack.push_back(channels[c].peak);
+        pair(stack, rows, c, n);
+      }
+      for (size_t i = 1; i < stack.size(); i++)
+        add(rows, c, n, fabs(stack[i] - stack[i - 1]), 0.5);
+    }
+  }
+
+ private:
+  struct Channel {
+    std::vector<double> stack;
+    double peak      = 0.0;
+    int    direction = 0;
+  };
+
+  void add(double *rows, int c, int n, double range, double count) const {
+    const int bin = std::min(numBins, (int)(range/maxRange*numBins));
+    rows[bin*n + c] += count;
+  }
+
+  // Count the cycles closed by the last reversal on the stack
+  void pair(std::vector<double> &stack, double *rows, int c, int n) const {
+    while (stack.size() >= 3) {
+      const size_t m = stack.size();
+      const double X = fabs(stack[m - 1] - stack[m - 2]);
+      const double Y = fabs(stack[m - 2] - stack[m - 3]);
+      if (X < Y)
+        break;
+      if (m == 3) {
+        // Y contains the starting point
+        add(rows, c, n, Y, 0.5);
+        stack.erase(stack.begin());
+      } else {
+        add(rows, c, n, Y, 1.0);
+        stack.erase(stack.end() - 3, stack.end() - 1);
+      }
+    }
+  }
+
+  int numBins;
+  double maxRange;
+  std::vector<Channel> channels;
+  std::vector<double> counts;
+};
+
+
+class Exceedance : public StatisticsRecorder::Reduction
+{
+ public:
+  Exceedance(const std::vector<double> &thresholds) : thresholds(thresholds) {}
+
+  // for each threshold: duration, first time, number of up-crossings
+  int numRows() const {return 3*(int)thresholds.size();}
+
+  void reset(int n) {
+    const size_t size = n*thresholds.size();
+    duration.assign(size, 0.0);
+    first.assign(size, -1.0);
+    crossings.assign(size, 0.0);
+    last.assign(n, 0.0);
+    started = false;
+  }
+
+  void update(double t, double dt, const double *x, int n) {
+    for (size_t j = 0; j < thresholds.size(); j++) {
+      const double b = thresholds[j];
+      for (int c = 0; c < n; c++) {
+        const size_t k = j*n + c;
+        const double a0 = last[c], a1 = fabs(x[c]);
+        if (!started) {
+          if (a1 > b) {
+            first[k] = t;
+            crossings[k] = 1.0;
+          }
+        }
+        else if (a0 > b && a1 > b)
+          duration[k] += dt;
+        else if (a1 > b) {
+          // up-crossing, at the linear interpolation of |x|
+          const double f = (a1 - b)/(a1 - a0);
+          duration[k] += f*dt;
+          crossings[k] += 1.0;
+          if (first[k] < 0.0)
+            first[k] = t - f*dt;
+        }
+        else if (a0 > b)
+          duration[k] += (a0 - b)/(a0 - a1)*dt;
+      }
+    }
+    for (int c = 0; c < n; c++)
+      last[c] = fabs(x[c]);
+    started = true;
+  }
+
+  void getRows(double *rows, int n) const {
+    for (size_t j = 0; j < thresholds.size(); j++)
+      for (int c = 0; c < n; c++) {
+        const size_t k = j*n + c;
+        rows[(3*j    )*n + c] = duration[k];
+        rows[(3*j + 1)*n + c] = first[k];
+        rows[(3*j + 2)*n + c] = crossings[k];
+      }
+  }
+
+ private:
+  std::vector<double> thresholds;
+  std::vector<double> duration, first, crossings, last;
+  bool started;
+};
+
+} // namespace
+
+
+static std::unique_ptr<StatisticsRecorder::Reduction>
+newReduction(const StatisticsRecorder::Statistic &statistic)
+{
+  typedef StatisticsRecorder::Statistic S;
+  switch (statistic.type) {
+  case S::Max: case S::Min: case S::AbsMax:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new Peak(statistic.type));
+  case S::Mean:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new TimeAverage(false));
+  case S::RMS:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new TimeAverage(true));
+  case S::Spectrum:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new Spectrum(statistic.values, statistic.damping));
+  case S::Histogram:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(
+        new Histogram(statistic.numBins, statistic.lower, statistic.upper));
+  case S::Rainflow:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new Rainflow(statistic.numBins, statistic.upper));
+  case S::Exceedance:
+    return std::unique_ptr<StatisticsRecorder::Reduction>(new Exceedance(statistic.values));
+  }
+  return nullptr;
+}
+
+
+StatisticsRecorder::StatisticsRecorder(const ID &nodes, const ID &dofs, NodeData dataFlag,
+                                       TimeSeries **series,
+                                       const std::vector<Statistic> &statistics,
+                                       Domain &theDomain, OPS_Stream &theOutput)
+  : Recorder(RECORDER_TAGS_StatisticsRecorder),
+    theDomain(&theDomain), theOutput(&theOutput),
+    nodes(nodes), dofs(dofs), dataFlag(dataFlag), theSeries(series),
+    iNodes(0), jNodes(0), dof(0), perpDirn(0),
+    numChannels(nodes.Size()*dofs.Size()), x(numChannels),
+    numRows(0), started(false), lastTime(0.0)
+{
+  for (const Statistic &statistic : statistics) {
+    reductions.push_back(newReduction(statistic));
+    numRows += reductions.back()->numRows();
+  }
+  this->restart();
+
+  theOutput.tag("OpenSeesOutput");
+  for (int i = 0; i < nodes.Size(); i++)
+    for (int j = 0; j < dofs.Size(); j++) {
+      theOutput.tag("NodeOutput");
+      theOutput.attr("nodeTag", nodes(i));
+      theOutput.attr("dof", dofs(j) + 1);
+      theOutput.endTag();
+    }
+}
+
+StatisticsRecorder::StatisticsRecorder(const ID &iNodes, const ID &jNodes, int dof, int perpDirn,
+                                       const std::vector<Statistic> &statistics,
+                                       Domain &theDomain, OPS_Stream &theOutput)
+  : Recorder(RECORDER_TAGS_StatisticsRecorder),
+    theDomain(&theDomain), theOutput(&theOutput),
+    nodes(0), dofs(0), dataFlag(NodeData::DisplTrial), theSeries(nullptr),
+    iNodes(iNodes), jNodes(jNodes), dof(dof), perpDirn(perpDirn),
+    numChannels(iNodes.Size()), x(numChannels),
+    numRows(0), started(false), lastTime(0.0)
+{
+  for (const Statistic &statistic : statistics) {
+    reductions.push_back(newReduction(statistic));
+    numRows += reductions.back()->numRows();
+  }
+  this->restart();
+  this->domainChanged();
+
+  theOutput.tag("OpenSeesOutput");
+  for (int i = 0; i < iNodes.Size(); i++) {
+    theOutput.tag("DriftOutput");
+    theOutput.attr("node1", iNodes(i));
+    theOutput.attr("node2", jNodes(i));
+    theOutput.attr("perpDirn", perpDirn + 1);
+    theOutput.attr("lengthPerpDirn", lengths[i]);
+    theOutput.endTag();
+  }
+}
+
+StatisticsRecorder::~StatisticsRecorder()
+{
+  if (theOutput != nullptr) {
+    std::vector<double> table;
+    this->getTable(table);
+
+    Vector row(numChannels);
+    theOutput->tag("Data");
+    for (int i = 0; i < numRows; i++) {
+      for (int c = 0; c < numChannels; c++)
+        row(c) = table[i*numChannels + c];
+      theOutput->write(row);
+    }
+    theOutput->endTag(); // Data
+    theOutput->endTag(); // OpenSeesOutput
+    delete theOutput;
+  }
+
+  if (theSeries != nullptr) {
+    for (int j = 0; j < dofs.Size(); j++)
+      if (theSeries[j] != nullptr)
+        delete theSeries[j];
+    delete[] theSeries;
+  }
+}
+
+int
+StatisticsRecorder::getValues(double timeStamp)
+{
+  if (iNodes.Size() > 0) {
+    for (int i = 0; i < iNodes.Size(); i++) {
+      Node *iNode = theDomain->getNode(iNodes(i));
+      Node *jNode = theDomain->getNode(jNodes(i));
+      if (iNode == nullptr || jNode == nullptr || lengths[i] == 0.0) {
+        x[i] = 0.0;
+        continue;
+      }
+      const Vector &ui = iNode->getDisp();
+      const Vector &uj = jNode->getDisp();
+      x[i] = (dof < ui.Size() && dof < uj.Size()) ? (uj(dof) - ui(dof))/lengths[i] : 0.0;
+    }
+    return 0;
+  }
+
+  const int numDOF = dofs.Size();
+  for (int i = 0; i < nodes.Size(); i++) {
+    const Vector *response = theDomain->getNodeResponse(nodes(i), dataFlag);
+    for (int j = 0; j < numDOF; j++) {
+      double value = 0.0;
+      if (response != nullptr && dofs(j) >= 0 && dofs(j) < response->Size())
+        value = (*response)(dofs(j));
+      if (theSeries != nullptr && theSeries[j] != nullptr)
+        value += theSeries[j]->getFactor(timeStamp);
+      x[i*numDOF + j] = value;
+    }
+  }
+  return 0;
+}
+
+int
+StatisticsRecorder::record(int commitTag, double timeStamp)
+{
+  if (numChannels == 0)
+    return 0;
+
+  this->getValues(timeStamp);
+
+  double dt = 0.0;
+  if (started) {
+    dt = timeStamp - lastTime;
+    if (dt < 0.0)
+      dt = 0.0;
+  }
+  for (auto &reduction : reductions)
+    reduction->update(timeStamp, dt, x.data(), numChannels);
+
+  started  = true;
+  lastTime = timeStamp;
+  return 0;
+}
+
+int
+StatisticsRecorder::restart()
+{
+  for (auto &reduction : reductions)
+    reduction->reset(numChannels);
+  started = false;
+  return 0;
+}
+
+int
+StatisticsRecorder::domainChanged()
+{
+  lengths.assign(iNodes.Size(), 0.0);
+  for (int i = 0; i < iNodes.Size(); i++) {
+    Node *iNode = theDomain->getNode(iNodes(i));
+    Node *jNode = theDomain->getNode(jNodes(i));
+    if (iNode == nullptr || jNode == nullptr) {
+      opserr << "WARNING StatisticsRecorder - node " << iNodes(i) << " or "
+             << jNodes(i) << " does not exist\n";
+      continue;
+    }
+    const Vector &ci = iNode->getCrds();
+    const Vector &cj = jNode->getCrds();
+    if (perpDirn < ci.Size() && perpDirn < cj.Size())
+      lengths[i] = cj(perpDirn) - ci(perpDirn);
+    if (lengths[i] == 0.0)
+      opserr << "WARNING StatisticsRecorder - nodes " << iNodes(i) << " and "
+             << jNodes(i) << " have the same coordinate in the perpendicular direction\n";
+  }
+  return 0;
+}
+
+int
+StatisticsRecorder::setDomain(Domain &domain)
+{
+  theDomain = &domain;
+  return this->domainChanged();
+}
+
+void
+StatisticsRecorder::getTable(std::vector<double> &table) const
+{
+  table.assign((size_t)numRows*numChannels, 0.0);
+  double *rows = table.data();
+  for (auto &reduction : reductions) {
+    reduction->getRows(rows, numChannels);
+    rows += (size_t)reduction->numRows()*numChannels;
+  }
+}
+
+double
+StatisticsRecorder::getRecordedValue(int clmnId, int rowOffset, bool reset)
+{
+  double value = 0.0;
+  if (clmnId >= 0 && clmnId < numChannels && rowOffset >= 0 && rowOffset < numRows) {
+    std::vector<double> table;
+    this->getTable(table);
+    value = table[rowOffset*numChannels + clmnId];
+  }
+  if (reset)
+    this->restart();
+  return value;
+}
+
+void
+StatisticsRecorder::Print(OPS_Stream &s, int flag)
+{
+  s << "StatisticsRecorder, " << numChannels << " channels, "
+    << numRows << " rows of statistics\n";
+}
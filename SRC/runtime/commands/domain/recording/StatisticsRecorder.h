@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: StatisticsRecorder reduces response histories while the
+// analysis runs and writes only the reduced results. Each channel is a
+// scalar history, either one dof of a node response (optionally plus a
+// time series, for absolute accelerations) or the drift ratio between two
+// nodes. Every statistic is updated in constant memory per channel at each
+// commit:
+//
+//   max, min, absMax   peak value and the time at which it occurred
+//   mean, rms          time averages by the trapezoidal rule
+//   spectrum           peak Sd, Sv and Sa of damped SDOF oscillators driven
+//                      by the channel as a base acceleration (floor spectra),
+//                      by the exact piecewise-linear recurrence
+//   histogram          sample counts in equal bins, plus below and above
+//   rainflow           cycle counts by range (ASTM E1049), with the residual
+//                      counted as half cycles
+//   exceedance         time spent with |x| above each threshold, the first
+//                      time it was exceeded (-1 if never) and the number of
+//                      up-crossings
+//
+// The results form a table with one column per channel and one row per
+// statistic value, in the order the statistics were given. It is written to
+// the output stream when the recorder is destroyed (as for the envelope
+// recorders), and single values may be queried during the analysis with
+// getRecordedValue (the recorderValue command).
+//
+// Written: cmp
+//
+#ifndef StatisticsRecorder_h
+#define StatisticsRecorder_h
+
+#include <memory>
+#include <vector>
+#include <Recorder.h>
+#include <NodeData.h>
+#include <ID.h>
+
+#define RECORDER_TAGS_StatisticsRecorder 1311
+
+class Domain;
+class OPS_Stream;
+class TimeSeries;
+
+class StatisticsRecorder : public Recorder
+{
+ public:
+  struct Statistic {
+    enum Type {
+      Max, Min, AbsMax, Mean, RMS, Spectrum, Histogram, Rainflow, Exceedance
+    } type;
+    std::vector<double> values;  // periods, or thresholds
+    double damping  = 0.05;      // spectrum
+    int    numBins  = 0;         // histogram, rainflow
+    double lower    = 0.0;       // histogram
+    double upper    = 0.0;       // histogram; the largest range for rainflow
+  };
+
+  // Node responses; series holds one (possibly null) time series per dof
+  // and is owned by the recorder
+  StatisticsRecorder(const ID &nodes, const ID &dofs, NodeData dataFlag,
+                     TimeSeries **series, const std::vector<Statistic> &statistics,
+                     Domain &theDomain, OPS_Stream &theOutput);
+
+  // Drift ratios between iNodes and jNodes
+  StatisticsRecorder(const ID &iNodes, const ID &jNodes, int dof, int perpDirn,
+                     const std::vector<Statistic> &statistics,
+                     Domain &theDomain, OPS_Stream &theOutput);
+
+  ~StatisticsRecorder();
+
+  int record(int commitTag, double timeStamp);
+  int restart();
+  int domainChanged();
+  int setDomain(Domain &theDomain);
+
+  double getRecordedValue(int clmnId, int rowOffset, bool reset);
+
+  void Print(OPS_Stream &s, int flag = 0);
+
+  class Reduction;
+
+ private:
+  int  getValues(double timeStamp);
+  void getTable(std::vector<double> &table) const;
+
+  Domain     *theDomain;
+  OPS_Stream *theOutput;
+
+  // channels
+  ID          nodes, dofs;      // node responses
+  NodeData    dataFlag;
+  TimeSeries **theSeries;
+  ID          iNodes, jNodes;   // drifts
+  int         dof, perpDirn;
+  std::vector<double> lengths;
+  int         numChannels;
+  std::vector<double> x;        // current values
+
+  std::vector<std::unique_ptr<Reduction>> reductions;
+  int    numRows;
+  bool   started;
+  double lastTime;
+};
+
+#endif
@@ -202,7 +202,7 @@ basicStiffness(ClientData clientData, Tcl_Interp *interp, int argc,
 
 int
 sectionForce(ClientData clientData, Tcl_Interp *interp, int argc,
-             TCL_Char ** const argv)
+             Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *the_domain = (Domain*)clientData;
@@ -215,7 +215,7 @@ sectionForce(ClientData clientData, Tcl_Interp *interp, int argc,
   int tag, dof;
   int secNum = 0;
 
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &tag) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "sectionForce eleTag? secNum? dof? - could not read "
               "eleTag? \n";
     return TCL_ERROR;
@@ -224,13 +224,13 @@ sectionForce(ClientData clientData, Tcl_Interp *interp, int argc,
   // Make this work for zeroLengthSection too
   int currentArg = 2;
   if (argc > 3) {
-    if (Tcl_GetInt(interp, argv[currentArg++], &secNum) != TCL_OK) {
+    if (Tcl_GetIntFromObj(interp, objv[currentArg++], &secNum) != TCL_OK) {
       opserr << G3_ERROR_PROMPT << "sectionForce eleTag? secNum? dof? - could not read "
                 "secNum? \n";
       return TCL_ERROR;
     }
   }
-  if (Tcl_GetInt(interp, argv[currentArg++], &dof) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[currentArg++], &dof) != TCL_OK) {
     opserr
         << G3_ERROR_PROMPT << "sectionForce eleTag? secNum? dof? - could not read dof? \n";
     return TCL_ERROR;
@@ -244,17 +244,12 @@ sectionForce(ClientData clientData, Tcl_Interp *interp, int argc,
   }
 
   int argcc = 3;
-  char a[80] = "section";
-  char b[80];
-  sprintf(b, "%d", secNum);
-  char c[80] = "force";
-  const char *argvv[3];
-  argvv[0] = a;
-  argvv[1] = b;
-  argvv[2] = c;
+  char b[16];
+  snprintf(b, sizeof(b), "%d", secNum);
+  const char *argvv[3] = {"section", b, "force"};
   if (argc < 4) { // For zeroLengthSection
     argcc = 2;
-    argvv[1] = c;
+    argvv[1] = "force";
   }
 
   DummyStream dummy;
@@ -268,6 +263,11 @@ sectionForce(ClientData clientData, Tcl_Interp *interp, int argc,
   Information &info = theResponse->getInformation();
 
   const Vector &theVec = *(info.theVector);
+  if (dof < 1 || dof > theVec.Size()) {
+    opserr << G3_ERROR_PROMPT << "sectionForce dof " << dof << " out of range\n";
+    delete theResponse;
+    return TCL_ERROR;
+  }
   Tcl_SetObjResult(interp, Tcl_NewDoubleObj(theVec(dof-1)));
 
   delete theResponse;
@@ -23,6 +23,9 @@ class ProgressBar;
 Tcl_ObjCmdProc TclObjCommand_progress;
 extern ProgressBar* progress_bar_ptr;
 
+// utilities/spectrum.cpp
+Tcl_ObjCmdProc TclObjCommand_sdofSpectrum;
+
 
 const char *getInterpPWD(Tcl_Interp *interp);
 
@@ -393,6 +396,7 @@ Init_OpenSees(Tcl_Interp *interp)
   Tcl_CreateObjCommand(interp, "source",           OPS_SourceCmd, nullptr, nullptr);
   Tcl_CreateObjCommand(interp, "pragma",           TclObjCommand_pragma, nullptr, nullptr);
   Tcl_CreateObjCommand(interp, "progress",         TclObjCommand_progress, (ClientData)&progress_bar_ptr, nullptr);
+  Tcl_CreateObjCommand(interp, "sdofSpectrum",     TclObjCommand_sdofSpectrum, nullptr, nullptr);
 
   //
   static int ncmd = sizeof(InterpreterCommands)/sizeof(char_cmd);
@@ -15,9 +15,13 @@ extern Tcl_CmdProc  buildModel;
 // modeling/nodes.cpp
 extern Tcl_CmdProc  TclCommand_getNDM;
 extern Tcl_CmdProc  TclCommand_getNDF;
-extern Tcl_CmdProc  TclCommand_addNode;
-extern Tcl_CmdProc  TclCommand_addNodalMass;
-extern Tcl_CmdProc  TclCommand_addNodalLoad;
+extern Tcl_ObjCmdProc TclCommand_addNode;
+extern Tcl_ObjCmdProc TclCommand_addNodalMass;
+extern Tcl_ObjCmdProc TclCommand_addNodalLoad;
+
+// modeling/loader.cpp
+extern Tcl_ObjCmdProc TclCommand_loadModel;
+
 // 
 extern Tcl_CmdProc  TclCommand_addSeries;
 extern Tcl_CmdProc  TclCommand_addPattern;
@@ -25,7 +29,7 @@ extern Tcl_CmdProc  TclCommand_addTimeSeries;
 extern Tcl_CmdProc  TclCommand_addGeomTransf;
 
 // element.cpp
-extern Tcl_CmdProc  TclCommand_addElement;
+extern Tcl_ObjCmdProc TclCommand_addElement;
 
 // blockND.cpp
 extern Tcl_CmdProc  TclCommand_doBlock2D;
@@ -45,7 +49,7 @@ extern Tcl_CmdProc  TclCommand_addHFiber;
 // Constraints
 extern Tcl_CmdProc TclCommand_addMP;
 extern Tcl_CmdProc TclCommand_addSP;
-extern Tcl_CmdProc TclCommand_addHomogeneousBC;
+extern Tcl_ObjCmdProc TclCommand_addHomogeneousBC;
 extern Tcl_CmdProc TclCommand_addHomogeneousBC_X;
 extern Tcl_CmdProc TclCommand_addHomogeneousBC_Y; 
 extern Tcl_CmdProc TclCommand_addHomogeneousBC_Z;
@@ -95,15 +99,11 @@ struct char_cmd {
 
   {"getNDM",               TclCommand_getNDM},
   {"getNDF",               TclCommand_getNDF},
-  {"node",                 TclCommand_addNode},
-  {"mass",                 TclCommand_addNodalMass},
-  {"element",              TclCommand_addElement},
 
   {"print",                TclCommand_print},
   {"classType",            TclCommand_classType},
   {"printModel",           TclCommand_print},
 
-  {"fix",                  TclCommand_addHomogeneousBC},
   {"fixX",                 TclCommand_addHomogeneousBC_X},
   {"fixY",                 TclCommand_addHomogeneousBC_Y},
   {"fixZ",                 TclCommand_addHomogeneousBC_Z},
@@ -128,7 +128,6 @@ struct char_cmd {
 
   {"pattern",              TclCommand_addPattern},
 //   {"load",             TclCommand_addNodalLoad},
-  {"nodalLoad",            TclCommand_addNodalLoad},
   {"timeSeries",           TclCommand_addTimeSeries},
 
   {"equalDOF",             TclCommand_addEqualDOF_MP},
@@ -187,6 +186,23 @@ struct char_cmd {
 
 };
 
+//
+// Commands that are called once per node, element or load are created with
+// Tcl_CreateObjCommand so that their numeric arguments are read
+// from the cached representation of each Tcl_Obj.
+//
+struct obj_cmd {
+  const char* name;
+  Tcl_ObjCmdProc*  func;
+}  const tcl_obj_cmds[] =  {
+  {"node",                 TclCommand_addNode},
+  {"mass",                 TclCommand_addNodalMass},
+  {"fix",                  TclCommand_addHomogeneousBC},
+  {"nodalLoad",            TclCommand_addNodalLoad},
+  {"element",              TclCommand_addElement},
+  {"loadModel",            TclCommand_loadModel},
+};
+
 Tcl_CmdProc TclCommand_Package;
 
 // Added by Scott J. Brandenberg
@@ -28,7 +28,7 @@
 
 int
 TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
-                            TCL_Char ** const argv)
+                            Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   Domain *theTclDomain = ((BasicModelBuilder*)clientData)->getDomain();
@@ -42,7 +42,7 @@ TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
 
   // get the tag of the node
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
     opserr << OpenSees::PromptValueError << "invalid tag\n";
     return TCL_ERROR;
   }
@@ -51,13 +51,13 @@ TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
   // 
   // fix $node -dof $dof <-value $value>
   //
-  if (strcmp(argv[2], "-dof") == 0) {
+  if (G3_ObjIs(objv[2], "-dof")) {
     if (argc < 4) {
       opserr << OpenSees::PromptValueError << "missing required argument for -dof $dof\n";
       return TCL_ERROR;
     }
     int dof;
-    if (Tcl_GetInt(interp, argv[3], &dof) != TCL_OK) {
+    if (Tcl_GetIntFromObj(interp, objv[3], &dof) != TCL_OK) {
       opserr << OpenSees::PromptValueError << "invalid dof\n";
       return TCL_ERROR;
     }
@@ -75,47 +75,36 @@ TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
   }
 
-  int ndf = argc - 2;
+  const int ndf = argc - 2;
 
-  // check number of arguments
-  if (argc < (2 + ndf)) {
-    opserr << OpenSees::PromptValueError 
-           << "bad command - want: fix nodeId " << ndf
-           << " [0,1] conditions";
+  // get the fixity conditions
+  ID fixity(ndf);
+  if (G3_GetIntArray(interp, ndf, objv+2, &fixity(0)) != TCL_OK) {
+    opserr << OpenSees::PromptValueError << "invalid fixity - fix " << nodeId;
+    opserr << " " << ndf << " fixities\n";
     return TCL_ERROR;
   }
 
-  // get the fixity condition and add the constraint if fixed
-  Tcl_Obj* list = Tcl_NewListObj(ndf, nullptr);
+  // add a constraint for each fixed dof
+  ID tags(0, ndf);
   for (int i = 0; i < ndf; ++i) {
-    int theFixity;
-    if (Tcl_GetInt(interp, argv[2 + i], &theFixity) != TCL_OK) {
-      opserr << OpenSees::PromptValueError << "invalid fixity " << i + 1 << " - load " << nodeId;
-      opserr << " " << ndf << " fixities\n";
-      return TCL_ERROR;
+    if (fixity(i) == 0)
+      continue;
 
-    } else {
-      if (theFixity != 0) {
-        // create a homogeneous constraint
-        SP_Constraint *theSP = new SP_Constraint(nodeId, i, 0.0, true);
-
-        // add it to the domain
-        if (theTclDomain->addSP_Constraint(theSP) == false) {
-          opserr << OpenSees::PromptValueError << "could not add SP_Constraint to domain using fix "
-                    "command - node may already be constrained\n";
-          delete theSP;
-          return TCL_ERROR;
+    // create a homogeneous constraint
+    SP_Constraint *theSP = new SP_Constraint(nodeId, i, 0.0, true);
 
-        } else {
-//        Tcl(buffer, "%d ", theSP->getTag());
-//        Tcl_AppendResult(interp, buffer, NULL);
-          Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(theSP->getTag()));
-        }
-      }
+    // add it to the domain
+    if (theTclDomain->addSP_Constraint(theSP) == false) {
+      opserr << OpenSees::PromptValueError << "could not add SP_Constraint to domain using fix "
+                "command - node may already be constrained\n";
+      delete theSP;
+      return TCL_ERROR;
     }
+    tags[tags.Size()] = theSP->getTag();
   }
 
-  Tcl_SetObjResult(interp, list);
+  Tcl_SetObjResult(interp, G3_NewListObj(tags));
 
   return TCL_OK;
 }
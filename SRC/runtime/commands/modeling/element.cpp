@@ -19,7 +19,9 @@
 #endif
 #define strcmp strcasecmp
 
+#include <vector>
 #include <runtimeAPI.h>
+#include <Parsing.h>
 #include <BasicModelBuilder.h>
 
 #include <G3_Logging.h>
@@ -125,8 +127,32 @@ Element* TclDispatch_newShellNLDKGT(ClientData, Tcl_Interp*, int, TCL_Char** con
 
 
 
+static int
+addElement(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv);
+
+//
+// element eleType <specific element args>
+//
+// The constructors read their numbers through OPS_GetIntInput and
+// OPS_GetDoubleInput, which take them from the values Tcl has cached on
+// objv; those that match keywords or parse argv themselves get the
+// string forms.
+//
 int
-TclCommand_addElement(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+TclCommand_addElement(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const *objv)
+{
+  assert(clientData != nullptr);
+
+  std::vector<TCL_Char *> argv(objc + 1, nullptr);
+  for (int i = 0; i < objc; i++)
+    argv[i] = Tcl_GetString(objv[i]);
+
+  G3_ResetInputObj(interp, 2, objc, objv, argv.data());
+  return addElement(clientData, interp, objc, argv.data());
+}
+
+static int
+addElement(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
   G3_Runtime *rt = G3_getRuntime(interp);
   TclBasicBuilder *theTclBuilder = (TclBasicBuilder*)G3_getSafeBuilder(rt);
@@ -135,8 +161,6 @@ TclCommand_addElement(ClientData clientData, Tcl_Interp *interp, int argc, TCL_C
   BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
   Domain *theTclDomain = builder->getDomain();
 
-  OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, theTclDomain);
-
   // check at least two arguments so don't segemnt fault on strcmp
   if (argc < 2) {
     opserr << G3_ERROR_PROMPT << "insufficient arguments, expected:\n";
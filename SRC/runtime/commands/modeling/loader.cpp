@@ -0,0 +1,522 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Bulk loader for models stored in the JSON layout written
+// by "print -json" (StructuralAnalysisModel).
+//
+//   loadModel ?-threads n? file
+//
+// Properties (materials, sections and transformations) are created first,
+// in file order, unless an object with the same tag is already in the
+// registry; this allows objects whose JSON form is not complete enough to
+// be rebuilt to be defined by a script before the model is loaded. The
+// file is parsed once with nlohmann::json, and the items of the nodes and
+// elements arrays are then read concurrently. Nodes are added to the
+// domain directly; each element is converted to the argument list of the
+// element command and handed to it without going through the Tcl parser.
+//
+// Any item may give the words of the command that creates it explicitly:
+//
+//   {"name": 1, "command": ["element", "truss", 1, 1, 2, 10.0, 1]}
+//
+// which is how types without an entry in the tables below are loaded.
+//
+// Written: cmp
+//
+#include <tcl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <threads/thread_pool.hpp>
+#include <nlohmann/json.hpp>
+#include <G3_Logging.h>
+#include <BasicModelBuilder.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <FrameSection.h>
+#include <FrameTransform.h>
+
+namespace {
+
+using Json = nlohmann::json;
+
+//
+// Conversion of JSON items to command words
+//
+struct Format {
+  const char *type;
+  const char *command;
+  // Keys whose values are appended in order; arrays are expanded and
+  // "key=value" supplies a default for keys that are missing
+  std::vector<const char*> keys;
+};
+
+static const Format element_formats[] = {
+  {"ElasticBeam2d",       "elasticBeamColumn",   {"name", "nodes", "A", "E", "Iz", "crdTransformation"}},
+  {"ElasticBeam3d",       "elasticBeamColumn",   {"name", "nodes", "A", "E", "G", "Jx", "Iy", "Iz", "crdTransformation"}},
+  {"Truss",               "truss",               {"name", "nodes", "A", "material"}},
+  {"CorotTruss",          "corotTruss",          {"name", "nodes", "A", "material"}},
+  {"ComponentElement2d",  "componentElement2d",  {"name", "nodes", "A", "E", "Iz", "crdTransformation", "materials"}},
+  {"FourNodeQuad",        "quad",                {"name", "nodes", "thickness", "materialType=PlaneStrain", "material"}},
+  {"SSPquad",             "SSPquad",             {"name", "nodes", "material", "materialType=PlaneStrain", "thickness"}},
+  {"Brick",               "stdBrick",            {"name", "nodes", "material"}},
+  {"SSPbrick",            "SSPbrick",            {"name", "nodes", "material"}},
+  {"FourNodeTetrahedron", "FourNodeTetrahedron", {"name", "nodes", "material"}},
+};
+
+static const Format uniaxial_formats[] = {
+  {"Elastic",             "Elastic",             {"name", "E"}},
+  {"ElasticMaterial",     "Elastic",             {"name", "E"}},
+  {"Steel01",             "Steel01",             {"name", "fy", "E", "b", "a1", "a2", "a3", "a4"}},
+};
+
+static const Format nd_formats[] = {
+  {"ElasticIsotropic",    "ElasticIsotropic",    {"name", "E", "nu", "rho=0.0"}},
+};
+
+static const Format transform_formats[] = {
+  {"LinearCrdTransf2d",   "Linear",              {"name"}},
+  {"PDeltaCrdTransf2d",   "PDelta",              {"name"}},
+  {"CorotCrdTransf2d",    "Corotational",        {"name"}},
+  {"LinearCrdTransf3d",   "Linear",              {"name", "vecxz"}},
+  {"PDeltaCrdTransf3d",   "PDelta",              {"name", "vecxz"}},
+  {"CorotCrdTransf3d",    "Corotational",        {"name", "vecxz"}},
+};
+
+// The command word for a scalar; numbers are written so that they read
+// back to the same value
+static std::string
+word(const Json& value)
+{
+  if (value.is_string())
+    return value.get<std::string>();
+  if (value.is_boolean())
+    return value.get<bool>() ? "1" : "0";
+  if (value.is_null())
+    return "";
+  return value.dump();
+}
+
+static void
+append(const Json& value, std::vector<std::string>& words)
+{
+  if (value.is_array())
+    for (const Json& item : value)
+      append(item, words);
+  else
+    words.push_back(word(value));
+}
+
+static const Json *
+find(const Json& item, const char *key)
+{
+  auto found = item.find(key);
+  return found != item.end() ? &*found : nullptr;
+}
+
+//
+// Fill words with the command that creates item; on failure, words holds
+// a description of the problem.
+//
+template <int n> static bool
+convert(const Json& item, const char *command, const Format (&formats)[n],
+        std::vector<std::string>& words)
+{
+  words.clear();
+
+  if (const Json *explicit_command = find(item, "command")) {
+    append(*explicit_command, words);
+    return !words.empty();
+  }
+
+  const Json *type = find(item, "type");
+  if (type == nullptr || !type->is_string()) {
+    words.push_back("missing type");
+    return false;
+  }
+  const std::string name_of_type = type->get<std::string>();
+
+  for (const Format& format : formats) {
+    if (name_of_type != format.type)
+      continue;
+
+    words.push_back(command);
+    words.push_back(format.command);
+    for (const char *key : format.keys) {
+      const char *fallback = strchr(key, '=');
+      std::string name = fallback ? std::string(key, fallback) : std::string(key);
+      const Json *value = find(item, name.c_str());
+      if (value != nullptr)
+        append(*value, words);
+      else if (fallback != nullptr)
+        words.push_back(fallback + 1);
+      else {
+        words.assign(1, name_of_type + " is missing " + name);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  words.assign(1, "no rule to create " + name_of_type);
+  return false;
+}
+
+
+//
+// Invoke a model building command with already separated words
+//
+class Invoker {
+public:
+  explicit Invoker(Tcl_Interp *interp) : interp(interp) {}
+
+  int operator()(const std::vector<std::string>& words) {
+    auto found = commands.find(words[0]);
+    if (found == commands.end()) {
+      Tcl_CmdInfo info;
+      if (Tcl_GetCommandInfo(interp, words[0].c_str(), &info) != 1) {
+        opserr << G3_ERROR_PROMPT << "unknown command " << words[0].c_str() << "\n";
+        return TCL_ERROR;
+      }
+      found = commands.emplace(words[0], info).first;
+    }
+
+    argv.resize(words.size());
+    for (size_t i = 0; i < words.size(); i++)
+      argv[i] = words[i].c_str();
+
+    const Tcl_CmdInfo& info = found->second;
+    return info.proc(info.clientData, interp, (int)argv.size(), argv.data());
+  }
+
+private:
+  Tcl_Interp *interp;
+  std::unordered_map<std::string, Tcl_CmdInfo> commands;
+  std::vector<const char*> argv;
+};
+
+struct NodeRecord {
+  int    tag = 0;
+  int    ndf = 0;
+  int    ncrd = 0;
+  double crd[3];
+  std::vector<double> mass;
+  std::string error;
+};
+
+static bool
+appendNumbers(const Json& value, std::vector<double>& numbers)
+{
+  if (value.is_array()) {
+    for (const Json& item : value)
+      if (!appendNumbers(item, numbers))
+        return false;
+    return true;
+  }
+  if (!value.is_number())
+    return false;
+  numbers.push_back(value.get<double>());
+  return true;
+}
+
+static void
+readNode(const Json& item, int ndf, NodeRecord& node)
+{
+  if (!item.is_object()) {
+    node.error = "invalid node";
+    return;
+  }
+
+  const Json *name = find(item, "name"),
+             *crd  = find(item, "crd");
+  if (name == nullptr || !name->is_number_integer()
+      || crd == nullptr || !crd->is_array() || crd->size() < 1 || crd->size() > 3) {
+    node.error = "node requires name and crd";
+    return;
+  }
+
+  node.tag  = name->get<int>();
+  node.ncrd = (int)crd->size();
+  for (int i = 0; i < node.ncrd; i++) {
+    if (!(*crd)[i].is_number()) {
+      node.error = "invalid coordinates for node " + std::to_string(node.tag);
+      return;
+    }
+    node.crd[i] = (*crd)[i].get<double>();
+  }
+
+  const Json *dofs = find(item, "ndf");
+  node.ndf = (dofs != nullptr && dofs->is_number_integer()) ? dofs->get<int>() : ndf;
+
+  // Diagonal or full mass matrix, given as a flat list or as rows
+  if (const Json *mass = find(item, "mass")) {
+    if (!appendNumbers(*mass, node.mass)) {
+      node.error = "invalid mass for node " + std::to_string(node.tag);
+      return;
+    }
+
+    const int n = (int)node.mass.size();
+    if (n != node.ndf && n != node.ndf*node.ndf) {
+      node.error = "mass of node " + std::to_string(node.tag) + " has "
+                 + std::to_string(n) + " values; expected ndf ("
+                 + std::to_string(node.ndf) + ") or ndf*ndf";
+      return;
+    }
+  }
+}
+
+static Node *
+createNode(const NodeRecord& data)
+{
+  Node *node = nullptr;
+  switch (data.ncrd) {
+    case 1: node = new Node(data.tag, data.ndf, data.crd[0]); break;
+    case 2: node = new Node(data.tag, data.ndf, data.crd[0], data.crd[1]); break;
+    case 3: node = new Node(data.tag, data.ndf, data.crd[0], data.crd[1], data.crd[2]); break;
+  }
+
+  const int ndf = data.ndf;
+  if (node != nullptr && !data.mass.empty()) {
+    Matrix mass(ndf, ndf);
+    if ((int)data.mass.size() == ndf)
+      for (int i = 0; i < ndf; i++)
+        mass(i, i) = data.mass[i];
+    else // ndf*ndf, checked by readNode
+      for (int i = 0; i < ndf; i++)
+        for (int j = 0; j < ndf; j++)
+          mass(i, j) = data.mass[i*ndf + j];
+    node->setMass(mass);
+  }
+  return node;
+}
+
+static bool
+isDefined(BasicModelBuilder& builder, const std::string& group, int tag)
+{
+  constexpr int flags = BasicModelBuilder::SilentLookup;
+  if (group == "uniaxialMaterials")
+    return builder.getTypedObject<UniaxialMaterial>(tag, flags) != nullptr;
+  if (group == "nDMaterials" || group == "ndMaterials")
+    return builder.getTypedObject<NDMaterial>(tag, flags) != nullptr;
+  if (group == "sections")
+    return builder.getTypedObject<SectionForceDeformation>(tag, flags) != nullptr
+        || builder.getTypedObject<FrameSection>(tag, flags) != nullptr;
+  if (group == "crdTransformations")
+    return builder.getTypedObject<FrameTransform2d>(tag, flags) != nullptr
+        || builder.getTypedObject<FrameTransform3d>(tag, flags) != nullptr;
+  return false;
+}
+
+static int
+loadProperties(BasicModelBuilder& builder, Invoker& invoke, const Json& properties)
+{
+  int count = 0;
+  std::vector<std::string> words;
+
+  if (!properties.is_object())
+    return 0;
+
+  for (const auto& [group, list] : properties.items()) {
+    if (!list.is_array())
+      continue;
+    if (group != "uniaxialMaterials" && group != "nDMaterials" && group != "ndMaterials"
+        && group != "sections" && group != "crdTransformations")
+      continue;
+
+    for (const Json& item : list) {
+      const Json *name = find(item, "name");
+      if (name == nullptr || !name->is_number_integer()
+          || isDefined(builder, group, name->get<int>()))
+        continue;
+
+      bool ok = false;
+      if (group == "uniaxialMaterials")
+        ok = convert(item, "uniaxialMaterial", uniaxial_formats, words);
+      else if (group == "nDMaterials" || group == "ndMaterials")
+        ok = convert(item, "nDMaterial", nd_formats, words);
+      else if (group == "crdTransformations")
+        ok = convert(item, "geomTransf", transform_formats, words);
+      else if (const Json *command = find(item, "command")) {
+        words.clear();
+        append(*command, words);
+        ok = !words.empty();
+      } else
+        words.assign(1, "sections must be defined beforehand or given a command");
+
+      if (!ok) {
+        opserr << G3_ERROR_PROMPT << "cannot create " << name->get<int>()
+               << " in " << group.c_str() << "; " << words[0].c_str() << "\n";
+        return -1;
+      }
+
+      if (invoke(words) != TCL_OK)
+        return -1;
+      count++;
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+
+int
+TclCommand_loadModel(ClientData clientData, Tcl_Interp *interp, int argc, Tcl_Obj *const *objv)
+{
+  assert(clientData != nullptr);
+  BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
+  Domain *domain = builder->getDomain();
+
+  const char *filename = nullptr;
+  int threads = 0;
+  for (int i = 1; i < argc; i++) {
+    const char *arg = Tcl_GetString(objv[i]);
+    if (strcmp(arg, "-threads") == 0 && i+1 < argc) {
+      if (Tcl_GetIntFromObj(interp, objv[++i], &threads) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-file") == 0 && i+1 < argc)
+      filename = Tcl_GetString(objv[++i]);
+    else
+      filename = arg;
+  }
+
+  if (filename == nullptr) {
+    opserr << G3_ERROR_PROMPT << "usage: loadModel ?-threads n? file\n";
+    return TCL_ERROR;
+  }
+
+  //
+  // Read the file
+  //
+  std::string text;
+  {
+    FILE *file = fopen(filename, "rb");
+    if (file == nullptr) {
+      opserr << G3_ERROR_PROMPT << "could not open file " << filename << "\n";
+      return TCL_ERROR;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    text.resize(size > 0 ? size : 0);
+    size_t read = fread(&text[0], 1, text.size(), file);
+    fclose(file);
+    if (read != text.size()) {
+      opserr << G3_ERROR_PROMPT << "failed to read " << filename << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  //
+  // Parse the file; without exceptions, a syntax error gives a
+  // discarded value
+  //
+  Json document = Json::parse(text, nullptr, false);
+  text.clear();
+  text.shrink_to_fit();
+  if (document.is_discarded() || !document.is_object()) {
+    opserr << G3_ERROR_PROMPT << "failed to parse " << filename << " as JSON\n";
+    return TCL_ERROR;
+  }
+
+  const Json *model = find(document, "StructuralAnalysisModel");
+  if (model == nullptr)
+    model = &document;
+
+  static const Json empty = Json::array();
+  const Json *properties = find(*model, "properties");
+  const Json *geometry   = find(*model, "geometry");
+  const Json *nodes      = geometry ? find(*geometry, "nodes")    : nullptr;
+  const Json *elements   = geometry ? find(*geometry, "elements") : nullptr;
+  if ((nodes != nullptr && !nodes->is_array()) || (elements != nullptr && !elements->is_array())) {
+    opserr << G3_ERROR_PROMPT << "nodes and elements of " << filename << " must be arrays\n";
+    return TCL_ERROR;
+  }
+  if (nodes == nullptr)
+    nodes = &empty;
+  if (elements == nullptr)
+    elements = &empty;
+
+  OpenSees::thread_pool pool(threads > 0 ? threads : 0);
+  Invoker invoke(interp);
+
+  //
+  // Properties
+  //
+  int numProperties = properties ? loadProperties(*builder, invoke, *properties) : 0;
+  if (numProperties < 0)
+    return TCL_ERROR;
+
+  //
+  // Nodes
+  //
+  {
+    std::vector<NodeRecord> data(nodes->size());
+    const int ndf = builder->getNDF();
+    pool.submit_loop<size_t>(0, nodes->size(), [&](size_t i) {
+      readNode((*nodes)[i], ndf, data[i]);
+    }).wait();
+
+    for (const NodeRecord& node : data) {
+      if (!node.error.empty()) {
+        opserr << G3_ERROR_PROMPT << node.error.c_str() << "\n";
+        return TCL_ERROR;
+      }
+      Node *theNode = createNode(node);
+      if (theNode == nullptr || domain->addNode(theNode) == false) {
+        opserr << G3_ERROR_PROMPT << "failed to add node " << node.tag << " to the domain\n";
+        delete theNode;
+        return TCL_ERROR;
+      }
+    }
+  }
+
+  //
+  // Elements
+  //
+  {
+    std::vector<std::vector<std::string>> words(elements->size());
+    std::vector<char> ok(elements->size(), 0);
+    pool.submit_loop<size_t>(0, elements->size(), [&](size_t i) {
+      const Json& item = (*elements)[i];
+      if (item.is_object())
+        ok[i] = convert(item, "element", element_formats, words[i]);
+      else
+        words[i].assign(1, "invalid element");
+    }).wait();
+
+    for (size_t i = 0; i < elements->size(); i++) {
+      if (!ok[i]) {
+        opserr << G3_ERROR_PROMPT << "element " << (int)i << ": " << words[i][0].c_str() << "\n";
+        return TCL_ERROR;
+      }
+      if (invoke(words[i]) != TCL_OK)
+        return TCL_ERROR;
+      // Release the words as soon as the element exists
+      std::vector<std::string>().swap(words[i]);
+    }
+  }
+
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("properties", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewIntObj(numProperties));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("nodes", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewIntObj((int)nodes->size()));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("elements", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewIntObj((int)elements->size()));
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
@@ -16,6 +16,7 @@
 #include <Parsing.h>
 #include <Node.h>
 #include <NodeND.h>
+#include <Vector.h>
 #include <Matrix.h>
 #include <Domain.h>
 #include <BasicModelBuilder.h>
@@ -27,7 +28,7 @@
 
 int
 TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
-                   TCL_Char ** const argv)
+                   Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
 
@@ -45,64 +46,31 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_ERROR;
   }
 
-  Node *theNode = nullptr;
-
   // read the node id
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
     opserr << G3_ERROR_PROMPT << "invalid nodeTag\n";
     opserr << "        Want: node nodeTag? [ndm coordinates?] <-mass [ndf values?]>\n";
     return TCL_ERROR;
   }
 
-  // read in the coordinates and create the node
-  double xLoc, yLoc, zLoc;
-  if (ndm == 1) {
-    // create a node in 1d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid coordinate\n";
-      return TCL_ERROR;
-    }
-  }
-
-  else if (ndm == 2) {
-    // create a node in 2d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid 1st coordinate\n";
-      opserr << "node: " << nodeId << "\n";
-      return TCL_ERROR;
-    }
-    if (Tcl_GetDouble(interp, argv[3], &yLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid 2nd coordinate\n";
-      opserr << "node: " << nodeId << "\n";
-      return TCL_ERROR;
-    }
+  if (ndm < 1 || ndm > 3) {
+    opserr << G3_ERROR_PROMPT << "unsupported model dimension\n";
+    return TCL_ERROR;
   }
 
-  else if (ndm == 3) {
-    // create a node in 3d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid 1st coordinate\n";
-      return TCL_ERROR;
-    }
-    if (Tcl_GetDouble(interp, argv[3], &yLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid 2nd coordinate\n";
-      return TCL_ERROR;
-    }
-    if (Tcl_GetDouble(interp, argv[4], &zLoc) != TCL_OK) {
-      opserr << G3_ERROR_PROMPT << "invalid 3rd coordinate\n";
-      return TCL_ERROR;
-    }
-
-  } else {
-    opserr << G3_ERROR_PROMPT << "unsupported model dimension\n";
+  // read in the coordinates
+  double crd[3];
+  if (G3_GetDoubleArray(interp, ndm, objv+2, crd) != TCL_OK) {
+    opserr << G3_ERROR_PROMPT << "invalid coordinate\n";
+    opserr << "node: " << nodeId << "\n";
     return TCL_ERROR;
   }
 
   // check for -ndf override option
   int currentArg = 2 + ndm;
-  if (currentArg < argc && strcmp(argv[currentArg], "-ndf") == 0) {
-    if (Tcl_GetInt(interp, argv[currentArg + 1], &ndf) != TCL_OK) {
+  if (currentArg + 1 < argc && G3_ObjIs(objv[currentArg], "-ndf")) {
+    if (Tcl_GetIntFromObj(interp, objv[currentArg + 1], &ndf) != TCL_OK) {
       opserr << G3_ERROR_PROMPT << "invalid nodal ndf given for node " << nodeId << "\n";
       return TCL_ERROR;
     }
@@ -112,112 +80,113 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
   //
   // create the node
   //
+  Node *theNode = nullptr;
   switch (ndm) {
   case 1:
-    theNode = new HeapNode(nodeId, ndf, xLoc);
+    theNode = new HeapNode(nodeId, ndf, crd[0]);
     break;
   case 2:
-    theNode = new HeapNode(nodeId, ndf, xLoc, yLoc);
+    theNode = new HeapNode(nodeId, ndf, crd[0], crd[1]);
     break;
   case 3:
 #if 0
     if (getenv("NODE")) {
       switch (ndf) {
         case 3:
-          theNode = new NodeND<3, 3>(nodeId, xLoc, yLoc, zLoc);
+          theNode = new NodeND<3, 3>(nodeId, crd[0], crd[1], crd[2]);
           break;
         case 6:
-          theNode = new NodeND<3, 6>(nodeId, xLoc, yLoc, zLoc);
+          theNode = new NodeND<3, 6>(nodeId, crd[0], crd[1], crd[2]);
           break;
         default:
-          theNode = new HeapNode(nodeId, ndf, xLoc, yLoc, zLoc);
+          theNode = new HeapNode(nodeId, ndf, crd[0], crd[1], crd[2]);
           break;
       }
     } else
 #endif
-      theNode = new HeapNode(nodeId, ndf, xLoc, yLoc, zLoc);
+      theNode = new HeapNode(nodeId, ndf, crd[0], crd[1], crd[2]);
     break;
   }
 
   while (currentArg < argc) {
-    if (strcmp(argv[currentArg], "-mass") == 0) {
+    if (G3_ObjIs(objv[currentArg], "-mass")) {
       currentArg++;
       if (argc < currentArg + ndf) {
         opserr << G3_ERROR_PROMPT << "incorrect number of nodal mass terms\n";
         opserr << "node: " << nodeId << "\n";
+        delete theNode;
         return TCL_ERROR;
       }
 
-      double theMass;
-      Matrix mass(ndf, ndf);
-      for (int i = 0; i < ndf; ++i) {
-        if (Tcl_GetDouble(interp, argv[currentArg++], &theMass) != TCL_OK) {
-          opserr << G3_ERROR_PROMPT << "invalid nodal mass term";
-          opserr << " at dof " << i + 1 << "\n";
-          return TCL_ERROR;
-        }
-        mass(i, i) = theMass;
+      Vector values(ndf);
+      if (G3_GetDoubleArray(interp, ndf, objv+currentArg, &values(0)) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid nodal mass term\n";
+        opserr << "node: " << nodeId << "\n";
+        delete theNode;
+        return TCL_ERROR;
       }
+      currentArg += ndf;
+
+      Matrix mass(ndf, ndf);
+      for (int i = 0; i < ndf; ++i)
+        mass(i, i) = values(i);
       theNode->setMass(mass);
 
-    } else if (strcmp(argv[currentArg], "-dispLoc") == 0) {
+    } else if (G3_ObjIs(objv[currentArg], "-dispLoc")) {
       currentArg++;
       if (argc < currentArg + ndm) {
         opserr << G3_ERROR_PROMPT << "incorrect number of nodal display location terms, "
                   "need ndm\n";
+        delete theNode;
         return TCL_ERROR;
       }
       Vector displayLoc(ndm);
-      double theCrd;
-      for (int i = 0; i < ndm; ++i) {
-        if (Tcl_GetDouble(interp, argv[currentArg++], &theCrd) != TCL_OK) {
-          opserr << G3_ERROR_PROMPT << "invalid nodal mass term\n";
-          opserr << "node: " << nodeId << ", dof: " << i + 1 << "\n";
-          return TCL_ERROR;
-        }
-        displayLoc(i) = theCrd;
+      if (G3_GetDoubleArray(interp, ndm, objv+currentArg, &displayLoc(0)) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid nodal display location\n";
+        opserr << "node: " << nodeId << "\n";
+        delete theNode;
+        return TCL_ERROR;
       }
+      currentArg += ndm;
       theNode->setDisplayCrds(displayLoc);
 
-    } else if (strcmp(argv[currentArg], "-disp") == 0) {
+    } else if (G3_ObjIs(objv[currentArg], "-disp")) {
       currentArg++;
       if (argc < currentArg + ndf) {
         opserr << G3_ERROR_PROMPT << "incorrect number of nodal disp terms\n";
         opserr << "node: " << nodeId << "\n";
+        delete theNode;
         return TCL_ERROR;
       }
       Vector disp(ndf);
-      double theDisp;
-      for (int i = 0; i < ndf; ++i) {
-        if (Tcl_GetDouble(interp, argv[currentArg++], &theDisp) != TCL_OK) {
-          opserr << G3_ERROR_PROMPT << "invalid nodal disp term\n";
-          opserr << "node: " << nodeId << ", dof: " << i + 1 << "\n";
-          return TCL_ERROR;
-        }
-        disp(i) = theDisp;
+      if (G3_GetDoubleArray(interp, ndf, objv+currentArg, &disp(0)) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid nodal disp term\n";
+        opserr << "node: " << nodeId << "\n";
+        delete theNode;
+        return TCL_ERROR;
       }
+      currentArg += ndf;
       theNode->setTrialDisp(disp);
       theNode->commitState();
 
-    } else if (strcmp(argv[currentArg], "-vel") == 0) {
+    } else if (G3_ObjIs(objv[currentArg], "-vel")) {
       currentArg++;
       if (argc < currentArg + ndf) {
         opserr << G3_ERROR_PROMPT << "incorrect number of nodal vel terms, ";
         opserr << "expected " << ndf << "\n";
+        delete theNode;
         return TCL_ERROR;
       }
 
-      double theDisp;
-      Vector disp(ndf);
-      for (int i = 0; i < ndf; ++i) {
-        if (Tcl_GetDouble(interp, argv[currentArg++], &theDisp) != TCL_OK) {
-          opserr << G3_ERROR_PROMPT << "invalid nodal vel term at ";
-          opserr << " dof " << i + 1 << "\n";
-          return TCL_ERROR;
-        }
-        disp(i) = theDisp;
+      Vector vel(ndf);
+      if (G3_GetDoubleArray(interp, ndf, objv+currentArg, &vel(0)) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid nodal vel term\n";
+        opserr << "node: " << nodeId << "\n";
+        delete theNode;
+        return TCL_ERROR;
       }
-      theNode->setTrialVel(disp);
+      currentArg += ndf;
+      theNode->setTrialVel(vel);
       theNode->commitState();
 
     } else
@@ -238,7 +207,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
 int
 TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,
-                        TCL_Char ** const argv)
+                        Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
   BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
@@ -247,32 +216,32 @@ TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,
   int ndf = argc - 2;
 
   // make sure at least one other argument
-  if (argc < (1 + ndf)) {
+  if (ndf < 1) {
     opserr << G3_ERROR_PROMPT << "insufficient arguments, expected:\n"
-              "      mass nodeId <" << ndf << " mass values>\n"; 
+              "      mass nodeId <ndf mass values>\n"; 
     return TCL_ERROR;
   }
 
   // get the id of the node
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-    opserr << G3_ERROR_PROMPT << "invalid nodeId: " << argv[1];
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+    opserr << G3_ERROR_PROMPT << "invalid nodeId: " << Tcl_GetString(objv[1]);
     opserr << " - mass nodeId " << ndf << " forces\n";
     return TCL_ERROR;
   }
 
   // check for mass terms
-  Matrix mass(ndf,ndf);
-  for (int i=0; i<ndf; ++i) {
-     double theMass;
-     if (Tcl_GetDouble(interp, argv[i+2], &theMass) != TCL_OK) {
-          opserr << G3_ERROR_PROMPT << "invalid nodal mass term\n";
-          opserr << "node: " << nodeId << ", dof: " << i+1 << "\n";
-          return TCL_ERROR;
-      }
-      mass(i,i) = theMass;
+  Vector values(ndf);
+  if (G3_GetDoubleArray(interp, ndf, objv+2, &values(0)) != TCL_OK) {
+    opserr << G3_ERROR_PROMPT << "invalid nodal mass term\n";
+    opserr << "node: " << nodeId << "\n";
+    return TCL_ERROR;
   }
 
+  Matrix mass(ndf,ndf);
+  for (int i=0; i<ndf; ++i)
+    mass(i,i) = values(i);
+
   if (theTclDomain->setMass(mass, nodeId) != 0) {
     opserr << G3_ERROR_PROMPT << "failed to set mass at node " << nodeId << "\n";
     return TCL_ERROR;
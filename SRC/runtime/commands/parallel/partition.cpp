@@ -6,18 +6,29 @@
 //
 //
 #include <tcl.h>
+#include <chrono>
+#include <map>
 #include <vector>
+#include <string.h>
 #include <OPS_Globals.h>
 // #include <mpi.h>
 #include <Channel.h>
 #include <MachineBroker.h>
 
 // #  include <DistributedDisplacementControl.h>
-// #  include <ShedHeaviest.h>
 // #  include <MPIDiagonalSOE.h>
 // #  include <MPIDiagonalSolver.h>
 #include <ShadowSubdomain.h>
 #include <Metis.h>
+#include <WeightedMetis.h>
+#include <ShedHeaviest.h>
+#include <SwapHeavierToLighterNeighbours.h>
+#include <ReleaseHeavierToLighterNeighbours.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Element.h>
+#include <ElementIter.h>
 #include <FEM_ObjectBroker.h>
 #include <DomainPartitioner.h>
 #include <domain/domain/partitioned/PartitionedDomain.h>
@@ -37,7 +48,7 @@
    FEM_ObjectBroker    *broker             = nullptr;
    DomainPartitioner   *DOMAIN_partitioner = nullptr;
    GraphPartitioner    *GRAPH_partitioner  = nullptr;
-// LoadBalancer        *balancer           = nullptr;
+   LoadBalancer        *balancer           = nullptr;
    Channel             **channels          = nullptr;  
    int  num_subdomains    = 0;
    bool partitioned       = false;
@@ -48,8 +59,9 @@
  };
 
 
-static int partitionModel(PartitionRuntime& part, int eleTag);
+static int partitionModel(PartitionRuntime& part, int eleTag, bool weighted);
 static Tcl_CmdProc opsPartition;
+static Tcl_CmdProc opsBalance;
 static Tcl_CmdProc wipePP;
 extern Tcl_CmdProc TclCommand_specifyModel;
 
@@ -77,30 +89,188 @@ Init_PartitionRuntime(Tcl_Interp* interp, MachineBroker* theMachineBroker, FEM_O
   
   
   Tcl_CreateCommand(interp, "partition", &opsPartition, (ClientData)part, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "balance",   &opsBalance,   (ClientData)part, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "wipePP",    &wipePP,       (ClientData)part, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "model",     &TclCommand_specifyModel,  (ClientData)&part->theDomain, (Tcl_CmdDeleteProc *)NULL);
 }
 
 
 
+//
+// Cost of each element, as the mean wall time of update() followed by
+// getTangentStiff() over numTrials evaluations at the current state
+//
+static void
+measureElementCosts(Domain &theDomain, int numTrials, std::map<int, double> &costs)
+{
+  ElementIter &theElements = theDomain.getElements();
+  Element *theElement;
+  while ((theElement = theElements()) != nullptr) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numTrials; i++) {
+      theElement->update();
+      theElement->getTangentStiff();
+    }
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    theElement->revertToLastCommit();
+    costs[theElement->getTag()] = time.count()/numTrials;
+  }
+}
+
+//
+// Store the costs as the weights of the vertices of the element graph,
+// which the domain partitioner hands to the graph partitioner
+//
+static void
+setElementWeights(Domain &theDomain, const std::map<int, double> &costs)
+{
+  Graph &theGraph = theDomain.getElementGraph();
+  VertexIter &theVertices = theGraph.getVertices();
+  Vertex *theVertex;
+  while ((theVertex = theVertices()) != nullptr) {
+    auto cost = costs.find(theVertex->getRef());
+    theVertex->setWeight(cost != costs.end() ? cost->second : 0.0);
+  }
+}
+
 int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc,
              TCL_Char ** const argv)
 {
+  // partition <eleTag> <-measure numTrials> <-weights {eleTag weight ...}>
+  //           <-balancer type <factorGreater numReleases>>
   PartitionRuntime& part = *static_cast<PartitionRuntime*>(clientData);
 
-  int eleTag;
-  if (argc == 2) {
+  int eleTag = 0;
+  int numTrials = 0;
+  std::map<int, double> costs;
+  TCL_Char *weights = nullptr;
+
+  int argi = 1;
+  if (argc > 1 && argv[1][0] != '-') {
     if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
-      ;
+      opserr << "WARNING partition - invalid eleTag " << argv[1] << "\n";
+      return TCL_ERROR;
+    }
+    argi++;
+  }
+
+  while (argi < argc) {
+    if (strcmp(argv[argi], "-measure") == 0 && argi + 1 < argc) {
+      if (Tcl_GetInt(interp, argv[argi + 1], &numTrials) != TCL_OK || numTrials < 1) {
+        opserr << "WARNING partition -measure numTrials - invalid numTrials " << argv[argi + 1] << "\n";
+        return TCL_ERROR;
+      }
+      argi += 2;
+
+    } else if (strcmp(argv[argi], "-weights") == 0 && argi + 1 < argc) {
+      weights = argv[argi + 1];
+      argi += 2;
+
+    } else if (strcmp(argv[argi], "-balancer") == 0 && argi + 1 < argc) {
+      TCL_Char *type = argv[argi + 1];
+      argi += 2;
+
+      double factorGreater = 1.0;
+      int numReleases = 1;
+      if (argi + 1 < argc && argv[argi][0] != '-') {
+        if (Tcl_GetDouble(interp, argv[argi], &factorGreater) != TCL_OK ||
+            Tcl_GetInt(interp, argv[argi + 1], &numReleases) != TCL_OK) {
+          opserr << "WARNING partition -balancer type <factorGreater numReleases> - invalid input\n";
+          return TCL_ERROR;
+        }
+        argi += 2;
+      }
+
+      if (part.DOMAIN_partitioner != nullptr) {
+        opserr << "WARNING partition -balancer - the domain partitioner has already been created\n";
+        return TCL_ERROR;
+      }
+      if (part.balancer != nullptr)
+        delete part.balancer;
+
+      if (strcmp(type, "ShedHeaviest") == 0)
+        part.balancer = new ShedHeaviest(factorGreater, numReleases, true);
+      else if (strcmp(type, "ReleaseHeavierToLighterNeighbours") == 0)
+        part.balancer = new ReleaseHeavierToLighterNeighbours(factorGreater, numReleases, true);
+      else if (strcmp(type, "SwapHeavierToLighterNeighbours") == 0)
+        part.balancer = new SwapHeavierToLighterNeighbours(factorGreater, numReleases);
+      else {
+        part.balancer = nullptr;
+        opserr << "WARNING partition -balancer - unknown type " << type << "\n";
+        return TCL_ERROR;
+      }
+
+    } else {
+      opserr << "WARNING partition - unknown option " << argv[argi] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (numTrials > 0)
+    measureElementCosts(part.theDomain, numTrials, costs);
+
+  // weights given by the user take precedence over measured ones
+  if (weights != nullptr) {
+    int numItems = 0;
+    TCL_Char **items = nullptr;
+    if (Tcl_SplitList(interp, weights, &numItems, &items) != TCL_OK || numItems % 2 != 0) {
+      opserr << "WARNING partition -weights - want a list of eleTag weight pairs\n";
+      return TCL_ERROR;
+    }
+    for (int i = 0; i < numItems; i += 2) {
+      int tag;
+      double weight;
+      if (Tcl_GetInt(interp, items[i], &tag) != TCL_OK ||
+          Tcl_GetDouble(interp, items[i + 1], &weight) != TCL_OK || weight < 0.0) {
+        opserr << "WARNING partition -weights - invalid pair " << items[i] << " " << items[i + 1] << "\n";
+        Tcl_Free((char *)items);
+        return TCL_ERROR;
+      }
+      costs[tag] = weight;
     }
+    Tcl_Free((char *)items);
+  }
+
+  const bool weighted = !costs.empty();
+  if (weighted && part.partitioned == false)
+    setElementWeights(part.theDomain, costs);
+
+  if (partitionModel(part, eleTag, weighted) < 0) {
+    opserr << "WARNING partition - failed to partition the model\n";
+    return TCL_ERROR;
   }
-  partitionModel(part, eleTag);
   return TCL_OK;
 }
 
+//
+// Rebalance the subdomains with the load balancer given to partition,
+// using as weights the costs the subdomains measured since the last call
+//
 static int
-partitionModel(PartitionRuntime& part, int eleTag)
+opsBalance(ClientData clientData, Tcl_Interp *interp, int argc,
+           TCL_Char ** const argv)
+{
+  PartitionRuntime& part = *static_cast<PartitionRuntime*>(clientData);
+
+  if (part.partitioned == false || part.DOMAIN_partitioner == nullptr) {
+    opserr << "WARNING balance - the model has not been partitioned\n";
+    return TCL_ERROR;
+  }
+  if (part.balancer == nullptr) {
+    opserr << "WARNING balance - no balancer was given to partition\n";
+    return TCL_ERROR;
+  }
+
+  if (part.DOMAIN_partitioner->balance(part.theDomain.getSubdomainGraph()) < 0) {
+    opserr << "WARNING balance - the load balancer failed\n";
+    return TCL_ERROR;
+  }
+  return TCL_OK;
+}
+
+static int
+partitionModel(PartitionRuntime& part, int eleTag, bool weighted)
 {
   if (part.partitioned == true)
     return 0;
@@ -124,10 +294,15 @@ partitionModel(PartitionRuntime& part, int eleTag)
 
   // create a partitioner & partition the domain
   if (part.DOMAIN_partitioner == nullptr) {
-    //      part.balancer = new ShedHeaviest();
-    // OPS_DOMAIN_partitioner = new DomainPartitioner(*OPS_GRAPH_partitioner, *part.balancer);
-    part.GRAPH_partitioner = new Metis;
-    part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner);
+    if (weighted)
+      part.GRAPH_partitioner = new WeightedMetis();
+    else
+      part.GRAPH_partitioner = new Metis;
+
+    if (part.balancer != nullptr)
+      part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner, *part.balancer);
+    else
+      part.DOMAIN_partitioner = new DomainPartitioner(*part.GRAPH_partitioner);
     part.theDomain.setPartitioner(part.DOMAIN_partitioner);
   }
 
@@ -0,0 +1,299 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This unit implements the taskFarm command, a dynamic
+// master/worker scheduler for parameter studies in OpenSeesMP.
+//
+//   taskFarm numTasks procName <-checkpoint fileName>
+//
+// The command is collective. Process 0 keeps the queue of task ids
+// 0, 1, ..., numTasks-1 and hands the next one to whichever worker asks
+// for it; each worker evaluates "procName taskId" and returns the list of
+// doubles produced by the procedure as a binary array. On process 0 the
+// command returns a dict of task id -> result list; on the workers it
+// returns the number of tasks they ran. With a single process all the
+// tasks are run by process 0.
+//
+// With -checkpoint, every completed task is appended to fileName as a
+// binary record (int id, int n, n doubles) and flushed. If the file
+// exists when the command starts, its tasks are not run again and their
+// results are returned with the others, so a campaign can be resumed.
+// Tasks whose procedure fails are reported and left out of the file.
+//
+#include <tcl.h>
+#include <mpi.h>
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <map>
+#include <vector>
+#include <Logging.h>
+#include <Parsing.h>
+#include <MachineBroker.h>
+
+static int opsTaskFarm(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
+
+void Init_TaskFarm(Tcl_Interp* interp, MachineBroker* theMachineBroker)
+{
+  Tcl_CreateCommand(interp, "taskFarm",  &opsTaskFarm, (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
+}
+
+// Messages of the farm, on a communicator of its own
+enum {
+  TaskReady  = 1,  // worker -> master, empty
+  TaskResult = 2,  // worker -> master, doubles
+  TaskFailed = 3,  // worker -> master, empty
+  TaskAssign = 4   // master -> worker, one int; -1 to stop
+};
+
+typedef std::map<int, std::vector<double> > TaskResults;
+
+//
+// Checkpoint file
+//
+static void
+readCheckpoint(const char *fileName, int numTasks, TaskResults &results)
+{
+  FILE *file = fopen(fileName, "rb");
+  if (file == nullptr)
+    return;
+
+  int header[2];
+  while (fread(header, sizeof(int), 2, file) == 2) {
+    if (header[1] < 0)
+      break;
+    std::vector<double> values(header[1]);
+    if (header[1] > 0 &&
+        fread(values.data(), sizeof(double), header[1], file) != (size_t)header[1])
+      break; // record cut short by an interrupted run
+    if (header[0] >= 0 && header[0] < numTasks)
+      results[header[0]] = values;
+  }
+  fclose(file);
+}
+
+static bool
+writeRecord(FILE *file, int id, const std::vector<double> &values)
+{
+  int header[2] = {id, (int)values.size()};
+  bool ok = fwrite(header, sizeof(int), 2, file) == 2 &&
+            fwrite(values.data(), sizeof(double), values.size(), file) == values.size();
+  return fflush(file) == 0 && ok;
+}
+
+// Rewrite the file with the complete records only, so that new records
+// are not appended after a partial one
+static FILE *
+openCheckpoint(const char *fileName, const TaskResults &results)
+{
+  FILE *file = fopen(fileName, "wb");
+  if (file == nullptr)
+    return nullptr;
+  for (auto &result : results)
+    if (!writeRecord(file, result.first, result.second)) {
+      fclose(file);
+      return nullptr;
+    }
+  return file;
+}
+
+//
+// Task evaluation
+//
+static int
+runTask(Tcl_Interp *interp, const char *procName, int id, std::vector<double> &values)
+{
+  Tcl_Obj *command[2] = {Tcl_NewStringObj(procName, -1), Tcl_NewIntObj(id)};
+  Tcl_IncrRefCount(command[0]);
+  Tcl_IncrRefCount(command[1]);
+  int status = Tcl_EvalObjv(interp, 2, command, TCL_EVAL_GLOBAL);
+  Tcl_DecrRefCount(command[0]);
+  Tcl_DecrRefCount(command[1]);
+
+  if (status != TCL_OK) {
+    opserr << "WARNING taskFarm - task " << id << " failed: "
+           << Tcl_GetStringResult(interp) << "\n";
+    return TCL_ERROR;
+  }
+
+  int numValues = 0;
+  Tcl_Obj **items = nullptr;
+  if (Tcl_ListObjGetElements(interp, Tcl_GetObjResult(interp), &numValues, &items) != TCL_OK) {
+    opserr << "WARNING taskFarm - task " << id << " did not return a list\n";
+    return TCL_ERROR;
+  }
+
+  values.resize(numValues);
+  for (int i = 0; i < numValues; i++)
+    if (Tcl_GetDoubleFromObj(interp, items[i], &values[i]) != TCL_OK) {
+      opserr << "WARNING taskFarm - task " << id << " returned "
+             << Tcl_GetString(items[i]) << " which is not a number\n";
+      return TCL_ERROR;
+    }
+
+  Tcl_ResetResult(interp);
+  return TCL_OK;
+}
+
+//
+// Master and worker loops
+//
+static int
+runMaster(Tcl_Interp *interp, MPI_Comm comm, int np, const char *procName,
+          int numTasks, FILE *checkpoint, TaskResults &results)
+{
+  std::deque<int> queue;
+  for (int id = 0; id < numTasks; id++)
+    if (results.find(id) == results.end())
+      queue.push_back(id);
+
+  int numFailed = 0;
+  bool checkpointOK = true;
+  auto complete = [&](int id, std::vector<double> &values) {
+    if (checkpoint != nullptr && checkpointOK && !writeRecord(checkpoint, id, values)) {
+      opserr << "WARNING taskFarm - could not write to the checkpoint file\n";
+      checkpointOK = false;
+    }
+    results[id].swap(values);
+  };
+
+  if (np == 1) {
+    for (int id : queue) {
+      std::vector<double> values;
+      if (runTask(interp, procName, id, values) == TCL_OK)
+        complete(id, values);
+      else
+        numFailed++;
+    }
+
+  } else {
+    std::vector<int> assigned(np, -1);
+    int numActive = np - 1;
+
+    while (numActive > 0) {
+      MPI_Status status;
+      MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &status);
+      const int worker = status.MPI_SOURCE;
+
+      int count = 0;
+      MPI_Get_count(&status, MPI_DOUBLE, &count);
+      std::vector<double> values(count);
+      MPI_Recv(values.data(), count, MPI_DOUBLE, worker, status.MPI_TAG, comm, MPI_STATUS_IGNORE);
+
+      if (status.MPI_TAG == TaskResult)
+        complete(assigned[worker], values);
+      else if (status.MPI_TAG == TaskFailed)
+        numFailed++;
+
+      // hand out the next task, or stop the worker
+      int id = -1;
+      if (!queue.empty()) {
+        id = queue.front();
+        queue.pop_front();
+      } else
+        numActive--;
+      assigned[worker] = id;
+      MPI_Send(&id, 1, MPI_INT, worker, TaskAssign, comm);
+    }
+  }
+
+  if (numFailed > 0)
+    opserr << "WARNING taskFarm - " << numFailed << " of " << numTasks
+           << " tasks failed and were not completed\n";
+
+  Tcl_Obj *dict = Tcl_NewDictObj();
+  for (auto &result : results) {
+    Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+    for (double value : result.second)
+      Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(value));
+    Tcl_DictObjPut(interp, dict, Tcl_NewIntObj(result.first), list);
+  }
+  Tcl_SetObjResult(interp, dict);
+  return TCL_OK;
+}
+
+static int
+runWorker(Tcl_Interp *interp, MPI_Comm comm, const char *procName)
+{
+  int numRun = 0;
+  MPI_Send(nullptr, 0, MPI_DOUBLE, 0, TaskReady, comm);
+
+  while (true) {
+    int id = -1;
+    MPI_Recv(&id, 1, MPI_INT, 0, TaskAssign, comm, MPI_STATUS_IGNORE);
+    if (id < 0)
+      break;
+
+    std::vector<double> values;
+    if (runTask(interp, procName, id, values) == TCL_OK)
+      MPI_Send(values.data(), (int)values.size(), MPI_DOUBLE, 0, TaskResult, comm);
+    else
+      MPI_Send(nullptr, 0, MPI_DOUBLE, 0, TaskFailed, comm);
+    numRun++;
+  }
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(numRun));
+  return TCL_OK;
+}
+
+static int
+opsTaskFarm(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  MachineBroker* theMachineBroker = (MachineBroker*)clientData;
+  int myPID = theMachineBroker->getPID();
+  int np    = theMachineBroker->getNP();
+
+  if (argc < 3) {
+    opserr << "WARNING want - taskFarm numTasks procName <-checkpoint fileName>\n";
+    return TCL_ERROR;
+  }
+
+  int numTasks = 0;
+  if (Tcl_GetInt(interp, argv[1], &numTasks) != TCL_OK || numTasks < 0) {
+    opserr << "WARNING taskFarm - invalid numTasks " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+  const char *procName = argv[2];
+
+  const char *fileName = nullptr;
+  for (int i = 3; i < argc; i++) {
+    if (strcmp(argv[i], "-checkpoint") == 0 && i + 1 < argc)
+      fileName = argv[++i];
+    else {
+      opserr << "WARNING taskFarm - unknown option " << argv[i] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  // a communicator of its own keeps the farm apart from send/recv
+  MPI_Comm comm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+
+  int status = TCL_OK;
+  if (myPID == 0) {
+    TaskResults results;
+    FILE *checkpoint = nullptr;
+    if (fileName != nullptr) {
+      readCheckpoint(fileName, numTasks, results);
+      checkpoint = openCheckpoint(fileName, results);
+      if (checkpoint == nullptr)
+        opserr << "WARNING taskFarm - could not open checkpoint file " << fileName << "\n";
+      else if (!results.empty())
+        opserr << "taskFarm - resuming with " << (int)results.size() << " of "
+               << numTasks << " tasks completed\n";
+    }
+
+    status = runMaster(interp, comm, np, procName, numTasks, checkpoint, results);
+
+    if (checkpoint != nullptr)
+      fclose(checkpoint);
+
+  } else
+    status = runWorker(interp, comm, procName);
+
+  MPI_Comm_free(&comm);
+  return status;
+}
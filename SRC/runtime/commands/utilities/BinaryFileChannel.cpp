@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include "BinaryFileChannel.h"
+#include <OPS_Globals.h>
+#include <MovableObject.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+static constexpr char SnapshotMagic[8] = {'O','P','S','S','N','A','P','1'};
+
+// Fixed-width fields, so that a snapshot written on one platform
+// (e.g. LP64 Linux) can be read on another (e.g. LLP64 Windows)
+struct RecordHeader {
+  int32_t kind;
+  int32_t reserved;
+  int64_t size;
+};
+static_assert(sizeof(RecordHeader) == 16, "snapshot record header must be 16 bytes");
+
+BinaryFileChannel::BinaryFileChannel(const char *filename, Mode mode)
+: file(nullptr), mode(mode)
+{
+  file = fopen(filename, mode == Write ? "wb" : "rb");
+  if (file == nullptr) {
+    opserr << "BinaryFileChannel - could not open file " << filename << "\n";
+    return;
+  }
+
+  char magic[8];
+  if (mode == Write)
+    fwrite(SnapshotMagic, 1, sizeof(SnapshotMagic), file);
+
+  else if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+           memcmp(magic, SnapshotMagic, sizeof(magic)) != 0) {
+    opserr << "BinaryFileChannel - " << filename << " is not a snapshot file\n";
+    fclose(file);
+    file = nullptr;
+  }
+}
+
+BinaryFileChannel::~BinaryFileChannel()
+{
+  if (file != nullptr)
+    fclose(file);
+}
+
+int
+BinaryFileChannel::writeRecord(int kind, const void *data, int64_t size)
+{
+  if (file == nullptr || mode != Write)
+    return -1;
+
+  RecordHeader header {kind, 0, size};
+  if (fwrite(&header, sizeof(header), 1, file) != 1)
+    return -1;
+  if (size > 0 && fwrite(data, 1, size, file) != (size_t)size)
+    return -1;
+  return 0;
+}
+
+int
+BinaryFileChannel::readRecord(int kind, void *data, int64_t size)
+{
+  if (file == nullptr || mode != Read)
+    return -1;
+
+  RecordHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1)
+    return -1;
+
+  if (header.kind != kind) {
+    opserr << "BinaryFileChannel - snapshot does not match the receiving object\n";
+    return -2;
+  }
+
+  if (header.size != size) {
+    opserr << "BinaryFileChannel - expected " << (int)size << " bytes but snapshot has "
+           << (int)header.size << "\n";
+    return -2;
+  }
+
+  if (header.size > 0 && fread(data, 1, header.size, file) != (size_t)header.size)
+    return -1;
+
+  return 0;
+}
+
+int
+BinaryFileChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+int
+BinaryFileChannel::recvObj(int commitTag, MovableObject &theObject, FEM_ObjectBroker &theBroker, ChannelAddress *)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+int
+BinaryFileChannel::sendMsg(int, int, const Message &msg, ChannelAddress *)
+{
+  Message &data = const_cast<Message&>(msg);
+  return this->writeRecord(KindMessage, data.getData(), data.getSize());
+}
+
+int
+BinaryFileChannel::recvMsg(int, int, Message &msg, ChannelAddress *)
+{
+  return this->readRecord(KindMessage, msg.getData(), msg.getSize());
+}
+
+//
+// A Message only wraps a buffer it does not own, so it cannot be grown to
+// the size stored in the snapshot, and a shorter record could not be
+// reported back to the caller. Messages must be received with recvMsg().
+//
+int
+BinaryFileChannel::recvMsgUnknownSize(int, int, Message &, ChannelAddress *)
+{
+  opserr << "BinaryFileChannel::recvMsgUnknownSize - not supported; "
+         << "snapshot messages must be received with recvMsg()\n";
+  return -1;
+}
+
+int
+BinaryFileChannel::sendMatrix(int, int, const Matrix &theMatrix, ChannelAddress *)
+{
+  const int nr = theMatrix.noRows(),
+            nc = theMatrix.noCols();
+  std::vector<double> data(nr*nc);
+  for (int j=0; j<nc; j++)
+    for (int i=0; i<nr; i++)
+      data[j*nr+i] = theMatrix(i,j);
+
+  return this->writeRecord(KindMatrix, data.data(), (int64_t)(data.size()*sizeof(double)));
+}
+
+int
+BinaryFileChannel::recvMatrix(int, int, Matrix &theMatrix, ChannelAddress *)
+{
+  const int nr = theMatrix.noRows(),
+            nc = theMatrix.noCols();
+  std::vector<double> data(nr*nc);
+  int status = this->readRecord(KindMatrix, data.data(), (int64_t)(data.size()*sizeof(double)));
+  if (status < 0)
+    return status;
+
+  for (int j=0; j<nc; j++)
+    for (int i=0; i<nr; i++)
+      theMatrix(i,j) = data[j*nr+i];
+  return 0;
+}
+
+int
+BinaryFileChannel::sendVector(int, int, const Vector &theVector, ChannelAddress *)
+{
+  const int n = theVector.Size();
+  std::vector<double> data(n);
+  for (int i=0; i<n; i++)
+    data[i] = theVector(i);
+
+  return this->writeRecord(KindVector, data.data(), (int64_t)(n*sizeof(double)));
+}
+
+int
+BinaryFileChannel::recvVector(int, int, Vector &theVector, ChannelAddress *)
+{
+  const int n = theVector.Size();
+  std::vector<double> data(n);
+  int status = this->readRecord(KindVector, data.data(), (int64_t)(n*sizeof(double)));
+  if (status < 0)
+    return status;
+
+  for (int i=0; i<n; i++)
+    theVector(i) = data[i];
+  return 0;
+}
+
+int
+BinaryFileChannel::sendID(int, int, const ID &theID, ChannelAddress *)
+{
+  const int n = theID.Size();
+  std::vector<int32_t> data(n);
+  for (int i=0; i<n; i++)
+    data[i] = theID(i);
+
+  return this->writeRecord(KindID, data.data(), (int64_t)(n*sizeof(int32_t)));
+}
+
+int
+BinaryFileChannel::recvID(int, int, ID &theID, ChannelAddress *)
+{
+  const int n = theID.Size();
+  std::vector<int32_t> data(n);
+  int status = this->readRecord(KindID, data.data(), (int64_t)(n*sizeof(int32_t)));
+  if (status < 0)
+    return status;
+
+  for (int i=0; i<n; i++)
+    theID(i) = data[i];
+  return 0;
+}
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: BinaryFileChannel is a Channel that streams the data passed
+// to it by sendSelf() into a single binary file, and hands the same data
+// back, in the same order, to recvSelf(). It is not a datastore; objects
+// send their complete state, as they would to a remote process, so a file
+// written by one process can be read by another.
+//
+// Every record is preceded by a small header holding its kind and size
+// so that a snapshot that does not match the receiving objects is
+// detected instead of silently misread.
+//
+// Written: cmp
+//
+#ifndef BinaryFileChannel_h
+#define BinaryFileChannel_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <Channel.h>
+
+class BinaryFileChannel : public Channel
+{
+public:
+  enum Mode {Read, Write};
+
+  BinaryFileChannel(const char *filename, Mode mode);
+  ~BinaryFileChannel();
+
+  // true if the file was opened and its header is valid
+  bool isOpen() const {return file != nullptr;}
+
+  char *addToProgram() {return nullptr;}
+  int setUpConnection() {return 0;}
+  int setNextAddress(const ChannelAddress &) {return 0;}
+  ChannelAddress *getLastSendersAddress() {return nullptr;}
+
+  bool isDatastore() {return false;}
+
+  int sendObj(int commitTag, MovableObject &, ChannelAddress *a = nullptr);
+  int recvObj(int commitTag, MovableObject &, FEM_ObjectBroker &, ChannelAddress *a = nullptr);
+
+  int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *a = nullptr);
+  int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *a = nullptr);
+  int recvMsgUnknownSize(int dbTag, int commitTag, Message &, ChannelAddress *a = nullptr);
+
+  int sendMatrix(int dbTag, int commitTag, const Matrix &, ChannelAddress *a = nullptr);
+  int recvMatrix(int dbTag, int commitTag, Matrix &, ChannelAddress *a = nullptr);
+
+  int sendVector(int dbTag, int commitTag, const Vector &, ChannelAddress *a = nullptr);
+  int recvVector(int dbTag, int commitTag, Vector &, ChannelAddress *a = nullptr);
+
+  int sendID(int dbTag, int commitTag, const ID &, ChannelAddress *a = nullptr);
+  int recvID(int dbTag, int commitTag, ID &, ChannelAddress *a = nullptr);
+
+private:
+  enum Kind : int {KindMessage = 1, KindMatrix, KindVector, KindID};
+
+  int writeRecord(int kind, const void *data, int64_t size);
+  int readRecord(int kind, void *data, int64_t size);
+
+  FILE *file;
+  Mode  mode;
+};
+
+#endif
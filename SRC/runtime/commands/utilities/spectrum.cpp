@@ -0,0 +1,428 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Batched response spectra of bilinear SDOF oscillators,
+// and the Tcl command sdofSpectrum.
+//
+//   sdofSpectrum -dt dt -periods {T...} ?-damping {zeta...}?
+//                ?-strength {fy...}? ?-hardening alpha? ?-substeps n?
+//                ?-threads n? record ?record...?
+//
+// Each record is a list of ground accelerations. The result is a list with
+// one entry per record, each of which is a flat list of rows
+//
+//   zeta fy T  Sd PSv PSa Sa ur mu
+//
+// where ur is the relative displacement at the end of the record.
+//
+// The oscillator integration follows sdofResponse.cpp (average acceleration
+// Newmark with a bilinear kinematic hardening spring) with unit mass.
+//
+// Author: cmp
+//
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tcl.h>
+#include <threads/thread_pool.hpp>
+#include "spectrum.h"
+
+namespace OpenSees {
+
+namespace {
+
+// State of all oscillators of one record, stored as separate arrays
+struct OscillatorBatch {
+  int n;
+  // properties
+  std::vector<double> k, fy, H, kep, a1, a2, a3;
+  // committed state
+  std::vector<double> u0, v0, acc0, fs0, up0, kT0;
+  // trial state
+  std::vector<double> u, fs, up, kT, phat, R, R0;
+  // peaks
+  std::vector<double> umax, amax;
+
+  explicit OscillatorBatch(int size)
+  : n(size),
+    k(size), fy(size), H(size), kep(size), a1(size), a2(size), a3(size),
+    u0(size), v0(size), acc0(size), fs0(size), up0(size), kT0(size),
+    u(size), fs(size), up(size), kT(size), phat(size), R(size), R0(size),
+    umax(size), amax(size)
+  {
+  }
+};
+
+constexpr double gamma = 0.5;  // Newmark average acceleration
+constexpr double beta  = 0.25;
+constexpr double tol   = 1.0e-8;
+constexpr int maxIter  = 10;
+
+// Worker threads are kept between calls and only rebuilt when a
+// different number is requested; calls that use them are serialized.
+std::mutex pool_mutex;
+std::unique_ptr<thread_pool> pool;
+
+void
+integrate_record(const SpectrumRecord& record,
+                 const double *periods,  int nper,
+                 const double *damping,  int ndamp,
+                 const double *strength, int nstr,
+                 double alpha, int substeps,
+                 double *out)
+{
+  const int nosc = ndamp*nstr*nper;
+  const double dt = record.dt/substeps;
+
+  OscillatorBatch b(nosc);
+
+  //
+  // Initialize properties; oscillators are ordered (damping, strength, period)
+  //
+  for (int d=0, i=0; d<ndamp; d++)
+    for (int s=0; s<nstr; s++)
+      for (int p=0; p<nper; p++, i++) {
+        const double w = 2.0*M_PI/periods[p];
+        const double k = w*w;
+        const double c = 2.0*damping[d]*w;
+        const double H = alpha/(1.0-alpha)*k;
+        b.k[i]   = k;
+        b.fy[i]  = (strength != nullptr && strength[s] > 0.0) ? strength[s] : HUGE_VAL;
+        b.H[i]   = H;
+        b.kep[i] = k*H/(k+H);
+        b.a1[i]  = 1.0/(beta*dt*dt) + (gamma/(beta*dt))*c;
+        b.a2[i]  = 1.0/(beta*dt) + (gamma/beta-1.0)*c;
+        b.a3[i]  = (0.5/beta-1.0) + dt*(0.5*gamma/beta-1.0)*c;
+
+        b.u0[i]  = b.v0[i] = b.fs0[i] = b.up0[i] = 0.0;
+        b.acc0[i] = record.size > 0 ? -record.accel[0] : 0.0;
+        b.kT0[i] = k;
+        b.umax[i] = 0.0;
+        b.amax[i] = 0.0;
+      }
+
+  const double au = 1.0/(beta*dt*dt);
+  const double vu = gamma/(beta*dt);
+  const double vv = 1.0-gamma/beta;
+  const double va = dt*(1.0-0.5*gamma/beta);
+  const double av = 1.0/(beta*dt);
+  const double aa = 0.5/beta-1.0;
+
+  double *__restrict u    = b.u.data();
+  double *__restrict fs   = b.fs.data();
+  double *__restrict up   = b.up.data();
+  double *__restrict kT   = b.kT.data();
+  double *__restrict R    = b.R.data();
+  double *__restrict R0   = b.R0.data();
+  double *__restrict phat = b.phat.data();
+  double *__restrict u0   = b.u0.data();
+  double *__restrict v0   = b.v0.data();
+  double *__restrict acc0 = b.acc0.data();
+  double *__restrict fs0  = b.fs0.data();
+  double *__restrict up0  = b.up0.data();
+  double *__restrict kT0  = b.kT0.data();
+  double *__restrict umax = b.umax.data();
+  double *__restrict amax = b.amax.data();
+  const double *__restrict k   = b.k.data();
+  const double *__restrict fy  = b.fy.data();
+  const double *__restrict H   = b.H.data();
+  const double *__restrict kep = b.kep.data();
+  const double *__restrict a1  = b.a1.data();
+  const double *__restrict a2  = b.a2.data();
+  const double *__restrict a3  = b.a3.data();
+
+  for (int step=1; step<record.size; step++) {
+    const double ag_prev = record.accel[step-1];
+    const double ag_next = record.accel[step];
+
+    for (int sub=1; sub<=substeps; sub++) {
+      const double ag = ag_prev + (ag_next - ag_prev)*sub/substeps;
+      const double p  = -ag;
+
+      for (int i=0; i<nosc; i++) {
+        u[i]    = u0[i];
+        fs[i]   = fs0[i];
+        kT[i]   = kT0[i];
+        up[i]   = up0[i];
+        phat[i] = p + a1[i]*u0[i] + a2[i]*v0[i] + a3[i]*acc0[i];
+        R[i]    = phat[i] - fs[i] - a1[i]*u[i];
+        R0[i]   = R[i] != 0.0 ? fabs(R[i]) : 1.0;
+      }
+
+      //
+      // Newton iterations; every oscillator is updated on each pass
+      // so that the loop body has no data-dependent control flow
+      //
+      for (int iter=0; iter<maxIter; iter++) {
+        double rmax = 0.0;
+        for (int i=0; i<nosc; i++) {
+          u[i] += R[i]/(kT[i] + a1[i]);
+
+          const double ftrial = k[i]*(u[i] - up0[i]);
+          const double zs     = ftrial - H[i]*up0[i];
+          const double f      = fabs(zs) - fy[i];
+          const double sign   = zs < 0.0 ? -1.0 : 1.0;
+          const double dg     = f > 0.0 ? f/(k[i]+H[i]) : 0.0;
+
+          fs[i] = ftrial - sign*dg*k[i];
+          up[i] = up0[i] + sign*dg;
+          kT[i] = f > 0.0 ? kep[i] : k[i];
+          R[i]  = phat[i] - fs[i] - a1[i]*u[i];
+
+          rmax = std::max(rmax, fabs(R[i])/R0[i]);
+        }
+        if (rmax <= tol)
+          break;
+      }
+
+      for (int i=0; i<nosc; i++) {
+        const double du = u[i] - u0[i];
+        const double v  = vu*du + vv*v0[i] + va*acc0[i];
+        const double a  = au*du - av*v0[i] - aa*acc0[i];
+
+        u0[i]   = u[i];
+        v0[i]   = v;
+        acc0[i] = a;
+        fs0[i]  = fs[i];
+        kT0[i]  = kT[i];
+        up0[i]  = up[i];
+
+        umax[i] = std::max(umax[i], fabs(u[i]));
+        amax[i] = std::max(amax[i], fabs(a + ag));
+      }
+    }
+  }
+
+  for (int d=0, i=0; d<ndamp; d++)
+    for (int s=0; s<nstr; s++)
+      for (int p=0; p<nper; p++, i++) {
+        const double w = 2.0*M_PI/periods[p];
+        double *row = out + static_cast<size_t>(i)*SpectrumQuantity::Count;
+        row[SpectrumQuantity::Displ]       = umax[i];
+        row[SpectrumQuantity::PseudoVeloc] = w*umax[i];
+        row[SpectrumQuantity::PseudoAccel] = w*w*umax[i];
+        row[SpectrumQuantity::TotalAccel]  = amax[i];
+        row[SpectrumQuantity::Residual]    = u0[i];
+        row[SpectrumQuantity::Ductility]   = fy[i] < HUGE_VAL ? umax[i]/(fy[i]/k[i]) : NAN;
+      }
+}
+
+} // namespace
+
+
+void
+sdof_step_coefficients(double w, double z, double dt, double *c)
+{
+  if (z < 1.0 && w*dt >= 1.0e-3) {
+    const double s1 = sqrt(1.0 - z*z);
+    const double wd = w*s1;
+    const double k  = w*w;
+    const double e  = exp(-z*w*dt);
+    const double s  = sin(wd*dt);
+    const double co = cos(wd*dt);
+    c[0] =  e*(z/s1*s + co);
+    c[1] =  e*s/wd;
+    c[2] = -e*w/s1*s;
+    c[3] =  e*(co - z/s1*s);
+    c[4] = (2.0*z/(w*dt) + e*(((1.0 - 2.0*z*z)/(wd*dt) - z/s1)*s
+                              - (1.0 + 2.0*z/(w*dt))*co))/k;
+    c[5] = (1.0 - 2.0*z/(w*dt) + e*((2.0*z*z - 1.0)/(wd*dt)*s + 2.0*z/(w*dt)*co))/k;
+    c[6] = (-1.0/dt + e*((w/s1 + z/(dt*s1))*s + co/dt))/k;
+    c[7] = (1.0 - e*(z/s1*s + co))/(k*dt);
+    return;
+  }
+
+  // Average acceleration; the step is linear in (q, q', p_n, p_n+1), so
+  // its coefficients are the responses to unit values of each
+  const double cd   = 2.0*z*w;
+  const double k    = w*w;
+  const double keff = k + 2.0*cd/dt + 4.0/(dt*dt);
+  for (int i = 0; i < 4; i++) {
+    const double q   = (i == 0) ? 1.0 : 0.0;
+    const double qd  = (i == 1) ? 1.0 : 0.0;
+    const double pn  = (i == 2) ? 1.0 : 0.0;
+    const double pn1 = (i == 3) ? 1.0 : 0.0;
+    const double a   = pn - cd*qd - k*q;
+    const double q1  = (pn1 + (4.0/(dt*dt) + 2.0*cd/dt)*q + (4.0/dt + cd)*qd + a)/keff;
+    const double qd1 = 2.0*(q1 - q)/dt - qd;
+    const int col = (i < 2) ? i : i + 2;
+    c[col]     = q1;
+    c[col + 2] = qd1;
+  }
+}
+
+
+int
+sdof_spectra(const SpectrumRecord *records, int nrec,
+             const double *periods,  int nper,
+             const double *damping,  int ndamp,
+             const double *strength, int nstr,
+             double alpha,
+             int substeps,
+             int threads,
+             double *out)
+{
+  static const double elastic = 0.0;
+  if (nstr == 0 || strength == nullptr) {
+    strength = &elastic;
+    nstr = 1;
+  }
+
+  if (nper <= 0 || ndamp <= 0 || alpha < 0.0 || alpha >= 1.0)
+    return -1;
+
+  for (int p=0; p<nper; p++)
+    if (periods[p] <= 0.0)
+      return -1;
+
+  if (substeps < 1)
+    substeps = 1;
+
+  const size_t stride = static_cast<size_t>(ndamp)*nstr*nper*SpectrumQuantity::Count;
+
+  if (threads == 1 || nrec == 1) {
+    for (int r=0; r<nrec; r++)
+      integrate_record(records[r], periods, nper, damping, ndamp, strength, nstr,
+                       alpha, substeps, out + r*stride);
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  const unsigned count = threads > 0 ? static_cast<unsigned>(threads)
+                                     : std::max(1u, std::thread::hardware_concurrency());
+  if (pool == nullptr)
+    pool.reset(new thread_pool(count));
+  else if (pool->get_thread_count() != count)
+    pool->reset(count);
+
+  pool->submit_loop<int>(0, nrec, [&](int r) {
+    integrate_record(records[r], periods, nper, damping, ndamp, strength, nstr,
+                     alpha, substeps, out + r*stride);
+  }).wait();
+
+  return 0;
+}
+
+} // namespace OpenSees
+
+
+static int
+get_doubles(Tcl_Interp *interp, Tcl_Obj *list, std::vector<double>& values)
+{
+  int size;
+  Tcl_Obj **items;
+  if (Tcl_ListObjGetElements(interp, list, &size, &items) != TCL_OK)
+    return TCL_ERROR;
+
+  values.resize(size);
+  for (int i=0; i<size; i++)
+    if (Tcl_GetDoubleFromObj(interp, items[i], &values[i]) != TCL_OK)
+      return TCL_ERROR;
+  return TCL_OK;
+}
+
+int
+TclObjCommand_sdofSpectrum(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj* const*objv)
+{
+  double dt = 0.0;
+  double alpha = 0.0;
+  int substeps = 1;
+  int threads  = 0;
+  std::vector<double> periods, strength, damping {0.05};
+  std::vector<std::vector<double>> accels;
+
+  for (int i=1; i<objc; i++) {
+    const char *arg = Tcl_GetString(objv[i]);
+    if (arg[0] == '-' && i+1 == objc) {
+      Tcl_SetResult(interp, (char*)"missing value for option", TCL_STATIC);
+      return TCL_ERROR;
+    }
+
+    if (strcmp(arg, "-dt") == 0) {
+      if (Tcl_GetDoubleFromObj(interp, objv[++i], &dt) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-periods") == 0) {
+      if (get_doubles(interp, objv[++i], periods) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-damping") == 0) {
+      if (get_doubles(interp, objv[++i], damping) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-strength") == 0) {
+      if (get_doubles(interp, objv[++i], strength) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-hardening") == 0) {
+      if (Tcl_GetDoubleFromObj(interp, objv[++i], &alpha) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-substeps") == 0) {
+      if (Tcl_GetIntFromObj(interp, objv[++i], &substeps) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(arg, "-threads") == 0) {
+      if (Tcl_GetIntFromObj(interp, objv[++i], &threads) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else {
+      accels.emplace_back();
+      if (get_doubles(interp, objv[i], accels.back()) != TCL_OK)
+        return TCL_ERROR;
+    }
+  }
+
+  if (dt <= 0.0 || periods.empty() || accels.empty()) {
+    Tcl_SetResult(interp, (char*)"usage: sdofSpectrum -dt dt -periods {T...} record ?record...?", TCL_STATIC);
+    return TCL_ERROR;
+  }
+
+  std::vector<OpenSees::SpectrumRecord> records;
+  for (const auto& accel : accels)
+    records.push_back({accel.data(), static_cast<int>(accel.size()), dt});
+
+  if (strength.empty())
+    strength.push_back(0.0);
+
+  const int nper = static_cast<int>(periods.size()),
+            nstr = static_cast<int>(strength.size()),
+            ndmp = static_cast<int>(damping.size());
+
+  const int nq = OpenSees::SpectrumQuantity::Count;
+  std::vector<double> out(records.size()*ndmp*nstr*nper*nq);
+
+  if (OpenSees::sdof_spectra(records.data(), static_cast<int>(records.size()),
+                             periods.data(),  nper,
+                             damping.data(),  ndmp,
+                             strength.data(), nstr,
+                             alpha, substeps, threads, out.data()) != 0) {
+    Tcl_SetResult(interp, (char*)"invalid spectrum parameters", TCL_STATIC);
+    return TCL_ERROR;
+  }
+
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  const double *row = out.data();
+  for (size_t r=0; r<records.size(); r++) {
+    Tcl_Obj *spectrum = Tcl_NewListObj(0, nullptr);
+    for (int d=0; d<ndmp; d++)
+      for (int s=0; s<nstr; s++)
+        for (int p=0; p<nper; p++, row += nq) {
+          Tcl_ListObjAppendElement(interp, spectrum, Tcl_NewDoubleObj(damping[d]));
+          Tcl_ListObjAppendElement(interp, spectrum, Tcl_NewDoubleObj(strength[s]));
+          Tcl_ListObjAppendElement(interp, spectrum, Tcl_NewDoubleObj(periods[p]));
+          for (int q=0; q<nq; q++)
+            Tcl_ListObjAppendElement(interp, spectrum, Tcl_NewDoubleObj(row[q]));
+        }
+    Tcl_ListObjAppendElement(interp, result, spectrum);
+  }
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
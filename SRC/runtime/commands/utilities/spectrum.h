@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Batched response spectra of bilinear SDOF oscillators.
+//
+// All oscillators of a (damping x strength x period) grid are integrated
+// together for each record, with the state stored as contiguous arrays
+// so that the inner loop over oscillators vectorizes. Records are
+// distributed over threads.
+//
+// Results are laid out as
+//
+//   out[(((r*ndamp + d)*nstr + s)*nper + p)*SpectrumQuantity::Count + q]
+//
+// Author: cmp
+//
+#ifndef OpenSees_Spectrum_h
+#define OpenSees_Spectrum_h
+
+namespace OpenSees {
+
+struct SpectrumQuantity {
+  enum : int {
+    Displ,       // peak relative displacement
+    PseudoVeloc, // omega * Displ
+    PseudoAccel, // omega^2 * Displ
+    TotalAccel,  // peak absolute acceleration
+    Residual,    // relative displacement at the end of the record
+    Ductility,   // Displ / yield displacement; NaN for elastic oscillators
+    Count
+  };
+};
+
+struct SpectrumRecord {
+  const double *accel;   // ground acceleration
+  int           size;
+  double        dt;
+};
+
+//
+// periods, damping   - oscillator grid
+// strength           - yield force per unit mass; values <= 0 denote an
+//                      elastic oscillator. If nstr is zero, only elastic
+//                      spectra are computed.
+// alpha              - post-yield stiffness ratio
+// substeps           - integration steps per record step; ground
+//                      acceleration is interpolated linearly
+// threads            - number of threads; 0 uses the hardware concurrency
+//
+// Returns 0 on success.
+//
+int sdof_spectra(const SpectrumRecord *records, int nrec,
+                 const double *periods,  int nper,
+                 const double *damping,  int ndamp,
+                 const double *strength, int nstr,
+                 double alpha,
+                 int substeps,
+                 int threads,
+                 double *out);
+
+//
+// Coefficients of one step of u'' + 2 z w u' + w^2 u = p(t) with p linear
+// over the step dt,
+//
+//   u1 = c0 u + c1 v + c4 p0 + c5 p1,   v1 = c2 u + c3 v + c6 p0 + c7 p1
+//
+// These are exact (Nigam & Jennings 1969) for z < 1; overdamped
+// oscillators and those with w dt < 1e-3 use the average acceleration rule.
+//
+void sdof_step_coefficients(double w, double z, double dt, double *c);
+
+} // namespace OpenSees
+
+#endif
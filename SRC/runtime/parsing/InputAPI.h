@@ -15,4 +15,32 @@ enum SuccessFlag {
 
 typedef enum SuccessFlag SuccessFlag;
 
+#ifdef __cplusplus
+//
+// Helpers for commands created with Tcl_CreateObjCommand. Numbers are read
+// through the internal representation that Tcl caches on each Tcl_Obj, so a
+// value that is passed repeatedly (a loop variable, a tag kept in a Tcl
+// variable) is converted from its string form only once. Results are
+// returned as list objects rather than formatted strings.
+//
+class ID;
+class Vector;
+
+// Read objc numbers from objv into values; returns TCL_OK or TCL_ERROR
+int G3_GetIntArray(Tcl_Interp*, int objc, Tcl_Obj *const *objv, int *values);
+int G3_GetDoubleArray(Tcl_Interp*, int objc, Tcl_Obj *const *objv, double *values);
+
+// True if the string representation of obj is equal to value
+bool G3_ObjIs(Tcl_Obj *obj, const char *value);
+
+// Parse the arguments of an object command with OPS_GetIntInput and
+// OPS_GetDoubleInput, starting at cArg; argv holds the strings of objv
+int G3_ResetInputObj(Tcl_Interp*, int cArg, int objc, Tcl_Obj *const *objv,
+                     TCL_Char ** const argv);
+
+Tcl_Obj *G3_NewListObj(const double *values, int size);
+Tcl_Obj *G3_NewListObj(const Vector &values);
+Tcl_Obj *G3_NewListObj(const ID &values);
+#endif
+
 #endif // G3PARSE_H
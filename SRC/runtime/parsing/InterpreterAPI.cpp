@@ -8,15 +8,19 @@
 #include <map>
 #include <vector>
 #include <assert.h>
+#include <string.h>
 #include <elementAPI.h>
 #include <stdlib.h>
 #include <packages.h>
 #include <OPS_Globals.h>
 #include <Domain.h>
 #include <Node.h>
+#include <Vector.h>
+#include <ID.h>
 #include <runtimeAPI.h>
 #include <G3_Runtime.h>
 #include <G3_Logging.h>
+#include <InputAPI.h>
 #include <BasicModelBuilder.h>
 
 #include <UniaxialMaterial.h>
@@ -29,10 +33,13 @@
 
 #include <TimeSeries.h>
 
-static Tcl_Interp *theInterp       = nullptr;
-static TCL_Char **currentArgv      = nullptr;
-static int currentArg = 0;
-static int maxArg     = 0;
+// The argument cursor is kept per thread, so that models held by
+// different interpreters may be parsed from different threads.
+static thread_local Tcl_Interp *theInterp  = nullptr;
+static thread_local TCL_Char **currentArgv = nullptr;
+static thread_local Tcl_Obj *const *currentObjv = nullptr;
+static thread_local int currentArg = 0;
+static thread_local int maxArg     = 0;
 
 
 extern const char *getInterpPWD(Tcl_Interp *interp);
@@ -93,11 +100,29 @@ OPS_ResetInputNoBuilder(ClientData clientData, Tcl_Interp *interp, int cArg,
 {
   theInterp = interp;
   currentArgv = argv;
+  currentObjv = nullptr;
   currentArg = cArg;
   maxArg = mArg;
   return 0;
 }
 
+//
+// Point the argument cursor at the arguments of an object command. argv
+// holds the string forms of objv for the parsers that compare keywords;
+// numbers are read from objv.
+//
+int
+G3_ResetInputObj(Tcl_Interp *interp, int cArg, int objc, Tcl_Obj *const *objv,
+                 TCL_Char ** const argv)
+{
+  theInterp = interp;
+  currentArgv = argv;
+  currentObjv = objv;
+  currentArg = cArg;
+  maxArg = objc;
+  return 0;
+}
+
 extern "C" int
 OPS_GetIntInput(int *numData, int *data)
 {
@@ -105,7 +130,9 @@ OPS_GetIntInput(int *numData, int *data)
 
   for (int i = 0; i < size; ++i) {
     if ((currentArg >= maxArg) ||
-        (Tcl_GetInt(theInterp, currentArgv[currentArg], &data[i]) != TCL_OK)) {
+        ((currentObjv != nullptr
+          ? Tcl_GetIntFromObj(theInterp, currentObjv[currentArg], &data[i])
+          : Tcl_GetInt(theInterp, currentArgv[currentArg], &data[i])) != TCL_OK)) {
       return -1;
     } else
       currentArg++;
@@ -120,7 +147,9 @@ OPS_GetDoubleInput(int *numData, double *data)
   int size = *numData;
   for (int i = 0; i < size; ++i) {
     if ((currentArg >= maxArg) ||
-        (Tcl_GetDouble(theInterp, currentArgv[currentArg], &data[i]) != TCL_OK)) {
+        ((currentObjv != nullptr
+          ? Tcl_GetDoubleFromObj(theInterp, currentObjv[currentArg], &data[i])
+          : Tcl_GetDouble(theInterp, currentArgv[currentArg], &data[i])) != TCL_OK)) {
       return -1;
     } else
       currentArg++;
@@ -284,9 +313,7 @@ extern "C" int OPS_SetDoubleDictListOutput(
 //
 
 
-extern bool builtModel;
-extern FE_Datastore *theDatabase;
-static BasicModelBuilder *theModelBuilder = nullptr;
+static thread_local BasicModelBuilder *theModelBuilder = nullptr;
 
 G3_Runtime *
 G3_getRuntime(Tcl_Interp *interp)
@@ -431,14 +458,14 @@ OPS_GetNDM(void)
 bool *
 OPS_builtModel(void) 
 {
-  return &builtModel;
+  return &G3_getRuntime(theInterp)->model_is_built;
 }
 
 AnalysisModel **
 G3_getAnalysisModelPtr(G3_Runtime *rt){return rt->m_analysis_model_ptr;}
 
 FE_Datastore *
-OPS_GetFEDatastore() {return theDatabase;}
+OPS_GetFEDatastore() {return G3_getRuntime(theInterp)->m_database;}
 
 const char *
 OPS_GetInterpPWD() {return getInterpPWD(theInterp);}
@@ -526,3 +553,58 @@ OPS_InvokeMaterialObject(struct matObject *theMat, modelState *theModel,
 }
 
 #endif
+
+
+//
+// Tcl_Obj helpers
+//
+int
+G3_GetIntArray(Tcl_Interp *interp, int objc, Tcl_Obj *const *objv, int *values)
+{
+  for (int i = 0; i < objc; i++)
+    if (Tcl_GetIntFromObj(interp, objv[i], &values[i]) != TCL_OK)
+      return TCL_ERROR;
+  return TCL_OK;
+}
+
+int
+G3_GetDoubleArray(Tcl_Interp *interp, int objc, Tcl_Obj *const *objv, double *values)
+{
+  for (int i = 0; i < objc; i++)
+    if (Tcl_GetDoubleFromObj(interp, objv[i], &values[i]) != TCL_OK)
+      return TCL_ERROR;
+  return TCL_OK;
+}
+
+bool
+G3_ObjIs(Tcl_Obj *obj, const char *value)
+{
+  return strcmp(Tcl_GetString(obj), value) == 0;
+}
+
+Tcl_Obj *
+G3_NewListObj(const double *values, int size)
+{
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  for (int i = 0; i < size; i++)
+    Tcl_ListObjAppendElement(nullptr, list, Tcl_NewDoubleObj(values[i]));
+  return list;
+}
+
+Tcl_Obj *
+G3_NewListObj(const Vector &values)
+{
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  for (int i = 0; i < values.Size(); i++)
+    Tcl_ListObjAppendElement(nullptr, list, Tcl_NewDoubleObj(values(i)));
+  return list;
+}
+
+Tcl_Obj *
+G3_NewListObj(const ID &values)
+{
+  Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+  for (int i = 0; i < values.Size(); i++)
+    Tcl_ListObjAppendElement(nullptr, list, Tcl_NewIntObj(values(i)));
+  return list;
+}
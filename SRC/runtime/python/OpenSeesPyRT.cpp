@@ -37,8 +37,11 @@ namespace py = pybind11;
 #include <PathTimeSeries.h>
 #include <PathSeries.h>
 #include <LinearSeries.h>
+#include <domain/loading/SharedPathSeries.h>
 #include <GroundMotion.h>
 
+#include <utilities/spectrum.h>
+
 #define ARRAY_FLAGS py::array::c_style|py::array::forcecast
 
 
@@ -225,17 +228,23 @@ quake2sees_motion(
     int tag = 110
 )
 {
-    Vector *accel;
     TimeSeries *accelSeries;
     GroundMotion *groundMotion;
-    // quake -> {Vector}
+    // quake -> {Path}; the series refers to the array's buffer, which is
+    // kept alive (and released under the GIL) by the path
     py::buffer_info info = quake_array.request();
-    double* accel_array = static_cast<double*>(info.ptr);
+    const double* accel_array = static_cast<const double*>(info.ptr);
     int array_size = static_cast<int>(info.shape[0]);
-    accel = new Vector(accel_array,array_size);
+    std::shared_ptr<const void> owner(new py::object(quake_array), [](const void* object) {
+      py::gil_scoped_acquire acquire;
+      delete static_cast<const py::object*>(object);
+    });
+    auto path = SharedPathSeries::Borrow(accel_array, array_size, owner);
+    if (path == nullptr)
+      throw std::invalid_argument("Invalid ground motion record");
 
-    // {Vector} -> {TimeSeries:PathTimeSeries}
-    accelSeries = new PathSeries(tag, *accel, time_step, cfactor, false, time_start);
+    // {Path} -> {TimeSeries:SharedPathSeries}
+    accelSeries = new SharedPathSeries(tag, path, time_step, cfactor, false, false, time_start);
 
     groundMotion = new GroundMotion(0, 0, accelSeries, 0);
     return groundMotion;
@@ -524,6 +533,52 @@ init_obj_module(py::module &m)
   // Module-Level Functions
   //
   m.def ("get_builder", &get_builder);
+
+  m.def ("sdof_spectrum", [](std::vector<py::array_t<double, ARRAY_FLAGS>> records,
+                             double time_step,
+                             py::array_t<double, ARRAY_FLAGS> periods,
+                             py::array_t<double, ARRAY_FLAGS> damping,
+                             py::array_t<double, ARRAY_FLAGS> strength,
+                             double alpha,
+                             int substeps,
+                             int threads) {
+      std::vector<OpenSees::SpectrumRecord> motions;
+      for (auto& record : records)
+        motions.push_back({record.data(), static_cast<int>(record.size()), time_step});
+
+      const int nrec = static_cast<int>(motions.size()),
+                nper = static_cast<int>(periods.size()),
+                ndmp = static_cast<int>(damping.size()),
+                nstr = std::max(1, static_cast<int>(strength.size()));
+
+      py::array_t<double> spectra({nrec, ndmp, nstr, nper, (int)OpenSees::SpectrumQuantity::Count});
+      int status;
+      {
+        py::gil_scoped_release release;
+        status = OpenSees::sdof_spectra(motions.data(), nrec,
+                                        periods.data(),  nper,
+                                        damping.data(),  ndmp,
+                                        strength.size() > 0 ? strength.data() : nullptr,
+                                        static_cast<int>(strength.size()),
+                                        alpha, substeps, threads,
+                                        spectra.mutable_data());
+      }
+      if (status != 0)
+        throw std::invalid_argument("Invalid spectrum parameters");
+      return spectra;
+    },
+    "Compute spectra of bilinear oscillators for a suite of records. Returns an array\n"
+    "of shape (records, damping, strength, periods, 6) holding Sd, PSv, PSa, Sa,\n"
+    "residual displacement and ductility.",
+    py::arg("records"),
+    py::arg("time_step"),
+    py::arg("periods"),
+    py::arg("damping")  = std::vector<double>{0.05},
+    py::arg("strength") = std::vector<double>{},
+    py::arg("alpha")    = 0.0,
+    py::arg("substeps") = 1,
+    py::arg("threads")  = 0
+  );
   m.def ("get_domain", [](G3_Runtime *rt)->std::unique_ptr<Domain, py::nodelete>{
       Domain *domain_addr = rt->m_domain;
       return std::unique_ptr<Domain, py::nodelete>((Domain*)domain_addr);
@@ -532,7 +587,17 @@ init_obj_module(py::module &m)
 
 }
 
+// batch.cpp
+void init_batch_module(py::module &m);
+// eigen.cpp
+void init_eigen_module(py::module &m);
+// analyze.cpp
+void init_analyze_module(py::module &m);
+
 PYBIND11_MODULE(OpenSeesPyRT, m) {
   init_obj_module(m);
+  init_batch_module(m);
+  init_eigen_module(m);
+  init_analyze_module(m);
 }
 
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Run the current analysis of a model without going
+// through the interpreter.
+//
+// The GIL is only released on request. Element scratch, ops_Dt and the
+// other OPS_Globals are still shared by all models of the process, so
+// two models analyzed at once from Python threads are not safe.
+//
+// Author: cmp
+//
+#include <pybind11/pybind11.h>
+namespace py = pybind11;
+
+#include <stdexcept>
+
+#include <tcl.h>
+#include <BasicAnalysisBuilder.h>
+
+static int
+analyze_model(py::object interpaddr, int steps, double dt, bool release_gil)
+{
+  Tcl_Interp *interp = static_cast<Tcl_Interp*>(PyLong_AsVoidPtr(interpaddr.ptr()));
+
+  Tcl_CmdInfo info;
+  if (Tcl_GetCommandInfo(interp, "analyze", &info) != 1 || info.clientData == nullptr)
+    throw std::runtime_error("The analysis commands are not available");
+  BasicAnalysisBuilder *analysis = static_cast<BasicAnalysisBuilder*>(info.clientData);
+
+  switch (analysis->CurrentAnalysisFlag) {
+    case BasicAnalysisBuilder::STATIC_ANALYSIS:
+      dt = 0.0;
+      break;
+    case BasicAnalysisBuilder::TRANSIENT_ANALYSIS:
+      if (dt <= 0.0)
+        throw std::invalid_argument("A transient analysis needs a positive time step");
+      break;
+    default:
+      throw std::runtime_error("No analysis type has been specified");
+  }
+
+  if (!release_gil)
+    return analysis->analyze(steps, dt);
+
+  py::gil_scoped_release release;
+  return analysis->analyze(steps, dt);
+}
+
+
+void
+init_analyze_module(py::module &m)
+{
+  m.def ("analyze", &analyze_model,
+    "Take steps of the current analysis of the model held by the interpreter\n"
+    "at interpaddr, with the GIL released if release_gil is true. Returns the\n"
+    "status of the analysis, as for the analyze command.",
+    py::arg("interpaddr"),
+    py::arg("steps"),
+    py::arg("dt") = 0.0,
+    py::arg("release_gil") = false
+  );
+}
@@ -0,0 +1,326 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Run one model under many ground motion records.
+//
+// The model is built once by the calling interpreter. Each record is then
+// analyzed by a child process that is forked from the caller, so that every
+// run starts from exactly the committed state of the parent (e.g., after a
+// gravity analysis) and all model data is shared copy-on-write between
+// workers. Response histories are written directly into a shared memory
+// buffer that is returned to Python as a NumPy array.
+//
+// On platforms without fork(), or with a single worker, the records are run
+// sequentially in-process; the committed state is saved to a snapshot
+// before the first record and restored after each one.
+//
+// The GIL is released while the workers are forked and waited for. The
+// model must not be used by other threads until the batch returns.
+//
+// Author: cmp
+//
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+namespace py = pybind11;
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+
+#if defined(_UNIX) || defined(__unix__) || defined(__APPLE__)
+#  define BATCH_USE_FORK
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/wait.h>
+#endif
+
+#include <tcl.h>
+#include <Domain.h>
+#include <Vector.h>
+#include <NodeData.h>
+#include <domain/loading/SharedPathSeries.h>
+#include <GroundMotion.h>
+#include <UniformExcitation.h>
+#include <BasicModelBuilder.h>
+#include <BasicAnalysisBuilder.h>
+#include <runtime/commands/analysis/snapshot.h>
+
+#define ARRAY_FLAGS py::array::c_style|py::array::forcecast
+
+// Tag given to the pattern that carries the record in each worker
+static constexpr int BatchPatternTag = 0x7FFF0001;
+
+struct BatchResponse {
+  int      node;
+  int      dof;
+  NodeData type;
+};
+
+struct BatchRecord {
+  const double *accel;
+  int           size;
+  double        dt;
+  double        scale;
+};
+
+//
+// Analyze a single record and write the selected responses to
+// output[step*nresp + j]. The dof is 0-based. Returns the number
+// of completed steps.
+//
+static int
+run_record(BasicAnalysisBuilder& analysis,
+           Domain& domain,
+           const BatchRecord& record,
+           int dof,
+           int num_steps,
+           const std::vector<BatchResponse>& responses,
+           double* output)
+{
+  const int nresp = static_cast<int>(responses.size());
+
+  // The record outlives the pattern, so it is referred to without copying
+  auto path = SharedPathSeries::Borrow(record.accel, record.size, nullptr);
+  if (path == nullptr)
+    return 0;
+  TimeSeries *series = new SharedPathSeries(BatchPatternTag, path, record.dt, record.scale,
+                                            false, false, domain.getCurrentTime());
+  GroundMotion *motion = new GroundMotion(nullptr, nullptr, series, nullptr);
+  UniformExcitation *pattern = new UniformExcitation(*motion, dof, BatchPatternTag, 0.0, 1.0);
+
+  if (domain.addLoadPattern(pattern) == false) {
+    delete pattern;
+    return 0;
+  }
+
+  if (analysis.domainChanged() < 0) {
+    delete domain.removeLoadPattern(BatchPatternTag);
+    return 0;
+  }
+
+  int step = 0;
+  for ( ; step < num_steps; step++) {
+    if (analysis.analyze(1, record.dt) < 0)
+      break;
+
+    double *row = output + static_cast<size_t>(step)*nresp;
+    for (int j=0; j<nresp; j++) {
+      const Vector *data = domain.getNodeResponse(responses[j].node, responses[j].type);
+      row[j] = (data != nullptr && responses[j].dof >= 0 && responses[j].dof < data->Size())
+             ? (*data)(responses[j].dof)
+             : NAN;
+    }
+  }
+
+  delete domain.removeLoadPattern(BatchPatternTag);
+  return step;
+}
+
+
+static py::tuple
+run_batch(py::object interpaddr,
+          std::vector<py::array_t<double, ARRAY_FLAGS>> records,
+          py::object time_step,
+          py::object scale,
+          std::vector<std::tuple<int,int,std::string>> response,
+          int dof,
+          int num_steps,
+          int workers)
+{
+  Tcl_Interp *interp = static_cast<Tcl_Interp*>(PyLong_AsVoidPtr(interpaddr.ptr()));
+
+  Tcl_CmdInfo info;
+  if (Tcl_GetCommandInfo(interp, "analyze", &info) != 1 || info.clientData == nullptr)
+    throw std::runtime_error("No analysis has been configured");
+  BasicAnalysisBuilder *analysis = static_cast<BasicAnalysisBuilder*>(info.clientData);
+
+  BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(
+      Tcl_GetAssocData(interp, "OPS::theBasicModelBuilder", nullptr));
+  if (builder == nullptr)
+    throw std::runtime_error("No model has been defined");
+
+  // dof is 1-based to match the Tcl interface
+  if (dof < 1 || dof > builder->getNDF())
+    throw std::invalid_argument("dof must be between 1 and the ndf of the model");
+  dof -= 1;
+
+  if (analysis->CurrentAnalysisFlag != BasicAnalysisBuilder::TRANSIENT_ANALYSIS)
+    throw std::runtime_error("A Transient analysis must be configured before running records");
+
+  Domain *domain = analysis->getDomain();
+
+  //
+  // Collect records; time_step and scale may be scalars or sequences
+  //
+  const int nrec = static_cast<int>(records.size());
+  std::vector<double> steps  = py::isinstance<py::sequence>(time_step)
+                             ? time_step.cast<std::vector<double>>()
+                             : std::vector<double>(nrec, time_step.cast<double>());
+  std::vector<double> scales = py::isinstance<py::sequence>(scale)
+                             ? scale.cast<std::vector<double>>()
+                             : std::vector<double>(nrec, scale.cast<double>());
+  if (static_cast<int>(steps.size()) != nrec || static_cast<int>(scales.size()) != nrec)
+    throw std::invalid_argument("time_step and scale must have one entry per record");
+
+  std::vector<BatchRecord> runs(nrec);
+  for (int i=0; i<nrec; i++) {
+    py::buffer_info buffer = records[i].request();
+    runs[i].accel = static_cast<const double*>(buffer.ptr);
+    runs[i].size  = static_cast<int>(buffer.shape[0]);
+    runs[i].dt    = steps[i];
+    runs[i].scale = scales[i];
+  }
+
+  if (num_steps <= 0)
+    for (const BatchRecord& run : runs)
+      num_steps = std::max(num_steps, run.size);
+
+  std::vector<BatchResponse> responses;
+  for (auto& [node, node_dof, type] : response) {
+    NodeData data;
+    if (type == "displ")       data = NodeData::Disp;
+    else if (type == "veloc")  data = NodeData::Vel;
+    else if (type == "accel")  data = NodeData::Accel;
+    else if (type == "react")  data = NodeData::Reaction;
+    else
+      throw std::invalid_argument("Unknown response type '" + type + "'");
+    // dof is 1-based to match the Tcl interface
+    if (node_dof < 1 || node_dof > builder->getNDF())
+      throw std::invalid_argument("response dof must be between 1 and the ndf of the model");
+    responses.push_back({node, node_dof-1, data});
+  }
+
+  const int    nresp = static_cast<int>(responses.size());
+  const size_t count = static_cast<size_t>(nrec)*num_steps*nresp;
+
+  py::array_t<double> histories({nrec, num_steps, nresp});
+  py::array_t<int>    completed(nrec);
+  double *history_ptr   = static_cast<double*>(histories.request().ptr);
+  int    *completed_ptr = static_cast<int*>(completed.request().ptr);
+
+#ifdef BATCH_USE_FORK
+  if (workers > 1 && nrec > 1) {
+    //
+    // Workers write into anonymous shared memory; it is copied into the
+    // NumPy arrays once all children have exited.
+    //
+    size_t bytes = count*sizeof(double) + nrec*sizeof(int);
+    void *shared = mmap(nullptr, bytes, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED)
+      throw std::runtime_error("Failed to allocate shared memory for batch results");
+
+    double *shared_history   = static_cast<double*>(shared);
+    int    *shared_completed = reinterpret_cast<int*>(shared_history + count);
+    std::fill(shared_history, shared_history + count, NAN);
+    std::fill(shared_completed, shared_completed + nrec, 0);
+
+    fflush(stdout);
+    fflush(stderr);
+
+    {
+      py::gil_scoped_release release;
+
+      // Workers are waited for in the order they were started, so that
+      // children forked elsewhere in the process are left alone. A worker
+      // that does not exit normally has its record reported as failed,
+      // whatever it wrote before.
+      std::vector<pid_t> pids(nrec, -1);
+      int oldest = 0;
+      auto reap = [&]() {
+        while (oldest < nrec && pids[oldest] < 0)
+          oldest++;
+        if (oldest == nrec)
+          return;
+        int status;
+        if (waitpid(pids[oldest], &status, 0) != pids[oldest]
+            || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+          shared_completed[oldest] = -1;
+        pids[oldest++] = -1;
+      };
+
+      int running = 0;
+      for (int i=0; i<nrec; i++) {
+        if (running == workers) {
+          reap();
+          running--;
+        }
+
+        pid_t pid = fork();
+        if (pid == 0) {
+          // Child: no Python API may be used past this point
+          shared_completed[i] = run_record(*analysis, *domain, runs[i], dof, num_steps, responses,
+                                           shared_history + static_cast<size_t>(i)*num_steps*nresp);
+          _exit(0);
+        }
+        else if (pid < 0) {
+          // Could not fork; the parent state must not be modified, so
+          // the record is reported as failed
+          shared_completed[i] = -1;
+          continue;
+        }
+        pids[i] = pid;
+        running++;
+      }
+      for (; running > 0; running--)
+        reap();
+    }
+
+    memcpy(history_ptr,   shared_history,   count*sizeof(double));
+    memcpy(completed_ptr, shared_completed, nrec*sizeof(int));
+    munmap(shared, bytes);
+
+    return py::make_tuple(histories, completed);
+  }
+#endif
+
+  //
+  // Sequential fallback; every record starts from the committed state
+  // at the time of the call, as it does in a forked worker.
+  //
+  std::filesystem::path snapshot = std::filesystem::temp_directory_path()
+        / ("opensees-batch-" + std::to_string(std::random_device{}()) + ".bin");
+
+  if (saveSnapshot(*analysis, snapshot.string().c_str()) < 0)
+    throw std::runtime_error("Failed to save the state of the model");
+
+  std::fill(history_ptr, history_ptr + count, NAN);
+  for (int i=0; i<nrec; i++) {
+    completed_ptr[i] = run_record(*analysis, *domain, runs[i], dof, num_steps, responses,
+                                  history_ptr + static_cast<size_t>(i)*num_steps*nresp);
+    if (restoreSnapshot(*analysis, snapshot.string().c_str()) < 0) {
+      std::filesystem::remove(snapshot);
+      throw std::runtime_error("Failed to restore the state of the model");
+    }
+  }
+  std::filesystem::remove(snapshot);
+
+  return py::make_tuple(histories, completed);
+}
+
+
+void
+init_batch_module(py::module &m)
+{
+  m.def ("run_batch", &run_batch,
+    "Analyze the current model under a set of uniform excitation records.\n"
+    "Returns an array of shape (records, steps, responses) and the number\n"
+    "of steps completed for each record.",
+    py::arg("interpaddr"),
+    py::arg("records"),
+    py::arg("time_step"),
+    py::arg("scale")     = 1.0,
+    py::arg("response")  = std::vector<std::tuple<int,int,std::string>>{},
+    py::arg("dof")       = 1,
+    py::arg("num_steps") = 0,
+    py::arg("workers")   = 1
+  );
+}
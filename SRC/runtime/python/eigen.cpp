@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Mode shapes of the current model as NumPy arrays.
+//
+// The modes are found by the shift-invert Lanczos solver of the analysis
+// builder, and only the requested modes are copied out, in equation
+// numbering, together with the node and dof of every equation.
+//
+// Author: cmp
+//
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+namespace py = pybind11;
+
+#include <stdexcept>
+#include <vector>
+
+#include <tcl.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <DOF_Group.h>
+#include <ID.h>
+#include <Vector.h>
+#include <BasicAnalysisBuilder.h>
+#include <LanczosEigen.h>
+
+static py::tuple
+solve_modes(py::object interpaddr,
+            int num_modes,
+            double shift,
+            int ncv,
+            double tolerance,
+            int threads,
+            bool reuse)
+{
+  Tcl_Interp *interp = static_cast<Tcl_Interp*>(PyLong_AsVoidPtr(interpaddr.ptr()));
+
+  Tcl_CmdInfo info;
+  if (Tcl_GetCommandInfo(interp, "analyze", &info) != 1 || info.clientData == nullptr)
+    throw std::runtime_error("The analysis commands are not available");
+  BasicAnalysisBuilder *analysis = static_cast<BasicAnalysisBuilder*>(info.clientData);
+
+  if (num_modes < 1)
+    throw std::invalid_argument("At least one mode must be requested");
+
+  OpenSees::LanczosOptions options;
+  options.ncv       = ncv;
+  options.tolerance = tolerance;
+
+  int status;
+  {
+    py::gil_scoped_release release;
+    status = analysis->eigenLanczos(num_modes, shift, reuse, threads, options);
+  }
+  // -3 means only some modes converged; a warning has been printed and
+  // the converged ones are returned
+  if (status == -3 && analysis->getNumEigen() == 0)
+    throw std::runtime_error("No mode converged");
+  if (status < 0 && status != -3)
+    throw std::runtime_error("Eigenvalue analysis failed");
+
+  Domain *domain = analysis->getDomain();
+  const int nmode = analysis->getNumEigen();
+  const std::vector<double> &vectors = analysis->getLanczosVectors();
+  const int neq = nmode > 0 ? static_cast<int>(vectors.size()/nmode) : 0;
+
+  py::array_t<double> values(nmode);
+  const Vector &eigenvalues = domain->getEigenvalues();
+  double *value_ptr = values.mutable_data();
+  for (int i=0; i<nmode; i++)
+    value_ptr[i] = eigenvalues(i);
+
+  py::array_t<double> shapes({nmode, neq});
+  std::copy(vectors.begin(), vectors.end(), shapes.mutable_data());
+
+  // node tag and dof (1-based) of each equation
+  py::array_t<int> dofs({neq, 2});
+  int *dof_ptr = dofs.mutable_data();
+  std::fill(dof_ptr, dof_ptr + 2*neq, -1);
+  Node *node;
+  NodeIter &nodes = domain->getNodes();
+  while ((node = nodes()) != nullptr) {
+    DOF_Group *group = node->getDOF_GroupPtr();
+    if (group == nullptr)
+      continue;
+    const ID &id = group->getID();
+    for (int i=0; i<id.Size(); i++)
+      if (id(i) >= 0 && id(i) < neq) {
+        dof_ptr[2*id(i)]     = node->getTag();
+        dof_ptr[2*id(i) + 1] = i + 1;
+      }
+  }
+
+  return py::make_tuple(values, shapes, dofs);
+}
+
+
+void
+init_eigen_module(py::module &m)
+{
+  m.def ("solve_modes", &solve_modes,
+    "Find the modes of the current model with eigenvalues nearest shift by\n"
+    "shift-invert Lanczos. Returns the eigenvalues, an array of shape\n"
+    "(modes, equations) of mass-normalized shapes, and an array of shape\n"
+    "(equations, 2) with the node and dof of each equation.",
+    py::arg("interpaddr"),
+    py::arg("num_modes"),
+    py::arg("shift")     = 0.0,
+    py::arg("ncv")       = 0,
+    py::arg("tolerance") = 1.0e-10,
+    py::arg("threads")   = 1,
+    py::arg("reuse")     = false
+  );
+}
@@ -8,6 +8,8 @@
 //
 #include <assert.h>
 #include <stdio.h>
+#include <math.h>
+#include <algorithm>
 #include <unordered_map>
 
 #include "BasicAnalysisBuilder.h"
@@ -24,7 +26,11 @@
 #include <AnalysisModel.h>
 #include <TimeSeries.h>
 #include <LoadPattern.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
 #include <float.h>
+#include <Vector.h>
+#include <ID.h>
 
 // For eigen()
 #include <FE_EleIter.h>
@@ -32,6 +38,20 @@
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 
+// For analyzeModal()
+#include <Element.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <LoadPatternIter.h>
+#include <ElementalLoadIter.h>
+
+// For eigenLanczos()
+#include <memory>
+#include <classTags.h>
+#include <threads/thread_pool.hpp>
+#include "LanczosEigen.h"
+#include <utilities/spectrum.h>
+
 // Default concrete analysis classes
 #include <Newmark.h>
 #include <EigenSOE.h>
@@ -127,6 +147,11 @@ BasicAnalysisBuilder::wipe()
     delete theAnalysisModel;
     theAnalysisModel = new AnalysisModel();
   }
+  if (theModalBasis != nullptr) {
+    delete theModalBasis;
+    theModalBasis = nullptr;
+  }
+  lanczosVectors.clear();
 }
 
 void
@@ -226,6 +251,7 @@ BasicAnalysisBuilder::domainChanged(void)
   Domain *domain = this->getDomain();
   int stamp = domain->hasDomainChanged();
   domainStamp = stamp;
+  factoredStiffness = false;
 
   opsdbg << G3_DEBUG_PROMPT << "Domain changed\n";
 
@@ -331,6 +357,7 @@ int
 BasicAnalysisBuilder::analyzeStatic(int numSteps, int flag)
 {
   int result = 0;
+  factoredStiffness = false;
 
   for (int i=0; i<numSteps; i++) {
       // This is used for parallelization
@@ -383,7 +410,7 @@ BasicAnalysisBuilder::analyzeStatic(int numSteps, int flag)
       }
 
       if (theStaticIntegrator->shouldComputeAtEachStep()) {
-        result = theStaticIntegrator->computeSensitivities();
+        result = this->computeSensitivities(*theStaticIntegrator);
         if (result < 0) {
           opserr << "StaticAnalysis::analyze() - the SensitivityAlgorithm failed";
           opserr << " at step: " << i << " with domain at load factor ";
@@ -409,12 +436,20 @@ BasicAnalysisBuilder::analyzeStatic(int numSteps, int flag)
       }
   }
 
+  // Newton and Linear leave the tangent of their last iteration factored
+  if (numSteps > 0 && (flag & Iterate) && theAlgorithm != nullptr) {
+    const int tag = theAlgorithm->getClassTag();
+    factoredStiffness = tag == EquiALGORITHM_TAGS_NewtonRaphson
+                     || tag == EquiALGORITHM_TAGS_Linear;
+  }
+
   return 0;
 }
 
 int
 BasicAnalysisBuilder::analyzeTransient(int numSteps, double dT)
 {
+  factoredStiffness = false;
   int result = 0;
 
   for (int i=0; i<numSteps; i++) {
@@ -494,7 +529,7 @@ BasicAnalysisBuilder::analyzeStep(double dT)
   }
 
   if (theTransientIntegrator->shouldComputeAtEachStep()) {
-    result = theTransientIntegrator->computeSensitivities();
+    result = this->computeSensitivities(*theTransientIntegrator);
     if (result < 0) {
       opserr << "TransientAnalysis::analyze() - the SensitivityAlgorithm failed";
       opserr << " at time " << theDomain->getCurrentTime() << "\n";
@@ -633,6 +668,704 @@ BasicAnalysisBuilder::analyzeVariable(int numSteps, double dT, double dtMin, dou
 }
 
 
+//
+// Estimate the local truncation error of the step that has just been
+// solved (but not yet committed). The predictor is the explicit Taylor
+// expansion from the committed state,
+//
+//   u_p = u_n + dt v_n + dt^2/2 a_n
+//
+// For a Newmark-type corrector u_{n+1} - u_p = beta dt^2 (a_{n+1} - a_n),
+// and the leading error term is (beta - 1/6) dt^2 (a_{n+1} - a_n)
+// (Zienkiewicz & Xie, 1991), so the predictor/corrector difference scaled
+// by (1 - 1/(6 beta)) is an embedded error estimate. The factor is taken
+// for average acceleration (beta = 1/4).
+//
+// The integrator is not asked for its beta; instead the ratio of
+// u_{n+1} - u_p to dt^2 (a_{n+1} - a_n) is fitted over all equations and
+// returned in beta. It is negative when the accelerations have not
+// changed enough for the ratio to be meaningful.
+//
+// Returns the weighted RMS norm of the estimate; no storage is allocated.
+//
+double
+BasicAnalysisBuilder::estimateStepError(double dT, const StepControl& control, double& beta)
+{
+  constexpr double scale = 1.0/3.0;
+
+  double sum = 0.0;
+  int    num = 0;
+
+  // least squares fit of beta, and the size of the acceleration change
+  double sumDQ = 0.0, sumQQ = 0.0;
+  double maxDa = 0.0, maxA  = 0.0;
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != nullptr) {
+    const ID     &id = dofPtr->getID();
+    const Vector &u  = dofPtr->getTrialDisp();
+    const Vector &un = dofPtr->getCommittedDisp();
+    const Vector &vn = dofPtr->getCommittedVel();
+    const Vector &an = dofPtr->getCommittedAccel();
+    const Vector &a  = dofPtr->getTrialAccel();
+
+    for (int i=0; i<id.Size(); i++) {
+      if (id(i) < 0)
+        continue;
+
+      double up  = un(i) + dT*vn(i) + 0.5*dT*dT*an(i);
+      double err = scale*(u(i) - up);
+      double w   = control.atol + control.rtol*std::max(fabs(u(i)), fabs(un(i)));
+      sum += (err/w)*(err/w);
+      num++;
+
+      double q = dT*dT*(a(i) - an(i));
+      sumDQ += (u(i) - up)*q;
+      sumQQ += q*q;
+      maxDa  = std::max(maxDa, fabs(a(i) - an(i)));
+      maxA   = std::max(maxA, std::max(fabs(a(i)), fabs(an(i))));
+    }
+  }
+
+  beta = (sumQQ > 0.0 && maxDa > 1.0e-6*maxA) ? sumDQ/sumQQ : -1.0;
+
+  if (num == 0)
+    return 0.0;
+
+  return sqrt(sum/num);
+}
+
+//
+// Integrate over the interval [t, t+duration] with a step size selected
+// by a PI controller acting on the embedded error estimate computed
+// by estimateStepError(). Rejected steps are reverted and retried
+// with a smaller step; every attempt is appended to stepHistory, which
+// keeps the last StepControl::maxHistory of them.
+//
+// The estimate is only valid for the Newmark average acceleration rule,
+// so the analysis stops with an error if the first step that changes
+// the accelerations does not follow it.
+//
+int
+BasicAnalysisBuilder::analyzeAdaptive(double duration, double dT, const StepControl& control)
+{
+  // The estimate is O(dt^3); exponents follow Gustafsson's PI controller
+  constexpr double order = 3.0;
+  constexpr double kI    = 0.7/order;
+  constexpr double kP    = 0.4/order;
+
+  const double dtMax = control.dtMax > 0.0 ? control.dtMax : duration;
+  const double dtMin = control.dtMin > 0.0 ? control.dtMin : DBL_EPSILON*duration;
+
+  double currentDt = std::min(std::max(dT, dtMin), dtMax);
+  double elapsed   = 0.0;
+  double lastError = 1.0;
+  int    numReject = 0;
+  bool   checkedBeta = false;
+
+  while (duration - elapsed > DBL_EPSILON*duration) {
+
+    // do not step past the end of the requested interval
+    double stepDt = std::min(currentDt, duration - elapsed);
+    double startTime = theDomain->getCurrentTime();
+
+    // TODO: Need to remove global timestep variable;
+    ops_Dt = stepDt;
+
+    if (theAnalysisModel->analysisStep(stepDt) < 0) {
+      opserr << G3_ERROR_PROMPT << "the AnalysisModel failed";
+      opserr << " at time " << theDomain->getCurrentTime() << "\n";
+      theDomain->revertToLastCommit();
+      return -2;
+    }
+
+    int stamp = theDomain->hasDomainChanged();
+    if (stamp != domainStamp) {
+      domainStamp = stamp;
+      if (this->domainChanged() < 0) {
+        opserr << G3_ERROR_PROMPT << "domainChanged() failed\n";
+        return -1;
+      }
+    }
+
+    int result = 0;
+    if (theTransientIntegrator->newStep(stepDt) < 0)
+      result = -2;
+
+    if (result >= 0 && theAlgorithm->solveCurrentStep() < 0)
+      result = -3;
+
+    int    numIter = theTest != nullptr ? theTest->getNumTests() : 1;
+    double error   = -1.0;
+    if (result >= 0) {
+      double beta;
+      error = this->estimateStepError(stepDt, control, beta);
+      if (!checkedBeta && beta >= 0.0) {
+        if (fabs(beta - 0.25) > 1.0e-6) {
+          opserr << G3_ERROR_PROMPT << "adaptive time stepping requires a Newmark "
+                 << "integrator with beta = 1/4; the current integrator "
+                 << "follows beta = " << beta << "\n";
+          theDomain->revertToLastCommit();
+          theTransientIntegrator->revertToLastStep();
+          return -6;
+        }
+        checkedBeta = true;
+      }
+    }
+
+    bool accept = (result >= 0) && (error <= 1.0 || stepDt <= dtMin);
+
+    if (accept && theTransientIntegrator->shouldComputeAtEachStep()) {
+      if (this->computeSensitivities(*theTransientIntegrator) < 0) {
+        opserr << G3_ERROR_PROMPT << "the SensitivityAlgorithm failed";
+        opserr << " at time " << theDomain->getCurrentTime() << "\n";
+        theDomain->revertToLastCommit();
+        theTransientIntegrator->revertToLastStep();
+        return -5;
+      }
+    }
+
+    if (accept && theTransientIntegrator->commit() < 0) {
+      result = -4;
+      accept = false;
+    }
+
+    if (control.maxHistory > 0) {
+      while (stepHistory.size() >= static_cast<std::size_t>(control.maxHistory))
+        stepHistory.pop_front();
+      stepHistory.push_back({startTime, stepDt, error, numIter, accept});
+    }
+
+    if (accept) {
+      elapsed  += stepDt;
+      numReject = 0;
+
+      // PI step size control
+      double e   = std::max(error, 1.0e-10);
+      double fac = control.safety * pow(e, -kI) * pow(lastError, kP);
+      fac = std::min(control.facMax, std::max(control.facMin, fac));
+      lastError = e;
+
+      // Only grow from the nominal step; a step truncated to hit the
+      // end of the interval says nothing about the admissible size
+      currentDt = std::min(dtMax, std::max(dtMin, currentDt*fac));
+      continue;
+    }
+
+    //
+    // Step rejected; restore the committed state and retry
+    //
+    theDomain->revertToLastCommit();
+    theTransientIntegrator->revertToLastStep();
+
+    if (stepDt <= dtMin || ++numReject > control.maxReject) {
+      opserr << G3_ERROR_PROMPT << "adaptive time stepping failed at time "
+             << theDomain->getCurrentTime() << " with step " << stepDt << "\n";
+      return result < 0 ? result : -3;
+    }
+
+    double fac;
+    if (result < 0)
+      // no error estimate is available when the solution fails
+      fac = 0.25;
+    else
+      fac = std::max(control.facMin, control.safety*pow(error, -1.0/order));
+
+    currentDt = std::max(dtMin, std::min(fac, 1.0)*stepDt);
+  }
+
+  return 0;
+}
+
+
+//
+// Modal superposition
+//
+// The response is u = u0 + Phi q, where u0 is the displacement of a
+// reference state and Phi holds the first numModes eigenvectors of
+// (K, M) formed at that state. Each modal coordinate obeys
+//
+//   q_j'' + 2 zeta_j w_j q_j' + w_j^2 q_j = phi_j' (P(t) - R0 - f_nl)/m_j
+//
+// where R0 is the resisting force of the reference state and m_j the
+// generalized mass. With the load linear over a step the equations are
+// integrated exactly (Nigam & Jennings, 1969); overdamped modes, and
+// modes too slow for the exact coefficients to be accurate, use the
+// average acceleration rule.
+//
+// f_nl are the pseudo-forces R_e(u) - R_e0 - K_e (u - u0) of the
+// elements listed as nonlinear (Wilson's fast nonlinear analysis). They
+// are found by fixed-point iteration on each step; only these elements
+// are updated unless all the elements are to be recovered.
+//
+struct BasicAnalysisBuilder::ModalBasis {
+  struct Subregion {
+    Element *element;
+    ID       id;        // equation numbers of the element dofs, -1 if fixed
+    Matrix   K;         // tangent at the state the modes were formed for
+    Vector   R0;        // resisting force at the reference state
+  };
+
+  int    stamp;         // domain stamp the basis was formed for
+  int    numEqn;
+  int    numModes;
+  std::vector<double> ratios;   // damping as given
+  std::vector<int>    tags;     // nonlinear elements as given
+
+  std::vector<double> phi;      // mode shapes, numModes x numEqn
+  std::vector<double> mphi;     // M phi, numModes x numEqn
+  std::vector<double> mass;     // generalized masses
+  std::vector<double> omega;
+  std::vector<double> zeta;
+
+  std::vector<Subregion>  region;
+  std::vector<DOF_Group*> regionDofs;
+
+  // reference state
+  std::vector<double> u0;
+  std::vector<double> R0;
+
+  // committed modal state
+  double time;
+  std::vector<double> q, qd;
+  std::vector<double> p;        // modal load per unit mass
+  std::vector<double> pnl;      // part of p due to the pseudo-forces
+
+  // recurrence q_n+1 = c0 q + c1 q' + c4 p_n + c5 p_n+1,
+  //          q'_n+1 = c2 q + c3 q' + c6 p_n + c7 p_n+1
+  double dt;
+  std::vector<double> coef;     // 8 per mode
+};
+
+//
+// Solve the eigenvalue problem and form the generalized masses and the
+// nonlinear subregion. The reference state is set by setModalReference().
+//
+int
+BasicAnalysisBuilder::formModalBasis(const ModalControl& control)
+{
+  delete theModalBasis;
+  theModalBasis = nullptr;
+
+  const int numModes = control.numModes;
+
+  if (theEigenSOE == nullptr)
+    this->newEigenAnalysis(EigenSOE_TAGS_ArpackSOE, 0.0);
+
+  if (this->eigen(numModes, true, true) < 0) {
+    opserr << G3_ERROR_PROMPT << "modal analysis failed to find " << numModes << " modes\n";
+    return -1;
+  }
+
+  ModalBasis *basis = new ModalBasis();
+  basis->stamp    = theDomain->hasDomainChanged();
+  basis->numEqn   = theEigenSOE->getEigenvector(1).Size();
+  basis->numModes = numModes;
+  basis->ratios   = control.damping;
+  basis->tags     = control.nonlinear;
+  basis->time     = 0.0;
+  basis->dt       = 0.0;
+
+  const int numEqn = basis->numEqn;
+  basis->phi.assign(numModes*numEqn, 0.0);
+  basis->mphi.assign(numModes*numEqn, 0.0);
+  basis->mass.assign(numModes, 0.0);
+  basis->omega.assign(numModes, 0.0);
+  basis->zeta.assign(numModes, 0.0);
+
+  for (int j = 0; j < numModes; j++) {
+    const Vector &shape = theEigenSOE->getEigenvector(j+1);
+    for (int i = 0; i < numEqn; i++)
+      basis->phi[j*numEqn + i] = shape(i);
+
+    const double lambda = theEigenSOE->getEigenvalue(j+1);
+    basis->omega[j] = lambda > 0.0 ? sqrt(lambda) : 0.0;
+
+    if (control.damping.size() == 1)
+      basis->zeta[j] = control.damping[0];
+    else if ((int)control.damping.size() > j)
+      basis->zeta[j] = control.damping[j];
+  }
+
+  //
+  // M phi, assembled as in eigen()
+  //
+  auto addMass = [basis, numModes, numEqn](const Matrix &M, const ID &id) {
+    for (int a = 0; a < id.Size(); a++) {
+      if (id(a) < 0)
+        continue;
+      for (int b = 0; b < id.Size(); b++) {
+        if (id(b) < 0 || M(a,b) == 0.0)
+          continue;
+        for (int j = 0; j < numModes; j++)
+          basis->mphi[j*numEqn + id(a)] += M(a,b)*basis->phi[j*numEqn + id(b)];
+      }
+    }
+  };
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theAnalysisModel->getFEs();
+  while ((elePtr = theEles()) != nullptr) {
+    elePtr->zeroTangent();
+    elePtr->addMtoTang(1.0);
+    addMass(elePtr->getTangent(0), elePtr->getID());
+  }
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != nullptr) {
+    dofPtr->zeroTangent();
+    dofPtr->addMtoTang(1.0);
+    addMass(dofPtr->getTangent(0), dofPtr->getID());
+  }
+
+  for (int j = 0; j < numModes; j++) {
+    double m = 0.0;
+    for (int i = 0; i < numEqn; i++)
+      m += basis->phi[j*numEqn + i]*basis->mphi[j*numEqn + i];
+    if (m <= 0.0) {
+      opserr << G3_ERROR_PROMPT << "mode " << j+1 << " has no mass\n";
+      delete basis;
+      return -1;
+    }
+    basis->mass[j] = m;
+  }
+
+  //
+  // Nonlinear subregion
+  //
+  for (int tag : control.nonlinear) {
+    Element *theEle = theDomain->getElement(tag);
+    if (theEle == nullptr) {
+      opserr << G3_ERROR_PROMPT << "nonlinear element " << tag << " not found\n";
+      delete basis;
+      return -1;
+    }
+
+    const Vector &R = theEle->getResistingForce();
+    ID id(R.Size());
+    int loc = 0;
+    Node **nodes = theEle->getNodePtrs();
+    for (int n = 0; n < theEle->getNumExternalNodes(); n++) {
+      DOF_Group *group = nodes[n]->getDOF_GroupPtr();
+      const ID &nodeID = group->getID();
+      if (nodeID.Size() != nodes[n]->getNumberDOF()) {
+        opserr << G3_ERROR_PROMPT << "nonlinear element " << tag
+               << " is connected to a constrained node; use the Plain or Penalty handler\n";
+        delete basis;
+        return -1;
+      }
+      for (int i = 0; i < nodeID.Size() && loc < id.Size(); i++)
+        id(loc++) = nodeID(i);
+
+      if (std::find(basis->regionDofs.begin(), basis->regionDofs.end(), group) == basis->regionDofs.end())
+        basis->regionDofs.push_back(group);
+    }
+
+    basis->region.push_back({theEle, id, theEle->getTangentStiff(), R});
+  }
+
+  theModalBasis = basis;
+  return 0;
+}
+
+//
+// Take the committed state of the domain as the reference state; the
+// modal coordinates start from zero, with the modal velocities the
+// projection of the committed velocities.
+//
+int
+BasicAnalysisBuilder::setModalReference()
+{
+  ModalBasis &basis = *theModalBasis;
+  const int numEqn   = basis.numEqn;
+  const int numModes = basis.numModes;
+
+  basis.u0.assign(numEqn, 0.0);
+  basis.R0.assign(numEqn, 0.0);
+  basis.time = theDomain->getCurrentTime();
+  basis.q.assign(numModes, 0.0);
+  basis.qd.assign(numModes, 0.0);
+  basis.p.assign(numModes, 0.0);
+  basis.pnl.assign(numModes, 0.0);
+
+  std::vector<double> v(numEqn, 0.0);
+  std::vector<double> P(numEqn, 0.0);
+
+  theAnalysisModel->applyLoadDomain(basis.time);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != nullptr) {
+    const ID     &id = dofPtr->getID();
+    const Vector &un = dofPtr->getCommittedDisp();
+    const Vector &vn = dofPtr->getCommittedVel();
+    dofPtr->zeroUnbalance();
+    dofPtr->addPtoUnbalance(1.0);
+    const Vector &Pn = dofPtr->getUnbalance(nullptr);
+    for (int i = 0; i < id.Size(); i++)
+      if (id(i) >= 0) {
+        basis.u0[id(i)] = un(i);
+        v[id(i)] = vn(i);
+        P[id(i)] = Pn(i);
+      }
+  }
+
+  // the residual of an FE_Element is minus the resisting force
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theAnalysisModel->getFEs();
+  while ((elePtr = theEles()) != nullptr) {
+    elePtr->zeroResidual();
+    elePtr->addRtoResidual(1.0);
+    const Vector &r  = elePtr->getResidual(nullptr);
+    const ID     &id = elePtr->getID();
+    for (int i = 0; i < id.Size(); i++)
+      if (id(i) >= 0)
+        basis.R0[id(i)] -= r(i);
+  }
+
+  for (auto &part : basis.region)
+    part.R0 = part.element->getResistingForce();
+
+  for (int j = 0; j < numModes; j++) {
+    const double *phi  = &basis.phi[j*numEqn];
+    const double *mphi = &basis.mphi[j*numEqn];
+    double mv = 0.0, pj = 0.0;
+    for (int i = 0; i < numEqn; i++) {
+      mv += mphi[i]*v[i];
+      pj += phi[i]*(P[i] - basis.R0[i]);
+    }
+    basis.qd[j] = mv/basis.mass[j];
+    basis.p[j]  = pj/basis.mass[j];
+  }
+
+  return 0;
+}
+
+int
+BasicAnalysisBuilder::analyzeModal(int numSteps, double dT, const ModalControl& control)
+{
+  if (control.numModes < 1) {
+    opserr << G3_ERROR_PROMPT << "modal analysis needs at least one mode\n";
+    return -1;
+  }
+
+  //
+  // The basis is kept between calls and formed again when the domain
+  // or the options change; the reference state is reset when the domain
+  // has been moved by another analysis since the last modal step.
+  //
+  bool reset = false;
+  if (theModalBasis == nullptr
+      || theModalBasis->stamp    != theDomain->hasDomainChanged()
+      || theModalBasis->numModes != control.numModes
+      || theModalBasis->ratios   != control.damping
+      || theModalBasis->tags     != control.nonlinear) {
+
+    if (this->formModalBasis(control) < 0)
+      return -1;
+    reset = true;
+
+    LoadPattern *thePattern;
+    LoadPatternIter &thePatterns = theDomain->getLoadPatterns();
+    while ((thePattern = thePatterns()) != nullptr) {
+      ElementalLoadIter &theEleLoads = thePattern->getElementalLoads();
+      if (theEleLoads() != nullptr) {
+        opserr << G3_WARN_PROMPT << "modal analysis keeps elemental loads at their value at time "
+               << theDomain->getCurrentTime() << "\n";
+        break;
+      }
+    }
+  }
+
+  ModalBasis &basis = *theModalBasis;
+  if (reset || theDomain->getCurrentTime() != basis.time)
+    this->setModalReference();
+
+  const int numEqn   = basis.numEqn;
+  const int numModes = basis.numModes;
+
+  if (basis.dt != dT) {
+    basis.dt = dT;
+    basis.coef.resize(8*numModes);
+    for (int j = 0; j < numModes; j++)
+      OpenSees::sdof_step_coefficients(basis.omega[j], basis.zeta[j], dT, &basis.coef[8*j]);
+  }
+
+  std::vector<double> P(numEqn);
+  std::vector<double> pext(numModes), pn1(numModes), pnl(numModes);
+  std::vector<double> q1(numModes), qd1(numModes);
+  Vector u(numEqn), v(numEqn), a(numEqn);
+
+  for (int step = 0; step < numSteps; step++) {
+
+    // TODO: Need to remove global timestep variable;
+    ops_Dt = dT;
+
+    if (theAnalysisModel->analysisStep(dT) < 0) {
+      opserr << G3_ERROR_PROMPT << "the AnalysisModel failed";
+      opserr << " at time " << theDomain->getCurrentTime() << "\n";
+      theDomain->revertToLastCommit();
+      return -2;
+    }
+
+    //
+    // Modal loads
+    //
+    theAnalysisModel->applyLoadDomain(basis.time + dT);
+
+    DOF_Group *dofPtr;
+    DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+    while ((dofPtr = theDofs()) != nullptr) {
+      const ID &id = dofPtr->getID();
+      dofPtr->zeroUnbalance();
+      dofPtr->addPtoUnbalance(1.0);
+      const Vector &Pn = dofPtr->getUnbalance(nullptr);
+      for (int i = 0; i < id.Size(); i++)
+        if (id(i) >= 0)
+          P[id(i)] = Pn(i) - basis.R0[id(i)];
+    }
+
+    for (int j = 0; j < numModes; j++) {
+      const double *phi = &basis.phi[j*numEqn];
+      double pj = 0.0;
+      for (int i = 0; i < numEqn; i++)
+        pj += phi[i]*P[i];
+      pext[j] = pj/basis.mass[j];
+      pnl[j]  = basis.pnl[j];
+    }
+
+    //
+    // Integrate, iterating on the pseudo-forces of the nonlinear elements
+    //
+    bool converged = false;
+    for (int iter = 0; iter < control.maxIter && !converged; iter++) {
+      for (int j = 0; j < numModes; j++) {
+        const double *c = &basis.coef[8*j];
+        pn1[j] = pext[j] + pnl[j];
+        q1[j]  = c[0]*basis.q[j] + c[1]*basis.qd[j] + c[4]*basis.p[j] + c[5]*pn1[j];
+        qd1[j] = c[2]*basis.q[j] + c[3]*basis.qd[j] + c[6]*basis.p[j] + c[7]*pn1[j];
+      }
+
+      if (basis.region.empty()) {
+        converged = true;
+        break;
+      }
+
+      // displace the nodes of the subregion
+      for (DOF_Group *group : basis.regionDofs) {
+        const ID &id = group->getID();
+        for (int i = 0; i < id.Size(); i++) {
+          const int eq = id(i);
+          if (eq < 0)
+            continue;
+          double ui = basis.u0[eq];
+          for (int j = 0; j < numModes; j++)
+            ui += basis.phi[j*numEqn + eq]*q1[j];
+          u(eq) = ui;
+        }
+        group->setNodeDisp(u);
+      }
+
+      // modal pseudo-forces
+      double change = 0.0, size = 0.0;
+      for (int j = 0; j < numModes; j++)
+        size = std::max(size, fabs(pn1[j]));
+
+      std::vector<double> pnew(numModes, 0.0);
+      for (auto &part : basis.region) {
+        if (part.element->update() < 0) {
+          opserr << G3_ERROR_PROMPT << "nonlinear element " << part.element->getTag()
+                 << " failed to update at time " << basis.time + dT << "\n";
+          theDomain->revertToLastCommit();
+          return -3;
+        }
+        const Vector &R  = part.element->getResistingForce();
+        const ID     &id = part.id;
+        for (int k = 0; k < id.Size(); k++) {
+          if (id(k) < 0)
+            continue;
+          double f = R(k) - part.R0(k);
+          for (int l = 0; l < id.Size(); l++) {
+            if (id(l) < 0)
+              continue;
+            double du = 0.0;
+            for (int j = 0; j < numModes; j++)
+              du += basis.phi[j*numEqn + id(l)]*q1[j];
+            f -= part.K(k,l)*du;
+          }
+          for (int j = 0; j < numModes; j++)
+            pnew[j] -= basis.phi[j*numEqn + id(k)]*f;
+        }
+      }
+
+      for (int j = 0; j < numModes; j++) {
+        pnew[j] /= basis.mass[j];
+        change = std::max(change, fabs(pnew[j] - pnl[j]));
+        pnl[j] = pnew[j];
+      }
+
+      converged = change <= control.tolerance*std::max(size, 1.0);
+    }
+
+    if (!converged) {
+      opserr << G3_ERROR_PROMPT << "modal analysis failed to converge on the nonlinear elements"
+             << " at time " << basis.time + dT << "\n";
+      theDomain->revertToLastCommit();
+      return -3;
+    }
+
+    //
+    // Recover the nodal response and commit
+    //
+    for (int i = 0; i < numEqn; i++) {
+      double ui = basis.u0[i], vi = 0.0, ai = 0.0;
+      for (int j = 0; j < numModes; j++) {
+        const double phi = basis.phi[j*numEqn + i];
+        const double w   = basis.omega[j];
+        const double qdd = pn1[j] - 2.0*basis.zeta[j]*w*qd1[j] - w*w*q1[j];
+        ui += phi*q1[j];
+        vi += phi*qd1[j];
+        ai += phi*qdd;
+      }
+      u(i) = ui;
+      v(i) = vi;
+      a(i) = ai;
+    }
+
+    DOF_GrpIter &theGroups = theAnalysisModel->getDOFs();
+    while ((dofPtr = theGroups()) != nullptr) {
+      dofPtr->setNodeDisp(u);
+      dofPtr->setNodeVel(v);
+      dofPtr->setNodeAccel(a);
+    }
+
+    if (control.recover && theDomain->update() < 0) {
+      opserr << G3_ERROR_PROMPT << "the Domain failed to update at time "
+             << basis.time + dT << "\n";
+      theDomain->revertToLastCommit();
+      return -3;
+    }
+
+    if (theDomain->commit() < 0) {
+      opserr << G3_ERROR_PROMPT << "the Domain failed to commit at time "
+             << basis.time + dT << "\n";
+      return -4;
+    }
+
+    basis.time += dT;
+    for (int j = 0; j < numModes; j++) {
+      basis.q[j]   = q1[j];
+      basis.qd[j]  = qd1[j];
+      basis.p[j]   = pn1[j];
+      basis.pnl[j] = pnl[j];
+    }
+  }
+
+  return 0;
+}
+
 void
 BasicAnalysisBuilder::set(ConstraintHandler* obj)
 {
@@ -684,6 +1417,7 @@ BasicAnalysisBuilder::set(LinearSOE* obj, bool free)
   freeSOE = free;
 
   theSOE = obj;
+  factoredStiffness = false;
 
   this->setLinks(this->CurrentAnalysisFlag);
 
@@ -1016,6 +1750,176 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
   return 0;
 }
 
+//
+// Eigenvalues nearest the shift by shift-invert Lanczos. K - shift M is
+// assembled into the LinearSOE of the analysis and factored once; M is
+// kept in compressed rows, so no dense or banded eigen system is formed.
+//
+int
+BasicAnalysisBuilder::eigenLanczos(int numMode, double shift, bool reuse, int threads,
+                                   const OpenSees::LanczosOptions& control)
+{
+  assert(theAnalysisModel != nullptr);
+
+  if (theHandler == nullptr)
+    theHandler = new TransformationConstraintHandler();
+
+  if (this->CurrentAnalysisFlag == EMPTY_ANALYSIS)
+    this->CurrentAnalysisFlag = TRANSIENT_ANALYSIS;
+
+  this->fillDefaults(this->CurrentAnalysisFlag);
+  this->setLinks(this->CurrentAnalysisFlag);
+
+  int stamp = theDomain->hasDomainChanged();
+  if (stamp != domainStamp) {
+    if (this->domainChanged() < 0) {
+      opserr << G3_ERROR_PROMPT << "eigen - domainChanged() failed\n";
+      return -1;
+    }
+    reuse = false;
+  }
+
+  // Only a converged static step leaves K itself factored in the SOE
+  if (reuse && (this->CurrentAnalysisFlag != STATIC_ANALYSIS || !factoredStiffness || shift != 0.0)) {
+    opserr << G3_WARN_PROMPT << "eigen - the factorization can only be reused after a "
+           << "converged static step with Newton or Linear and with no shift; K is formed again\n";
+    reuse = false;
+  }
+
+  FE_Element *elePtr;
+  DOF_Group  *dofPtr;
+
+  if (!reuse) {
+    // the SOE now holds K - shift M
+    factoredStiffness = false;
+    theSOE->zeroA();
+
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != nullptr) {
+      elePtr->zeroTangent();
+      elePtr->addKtToTang(1.0);
+      if (shift != 0.0)
+        elePtr->addMtoTang(-shift);
+      if (theSOE->addA(elePtr->getTangent(0), elePtr->getID()) < 0) {
+        opserr << G3_ERROR_PROMPT << "eigen - failed in addA for ID " << elePtr->getID();
+        return -2;
+      }
+    }
+
+    if (shift != 0.0) {
+      DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+      while ((dofPtr = theDofs()) != nullptr) {
+        dofPtr->zeroTangent();
+        dofPtr->addMtoTang(-shift);
+        if (theSOE->addA(dofPtr->getTangent(0), dofPtr->getID()) < 0) {
+          opserr << G3_ERROR_PROMPT << "eigen - failed in addA for ID " << dofPtr->getID();
+          return -2;
+        }
+      }
+    }
+  }
+
+  //
+  // M in compressed rows
+  //
+  const int numEqn = theSOE->getNumEqn();
+  std::vector<int>    rows, cols;
+  std::vector<double> values;
+
+  auto addMass = [&](const Matrix &M, const ID &id) {
+    for (int a = 0; a < id.Size(); a++) {
+      if (id(a) < 0)
+        continue;
+      for (int b = 0; b < id.Size(); b++)
+        if (id(b) >= 0 && M(a,b) != 0.0) {
+          rows.push_back(id(a));
+          cols.push_back(id(b));
+          values.push_back(M(a,b));
+        }
+    }
+  };
+
+  FE_EleIter &theEles = theAnalysisModel->getFEs();
+  while ((elePtr = theEles()) != nullptr) {
+    elePtr->zeroTangent();
+    elePtr->addMtoTang(1.0);
+    addMass(elePtr->getTangent(0), elePtr->getID());
+  }
+
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != nullptr) {
+    dofPtr->zeroTangent();
+    dofPtr->addMtoTang(1.0);
+    addMass(dofPtr->getTangent(0), dofPtr->getID());
+  }
+
+  OpenSees::SparseSymmetric M;
+  M.assemble(numEqn, rows, cols, values);
+  rows.clear();
+  cols.clear();
+  values.clear();
+
+  //
+  // Solve
+  //
+  std::unique_ptr<OpenSees::thread_pool> pool;
+  if (threads != 1)
+    pool.reset(new OpenSees::thread_pool(threads > 0 ? threads : 0));
+
+  OpenSees::LanczosOptions options = control;
+  options.pool = pool.get();
+
+  // The solver refactors only when A has changed, so every solve after
+  // the first is a pair of triangular sweeps
+  Vector b(numEqn);
+  auto solve = [&](const double *x, double *y) -> int {
+    for (int i = 0; i < numEqn; i++)
+      b(i) = x[i];
+    theSOE->setB(b);
+    if (theSOE->solve() < 0)
+      return -1;
+    const Vector &X = theSOE->getX();
+    for (int i = 0; i < numEqn; i++)
+      y[i] = X(i);
+    return 0;
+  };
+
+  auto mass = [&](const double *x, double *y) -> int {
+    M.multiply(x, y, options.pool);
+    return 0;
+  };
+
+  std::vector<double> eigenvalues;
+  int numConverged = OpenSees::lanczos_eigen(numEqn, solve, mass, shift, numMode, options,
+                                             eigenvalues, lanczosVectors);
+  if (numConverged < 0) {
+    opserr << G3_ERROR_PROMPT << "eigen - the factorization of K - shift M failed\n";
+    lanczosVectors.clear();
+    return -4;
+  }
+
+  // Only converged modes are returned, nearest the shift first
+  const int numFound = numConverged;
+  if (numFound < numMode)
+    opserr << G3_WARN_PROMPT << "eigen - only the " << numFound << " of " << numMode
+           << " modes nearest the shift converged; increase -ncv, or the mass"
+           << " matrix may have rank " << numFound << "\n";
+
+  //
+  // Store the eigenvalues and eigenvectors in the model
+  //
+  theAnalysisModel->setNumEigenvectors(numFound);
+  Vector theEigenvalues(numFound);
+  for (int i = 0; i < numFound; i++) {
+    theEigenvalues[i] = eigenvalues[i];
+    theAnalysisModel->setEigenvector(i+1, Vector(&lanczosVectors[(size_t)i*numEqn], numEqn));
+  }
+  theAnalysisModel->setEigenvalues(theEigenvalues);
+  this->numEigen = numFound;
+
+  return numFound < numMode ? -3 : 0;
+}
+
 Domain*
 BasicAnalysisBuilder::getDomain()
 {
@@ -1058,3 +1962,64 @@ BasicAnalysisBuilder::formUnbalance()
     return -1;
 }
 
+
+//
+// Response sensitivity by the direct differentiation method. Each
+// parameter in turn has its right-hand side formed and solved against
+// the tangent factorized during the last iteration, and its sensitivity
+// saved and its history variables committed, so only one right-hand
+// side is held at a time. A parameter whose right-hand side is zero has
+// a zero displacement sensitivity and is not solved for.
+//
+int
+BasicAnalysisBuilder::computeSensitivities(Integrator& theIntegrator)
+{
+  if (theSOE == nullptr) {
+    opserr << OpenSees::PromptValueError << "no linear system of equations\n";
+    return -1;
+  }
+
+  ParameterIter &theParams = theDomain->getParameters();
+  Parameter *theParam;
+  while ((theParam = theParams()) != nullptr)
+    theParam->activate(false);
+
+  const int numEqn   = theSOE->getNumEqn();
+  const int numGrads = theDomain->getNumParameters();
+
+  theSOE->zeroB();
+  theIntegrator.formIndependentSensitivityRHS();
+
+  Vector zero(numEqn);
+  ParameterIter &paramIter = theDomain->getParameters();
+  while ((theParam = paramIter()) != nullptr) {
+    const int gradIndex = theParam->getGradIndex();
+    theParam->activate(true);
+
+    theSOE->zeroB();
+    if (theIntegrator.formSensitivityRHS(gradIndex) < 0) {
+      theParam->activate(false);
+      return -1;
+    }
+
+    const Vector &B = theSOE->getB();
+    bool active = false;
+    for (int i = 0; i < numEqn && !active; i++)
+      active = B(i) != 0.0;
+
+    if (active) {
+      if (theSOE->solve() < 0) {
+        theParam->activate(false);
+        return -2;
+      }
+      theIntegrator.saveSensitivity(theSOE->getX(), gradIndex, numGrads);
+    }
+    else
+      theIntegrator.saveSensitivity(zero, gradIndex, numGrads);
+
+    theIntegrator.commitSensitivity(gradIndex, numGrads);
+    theParam->activate(false);
+  }
+
+  return 0;
+}
@@ -27,8 +27,12 @@
 #ifndef BasicAnalysisBulider_h
 #define BasicAnalysisBulider_h
 
+#include <deque>
+#include <vector>
+
 class Domain;
 class G3_Table;
+class Integrator;
 class ConstraintHandler;
 class DOF_Numberer;
 class AnalysisModel;
@@ -38,6 +42,9 @@ class EigenSOE;
 class StaticIntegrator;
 class TransientIntegrator;
 class ConvergenceTest;
+namespace OpenSees {
+  struct LanczosOptions;
+}
 
 class BasicAnalysisBuilder
 {
@@ -57,6 +64,43 @@ public:
       Commit    = 1<<2
     };
 
+    // Parameters of the error-controlled time stepper used by
+    // analyzeAdaptive(). Tolerances apply to the weighted RMS norm
+    // of the local error estimate; a step is accepted when this
+    // norm is no larger than one.
+    struct StepControl {
+      double rtol    = 1.0e-3;
+      double atol    = 1.0e-6;
+      double dtMin   = 0.0;
+      double dtMax   = 0.0;     // <= 0 means no upper bound
+      double safety  = 0.9;
+      double facMin  = 0.2;
+      double facMax  = 5.0;
+      int    maxReject = 50;    // consecutive rejections before giving up
+      int    maxHistory = 10000;// step records kept; older ones are dropped
+    };
+
+    // One entry is recorded for every attempted step
+    struct StepRecord {
+      double time;              // time at the start of the step
+      double dt;
+      double error;             // normalized error; negative if the solve failed
+      int    iterations;
+      bool   accepted;
+    };
+
+    // Parameters of the modal superposition used by analyzeModal().
+    // Elements listed in nonlinear keep their own state determination
+    // and enter the modal equations as pseudo-forces.
+    struct ModalControl {
+      int    numModes  = 0;
+      std::vector<double> damping;   // one ratio for all modes, or one per mode
+      std::vector<int>    nonlinear; // element tags
+      bool   recover   = false;      // update all the elements every step
+      double tolerance = 1.0e-8;     // on the pseudo-forces
+      int    maxIter   = 25;
+    };
+
     void set(ConstraintHandler* obj);
     void set(DOF_Numberer* obj);
     void set(EquiSolnAlgo* obj);
@@ -79,6 +123,15 @@ public:
     void newEigenAnalysis(int typeSolver, double shift);
     int  eigen(int numMode, bool generalized, bool findSmallest);
     int  getNumEigen() {return numEigen;};
+    // Shift-invert Lanczos on the LinearSOE of the analysis. With reuse and
+    // no shift, the factorization left by the last static step is used as
+    // K, provided that step converged with Newton or Linear. That is the
+    // tangent of the last iteration, not of the converged state, and it is
+    // the initial tangent if the algorithm was given -initial.
+    int  eigenLanczos(int numMode, double shift, bool reuse, int threads,
+                      const OpenSees::LanczosOptions&);
+    // Eigenvectors in equation numbering from eigenLanczos(), one after another
+    const std::vector<double>& getLanczosVectors() const {return lanczosVectors;};
 
     int formUnbalance();
 
@@ -97,6 +150,13 @@ public:
     int analyzeStep(double dT);
     int analyzeSubLevel(int level, double dT);
     int analyzeVariable(int numSteps, double dT, double dtMin, double dtMax, int Jd);
+    int analyzeAdaptive(double duration, double dT, const StepControl&);
+    const std::deque<StepRecord>& getStepHistory() const {return stepHistory;};
+    int analyzeModal(int numSteps, double dT, const ModalControl&);
+
+    // Response sensitivity for all parameters, solved one parameter at
+    // a time against the current factorization
+    int computeSensitivities(Integrator& theIntegrator);
 
     void wipe();
 
@@ -106,6 +166,10 @@ public:
 private:
     void setLinks(CurrentAnalysis flag = EMPTY_ANALYSIS);
     void fillDefaults(enum CurrentAnalysis flag);
+    double estimateStepError(double dT, const StepControl&, double& beta);
+    struct ModalBasis;
+    int formModalBasis(const ModalControl&);
+    int setModalReference();
 
     Domain                    *theDomain;
     ConstraintHandler         *theHandler;
@@ -127,6 +191,12 @@ private:
     bool freeSOE = true;
     bool freeTI  = true;
 
+    std::deque<StepRecord> stepHistory;
+    ModalBasis *theModalBasis = nullptr;
+    std::vector<double> lanczosVectors;
+    // The LinearSOE holds a factored tangent K from a converged static step
+    bool factoredStiffness = false;
+
 };
 
 #endif
@@ -51,6 +51,9 @@ BasicModelBuilder::BasicModelBuilder(Domain &domain, Tcl_Interp *interp,
         tcl_char_cmds[i].name, 
         tcl_char_cmds[i].func, 
         (ClientData) this, nullptr);
+
+  for (const obj_cmd& cmd : tcl_obj_cmds)
+    Tcl_CreateObjCommand(interp, cmd.name, cmd.func, (ClientData) this, nullptr);
  
   tclEnclosingPattern = nullptr;
 
@@ -75,6 +78,9 @@ BasicModelBuilder::~BasicModelBuilder()
   static int ncmd = sizeof(tcl_char_cmds)/sizeof(char_cmd);
   for (int i = 0; i < ncmd; i++)
     Tcl_DeleteCommand(theInterp, tcl_char_cmds[i].name);
+
+  for (const obj_cmd& cmd : tcl_obj_cmds)
+    Tcl_DeleteCommand(theInterp, cmd.name);
 }
 
 
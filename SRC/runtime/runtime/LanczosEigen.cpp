@@ -0,0 +1,366 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Thick-restart shift-invert Lanczos; see LanczosEigen.h
+//
+// Author: cmp
+//
+#include "LanczosEigen.h"
+
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <threads/thread_pool.hpp>
+
+namespace OpenSees {
+
+void
+SparseSymmetric::assemble(int size, std::vector<int>& rows, std::vector<int>& cols,
+                          std::vector<double>& values)
+{
+  n = size;
+
+  std::vector<size_t> order(rows.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return rows[a] < rows[b] || (rows[a] == rows[b] && cols[a] < cols[b]);
+  });
+
+  rowStart.assign(n + 1, 0);
+  column.clear();
+  value.clear();
+  int lastRow = -1, lastCol = -1;
+  for (size_t k : order) {
+    if (rows[k] == lastRow && cols[k] == lastCol) {
+      value.back() += values[k];
+      continue;
+    }
+    lastRow = rows[k];
+    lastCol = cols[k];
+    column.push_back(lastCol);
+    value.push_back(values[k]);
+    rowStart[lastRow + 1]++;
+  }
+  for (int i = 0; i < n; i++)
+    rowStart[i + 1] += rowStart[i];
+}
+
+void
+SparseSymmetric::multiply(const double *x, double *y, thread_pool *pool) const
+{
+  auto rows = [&](int first, int last) {
+    for (int i = first; i < last; i++) {
+      double sum = 0.0;
+      for (int k = rowStart[i]; k < rowStart[i + 1]; k++)
+        sum += value[k]*x[column[k]];
+      y[i] = sum;
+    }
+  };
+
+  if (pool == nullptr)
+    rows(0, n);
+  else
+    pool->submit_blocks<int>(0, n, rows).wait();
+}
+
+namespace {
+
+template <typename F> void
+for_rows(thread_pool *pool, int n, F&& block)
+{
+  if (pool == nullptr)
+    block(0, n);
+  else
+    pool->submit_blocks<int>(0, n, block).wait();
+}
+
+double
+dot(int n, const double *x, const double *y)
+{
+  double sum = 0.0;
+  for (int i = 0; i < n; i++)
+    sum += x[i]*y[i];
+  return sum;
+}
+
+//
+// Eigenvalues w and orthonormal eigenvectors Y (columns, row-major) of
+// the symmetric m x m matrix A, by cyclic Jacobi rotations. A is destroyed.
+//
+void
+jacobi_eigen(int m, std::vector<double>& A, std::vector<double>& Y, std::vector<double>& w)
+{
+  Y.assign(m*m, 0.0);
+  for (int i = 0; i < m; i++)
+    Y[i*m + i] = 1.0;
+
+  double norm = 0.0;
+  for (double a : A)
+    norm += a*a;
+
+  for (int sweep = 0; sweep < 100; sweep++) {
+    double off = 0.0;
+    for (int p = 0; p < m; p++)
+      for (int q = p + 1; q < m; q++)
+        off += 2.0*A[p*m + q]*A[p*m + q];
+    if (off <= DBL_EPSILON*DBL_EPSILON*norm)
+      break;
+
+    for (int p = 0; p < m; p++)
+      for (int q = p + 1; q < m; q++) {
+        const double apq = A[p*m + q];
+        if (apq == 0.0)
+          continue;
+        const double theta = (A[q*m + q] - A[p*m + p])/(2.0*apq);
+        const double t = (theta >= 0.0 ? 1.0 : -1.0)/(fabs(theta) + sqrt(theta*theta + 1.0));
+        const double c = 1.0/sqrt(t*t + 1.0);
+        const double s = t*c;
+
+        for (int k = 0; k < m; k++) {
+          const double akp = A[k*m + p], akq = A[k*m + q];
+          A[k*m + p] = c*akp - s*akq;
+          A[k*m + q] = s*akp + c*akq;
+        }
+        for (int k = 0; k < m; k++) {
+          const double apk = A[p*m + k], aqk = A[q*m + k];
+          A[p*m + k] = c*apk - s*aqk;
+          A[q*m + k] = s*apk + c*aqk;
+        }
+        A[p*m + q] = A[q*m + p] = 0.0;
+
+        for (int k = 0; k < m; k++) {
+          const double ykp = Y[k*m + p], ykq = Y[k*m + q];
+          Y[k*m + p] = c*ykp - s*ykq;
+          Y[k*m + q] = s*ykp + c*ykq;
+        }
+      }
+  }
+
+  w.resize(m);
+  for (int i = 0; i < m; i++)
+    w[i] = A[i*m + i];
+}
+
+} // namespace
+
+
+int
+lanczos_eigen(int n, const LanczosOperator& solve, const LanczosOperator& mass,
+              double shift, int nev, const LanczosOptions& options,
+              std::vector<double>& values, std::vector<double>& vectors)
+{
+  if (n < 1 || nev < 1)
+    return -1;
+
+  nev = std::min(nev, n);
+  int ncv = options.ncv > 0 ? options.ncv : std::max(2*nev + 1, nev + 20);
+  ncv = std::min(std::max(ncv, nev + 1), n);
+
+  thread_pool *pool = options.pool;
+
+  // Lanczos vectors and their products with M, one column after another
+  std::vector<double> V((size_t)n*(ncv + 1)), MV((size_t)n*(ncv + 1));
+  auto col = [n](std::vector<double>& B, int j) {return &B[(size_t)j*n];};
+
+  std::vector<double> H(ncv*ncv, 0.0), T, Y, theta;
+  std::vector<double> w(n), Mw(n), h(ncv + 1), c(ncv + 1);
+
+  // Orthogonalize w against the first m columns in the M inner product,
+  // twice, accumulating the coefficients in h
+  auto orthogonalize = [&](int m) {
+    std::fill(h.begin(), h.begin() + m, 0.0);
+    for (int pass = 0; pass < 2; pass++) {
+      if (pool == nullptr)
+        for (int i = 0; i < m; i++)
+          c[i] = dot(n, col(MV, i), w.data());
+      else
+        pool->submit_loop<int>(0, m, [&](int i) {
+          c[i] = dot(n, col(MV, i), w.data());
+        }).wait();
+
+      for_rows(pool, n, [&](int first, int last) {
+        for (int i = 0; i < m; i++) {
+          const double *v = col(V, i);
+          for (int r = first; r < last; r++)
+            w[r] -= c[i]*v[r];
+        }
+      });
+      for (int i = 0; i < m; i++)
+        h[i] += c[i];
+    }
+  };
+
+  // Replace w by a vector in the range of the operator, orthogonal to
+  // the first m columns; false if there is no such vector
+  std::mt19937 random(5489u);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  auto restartVector = [&](int m, double &beta) -> int {
+    std::vector<double> r(n);
+    for (double &ri : r)
+      ri = uniform(random);
+    if (mass(r.data(), Mw.data()) < 0 || solve(Mw.data(), w.data()) < 0)
+      return -1;
+    if (mass(w.data(), Mw.data()) < 0)
+      return -1;
+    const double before = sqrt(fabs(dot(n, w.data(), Mw.data())));
+    orthogonalize(m);
+    if (mass(w.data(), Mw.data()) < 0)
+      return -1;
+    beta = sqrt(fabs(dot(n, w.data(), Mw.data())));
+    return (beta > 1.0e-10*before) ? 1 : 0;
+  };
+
+  double beta = 0.0;
+  int status = restartVector(0, beta);
+  if (status < 0)
+    return -1;
+  if (status == 0)
+    return 0; // M is zero
+  for (int r = 0; r < n; r++) {
+    col(V, 0)[r]  = w[r]/beta;
+    col(MV, 0)[r] = Mw[r]/beta;
+  }
+
+  int k = 0;        // number of Ritz vectors kept at a restart
+  int m = ncv;      // basis size, less than ncv if the space is exhausted
+  std::vector<int> order;
+  int numConverged = 0;
+
+  for (int restart = 0; ; restart++) {
+
+    //
+    // Extend the basis from k to m vectors
+    //
+    for (int j = k; j < m; j++) {
+      if (solve(col(MV, j), w.data()) < 0)
+        return -1;
+
+      orthogonalize(j + 1);
+      if (mass(w.data(), Mw.data()) < 0)
+        return -1;
+      beta = sqrt(fabs(dot(n, w.data(), Mw.data())));
+
+      double size = beta*beta;
+      for (int i = 0; i <= j; i++) {
+        H[i*ncv + j] = H[j*ncv + i] = h[i];
+        size += h[i]*h[i];
+      }
+
+      if (beta <= 1.0e-12*sqrt(size)) {
+        // invariant subspace; continue with a new direction
+        beta = 0.0;
+        double norm;
+        status = (j + 1 < n) ? restartVector(j + 1, norm) : 0;
+        if (status < 0)
+          return -1;
+        if (status == 0) {
+          m = j + 1;
+          break;
+        }
+        for (int r = 0; r < n; r++) {
+          col(V, j + 1)[r]  = w[r]/norm;
+          col(MV, j + 1)[r] = Mw[r]/norm;
+        }
+      } else {
+        for (int r = 0; r < n; r++) {
+          col(V, j + 1)[r]  = w[r]/beta;
+          col(MV, j + 1)[r] = Mw[r]/beta;
+        }
+      }
+      if (j + 1 < m)
+        H[(j + 1)*ncv + j] = H[j*ncv + j + 1] = beta;
+    }
+
+    //
+    // Ritz values, largest in magnitude first
+    //
+    T.resize(m*m);
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < m; j++)
+        T[i*m + j] = H[i*ncv + j];
+    jacobi_eigen(m, T, Y, theta);
+
+    order.resize(m);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return fabs(theta[a]) > fabs(theta[b]);
+    });
+
+    const int numWanted = std::min(nev, m);
+    numConverged = 0;
+    for (int i = 0; i < numWanted; i++) {
+      const int l = order[i];
+      if (fabs(beta*Y[(m - 1)*m + l]) <= options.tolerance*fabs(theta[l]))
+        numConverged++;
+    }
+
+    const bool done = numConverged == numWanted || m < ncv
+                   || restart >= options.maxRestart;
+
+    //
+    // Rotate the basis onto the Ritz vectors that are kept
+    //
+    const int keep = done ? numWanted : std::min(m - 1, nev + (m - nev)/2);
+    for (std::vector<double> *B : {&V, &MV}) {
+      std::vector<double> &basis = *B;
+      for_rows(pool, n, [&](int first, int last) {
+        std::vector<double> row(keep);
+        for (int r = first; r < last; r++) {
+          std::fill(row.begin(), row.end(), 0.0);
+          for (int l = 0; l < m; l++) {
+            const double v = basis[(size_t)l*n + r];
+            for (int i = 0; i < keep; i++)
+              row[i] += v*Y[l*m + order[i]];
+          }
+          for (int i = 0; i < keep; i++)
+            basis[(size_t)i*n + r] = row[i];
+        }
+      });
+    }
+
+    if (done)
+      break;
+
+    // the residual vector continues the basis
+    std::copy(col(V, m),  col(V, m) + n,  col(V, keep));
+    std::copy(col(MV, m), col(MV, m) + n, col(MV, keep));
+
+    std::fill(H.begin(), H.end(), 0.0);
+    for (int i = 0; i < keep; i++) {
+      H[i*ncv + i] = theta[order[i]];
+      H[i*ncv + keep] = H[keep*ncv + i] = beta*Y[(m - 1)*m + order[i]];
+    }
+    k = keep;
+  }
+
+  //
+  // Eigenpairs of K x = lambda M x, ascending; only the converged pairs
+  // nearest the shift are returned, so that no mode in between is missing
+  //
+  const int numWanted = std::min(nev, m);
+  int numFound = 0;
+  while (numFound < numWanted &&
+         fabs(beta*Y[(m - 1)*m + order[numFound]]) <= options.tolerance*fabs(theta[order[numFound]]))
+    numFound++;
+
+  std::vector<int> index(numFound);
+  std::iota(index.begin(), index.end(), 0);
+  auto lambda = [&](int i) {return shift + 1.0/theta[order[i]];};
+  std::sort(index.begin(), index.end(), [&](int a, int b) {return lambda(a) < lambda(b);});
+
+  values.resize(numFound);
+  vectors.resize((size_t)numFound*n);
+  for (int i = 0; i < numFound; i++) {
+    values[i] = lambda(index[i]);
+    std::copy(col(V, index[i]), col(V, index[i]) + n, &vectors[(size_t)i*n]);
+  }
+
+  return numFound;
+}
+
+} // namespace OpenSees
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Shift-invert Lanczos for the generalized problem
+//
+//   K x = lambda M x
+//
+// with K symmetric and M symmetric positive semi-definite. The Lanczos
+// process is run on the operator (K - shift M)^-1 M in the M inner product
+// with full reorthogonalization, and restarted by keeping the best Ritz
+// vectors (thick restart, Wu & Simon 2000). The operator is supplied as
+// two callbacks, so the factorization of K - shift M can be that of any
+// LinearSOE, and the mass product can be sparse and threaded.
+//
+// The storage is two blocks of n x (ncv + 1) doubles, against the n x n
+// of the dense eigen solvers.
+//
+// Author: cmp
+//
+#ifndef OpenSees_LanczosEigen_h
+#define OpenSees_LanczosEigen_h
+
+#include <functional>
+#include <vector>
+
+namespace OpenSees {
+
+class thread_pool;
+
+// y = op(x); returns 0 on success
+typedef std::function<int(const double *x, double *y)> LanczosOperator;
+
+struct LanczosOptions {
+  int    ncv        = 0;        // basis size; 0 selects max(2 nev + 1, nev + 20)
+  double tolerance  = 1.0e-10;  // on the residual relative to the Ritz value
+  int    maxRestart = 300;
+  thread_pool *pool = nullptr;  // for the orthogonalization, if given
+};
+
+//
+// Symmetric matrix in compressed row storage, both triangles stored
+//
+class SparseSymmetric {
+public:
+  // Entries may be repeated and are summed
+  void assemble(int n, std::vector<int>& rows, std::vector<int>& cols, std::vector<double>& values);
+  void multiply(const double *x, double *y, thread_pool *pool = nullptr) const;
+  int  size() const {return n;}
+
+private:
+  int n = 0;
+  std::vector<int>    rowStart;
+  std::vector<int>    column;
+  std::vector<double> value;
+};
+
+//
+// solve      - y = (K - shift M)^-1 x
+// mass       - y = M x
+// nev        - number of eigenpairs, those with eigenvalues nearest shift
+// values     - eigenvalues, ascending
+// vectors    - eigenvectors, M-orthonormal, stored one after the other
+//
+// Only converged pairs are returned: those nearest the shift up to the
+// first that did not converge, or up to the rank of M. Returns their
+// number (nev on success), or a negative value if an operator failed.
+//
+int lanczos_eigen(int n, const LanczosOperator& solve, const LanczosOperator& mass,
+                  double shift, int nev, const LanczosOptions& options,
+                  std::vector<double>& values, std::vector<double>& vectors);
+
+} // namespace OpenSees
+
+#endif
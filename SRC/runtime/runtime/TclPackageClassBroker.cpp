@@ -60,6 +60,11 @@ using namespace OpenSees::Hash::literals;
 #include "Concrete04.h"
 #include "Concrete06.h"
 #include "Concrete07.h"
+#include "TDConcrete.h"
+#include "TDConcreteEXP.h"
+#include "TDConcreteNL.h"
+#include "TDConcreteMC10.h"
+#include "TDConcreteMC10NL.h"
 #include "ConcretewBeta.h"
 #include "OriginCentered.h"
 #include "Steel01.h"
@@ -283,6 +288,25 @@ using namespace OpenSees::Hash::literals;
 #include "Bearing/friction/frictionModel/VelDepMultiLinear.h"
 #include "Bearing/friction/frictionModel/VelNormalFrcDep.h"
 
+// hysteretic backbones
+#include <ArctangentBackbone.h>
+#include <CappedBackbone.h>
+#include <CementedSoil.h>
+#include <LinearCappedBackbone.h>
+#include <LiquefiedSand.h>
+#include <ManderBackbone.h>
+#include <MaterialBackbone.h>
+#include <MultilinearBackbone.h>
+#include <RaynorBackbone.h>
+#include <ReeseSandBackbone.h>
+#include <ReeseSoftClayBackbone.h>
+#include <ReeseStiffClayAboveWS.h>
+#include <ReeseStiffClayBelowWS.h>
+#include <TabulatedBackbone.h>
+#include <TrilinearBackbone.h>
+#include <VuggyLimestone.h>
+#include <WeakRock.h>
+
 
 #include "mvlem/MVLEM.h"        // Kristijan Kolozvari
 #include "mvlem/SFI_MVLEM.h"    // Kristijan Kolozvari
@@ -497,6 +521,7 @@ using namespace OpenSees::Hash::literals;
 #include "LinearSeries.h"
 #include "PathSeries.h"
 #include "PathTimeSeries.h"
+#include "domain/loading/SharedPathSeries.h"
 #include "RectangularSeries.h"
 #include "ConstantSeries.h"
 #include "TrigSeries.h"
@@ -1135,6 +1160,21 @@ TclPackageClassBroker::getNewUniaxialMaterial(int classTag)
   case MAT_TAG_ConfinedConcrete01:
     return new ConfinedConcrete01();
 
+  case MAT_TAG_TDConcrete:
+    return new TDConcrete();
+
+  case MAT_TAG_TDConcreteEXP:
+    return new TDConcreteEXP();
+
+  case MAT_TAG_TDConcreteNL:
+    return new TDConcreteNL();
+
+  case MAT_TAG_TDConcreteMC10:
+    return new TDConcreteMC10();
+
+  case MAT_TAG_TDConcreteMC10NL:
+    return new TDConcreteMC10NL();
+
   case MAT_TAG_HystereticPoly: // Salvatore Sessa
     return new HystereticPoly();
 
@@ -1401,6 +1441,69 @@ TclPackageClassBroker::getNewFrictionModel(int classTag)
   }
 }
 
+HystereticBackbone *
+TclPackageClassBroker::getNewHystereticBackbone(int classTag)
+{
+  switch (classTag) {
+  case BACKBONE_TAG_Arctangent:
+    return new ArctangentBackbone();
+
+  case BACKBONE_TAG_Capped:
+    return new CappedBackbone();
+
+  case BACKBONE_TAG_CementedSoil:
+    return new CementedSoil();
+
+  case BACKBONE_TAG_LinearCapped:
+    return new LinearCappedBackbone();
+
+  case BACKBONE_TAG_LiquefiedSand:
+    return new LiquefiedSand();
+
+  case BACKBONE_TAG_Mander:
+    return new ManderBackbone();
+
+  case BACKBONE_TAG_Material:
+    return new MaterialBackbone();
+
+  case BACKBONE_TAG_Multilinear:
+    return new MultilinearBackbone();
+
+  case BACKBONE_TAG_Raynor:
+    return new RaynorBackbone();
+
+  case BACKBONE_TAG_ReeseSand:
+    return new ReeseSandBackbone();
+
+  case BACKBONE_TAG_ReeseSoftClay:
+    return new ReeseSoftClayBackbone();
+
+  case BACKBONE_TAG_ReeseStiffClayAboveWS:
+    return new ReeseStiffClayAboveWS();
+
+  case BACKBONE_TAG_ReeseStiffClayBelowWS:
+    return new ReeseStiffClayBelowWS();
+
+  case BACKBONE_TAG_Tabulated:
+    return new TabulatedBackbone();
+
+  case BACKBONE_TAG_Trilinear:
+    return new TrilinearBackbone();
+
+  case BACKBONE_TAG_VuggyLimestone:
+    return new VuggyLimestone();
+
+  case BACKBONE_TAG_WeakRock:
+    return new WeakRock();
+
+  default:
+    opserr << "TclPackageClassBroker::getNewHystereticBackbone - ";
+    opserr << " - no HystereticBackbone type exists for class tag ";
+    opserr << classTag << endln;
+    return 0;
+  }
+}
+
 ConvergenceTest *
 TclPackageClassBroker::getNewConvergenceTest(int classTag)
 {
@@ -1502,6 +1605,9 @@ TclPackageClassBroker::getNewTimeSeries(int classTag)
   case TSERIES_TAG_PathSeries:
     return new PathSeries;
 
+  case TSERIES_TAG_SharedPathSeries:
+    return new SharedPathSeries;
+
   case TSERIES_TAG_ConstantSeries:
     return new ConstantSeries;
 
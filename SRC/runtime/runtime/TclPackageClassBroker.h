@@ -19,6 +19,8 @@
 
 #include <FEM_ObjectBroker.h>
 
+class HystereticBackbone;
+
 class TclPackageClassBroker : public FEM_ObjectBroker {
 public:
   TclPackageClassBroker();
@@ -48,6 +50,7 @@ public:
   NDMaterial *getNewNDMaterial(int classTag);
   Fiber *getNewFiber(int classTag);
   FrictionModel *getNewFrictionModel(int classTag);
+  HystereticBackbone *getNewHystereticBackbone(int classTag);
 
   ConvergenceTest *getNewConvergenceTest(int classTag);
   LoadPattern *getNewLoadPattern(int classTag);
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Micro-benchmark comparing the cost and accuracy of
+// closed-form backbone evaluation against TabulatedBackbone.
+//
+//   bench_backbone [evaluations] [tolerance]
+//
+// Written: cmp
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <ManderBackbone.h>
+#include <RaynorBackbone.h>
+#include <ReeseSandBackbone.h>
+#include <ArctangentBackbone.h>
+#include <MultilinearBackbone.h>
+#include <TabulatedBackbone.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+struct Timing {
+  double seconds;
+  double checksum;
+};
+
+static Timing
+time_backbone(HystereticBackbone &b, const std::vector<double> &strain)
+{
+  double sum = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (double e : strain)
+    sum += b.getStress(e) + b.getTangent(e);
+  auto stop = std::chrono::steady_clock::now();
+  return {std::chrono::duration<double>(stop - start).count(), sum};
+}
+
+static void
+run(const char *name, HystereticBackbone &exact, double eMin, double eMax,
+    double tol, int numEval)
+{
+  TabulatedBackbone table(0, exact, eMin, eMax, tol);
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> dist(eMin, eMax);
+  std::vector<double> strain(numEval);
+  for (double &e : strain)
+    e = dist(gen);
+
+  // Error against the closed form at the random strains
+  double smax = 0.0, serr = 0.0, terr = 0.0, tmax = 0.0;
+  for (double e : strain) {
+    const double s = exact.getStress(e),
+                 t = exact.getTangent(e);
+    smax = std::max(smax, fabs(s));
+    tmax = std::max(tmax, fabs(t));
+    serr = std::max(serr, fabs(s - table.getStress(e)));
+    terr = std::max(terr, fabs(t - table.getTangent(e)));
+  }
+
+  Timing a = time_backbone(exact, strain),
+         b = time_backbone(table, strain);
+
+  printf("%-12s %8d %10.2f %10.2f %7.2fx %12.3e %12.3e\n", name,
+         table.getNumIntervals(),
+         1e9*a.seconds/numEval, 1e9*b.seconds/numEval, a.seconds/b.seconds,
+         serr/(smax > 0 ? smax : 1.0), terr/(tmax > 0 ? tmax : 1.0));
+
+  // Keep the loops from being optimized away
+  if (a.checksum == 1.2345 && b.checksum == 1.2345)
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  const int    numEval = argc > 1 ? atoi(argv[1]) : 2000000;
+  const double tol     = argc > 2 ? atof(argv[2]) : 1.0e-6;
+
+  printf("%-12s %8s %10s %10s %8s %12s %12s\n", "backbone", "n",
+         "exact ns", "table ns", "speedup", "stress err", "tangent err");
+
+  ManderBackbone mander(1, 4.0, 0.002, 3600.0);
+  run("Mander", mander, -0.006, 0.0, tol, numEval);
+
+  RaynorBackbone raynor(2, 29000.0, 60.0, 90.0, 0.008, 0.1, 3.0, 300.0);
+  run("Raynor", raynor, 0.0, 0.1, tol, numEval);
+
+  ReeseSandBackbone sand(3, 100.0, 0.2, 10.0, 0.6, 12.0);
+  run("ReeseSand", sand, 0.0, 1.0, tol, numEval);
+
+  ArctangentBackbone atan(4, 1.0, 0.01, 2.0);
+  run("Arctangent", atan, -0.1, 0.1, tol, numEval);
+
+  Vector e(4), s(4);
+  e(0) = 0.001; e(1) = 0.01; e(2) = 0.02; e(3) = 0.05;
+  s(0) = 50.0;  s(1) = 60.0; s(2) = 65.0; s(3) = 66.0;
+  MultilinearBackbone multi(5, 4, e, s);
+  run("Multilinear", multi, 0.0, 0.05, tol, numEval);
+
+  return 0;
+}
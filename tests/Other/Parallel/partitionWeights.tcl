@@ -0,0 +1,75 @@
+# Smoke test of the weighted partitioning of OpenSeesSP:
+#
+#   mpirun -n 2 OpenSeesSP partitionWeights.tcl
+#   mpirun -n 3 OpenSeesSP partitionWeights.tcl
+#
+# A chain of trusses in series, half of them given a much larger cost, is
+# partitioned with -weights (WeightedMetis) and a neighbour balancer, and
+# the tip displacement of the partitioned analysis is compared with the
+# flexibility of the chain, before and after a call to balance.
+
+wipe
+model basic -ndm 2 -ndf 2
+
+set numEle 12
+set L      1.0
+set A      2.0
+set P      10.0
+
+uniaxialMaterial Elastic 1 100.0
+uniaxialMaterial Elastic 2 400.0
+
+for {set i 0} {$i <= $numEle} {incr i} {
+  node [expr {$i + 1}] [expr {$i*$L}] 0.0
+  fix  [expr {$i + 1}] [expr {$i == 0}] 1
+}
+
+# the first half of the chain stands for costly nonlinear elements
+set weights {}
+set flexibility 0.0
+for {set i 1} {$i <= $numEle} {incr i} {
+  set mat [expr {$i <= $numEle/2 ? 1 : 2}]
+  set E   [expr {$mat == 1 ? 100.0 : 400.0}]
+  element truss $i $i [expr {$i + 1}] $A $mat
+  lappend weights $i [expr {$i <= $numEle/2 ? 10.0 : 1.0}]
+  set flexibility [expr {$flexibility + $L/($E*$A)}]
+}
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+  load [expr {$numEle + 1}] $P 0.0
+}
+
+partition -weights $weights -balancer ReleaseHeavierToLighterNeighbours 1.05 1
+
+integrator LoadControl 1.0
+algorithm  Linear
+numberer   RCM
+constraints Plain
+system     Mumps
+analysis   Static
+
+proc check {step} {
+  global numEle P flexibility
+  set u [nodeDisp [expr {$numEle + 1}] 1]
+  set expected [expr {$step*$P*$flexibility}]
+  if {abs($u - $expected) > 1e-10*abs($expected)} {
+    error "partitionWeights: tip displacement $u after step $step, expected $expected"
+  }
+}
+
+analyze 1
+check 1
+
+# move elements between neighbouring subdomains and continue
+balance
+analyze 1
+check 2
+
+# the balancer is fixed once the domain partitioner exists
+if {[catch {partition -balancer ShedHeaviest}] == 0} {
+  error "partitionWeights: -balancer accepted after partitioning"
+}
+
+puts "partitionWeights: [getNP] processes, tip displacement [nodeDisp [expr {$numEle + 1}] 1]"
+wipe
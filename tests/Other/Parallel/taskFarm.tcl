@@ -0,0 +1,100 @@
+# Check the taskFarm command of OpenSeesMP, including a resume from its
+# checkpoint file:
+#
+#   mpirun -n 3 OpenSeesMP taskFarm.tcl
+#   mpirun -n 1 OpenSeesMP taskFarm.tcl
+#
+# The first farm stands for an interrupted campaign: the tasks from
+# numDone on fail, so only the first ones reach the checkpoint. A partial
+# record is then appended to the file, as a run killed while writing
+# would leave it. The second farm must run only the remaining tasks, keep
+# the checkpointed results, and drop the partial record.
+
+set pid  [getPID]
+set np   [getNP]
+
+set numTasks 12
+set numDone  5
+set fileName "taskFarm.[pid].ckpt"
+if {$pid == 0} {
+  file delete -force $fileName
+}
+
+# The displacement of a spring of stiffness id+1 under a unit load,
+# tagged with the farm that computed it
+proc spring {id} {
+  global phase numDone
+  if {$phase == 1 && $id >= $numDone} {
+    error "interrupted"
+  }
+  wipe
+  model basic -ndm 1 -ndf 1
+  node 1 0.0
+  node 2 1.0
+  fix 1 1
+  uniaxialMaterial Elastic 1 [expr {$id + 1.0}]
+  element zeroLength 1 1 2 -mat 1 -dir 1
+  timeSeries Linear 1
+  pattern Plain 1 1 {
+    load 2 1.0
+  }
+  system FullGeneral
+  numberer Plain
+  constraints Plain
+  integrator LoadControl 1.0
+  algorithm Linear
+  analysis Static
+  analyze 1
+  return [list [nodeDisp 2 1] $phase]
+}
+
+# Failures are collected so that every process reaches the second farm
+set failures {}
+proc check {condition message} {
+  global failures
+  if {![uplevel 1 [list expr $condition]]} {
+    lappend failures $message
+  }
+}
+
+set phase 1
+set first [taskFarm $numTasks spring -checkpoint $fileName]
+if {$pid == 0} {
+  check {[dict size $first] == $numDone} "first farm completed [dict size $first] tasks"
+
+  # a record cut short: an id and no count
+  set file [open $fileName ab]
+  fconfigure $file -translation binary
+  puts -nonewline $file [binary format i 7]
+  close $file
+}
+
+set phase 2
+set second [taskFarm $numTasks spring -checkpoint $fileName]
+if {$pid == 0} {
+  check {[dict size $second] == $numTasks} "resumed farm returned [dict size $second] tasks"
+  for {set id 0} {$id < $numTasks} {incr id} {
+    lassign [dict get $second $id] u farm
+    check {abs($u - 1.0/($id + 1)) < 1e-12} "task $id returned $u"
+    set expected [expr {$id < $numDone ? 1 : 2}]
+    check {$farm == $expected} "task $id was run by farm $farm"
+  }
+
+  # the checkpoint now holds every task once
+  set file [open $fileName rb]
+  set size [string length [read $file]]
+  close $file
+  check {$size == $numTasks*(2*4 + 2*8)} "checkpoint has $size bytes"
+
+  file delete -force $fileName
+} else {
+  # the workers ran only the remaining tasks between them
+  check {[string is integer $second]} "worker returned $second"
+}
+
+barrier
+if {[llength $failures]} {
+  error "taskFarm test failed on process $pid: [join $failures {; }]"
+} elseif {$pid == 0} {
+  puts "taskFarm: $numTasks tasks on $np processes, resumed after $numDone"
+}
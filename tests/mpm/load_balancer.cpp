@@ -0,0 +1,171 @@
+//
+// Run the incremental MPM load balancer on a grid of cells whose particles
+// are concentrated on one side, on however many ranks mpirun starts, and
+// check that
+//
+//   - all ranks agree on the owner of every cell,
+//   - the particles of moved cells reach their new owner and none are lost,
+//   - the measured imbalance drops below the threshold.
+//
+// The cells are a minimal stand-in for mpm::Cell, which is all the balancer
+// needs.
+//
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "mpi.h"
+
+#include "load_balancer.h"
+
+namespace {
+
+struct TestCell {
+  mpm::Index id_;
+  unsigned rank_{0};
+  std::set<mpm::Index> neighbours_;
+
+  mpm::Index id() const { return id_; }
+  unsigned rank() const { return rank_; }
+  void rank(unsigned rank) { rank_ = rank; }
+  const std::set<mpm::Index>& neighbours() const { return neighbours_; }
+};
+
+constexpr unsigned nx = 24, ny = 8;
+constexpr double threshold = 0.10;
+
+// Particles per cell: dense on the left, sparse on the right
+unsigned nparticles(mpm::Index id) { return (id % nx) < nx / 3 ? 12 : 2; }
+
+int failures = 0;
+
+void check(bool passed, int mpi_rank, const char* what) {
+  if (!passed) {
+    ++failures;
+    std::fprintf(stderr, "rank %d: %s\n", mpi_rank, what);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+  int mpi_rank, mpi_size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  // Grid of cells in vertical strips of equal width, one per rank
+  std::vector<std::shared_ptr<TestCell>> cells;
+  for (unsigned j = 0; j < ny; ++j)
+    for (unsigned i = 0; i < nx; ++i) {
+      auto cell = std::make_shared<TestCell>();
+      cell->id_ = j * nx + i;
+      cell->rank_ = i * mpi_size / nx;
+      if (i > 0) cell->neighbours_.insert(cell->id_ - 1);
+      if (i + 1 < nx) cell->neighbours_.insert(cell->id_ + 1);
+      if (j > 0) cell->neighbours_.insert(cell->id_ - nx);
+      if (j + 1 < ny) cell->neighbours_.insert(cell->id_ + nx);
+      cells.emplace_back(cell);
+    }
+
+  // Particles held by this rank, by cell; particle ids are unique globally
+  std::unordered_map<mpm::Index, std::vector<mpm::Index>> particles;
+  mpm::Index total = 0, id_sum = 0;
+  for (const auto& cell : cells) {
+    for (unsigned p = 0; p < nparticles(cell->id()); ++p, ++total) {
+      id_sum += total;
+      if (cell->rank() == static_cast<unsigned>(mpi_rank))
+        particles[cell->id()].emplace_back(total);
+    }
+  }
+
+  mpm::LoadBalancer<2> balancer(threshold);
+  double initial_imbalance = -1.;
+  for (int iteration = 0; iteration < 50; ++iteration) {
+    std::unordered_map<mpm::Index, double> cell_costs;
+    for (const auto& cell : particles)
+      cell_costs[cell.first] = static_cast<double>(cell.second.size());
+
+    std::vector<unsigned> previous(cells.size());
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      previous[i] = cells[i]->rank();
+
+    auto exchange_cells =
+        balancer.rebalance(cells, cell_costs, MPI_COMM_WORLD);
+    if (initial_imbalance < 0.)
+      initial_imbalance = balancer.measured_imbalance();
+    if (exchange_cells.empty()) break;
+
+    // Send the particles of each moved cell from its old to its new owner
+    for (const auto id : exchange_cells) {
+      const int from = previous[id], to = cells[id]->rank();
+      if (from == mpi_rank) {
+        auto& moving = particles[id];
+        int count = moving.size();
+        MPI_Send(&count, 1, MPI_INT, to, 0, MPI_COMM_WORLD);
+        MPI_Send(moving.data(), count, MPI_UNSIGNED_LONG_LONG, to, 1,
+                 MPI_COMM_WORLD);
+        particles.erase(id);
+      } else if (to == mpi_rank) {
+        int count = 0;
+        MPI_Recv(&count, 1, MPI_INT, from, 0, MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+        auto& arriving = particles[id];
+        arriving.resize(count);
+        MPI_Recv(arriving.data(), count, MPI_UNSIGNED_LONG_LONG, from, 1,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      }
+    }
+  }
+
+  // Cell ownership is the same on every rank
+  std::vector<unsigned> owners(cells.size()), root_owners;
+  for (std::size_t i = 0; i < cells.size(); ++i) owners[i] = cells[i]->rank();
+  root_owners = owners;
+  MPI_Bcast(root_owners.data(), root_owners.size(), MPI_UNSIGNED, 0,
+            MPI_COMM_WORLD);
+  check(owners == root_owners, mpi_rank, "ranks disagree on cell owners");
+
+  // Every particle is held once, by the owner of its cell
+  mpm::Index held = 0, held_sum = 0;
+  for (const auto& cell : particles) {
+    check(cells[cell.first]->rank() == static_cast<unsigned>(mpi_rank),
+          mpi_rank, "particles held for a cell of another rank");
+    check(cell.second.size() == nparticles(cell.first), mpi_rank,
+          "particles of a cell lost in transfer");
+    for (const auto id : cell.second) {
+      ++held;
+      held_sum += id;
+    }
+  }
+  mpm::Index global_held = 0, global_sum = 0;
+  MPI_Allreduce(&held, &global_held, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                MPI_COMM_WORLD);
+  MPI_Allreduce(&held_sum, &global_sum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                MPI_COMM_WORLD);
+  check(global_held == total && global_sum == id_sum, mpi_rank,
+        "particles not conserved");
+
+  // The load is balanced to within the threshold
+  std::unordered_map<mpm::Index, double> cell_costs;
+  for (const auto& cell : particles)
+    cell_costs[cell.first] = static_cast<double>(cell.second.size());
+  balancer.rebalance(cells, cell_costs, MPI_COMM_WORLD);
+  check(initial_imbalance > threshold, mpi_rank,
+        "initial decomposition is already balanced");
+  check(balancer.measured_imbalance() <= threshold, mpi_rank,
+        "imbalance above the threshold");
+
+  if (mpi_rank == 0)
+    std::printf("%d ranks: imbalance %.3f -> %.3f\n", mpi_size,
+                initial_imbalance, balancer.measured_imbalance());
+
+  int all_failures = 0;
+  MPI_Allreduce(&failures, &all_failures, 1, MPI_INT, MPI_SUM,
+                MPI_COMM_WORLD);
+  MPI_Finalize();
+  return all_failures == 0 ? 0 : 1;
+}
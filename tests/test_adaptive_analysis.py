@@ -0,0 +1,73 @@
+"""
+Run `analyze -adaptive` on a harmonically forced oscillator and check
+that the step size adapts, that the response stays within the tolerance
+of a fine fixed-step run of the same Newmark average acceleration rule
+(and gets closer as the tolerance is tightened), and that -history caps
+the step records kept by timeStepHistory.
+
+The controller bounds the local error of each step, so the global error
+over several periods is a modest multiple of rtol times the peak response.
+"""
+import opensees.openseespy as ops
+
+atol   = 1e-8
+ends   = [1.0, 2.0, 3.0, 4.0]
+
+def make_oscillator():
+    model = ops.Model(ndm=1, ndf=1)
+    model.node(1, 0.0)
+    model.node(2, 1.0)
+    model.fix(1, 1)
+    model.mass(2, 1.0)
+    model.uniaxialMaterial("Elastic", 1, 39.47841760435743) # (2 pi)^2, T = 1
+    model.element("zeroLength", 1, 1, 2, "-mat", 1, "-dir", 1)
+
+    model.timeSeries("Trig", 1, 0.0, 100.0, 1/0.7)
+    model.pattern("Plain", 1, 1)
+    model.load(2, 1.0)
+
+    model.system("FullGeneral")
+    model.numberer("Plain")
+    model.constraints("Plain")
+    model.test("NormDispIncr", 1e-12, 10)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    return model
+
+def accepted_steps(model):
+    return [float(dt) for dt in
+            model.eval("join [lmap s [timeStepHistory -accepted] {lindex $s 1}]").split()]
+
+# fine fixed-step reference, and the peak sampled every 0.1
+model = make_oscillator()
+reference, peak = [], 0.0
+for i in range(40):
+    assert model.analyze(1000, 1e-4) == 0
+    peak = max(peak, abs(model.nodeDisp(2, 1)))
+    if abs((i + 1)/10 - ends[len(reference)]) < 1e-9:
+        reference.append(model.nodeDisp(2, 1))
+
+errors = {}
+for rtol in (1e-3, 1e-4):
+    model = make_oscillator()
+    error = 0.0
+    for end, expected in zip(ends, reference):
+        assert model.analyze(100, 0.01, "-adaptive", "-tolerance", rtol, "-atol", atol) == 0
+        assert abs(model.getTime() - end) < 1e-9
+        error = max(error, abs(model.nodeDisp(2, 1) - expected))
+    assert error < 50*rtol*peak, (rtol, error, peak)
+    errors[rtol] = error
+
+    # the accepted steps grow from the initial 0.01 and vary along the way
+    steps = accepted_steps(model)
+    assert max(steps) > 2*0.01 and max(steps) > 4*min(steps), (min(steps), max(steps))
+
+assert errors[1e-4] < 0.5*errors[1e-3], errors
+
+# only the last records are kept
+model = make_oscillator()
+assert model.analyze(200, 0.01, "-adaptive", "-tolerance", 1e-4, "-history", 25) == 0
+assert int(model.eval("llength [timeStepHistory]")) == 25
+last = model.eval("lindex [timeStepHistory] end").split()
+assert abs(float(last[0]) + float(last[1]) - 2.0) < 1e-9, last
@@ -0,0 +1,91 @@
+"""
+Run a small batch of records through `Model.batch` and check that the
+excitation acts along the requested dof, and that each record starts from
+the committed state left by a preceding static analysis, both with forked
+workers and with the sequential fallback.
+"""
+import math
+import opensees.openseespy as ops
+
+kx, ky = 100.0, 400.0
+mass   = 1.0
+dt     = 0.01
+steps  = 200
+P      = -20.0
+
+def make_oscillator():
+    model = ops.Model(ndm=2, ndf=2)
+    model.node(1, 0.0, 0.0)
+    model.node(2, 0.0, 0.0)
+    model.fix(1, 1, 1)
+    model.mass(2, mass, mass)
+
+    model.uniaxialMaterial("Elastic", 1, kx)
+    model.uniaxialMaterial("Elastic", 2, ky)
+    model.element("zeroLength", 1, 1, 2, "-mat", 1, 2, "-dir", 1, 2)
+
+    # static load along Y, held constant during the records
+    model.timeSeries("Constant", 1)
+    model.pattern("Plain", 1, 1)
+    model.load(2, 0.0, P)
+
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-10, 10)
+    model.algorithm("Newton")
+    model.integrator("LoadControl", 1.0)
+    model.analysis("Static")
+    model.analyze(1)
+    model.loadConst("-time", 0.0)
+
+    model.wipeAnalysis()
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-10, 10)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    return model
+
+
+records = [
+    [math.sin(2*math.pi*i*dt) for i in range(steps)],
+    [0.5*math.sin(4*math.pi*i*dt) for i in range(steps)],
+]
+response = [(2, 1, "displ"), (2, 2, "displ")]
+
+for workers in 1, 2:
+    model = make_oscillator()
+    histories, completed = model.batch(records, dt, response=response,
+                                       dof=1, steps=steps, workers=workers)
+
+    for r in range(len(records)):
+        assert completed[r] == steps, (workers, completed[r])
+
+        # the record excites X ...
+        assert max(abs(histories[r,:,0])) > 1e-4, workers
+
+        # ... and Y stays at the static deflection
+        for u in histories[r,:,1]:
+            assert abs(u - P/ky) < 1e-10, (workers, u)
+
+    # the committed state of the caller is unchanged
+    assert abs(model.nodeDisp(2, 1)) < 1e-12
+    assert abs(model.nodeDisp(2, 2) - P/ky) < 1e-10
+
+# dof is checked against the ndf of the model
+try:
+    make_oscillator().batch(records, dt, response=response, dof=3, steps=steps)
+    assert False, "dof 3 accepted in a model with ndf 2"
+except ValueError:
+    pass
+
+# and so is the dof of each response
+for node_dof in 0, 3:
+    try:
+        make_oscillator().batch(records, dt, response=[(2, node_dof, "displ")], dof=1, steps=steps)
+        assert False, f"response dof {node_dof} accepted in a model with ndf 2"
+    except ValueError:
+        pass
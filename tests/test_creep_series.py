@@ -0,0 +1,84 @@
+"""
+Compare the recursive creep series (-creepSeries) of the TDConcrete
+materials against the summation over the stress history that it
+replaces, for a sustained load held over several years. Then check that
+a snapshot taken part way through the creep analysis restarts from the
+same creep history, with and without the series.
+"""
+import os
+import tempfile
+import opensees.openseespy as ops
+
+# fc, ft, Ec, beta, age, epsshu, epssha, tcr, epscru, <sigCr,> epscra, epscrd, tcast
+properties = {
+    "TDConcrete":    [-30.0, 3.0, 25e3, 0.4, 7.0, -600e-6, 35.0, 28.0, 2.0,       0.6, 10.0, 7.0],
+    "TDConcreteEXP": [-30.0, 3.0, 25e3, 0.4, 7.0, -600e-6, 35.0, 28.0, 2.0, 30.0, 0.6, 10.0, 7.0],
+}
+P      = -5.0   # sustained stress, well in the linear range
+area   = 1.0
+steps  = 300
+dt     = 5.0    # days
+
+def make_column(material, series):
+    model = ops.Model(ndm=1, ndf=1)
+    model.node(1, 0.0)
+    model.node(2, 1.0)
+    model.fix(1, 1)
+
+    args = properties[material]
+    if series:
+        args = args + ["-creepSeries", 12]
+    model.uniaxialMaterial(material, 1, *args)
+    model.element("Truss", 1, 1, 2, area, 1)
+
+    # load at the end of curing, then hold it
+    model.setTime(28.0)
+    model.timeSeries("Constant", 1)
+    model.pattern("Plain", 1, 1)
+    model.load(2, P*area)
+
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-12, 20)
+    model.algorithm("Newton")
+    model.integrator("LoadControl", 0.0)
+    model.analysis("Static")
+    assert model.analyze(1) == 0
+
+    model.integrator("LoadControl", dt)
+    model.setCreep(1)
+    return model
+
+
+def creep_history(model, steps):
+    u = []
+    for i in range(steps):
+        assert model.analyze(1) == 0
+        u.append(model.nodeDisp(2, 1))
+    return u
+
+
+for material in properties:
+    exact  = creep_history(make_column(material, False), steps)
+    series = creep_history(make_column(material, True),  steps)
+
+    # creep strain grows well beyond the elastic strain
+    assert abs(exact[-1]) > 2*abs(P/properties[material][2])
+
+    # the series is within 1% of the summation over the whole history
+    scale = max(abs(u) for u in exact)
+    error = max(abs(a - b) for a, b in zip(exact, series))/scale
+    assert error < 0.01, (material, error)
+
+    # restart from a snapshot part way through
+    for use_series in False, True:
+        with tempfile.TemporaryDirectory() as tmp:
+            path  = os.path.join(tmp, "column.snap")
+            model = make_column(material, use_series)
+            creep_history(model, steps//2)
+            model.snapshot("save", "-file", path)
+            first = creep_history(model, steps//2)
+
+            model.snapshot("restore", "-file", path)
+            assert creep_history(model, steps//2) == first, (material, use_series)
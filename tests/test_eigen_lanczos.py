@@ -0,0 +1,65 @@
+"""
+Compare `eigen -lanczos` on a fixed-free chain of unit springs and masses
+against the exact eigenvalues 4 sin^2((2j-1) pi / (2(2n+1))), and check
+the reuse of the factorization left by a converged static step, the modes
+returned through Model.modes, and the error when no mode converges.
+"""
+import math
+import opensees.openseespy as ops
+
+n     = 60
+modes = 10
+exact = [4*math.sin((2*j - 1)*math.pi/(2*(2*n + 1)))**2 for j in range(1, modes + 1)]
+
+def make_chain():
+    model = ops.Model(ndm=1, ndf=1)
+    model.uniaxialMaterial("Elastic", 1, 1.0)
+    model.node(0, 0.0)
+    model.fix(0, 1)
+    for i in range(1, n + 1):
+        model.node(i, float(i))
+        model.mass(i, 1.0)
+        model.element("truss", i, i - 1, i, 1.0, 1)
+
+    model.system("ProfileSPD")
+    model.numberer("RCM")
+    model.constraints("Plain")
+    return model
+
+def check(values, what):
+    assert len(values) == modes, (what, values)
+    for computed, expected in zip(values, exact):
+        assert abs(computed - expected) < 1e-9*expected, (what, computed, expected)
+
+# sparse path against the exact values and the dense solver
+model = make_chain()
+check(model.eigen("-lanczos", modes), "lanczos")
+check(model.eigen("-lanczos", "-shift", 0.01, "-threads", 2, modes), "lanczos with shift")
+check(model.eigen("-fullGenLapack", modes), "fullGenLapack")
+
+# reuse the factorization of a converged Newton step on the linear chain
+model = make_chain()
+model.timeSeries("Linear", 1)
+model.pattern("Plain", 1, 1)
+model.load(n, 1.0)
+model.test("NormDispIncr", 1e-12, 10)
+model.algorithm("Newton")
+model.integrator("LoadControl", 1.0)
+model.analysis("Static")
+assert model.analyze(1) == 0
+check(model.eigen("-lanczos", "-reuse", modes), "lanczos with reuse")
+
+# the modes as arrays, mass-normalized
+values, shapes, dofs = model.modes(modes)
+check(list(values), "modes")
+assert shapes.shape == (modes, n)
+for shape in shapes:
+    assert abs(sum(x*x for x in shape) - 1.0) < 1e-10
+
+# a tolerance that cannot be met leaves no converged mode
+try:
+    model.eigen("-lanczos", "-tolerance", 0.0, modes)
+    accepted = True
+except Exception:
+    accepted = False
+assert not accepted, "eigen -lanczos returned without any converged mode"
@@ -0,0 +1,70 @@
+"""
+Record the free vibration of a two-dof chain with encoded Node recorders
+and read the files back with `read_encoded`, comparing against a text
+recorder of the same response: lossless with -delta, within single
+precision with -float32, and within the column tolerances with -quantize.
+Chunks of a few rows make each file hold several of them.
+"""
+import os
+import tempfile
+import numpy as np
+import opensees.openseespy as ops
+from opensees.recorder import read_encoded
+
+numSteps = 50
+dt       = 0.01
+tolTime  = 1e-9
+tolDisp  = 1e-6
+
+def record(directory):
+    model = ops.Model(ndm=1, ndf=1)
+    model.uniaxialMaterial("Elastic", 1, 100.0)
+    model.node(1, 0.0)
+    model.node(2, 1.0)
+    model.node(3, 2.0)
+    model.fix(1, 1)
+    model.mass(2, 1.0)
+    model.mass(3, 0.5)
+    model.element("zeroLength", 1, 1, 2, "-mat", 1, "-dir", 1)
+    model.element("zeroLength", 2, 2, 3, "-mat", 1, "-dir", 1)
+    model.setNodeDisp(3, 1, 0.01, "-commit")
+
+    path = lambda name: os.path.join(directory, name)
+    nodes = ("-time", "-node", 2, 3, "-dof", 1, "disp")
+    model.recorder("Node", "-file", path("disp.txt"), "-precision", 17, *nodes)
+    model.recorder("Node", "-encoded", path("delta.enc"), "-delta", "-chunk", 7, *nodes)
+    model.recorder("Node", "-binary", path("float.enc"), "-float32", "-chunk", 7, *nodes)
+    model.recorder("Node", "-encoded", path("quant.enc"), "-quantize", tolTime, tolDisp,
+                   "-delta", "-chunk", 7, *nodes)
+
+    model.system("FullGeneral")
+    model.numberer("Plain")
+    model.constraints("Plain")
+    model.test("NormDispIncr", 1e-12, 10)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    assert model.analyze(numSteps, dt) == 0
+
+    # close the recorders so that the last chunks are written
+    model.remove("recorders")
+    return np.loadtxt(path("disp.txt"), ndmin=2)
+
+
+with tempfile.TemporaryDirectory() as directory:
+    expected = record(directory)
+    assert expected.shape[0] >= numSteps and expected.shape[1] == 3, expected.shape
+    assert np.abs(expected[:, 1:]).max() > 100*tolDisp
+
+    delta = read_encoded(os.path.join(directory, "delta.enc"))
+    assert delta.shape == expected.shape, delta.shape
+    assert np.array_equal(delta, expected), np.abs(delta - expected).max()
+
+    single = read_encoded(os.path.join(directory, "float.enc"))
+    assert single.dtype == np.float32
+    assert np.allclose(single, expected, rtol=1e-6, atol=1e-12)
+
+    quant = read_encoded(os.path.join(directory, "quant.enc"))
+    assert quant.shape == expected.shape, quant.shape
+    assert np.abs(quant[:, 0]  - expected[:, 0]).max()  <= tolTime*(1 + 1e-9)
+    assert np.abs(quant[:, 1:] - expected[:, 1:]).max() <= tolDisp*(1 + 1e-9)
@@ -0,0 +1,86 @@
+"""
+Load a small truss from the JSON layout read by `loadModel`, check the
+counts it reports, the stiffness and mass it builds, and that a node
+whose mass has neither ndf nor ndf*ndf values is rejected.
+"""
+import os
+import json
+import tempfile
+import opensees.openseespy as ops
+
+E, A, L = 200.0, 10.0, 4.0
+m       = 2.5
+P       = 30.0
+
+def write_model(path, mass):
+    document = {"StructuralAnalysisModel": {
+        "properties": {
+            "uniaxialMaterials": [{"name": 1, "type": "Elastic", "E": E}]
+        },
+        "geometry": {
+            "nodes": [
+                {"name": 1, "crd": [0.0, 0.0]},
+                {"name": 2, "crd": [L,   0.0], "mass": mass},
+                {"name": 3, "crd": [2*L, 0.0], "mass": [m, m]},
+            ],
+            "elements": [
+                {"name": 1, "type": "Truss", "nodes": [1, 2], "A": A, "material": 1},
+                {"name": 2, "command": ["element", "truss", 2, 2, 3, A, 1]},
+            ]
+        }
+    }}
+    with open(path, "w") as f:
+        json.dump(document, f)
+
+
+def make_truss(path):
+    model = ops.Model(ndm=2, ndf=2)
+    counts = model.loadModel("-threads", 2, path)
+    model.fix(1, 1, 1)
+    model.fix(2, 0, 1)
+    model.fix(3, 0, 1)
+    return model, counts
+
+
+with tempfile.TemporaryDirectory() as directory:
+    path = os.path.join(directory, "truss.json")
+
+    # full mass matrix on node 2, diagonal on node 3
+    write_model(path, [[m, 0.0], [0.0, m]])
+    model, counts = make_truss(path)
+    assert counts.split() == ["properties", "1", "nodes", "3", "elements", "2"], counts
+
+    model.timeSeries("Linear", 1)
+    model.pattern("Plain", 1, 1)
+    model.load(3, P, 0.0)
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-10, 10)
+    model.algorithm("Newton")
+    model.integrator("LoadControl", 1.0)
+    model.analysis("Static")
+    assert model.analyze(1) == 0
+
+    k = E*A/L
+    assert abs(model.nodeDisp(2, 1) - P/k)   < 1e-10
+    assert abs(model.nodeDisp(3, 1) - 2*P/k) < 1e-10
+
+    # two equal springs and masses: lambda = (3 -/+ sqrt(5))/2 k/m
+    model.wipeAnalysis()
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    values = model.eigen("-fullGenLapack", 2)
+    expected = sorted([(3 - 5**0.5)/2*k/m, (3 + 5**0.5)/2*k/m])
+    for computed, exact in zip(sorted(values), expected):
+        assert abs(computed - exact) < 1e-8*exact, (computed, exact)
+
+    # three values for a node with two dofs
+    write_model(path, [m, m, m])
+    try:
+        make_truss(path)
+        accepted = True
+    except Exception:
+        accepted = False
+    assert not accepted, "mass of the wrong size accepted"
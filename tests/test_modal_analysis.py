@@ -0,0 +1,79 @@
+"""
+Compare `analyze N dt -modal n` with all the modes of a three-story shear
+building against a Newmark average acceleration analysis of the same
+model with the same modal damping, first with linear springs and then
+with a yielding first story given through -nonlinear. With all modes
+kept both solve the same equations, so they differ only by the time
+discretization.
+"""
+import opensees.openseespy as ops
+
+k      = [300.0, 200.0, 100.0]
+m      = [1.0, 1.0, 0.5]
+zeta   = 0.05
+P      = 40.0
+dt     = 0.001
+steps  = 2000
+
+def make_building(yielding):
+    model = ops.Model(ndm=1, ndf=1)
+    model.node(0, 0.0)
+    model.fix(0, 1)
+    for i in range(3):
+        model.node(i + 1, float(i + 1))
+        model.mass(i + 1, m[i])
+        if i == 0 and yielding:
+            model.uniaxialMaterial("ElasticPP", i + 1, k[i], 0.1)
+        else:
+            model.uniaxialMaterial("Elastic", i + 1, k[i])
+        model.element("zeroLength", i + 1, i, i + 1, "-mat", i + 1, "-dir", 1)
+
+    model.timeSeries("Trig", 1, 0.0, 100.0, 0.5)
+    model.pattern("Plain", 1, 1)
+    model.load(3, P)
+
+    model.system("FullGeneral")
+    model.numberer("Plain")
+    model.constraints("Plain")
+    model.test("NormDispIncr", 1e-12, 20)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    model.eigen("-fullGenLapack", 3)
+    return model
+
+def history(model, *options):
+    roof = []
+    for i in range(steps):
+        assert model.analyze(1, dt, *options) == 0
+        roof.append(model.nodeDisp(3, 1))
+    return roof
+
+def compare(computed, expected, what):
+    peak = max(abs(u) for u in expected)
+    error = max(abs(a - b) for a, b in zip(computed, expected))
+    assert error < 1e-2*peak, (what, error, peak)
+    return peak
+
+
+# linear
+reference = make_building(False)
+reference.modalDamping(zeta)
+linear = history(reference)
+
+model = make_building(False)
+compare(history(model, "-modal", 3, "-damping", zeta), linear, "linear")
+
+# per-mode damping ratios given as a list
+model = make_building(False)
+compare(history(model, "-modal", 3, "-damping", f"{zeta} {zeta} {zeta}"), linear, "damping list")
+
+# first story yields; its pseudo-forces are iterated on each step
+reference = make_building(True)
+reference.modalDamping(zeta)
+nonlinear = history(reference)
+assert max(abs(a - b) for a, b in zip(nonlinear, linear)) > 0.05*max(abs(u) for u in linear), \
+       "the first story did not yield"
+
+model = make_building(True)
+compare(history(model, "-modal", 3, "-damping", zeta, "-nonlinear", 1), nonlinear, "nonlinear")
@@ -92,3 +92,70 @@ analyze(system_2)
 system_2.printModel("node", 4)
 system_2.printModel("ele")
 
+
+
+#
+# Analyze independent models with their steps interleaved, and check that
+# each gives the same response as when it is analyzed alone. The
+# multi-yield soil material keeps its parameters with the material rather
+# than in class-wide tables, so the two models must not interfere. The
+# models are stepped from one thread: element scratch is still shared by
+# all models, so they may not be analyzed concurrently.
+#
+def make_soil(system, load):
+    system.node(1, 0.0, 0.0)
+    system.node(2, 1.0, 0.0)
+    system.node(3, 1.0, 1.0)
+    system.node(4, 0.0, 1.0)
+    system.fix(1, 1, 1)
+    system.fix(2, 1, 1)
+
+    system.nDMaterial("PressureIndependMultiYield", 1, 2, 1.8, 9.0e4, 2.2e5, 18.0, 0.1)
+    system.element("quad", 1, 1, 2, 3, 4, 1.0, "PlaneStrain", 1)
+    system.updateMaterialStage("-material", 1, "-stage", 1)
+
+    system.timeSeries("Linear", 1)
+    system.pattern("Plain", 1, 1)
+    system.load(3, load, 0.0)
+    system.load(4, load, 0.0)
+
+    system.system("FullGeneral")
+    system.numberer("Plain")
+    system.constraints("Plain")
+    system.test("NormDispIncr", 1e-10, 50)
+    system.algorithm("Newton")
+    system.integrator("LoadControl", 0.05)
+    system.analysis("Static")
+
+
+def soil_history(system, steps=20):
+    history = []
+    for i in range(steps):
+        assert system.analyze(1) == 0
+        history.append(system.nodeDisp(3, 1))
+    return history
+
+
+loads = [5.0, 8.0]
+
+# each model alone
+expected = []
+for load in loads:
+    system = ops.Model(ndm=2, ndf=2)
+    make_soil(system, load)
+    expected.append(soil_history(system))
+
+# both, one step of each in turn
+systems = []
+for load in loads:
+    systems.append(ops.Model(ndm=2, ndf=2))
+    make_soil(systems[-1], load)
+
+results = [[] for system in systems]
+for step in range(len(expected[0])):
+    for system, history in zip(systems, results):
+        assert system.analyze(1) == 0
+        history.append(system.nodeDisp(3, 1))
+
+for i in range(len(systems)):
+    assert results[i] == expected[i], (i, results[i], expected[i])
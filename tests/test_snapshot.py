@@ -0,0 +1,82 @@
+"""
+Save a snapshot part way through a transient analysis, continue, then
+restore the snapshot and repeat the same steps. The repeated steps must
+reproduce the original response, and a snapshot read back with -verify
+must match the model it was written from.
+"""
+import os
+import math
+import tempfile
+import opensees.openseespy as ops
+
+dt = 0.01
+
+def make_frame():
+    model = ops.Model(ndm=2, ndf=3)
+    model.node(1, 0.0, 0.0)
+    model.node(2, 0.0, 3.0)
+    model.node(3, 4.0, 3.0)
+    model.node(4, 4.0, 0.0)
+    model.fix(1, 1, 1, 1)
+    model.fix(4, 1, 1, 1)
+    model.mass(2, 1.0, 1.0, 0.0)
+    model.mass(3, 1.0, 1.0, 0.0)
+
+    model.geomTransf("Linear", 1)
+    model.uniaxialMaterial("Steel01", 1, 50.0, 2.9e4, 0.02)
+    model.section("Fiber", 1, "-GJ", 1e6)
+    model.patch("rect", 1, 8, 2, -0.5, -0.25, 0.5, 0.25)
+    for tag, (i, j) in enumerate([(1, 2), (2, 3), (3, 4)], 1):
+        model.element("forceBeamColumn", tag, i, j, 1, "Lobatto", 1, 5)
+
+    model.timeSeries("Path", 1, dt=dt,
+                     values=[0.3*math.sin(6*math.pi*i*dt) for i in range(400)])
+    model.pattern("UniformExcitation", 1, 1, accel=1)
+
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-10, 20)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    return model
+
+
+def history(model, steps):
+    out = []
+    for i in range(steps):
+        assert model.analyze(1, dt) == 0
+        out.append((model.getTime(), model.nodeDisp(2, 1), model.nodeVel(3, 1)))
+    return out
+
+
+with tempfile.TemporaryDirectory() as tmp:
+    path = os.path.join(tmp, "frame.snap")
+
+    model = make_frame()
+    history(model, 50)
+
+    # save and read back; the scratch copy must match the live model
+    diff = model.snapshot("save", "-file", path, "-verify")
+    assert float(diff) == 0.0, diff
+
+    first = history(model, 50)
+
+    # restore into the same model and repeat the steps
+    model.snapshot("restore", "-file", path)
+    again = history(model, 50)
+    assert first == again
+
+    # restore into a new model configured the same way
+    other = make_frame()
+    other.snapshot("restore", "-file", path)
+    assert history(other, 50) == first
+
+    # the sub-command is required
+    try:
+        model.snapshot("-file", path)
+        accepted = True
+    except Exception:
+        accepted = False
+    assert not accepted, "snapshot accepted without save or restore"
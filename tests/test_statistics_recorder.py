@@ -0,0 +1,91 @@
+"""
+Feed known signals to the Statistics recorder through setNodeDisp and
+record, and compare its table against values worked out by hand:
+
+- rainflow counts of the ASTM E1049 example history, including the
+  residual half cycles and a range above maxRange;
+- exceedance durations, first times and up-crossings with the threshold
+  crossings interpolated linearly between samples;
+- spectrum peaks of a step input against the closed form response of a
+  damped oscillator, which the piecewise-linear recurrence is exact for.
+"""
+import os
+import math
+import tempfile
+import numpy as np
+import opensees.openseespy as ops
+
+def record(directory, name, times, signal, *stat):
+    model = ops.Model(ndm=1, ndf=1)
+    model.node(1, 0.0)
+
+    path = os.path.join(directory, name)
+    model.recorder("Statistics", "-file", path, "-precision", 16,
+                   "-node", 1, "-dof", 1, "disp", *stat)
+    for t, x in zip(times, signal):
+        model.setTime(t)
+        model.setNodeDisp(1, 1, x, "-commit")
+        model.record()
+
+    # the table is written when the recorder is closed
+    model.remove("recorders")
+    return np.loadtxt(path, ndmin=2)[:, 0]
+
+
+with tempfile.TemporaryDirectory() as directory:
+    #
+    # Rainflow: the reversals of ASTM E1049 Fig. 6, with a point on a rising
+    # branch, a repeated sample and a point on a falling branch added.
+    # Ranges of 3 (1/2), 4 (1 + 1/2), 6 (1/2), 8 (1) and 9 (1/2) cycles;
+    # with 17 bins up to 8.5 the bin of a range r is 2r, and 9 is above.
+    #
+    signal = [-2, -0.5, 1, -3, -3, 1, 5, -1, 3, 2, -4, 4, -2]
+    counts = record(directory, "rainflow.txt", range(len(signal)), signal,
+                    "-stat", "rainflow", 17, 8.5)
+    expected = np.zeros(18)
+    expected[6]  = 0.5
+    expected[8]  = 1.5
+    expected[12] = 0.5
+    expected[16] = 1.0
+    expected[17] = 0.5
+    assert np.array_equal(counts, expected), counts
+
+    #
+    # Exceedance of |x| at unit time steps. Above 1: from 0.5 to 3.5 and
+    # from 4 + 1/3 to 5 + 2/3, two up-crossings; above 3: from 1.5 to 2.5,
+    # as 3 itself is not above; never above 5.
+    #
+    signal = [0, 2, 4, 2, 0, -3, 0]
+    table = record(directory, "exceedance.txt", range(len(signal)), signal,
+                   "-stat", "exceedance", 1.0, 3.0, 5.0)
+    expected = [3.0 + 4.0/3.0, 0.5, 2,
+                1.0,           1.5, 1,
+                0.0,          -1.0, 0]
+    assert np.allclose(table, expected, rtol=1e-12, atol=1e-12), table
+
+    #
+    # Spectrum of a unit step in x from t = 0; each oscillator starts at
+    # rest under the constant load -1, so that
+    #
+    #   u = -(1 - e^{-z w t} (cos wd t + z/sqrt(1 - z^2) sin wd t))/w^2
+    #   v = -e^{-z w t} sin(wd t)/wd
+    #
+    periods = [0.5, 1.0, 2.0]
+    zeta    = 0.05
+    dt      = 0.01
+    times   = dt*np.arange(301)
+    table = record(directory, "spectrum.txt", times, np.ones(len(times)),
+                   "-stat", "spectrum", "-periods", *periods, "-damping", zeta)
+    assert table.shape == (3*len(periods),), table.shape
+
+    t = times[1:]
+    for j, T in enumerate(periods):
+        w  = 2*math.pi/T
+        wd = w*math.sqrt(1 - zeta**2)
+        e  = np.exp(-zeta*w*t)
+        u  = -(1 - e*(np.cos(wd*t) + zeta/math.sqrt(1 - zeta**2)*np.sin(wd*t)))/w**2
+        v  = -e*np.sin(wd*t)/wd
+        a  = 2*zeta*w*v + w**2*u
+        for row, peak in enumerate((np.abs(u).max(), np.abs(v).max(), np.abs(a).max())):
+            value = table[row*len(periods) + j]
+            assert abs(value - peak) < 1e-8*peak, (T, row, value, peak)
@@ -0,0 +1,79 @@
+"""
+Push a yield-surface section under constant axial load past yield, once
+with the default constant-P return and once with -closestPoint, for the
+Orbison2D and ElTawil2D surfaces. The axial load is held by equilibrium,
+so both returns must settle on the same point of the surface.
+"""
+import opensees.openseespy as ops
+
+E, A, Iz = 29e3, 20.0, 800.0
+Py, Mp   = 1000.0, 5000.0
+
+surfaces = {
+    "Orbison2D": (Mp, Py),
+    # Mbal, Pbal, P tension, P compression
+    "ElTawil2D": (1.2*Mp, -0.3*Py, Py, -1.5*Py),
+}
+
+def orbison(P, M):
+    p, m = P/Py, M/Mp
+    return 1.15*p*p + m*m + 3.67*p*p*m*m
+
+def push(surface, closest):
+    model = ops.Model(ndm=2, ndf=3)
+    model.node(1, 0.0, 0.0)
+    model.node(2, 0.0, 0.0)
+    model.fix(1, 1, 1, 1)
+    model.fix(2, 0, 1, 0)
+
+    model.ysEvolutionModel("null", 1, 0.0, 0.0)
+    model.yieldSurface_BC(surface, 1, *surfaces[surface], 1)
+    options = ["-closestPoint"] if closest else []
+    model.section("YS_Section2D01", 1, E, A, Iz, 1, *options)
+    model.element("zeroLengthSection", 1, 1, 2, 1)
+
+    # constant axial compression
+    model.timeSeries("Constant", 1)
+    model.pattern("Plain", 1, 1)
+    model.load(2, -0.3*Py, 0.0, 0.0)
+
+    model.system("FullGeneral")
+    model.constraints("Plain")
+    model.numberer("Plain")
+    model.test("NormDispIncr", 1e-10, 50)
+    model.algorithm("Newton")
+    model.integrator("LoadControl", 1.0)
+    model.analysis("Static")
+    assert model.analyze(1) == 0
+    model.loadConst("-time", 0.0)
+
+    # then rotate the free end well past yield
+    model.timeSeries("Linear", 2)
+    model.pattern("Plain", 2, 2)
+    model.load(2, 0.0, 0.0, 1.0)
+    model.integrator("DisplacementControl", 2, 3, 2.0*Mp/(E*Iz)/20)
+    model.analysis("Static")
+
+    points = []
+    for i in range(60):
+        assert model.analyze(1) == 0, (surface, closest, i)
+        model.reactions()
+        points.append((-model.nodeReaction(1, 1), -model.nodeReaction(1, 3)))
+    return points
+
+
+for surface in surfaces:
+    constantP = push(surface, False)
+    closest   = push(surface, True)
+
+    # the section yields ...
+    assert abs(constantP[-1][1]) > abs(constantP[0][1])
+
+    # ... and both returns end on the same point
+    for (P1, M1), (P2, M2) in zip(constantP[-10:], closest[-10:]):
+        assert abs(P1 - P2) < 1e-6*Py, (surface, P1, P2)
+        assert abs(M1 - M2) < 1e-3*Mp, (surface, M1, M2)
+
+    if surface == "Orbison2D":
+        for P, M in constantP[-10:] + closest[-10:]:
+            assert orbison(P, M) < 1.0 + 1e-2, (P, M, orbison(P, M))